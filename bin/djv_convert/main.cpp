@@ -0,0 +1,621 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvCmdLineApp/Application.h>
+
+#include <djvAV/AVSystem.h>
+#include <djvAV/IOSystem.h>
+
+#include <djvImage/Convert.h>
+#include <djvImage/Data.h>
+
+#include <djvMath/Math.h>
+
+#include <djvSystem/Context.h>
+#include <djvSystem/FileInfo.h>
+#include <djvSystem/TextSystem.h>
+#include <djvSystem/Timer.h>
+
+#include <djvCore/Error.h>
+#include <djvCore/Memory.h>
+#include <djvCore/StringFormat.h>
+#include <djvCore/UID.h>
+
+#include <future>
+#include <iostream>
+#include <thread>
+
+using namespace djv;
+
+namespace
+{
+    size_t getThreadCountDefault()
+    {
+        const size_t out = std::thread::hardware_concurrency();
+        return out > 0 ? out : 4;
+    }
+
+} // namespace
+
+class Application : public CmdLine::Application
+{
+    DJV_NON_COPYABLE(Application);
+
+protected:
+    void _init(std::list<std::string>&);
+
+    Application();
+
+public:
+    static std::shared_ptr<Application> create(std::list<std::string>&);
+
+    void run() override;
+    void tick() override;
+
+protected:
+    void _parseCmdLine(std::list<std::string>&) override;
+    void _printUsage() override;
+
+private:
+    void _abort();
+    void _printStats();
+
+    std::string _input;
+    std::string _output;
+    std::unique_ptr<Math::Frame::Range> _frames;
+    std::unique_ptr<Image::Size> _resize;
+    std::unique_ptr<size_t> _layer;
+    std::unique_ptr<Image::Channels> _channels;
+    std::unique_ptr<size_t> _threadCount;
+    Image::Info _info;
+    size_t _frameCount = 0;
+    size_t _readCount = 0;
+    size_t _writeCount = 0;
+    size_t _errorCount = 0;
+    bool _aborted = false;
+    uint64_t _byteCount = 0;
+    Math::Frame::Number _frame = 0;
+    Core::UID _uid = 0;
+    std::list<std::future<std::shared_ptr<Image::Data> > > _images;
+    std::shared_ptr<Image::Convert> _convert;
+    std::shared_ptr<AV::IO::IRead> _read;
+    std::shared_ptr<AV::IO::IWrite> _write;
+    std::shared_ptr<System::Timer> _statsTimer;
+    Core::Time::TimePoint _startTime;
+};
+
+void Application::_init(std::list<std::string>& args)
+{
+    CmdLine::Application::_init(args);
+
+    _uid = Core::createUID();
+
+    _parseCmdLine(args);
+}
+
+Application::Application()
+{}
+
+std::shared_ptr<Application> Application::create(std::list<std::string>& args)
+{
+    auto out = std::shared_ptr<Application>(new Application);
+    out->_init(args);
+    return out;
+}
+
+void Application::run()
+{
+    auto textSystem = getSystemT<System::TextSystem>();
+    auto io = getSystemT<AV::IO::IOSystem>();
+    if (!_threadCount)
+    {
+        _threadCount.reset(new size_t(getThreadCountDefault()));
+    }
+    const size_t threadCount = *_threadCount;
+    io->getThreadPool()->setThreadCount(threadCount);
+
+    // Open the input.
+    System::File::Info inputInfo(_input);
+    if (System::File::Type::File == inputInfo.getType() &&
+        io->canSequence(inputInfo))
+    {
+        const auto fileSequence = System::File::getSequence(inputInfo.getPath(), io->getSequenceExtensions());
+        if (fileSequence.getSequence().getFrameCount() > 1)
+        {
+            inputInfo = fileSequence;
+        }
+    }
+    if (_frames && System::File::Type::Sequence == inputInfo.getType())
+    {
+        // Only read the files in the frame range.
+        const auto& sequence = inputInfo.getSequence();
+        Math::Frame::Sequence frames;
+        frames.setPad(sequence.getPad());
+        for (const auto& range : sequence.getRanges())
+        {
+            const auto min = std::max(range.getMin(), _frames->getMin());
+            const auto max = std::min(range.getMax(), _frames->getMax());
+            if (min <= max)
+            {
+                frames.add(Math::Frame::Range(min, max));
+            }
+        }
+        if (!frames.isValid())
+        {
+            throw std::runtime_error(Core::String::Format("{0}: {1}").
+                arg("-frames").
+                arg(textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+        }
+        inputInfo.setSequence(frames);
+    }
+    AV::IO::ReadOptions readOptions;
+    if (_layer)
+    {
+        readOptions.layer = *_layer;
+    }
+    readOptions.videoQueueSize = threadCount * 2;
+    _read = io->read(inputInfo, readOptions);
+    const auto info = _read->getInfo().get();
+    if (info.video.empty() || readOptions.layer >= info.video.size())
+    {
+        throw std::runtime_error(Core::String::Format("{0}: {1}").
+            arg(inputInfo.getFileName()).
+            arg(textSystem->getText(DJV_TEXT("djv_convert_input_error"))));
+    }
+    _frameCount = info.videoSequence.getFrameCount();
+    Math::Frame::Number outputStart = info.videoSequence.isValid() ?
+        info.videoSequence.getFrame(0) :
+        0;
+    if (_frames && System::File::Type::Sequence != inputInfo.getType())
+    {
+        // Movie frames use the same numbers as sequences, starting at the
+        // first frame of the movie. Seek to the start of the frame range.
+        Math::Frame::Number min = Math::Frame::invalid;
+        Math::Frame::Number max = Math::Frame::invalid;
+        if (_frameCount > 0)
+        {
+            min = std::max(_frames->getMin(), info.videoSequence.getFrame(0));
+            max = std::min(_frames->getMax(), info.videoSequence.getFrame(info.videoSequence.getLastIndex()));
+        }
+        if (Math::Frame::invalid == min || min > max)
+        {
+            throw std::runtime_error(Core::String::Format("{0}: {1}").
+                arg("-frames").
+                arg(textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+        }
+        _frameCount = static_cast<size_t>(max - min + 1);
+        outputStart = min;
+        _read->seek(info.videoSequence.getIndex(min), AV::IO::Direction::Forward);
+    }
+    _frameCount = std::max(_frameCount, static_cast<size_t>(1));
+
+    // The sequence readers read ahead by half of their thread count during
+    // playback.
+    _read->setThreadCount(threadCount * 2);
+    _read->setCacheEnabled(false);
+    _read->setPlayback(true);
+
+    // Set the output image information.
+    const auto& inputImageInfo = info.video[readOptions.layer];
+    _info = Image::Info(inputImageInfo.size, inputImageInfo.type);
+    if (_resize)
+    {
+        _info.size = *_resize;
+    }
+    if (_channels && *_channels != Image::Channels::None)
+    {
+        const uint8_t channelCount = static_cast<uint8_t>(*_channels);
+        const uint8_t bitDepth = Image::getBitDepth(inputImageInfo.type);
+        _info.type = Image::isFloatType(inputImageInfo.type) ?
+            Image::getFloatType(channelCount, bitDepth) :
+            Image::getIntType(channelCount, bitDepth);
+        if (Image::Type::None == _info.type)
+        {
+            _info.type = Image::isFloatType(inputImageInfo.type) ?
+                Image::getFloatType(channelCount, 32) :
+                Image::getIntType(channelCount, 16);
+        }
+    }
+    if (_info.size != inputImageInfo.size)
+    {
+        // Planar YUV images are converted to RGB when they are resized.
+        _info.type = Image::getRGBType(_info.type);
+    }
+    if (_info.size != inputImageInfo.size || _info.type != inputImageInfo.type)
+    {
+        // The frames are converted in parallel on the I/O thread pool, so
+        // each conversion uses a single thread.
+        _convert = Image::Convert::create(1);
+    }
+    else
+    {
+        _info = inputImageInfo;
+    }
+
+    // Open the output.
+    const System::File::Path outputPath(_output);
+    System::File::Info outputInfo(outputPath);
+    const std::string& number = outputPath.getNumber();
+    if (!number.empty())
+    {
+        // Use the input frame numbers for wildcards (e.g., "render.####.exr").
+        const Math::Frame::Number start = System::File::isSequenceWildcard(number) ?
+            outputStart :
+            std::stoi(number);
+        outputInfo = System::File::Info(
+            outputPath,
+            System::File::Type::Sequence,
+            Math::Frame::Sequence(start, start + static_cast<Math::Frame::Number>(_frameCount) - 1, number.size()));
+        outputStart = start;
+    }
+    AV::IO::Info ioInfo;
+    ioInfo.video.push_back(_info);
+    ioInfo.videoSpeed = info.videoSpeed;
+    ioInfo.videoSequence = Math::Frame::Sequence(outputStart, outputStart + static_cast<Math::Frame::Number>(_frameCount) - 1);
+    ioInfo.tags = info.tags;
+    AV::IO::WriteOptions writeOptions;
+    writeOptions.videoQueueSize = threadCount;
+    _write = io->write(outputInfo, ioInfo, writeOptions);
+    _write->setThreadCount(threadCount);
+    _frame = outputStart;
+
+    _statsTimer = System::Timer::create(shared_from_this());
+    _statsTimer->setRepeating(true);
+    _statsTimer->start(
+        System::getTimerDuration(System::TimerValue::Slow),
+        [this](const std::chrono::steady_clock::time_point&, const Core::Time::Duration&)
+        {
+            std::cout << static_cast<size_t>(_writeCount / static_cast<float>(_frameCount) * 100.F) << "%" << std::endl;
+        });
+
+    _startTime = std::chrono::steady_clock::now();
+    CmdLine::Application::run();
+    _printStats();
+}
+
+void Application::tick()
+{
+    CmdLine::Application::tick();
+
+    // Get the frames from the reader and start converting them. Stop when
+    // there are enough frames waiting for the writer so the reader queue can
+    // fill up.
+    bool readFinished = false;
+    if (!_aborted)
+    {
+        std::lock_guard<std::mutex> lock(_read->getMutex());
+        auto& readQueue = _read->getVideoQueue();
+        while (!readQueue.isEmpty() &&
+            _readCount < _frameCount &&
+            _images.size() < *_threadCount)
+        {
+            auto image = readQueue.popFrame().data;
+            ++_readCount;
+            auto promise = std::make_shared<std::promise<std::shared_ptr<Image::Data> > >();
+            _images.push_back(promise->get_future());
+            if (image && _convert)
+            {
+                auto convert = _convert;
+                const auto info = _info;
+                getSystemT<AV::IO::IOSystem>()->getThreadPool()->addJob(
+                    _uid,
+                    AV::IO::JobPriority::High,
+                    [promise, convert, info, image]
+                    {
+                        try
+                        {
+                            auto out = Image::Data::create(info);
+                            out->setTags(image->getTags());
+                            convert->process(*image, info, *out);
+                            promise->set_value(out);
+                        }
+                        catch (const std::exception&)
+                        {
+                            promise->set_exception(std::current_exception());
+                        }
+                    });
+            }
+            else
+            {
+                promise->set_value(image);
+            }
+        }
+        readFinished = readQueue.isEmpty() && readQueue.isFinished();
+    }
+
+    // Pass the converted frames to the writer in order. The writers number
+    // the output files in the order the frames are received, so the
+    // conversion is stopped if a frame could not be read or converted
+    // rather than shifting the following frames.
+    {
+        std::lock_guard<std::mutex> lock(_write->getMutex());
+        auto& writeQueue = _write->getVideoQueue();
+        while (!_aborted &&
+            _images.size() &&
+            _images.front().wait_for(std::chrono::seconds(0)) == std::future_status::ready &&
+            writeQueue.getCount() < writeQueue.getMax())
+        {
+            std::shared_ptr<Image::Data> image;
+            try
+            {
+                image = _images.front().get();
+            }
+            catch (const std::exception& e)
+            {
+                std::cout << Core::Error::format(e) << std::endl;
+            }
+            _images.pop_front();
+            if (image)
+            {
+                _byteCount += image->getDataByteCount();
+                writeQueue.addFrame(AV::IO::VideoFrame(_frame, image));
+                ++_writeCount;
+                ++_frame;
+            }
+            else
+            {
+                _abort();
+            }
+        }
+        if (_aborted || ((_readCount >= _frameCount || readFinished) && _images.empty()))
+        {
+            writeQueue.setFinished(true);
+        }
+    }
+
+    if (!_write->isRunning())
+    {
+        exit(_errorCount > 0 ? 1 : 0);
+    }
+}
+
+void Application::_parseCmdLine(std::list<std::string>& args)
+{
+    CmdLine::Application::_parseCmdLine(args);
+    if (0 == getExitCode())
+    {
+        auto textSystem = getSystemT<System::TextSystem>();
+        auto i = args.begin();
+        while (i != args.end())
+        {
+            if ("-frames" == *i)
+            {
+                i = args.erase(i);
+                if (args.end() == i)
+                {
+                    throw std::runtime_error(Core::String::Format("{0}: {1}").
+                        arg("-frames").
+                        arg(textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+                }
+                Math::Frame::Range value;
+                bool error = false;
+                try
+                {
+                    std::stringstream ss(*i);
+                    ss >> value;
+                }
+                catch (const std::exception&)
+                {
+                    error = true;
+                }
+                if (error)
+                {
+                    throw std::runtime_error(Core::String::Format("{0}: {1}").
+                        arg("-frames").
+                        arg(textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+                }
+                i = args.erase(i);
+                _frames.reset(new Math::Frame::Range(value));
+            }
+            else if ("-resize" == *i)
+            {
+                i = args.erase(i);
+                if (args.end() == i)
+                {
+                    throw std::runtime_error(Core::String::Format("{0}: {1}").
+                        arg("-resize").
+                        arg(textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+                }
+                // Parse signed values so that negative sizes are rejected
+                // instead of wrapping around.
+                int w = 0;
+                int h = 0;
+                std::stringstream ss(*i);
+                ss >> w >> h;
+                if (ss.fail() || w <= 0 || h <= 0)
+                {
+                    throw std::runtime_error(Core::String::Format("{0}: {1}").
+                        arg("-resize").
+                        arg(textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+                }
+                i = args.erase(i);
+                _resize.reset(new Image::Size(static_cast<uint32_t>(w), static_cast<uint32_t>(h)));
+            }
+            else if ("-layer" == *i)
+            {
+                i = args.erase(i);
+                if (args.end() == i)
+                {
+                    throw std::runtime_error(Core::String::Format("{0}: {1}").
+                        arg("-layer").
+                        arg(textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+                }
+                int value = 0;
+                std::stringstream ss(*i);
+                ss >> value;
+                if (ss.fail() || value < 0)
+                {
+                    throw std::runtime_error(Core::String::Format("{0}: {1}").
+                        arg("-layer").
+                        arg(textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+                }
+                i = args.erase(i);
+                _layer.reset(new size_t(value));
+            }
+            else if ("-channels" == *i)
+            {
+                i = args.erase(i);
+                if (args.end() == i)
+                {
+                    throw std::runtime_error(Core::String::Format("{0}: {1}").
+                        arg("-channels").
+                        arg(textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+                }
+                Image::Channels value = Image::Channels::None;
+                bool error = false;
+                try
+                {
+                    std::stringstream ss(*i);
+                    ss >> value;
+                }
+                catch (const std::exception&)
+                {
+                    error = true;
+                }
+                if (error)
+                {
+                    throw std::runtime_error(Core::String::Format("{0}: {1}").
+                        arg("-channels").
+                        arg(textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+                }
+                i = args.erase(i);
+                _channels.reset(new Image::Channels(value));
+            }
+            else if ("-threads" == *i)
+            {
+                i = args.erase(i);
+                if (args.end() == i)
+                {
+                    throw std::runtime_error(Core::String::Format("{0}: {1}").
+                        arg("-threads").
+                        arg(textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+                }
+                int value = 0;
+                std::stringstream ss(*i);
+                ss >> value;
+                if (ss.fail() || value < 1)
+                {
+                    throw std::runtime_error(Core::String::Format("{0}: {1}").
+                        arg("-threads").
+                        arg(textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+                }
+                i = args.erase(i);
+                _threadCount.reset(new size_t(value));
+            }
+            else
+            {
+                ++i;
+            }
+        }
+        if (!args.size())
+        {
+            _printUsage();
+            exit(1);
+        }
+        else if (2 == args.size())
+        {
+            _input = args.front();
+            args.pop_front();
+            _output = args.front();
+            args.pop_front();
+        }
+        else
+        {
+            throw std::runtime_error(textSystem->getText(DJV_TEXT("djv_convert_arguments_error")));
+        }
+    }
+}
+
+void Application::_printUsage()
+{
+    auto textSystem = getSystemT<System::TextSystem>();
+    std::cout << std::endl;
+    std::cout << " " << textSystem->getText(DJV_TEXT("djv_convert_cli_description")) << std::endl;
+    std::cout << std::endl;
+    std::cout << " " << textSystem->getText(DJV_TEXT("djv_convert_cli_usage")) << std::endl;
+    std::cout << std::endl;
+    std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_usage_format")) << std::endl;
+    std::cout << std::endl;
+    std::cout << " " << textSystem->getText(DJV_TEXT("djv_convert_cli_options")) << std::endl;
+    std::cout << std::endl;
+    std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_option_frames")) << std::endl;
+    std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_description_frames")) << std::endl;
+    std::cout << std::endl;
+    std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_option_resize")) << std::endl;
+    std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_description_resize")) << std::endl;
+    std::cout << std::endl;
+    std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_option_layer")) << std::endl;
+    std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_description_layer")) << std::endl;
+    std::cout << std::endl;
+    std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_option_channels")) << std::endl;
+    std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_description_channels")) << std::endl;
+    std::cout << std::endl;
+    std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_option_threads")) << std::endl;
+    std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_description_threads")) << getThreadCountDefault() << std::endl;
+    std::cout << std::endl;
+    std::cout << " " << textSystem->getText(DJV_TEXT("djv_convert_cli_examples")) << std::endl;
+    std::cout << std::endl;
+    std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_example_sequence")) << std::endl;
+    std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_example_sequence_description")) << std::endl;
+    std::cout << std::endl;
+    std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_example_resize")) << std::endl;
+    std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_example_resize_description")) << std::endl;
+    std::cout << std::endl;
+
+    CmdLine::Application::_printUsage();
+}
+
+void Application::_abort()
+{
+    auto textSystem = getSystemT<System::TextSystem>();
+    std::cout << Core::Error::format(Core::String::Format("{0}: {1}").
+        arg(static_cast<int>(_frame)).
+        arg(textSystem->getText(DJV_TEXT("djv_convert_frame_error")))) << std::endl;
+    ++_errorCount;
+    _aborted = true;
+    getSystemT<AV::IO::IOSystem>()->getThreadPool()->cancelJobs(_uid);
+    _images.clear();
+}
+
+void Application::_printStats()
+{
+    const auto now = std::chrono::steady_clock::now();
+    const std::chrono::duration<float> delta = now - _startTime;
+    const float seconds = delta.count();
+    auto textSystem = getSystemT<System::TextSystem>();
+    std::cout << textSystem->getText(DJV_TEXT("djv_convert_stats_frames")) << ": " << _writeCount << std::endl;
+    if (_errorCount > 0)
+    {
+        std::cout << textSystem->getText(DJV_TEXT("djv_convert_stats_errors")) << ": " << _errorCount << std::endl;
+    }
+    std::cout << textSystem->getText(DJV_TEXT("djv_convert_stats_time")) << ": " << seconds << " " <<
+        textSystem->getText(DJV_TEXT("djv_convert_stats_seconds")) << std::endl;
+    if (seconds > 0.F)
+    {
+        std::cout << textSystem->getText(DJV_TEXT("djv_convert_stats_frames_per_second")) << ": " <<
+            (_writeCount / seconds) << std::endl;
+        std::cout << textSystem->getText(DJV_TEXT("djv_convert_stats_megabytes_per_second")) << ": " <<
+            (_byteCount / static_cast<float>(Core::Memory::megabyte) / seconds) << std::endl;
+    }
+}
+
+DJV_MAIN()
+{
+    int r = 1;
+    try
+    {
+        auto args = Application::args(argc, argv);
+        auto app = Application::create(args);
+        if (0 == app->getExitCode())
+        {
+            app->run();
+        }
+        r = app->getExitCode();
+    }
+    catch (const std::exception & e)
+    {
+        std::cout << Core::Error::format(e) << std::endl;
+    }
+    return r;
+}
@@ -76,6 +76,7 @@ public:
                 System::File::DirectoryListOptions options;
                 options.sequences = true;
                 options.sequenceExtensions = io->getSequenceExtensions();
+                options.sequenceStat = System::File::SequenceStat::FirstLast;
                 for (const auto& j : System::File::directoryList(i.getPath(), options))
                 {
                     _print(j.getFileName(Math::Frame::invalid, false));
@@ -9,9 +9,39 @@ in vec2 Texture;
 out vec4 FragColor;
 
 uniform sampler2D textureSampler;
+uniform bool      yuv = false;
+uniform vec4      yuvPlanes;
+uniform mat4      yuvMatrix;
+
+vec4 yuvFunc(sampler2D tex, vec2 uv, vec4 planes, mat4 m)
+{
+    // The planes are stacked vertically in a single channel texture, with
+    // the luma plane size in "planes.xy" and the chroma plane size in
+    // "planes.zw". The coordinates are clamped so that filtering does not
+    // sample the neighboring planes.
+    vec2 size = vec2(planes.x, planes.y + planes.w * 2.0);
+    vec2 l = clamp(uv * planes.xy, vec2(0.5), planes.xy - vec2(0.5));
+    vec2 c = clamp(uv * planes.zw, vec2(0.5), planes.zw - vec2(0.5));
+    vec4 value;
+    value[0] = texture(tex, l / size).r;
+    value[1] = texture(tex, (c + vec2(0.0, planes.y)) / size).r;
+    value[2] = texture(tex, (c + vec2(0.0, planes.y + planes.w)) / size).r;
+    value[3] = 1.0;
+    vec4 tmp = m * value;
+    tmp[3] = 1.0;
+    return tmp;
+}
 
 void main()
 {
-    vec4 t = texture(textureSampler, Texture);
+    vec4 t;
+    if (yuv)
+    {
+        t = yuvFunc(textureSampler, Texture, yuvPlanes, yuvMatrix);
+    }
+    else
+    {
+        t = texture(textureSampler, Texture);
+    }
     FragColor = t;
 }
@@ -330,109 +330,163 @@ namespace djv
                     break;
                 default: break;
                 }
-                if (isValid(out.file.time, 24))
+                readTags(out, info);
+                switch (static_cast<Descriptor>(out.image.channel[0].descriptor[1]))
+                {
+                case Descriptor::RedFilmPrint: colorProfile = ColorProfile::FilmPrint; break;
+                default:                       colorProfile = ColorProfile::Raw;       break;
+                }
+
+                // Set the file position.
+                if (out.file.imageOffset)
                 {
-                    info.tags.set("Time", toString(out.file.time, 24));
+                    io->setPos(out.file.imageOffset);
                 }
-                if (isValid(&out.source.offset[0]) && isValid(&out.source.offset[1]))
+                const size_t ioSize = io->getSize();
+                const size_t ioPos = io->getPos();
+                const size_t fileDataByteCount = ioSize > 0 ? (ioSize - ioPos) : 0;
+                const size_t dataByteCount = info.video[0].getDataByteCount();
+                if (dataByteCount > fileDataByteCount)
+                {
+                    throw System::File::Error(String::Format("{0}: {1}").
+                        arg(io->getFileName()).
+                        arg(textSystem->getText(DJV_TEXT("error_incomplete_file"))));
+                }
+
+                return out;
+            }
+
+            void readTags(const Header& header, IO::Info& info)
+            {
+                if (isValid(header.file.time, 24))
+                {
+                    info.tags.set("Time", toString(header.file.time, 24));
+                }
+                if (isValid(&header.source.offset[0]) && isValid(&header.source.offset[1]))
                 {
                     std::stringstream ss;
-                    ss << out.source.offset[0] << " " << out.source.offset[1];
+                    ss << header.source.offset[0] << " " << header.source.offset[1];
                     info.tags.set("Source Offset", ss.str());
                 }
-                if (isValid(out.source.file, 100))
+                if (isValid(header.source.file, 100))
                 {
-                    info.tags.set("Source File", toString(out.source.file, 100));
+                    info.tags.set("Source File", toString(header.source.file, 100));
                 }
-                if (isValid(out.source.time, 24))
+                if (isValid(header.source.time, 24))
                 {
-                    info.tags.set("Source Time", toString(out.source.time, 24));
+                    info.tags.set("Source Time", toString(header.source.time, 24));
                 }
-                if (isValid(out.source.inputDevice, 64))
+                if (isValid(header.source.inputDevice, 64))
                 {
-                    info.tags.set("Source Input Device", toString(out.source.inputDevice, 64));
+                    info.tags.set("Source Input Device", toString(header.source.inputDevice, 64));
                 }
-                if (isValid(out.source.inputModel, 32))
+                if (isValid(header.source.inputModel, 32))
                 {
-                    info.tags.set("Source Input Model", toString(out.source.inputModel, 32));
+                    info.tags.set("Source Input Model", toString(header.source.inputModel, 32));
                 }
-                if (isValid(out.source.inputSerial, 32))
+                if (isValid(header.source.inputSerial, 32))
                 {
-                    info.tags.set("Source Input Serial", toString(out.source.inputSerial, 32));
+                    info.tags.set("Source Input Serial", toString(header.source.inputSerial, 32));
                 }
-                if (isValid(&out.source.inputPitch[0]) && isValid(&out.source.inputPitch[1]))
+                if (isValid(&header.source.inputPitch[0]) && isValid(&header.source.inputPitch[1]))
                 {
                     std::stringstream ss;
-                    ss << out.source.inputPitch[0] << " " << out.source.inputPitch[1];
+                    ss << header.source.inputPitch[0] << " " << header.source.inputPitch[1];
                     info.tags.set("Source Input Pitch", ss.str());
                 }
-                if (isValid(&out.source.gamma))
+                if (isValid(&header.source.gamma))
                 {
                     std::stringstream ss;
-                    ss << out.source.gamma;
+                    ss << header.source.gamma;
                     info.tags.set("Source Gamma", ss.str());
                 }
-                if (isValid(&out.film.id) &&
-                    isValid(&out.film.type) &&
-                    isValid(&out.film.offset) &&
-                    isValid(&out.film.prefix) &&
-                    isValid(&out.film.count))
+                if (isValid(&header.film.id) &&
+                    isValid(&header.film.type) &&
+                    isValid(&header.film.offset) &&
+                    isValid(&header.film.prefix) &&
+                    isValid(&header.film.count))
                 {
                     info.tags.set( "Keycode", Time::keycodeToString(
-                        out.film.id,
-                        out.film.type,
-                        out.film.prefix,
-                        out.film.count,
-                        out.film.offset));
+                        header.film.id,
+                        header.film.type,
+                        header.film.prefix,
+                        header.film.count,
+                        header.film.offset));
                 }
-                if (isValid(out.film.format, 32))
+                if (isValid(header.film.format, 32))
                 {
-                    info.tags.set("Film Format", toString(out.film.format, 32));
+                    info.tags.set("Film Format", toString(header.film.format, 32));
                 }
-                if (isValid(&out.film.frame))
+                if (isValid(&header.film.frame))
                 {
                     std::stringstream ss;
-                    ss << out.film.frame;
+                    ss << header.film.frame;
                     info.tags.set("Film Frame", ss.str());
                 }
-                if (isValid(&out.film.frameRate) && out.film.frameRate >= _minSpeed)
+                if (isValid(&header.film.frameRate) && header.film.frameRate >= _minSpeed)
                 {
-                    info.videoSpeed = fromSpeed(out.film.frameRate);
+                    info.videoSpeed = fromSpeed(header.film.frameRate);
                     std::stringstream ss;
-                    ss << out.film.frameRate;
+                    ss << header.film.frameRate;
                     info.tags.set("Film Frame Rate", ss.str());
                 }
-                if (isValid(out.film.frameId, 32))
+                if (isValid(header.film.frameId, 32))
                 {
-                    info.tags.set("Film Frame ID", toString(out.film.frameId, 32));
+                    info.tags.set("Film Frame ID", toString(header.film.frameId, 32));
                 }
-                if (isValid(out.film.slate, 200))
+                if (isValid(header.film.slate, 200))
                 {
-                    info.tags.set("Film Slate", toString(out.film.slate, 200));
+                    info.tags.set("Film Slate", toString(header.film.slate, 200));
                 }
-                switch (static_cast<Descriptor>(out.image.channel[0].descriptor[1]))
+            }
+
+            bool read(
+                const std::shared_ptr<System::File::IO>& io,
+                IO::Info& info,
+                const Header& headerTemplate,
+                const IO::Info& infoTemplate)
+            {
+                Header header;
+                io->read(&header.file, sizeof(Header::File));
+                if (header.file.magic != headerTemplate.file.magic)
                 {
-                case Descriptor::RedFilmPrint: colorProfile = ColorProfile::FilmPrint; break;
-                default:                       colorProfile = ColorProfile::Raw;       break;
+                    return false;
+                }
+                io->read(&header.image, sizeof(Header::Image));
+                io->read(&header.source, sizeof(Header::Source));
+                io->read(&header.film, sizeof(Header::Film));
+                if (infoTemplate.video[0].layout.endian != Memory::getEndian())
+                {
+                    io->setEndianConversion(true);
+                    convertEndian(header);
                 }
 
-                // Set the file position.
-                if (out.file.imageOffset)
+                // The image section describes the layout of the pixel data,
+                // if it matches the template the rest of the validation can
+                // be skipped.
+                if (header.file.imageOffset != headerTemplate.file.imageOffset ||
+                    memcmp(&header.image, &headerTemplate.image, sizeof(Header::Image)) != 0)
                 {
-                    io->setPos(out.file.imageOffset);
+                    return false;
                 }
+                const size_t dataByteCount = infoTemplate.video[0].getDataByteCount();
                 const size_t ioSize = io->getSize();
-                const size_t ioPos = io->getPos();
-                const size_t fileDataByteCount = ioSize > 0 ? (ioSize - ioPos) : 0;
-                const size_t dataByteCount = info.video[0].getDataByteCount();
-                if (dataByteCount > fileDataByteCount)
+                if (ioSize < header.file.imageOffset ||
+                    ioSize - header.file.imageOffset != dataByteCount)
                 {
-                    throw System::File::Error(String::Format("{0}: {1}").
-                        arg(io->getFileName()).
-                        arg(textSystem->getText(DJV_TEXT("error_incomplete_file"))));
+                    return false;
                 }
 
-                return out;
+                info = infoTemplate;
+                info.fileName = io->getFileName();
+                info.tags = Image::Tags();
+                readTags(header, info);
+
+                if (header.file.imageOffset)
+                {
+                    io->setPos(header.file.imageOffset);
+                }
+                return true;
             }
 
             void write(
@@ -180,6 +180,20 @@ namespace djv
                 ColorProfile&,
                 const std::shared_ptr<System::TextSystem>&);
 
+            //! Read a Cineon file header using the header of another file in
+            //! the same sequence as a template. Only the magic number, image
+            //! offset, file size, and image section are checked, the image
+            //! information is copied from the template and only the tags are
+            //! read. Returns false if the header does not match the template.
+            bool read(
+                const std::shared_ptr<System::File::IO>&,
+                IO::Info&,
+                const Header& headerTemplate,
+                const IO::Info& infoTemplate);
+
+            //! Read the tags from a Cineon file header.
+            void readTags(const Header&, IO::Info&);
+
             //! Write a Cineon file header.
             //!
             //! Throws:
@@ -225,7 +239,8 @@ namespace djv
 
                 static std::shared_ptr<Image::Data> readImage(
                     const IO::Info&,
-                    const std::shared_ptr<System::File::IO>&);
+                    const std::shared_ptr<System::File::IO>&,
+                    const std::shared_ptr<Image::DataPool>& = nullptr);
 
             protected:
                 IO::Info _readInfo(const std::string&) override;
@@ -6,6 +6,8 @@
 
 #include <djvSystem/FileIO.h>
 
+#include <mutex>
+
 using namespace djv::Core;
 
 namespace djv
@@ -17,6 +19,11 @@ namespace djv
             struct Read::Private
             {
                 ColorProfile colorProfile = ColorProfile::FilmPrint;
+
+                std::mutex mutex;
+                bool headerTemplateInit = false;
+                Header headerTemplate;
+                IO::Info infoTemplate;
             };
 
             Read::Read() :
@@ -42,10 +49,13 @@ namespace djv
                 
             std::shared_ptr<Image::Data> Read::readImage(
                 const IO::Info& info,
-                const std::shared_ptr<System::File::IO>& io)
+                const std::shared_ptr<System::File::IO>& io,
+                const std::shared_ptr<Image::DataPool>& dataPool)
             {
 #if defined(DJV_MMAP)
-                auto out = Image::Data::create(info.video[0].info, io);
+                // The data is kept in the file endian, the image layout is
+                // used to convert it when it is uploaded.
+                auto out = Image::Data::create(info.video[0], io);
 #else // DJV_MMAP
                 auto infoTmp = info;
                 bool convertEndian = false;
@@ -54,7 +64,7 @@ namespace djv
                     convertEndian = true;
                     infoTmp.video[0].layout.endian = Memory::getEndian();
                 }
-                auto out = Image::Data::create(infoTmp.video[0]);
+                auto out = Image::Data::create(infoTmp.video[0], dataPool);
                 io->read(out->getData(), out->getDataByteCount());
                 if (convertEndian)
                 {
@@ -68,7 +78,7 @@ namespace djv
                     }
                 }
 #endif // DJV_MMAP
-                out->setTags(infoTmp.tags);
+                out->setTags(info.tags);
                 return out;
             }
 
@@ -82,7 +92,7 @@ namespace djv
             {
                 auto io = System::File::IO::create();
                 const auto info = _open(fileName, io);
-                auto out = readImage(info, io);
+                auto out = readImage(info, io, _options.dataPool);
                 out->setPluginName(pluginName);
                 return out;
             }
@@ -91,11 +101,44 @@ namespace djv
             {
                 DJV_PRIVATE_PTR();
                 io->open(fileName, System::File::Mode::Read);
+
+                // Try reading the header with the template from a previous
+                // file in the sequence.
+                bool headerTemplateInit = false;
+                Header headerTemplate;
+                IO::Info infoTemplate;
+                {
+                    std::lock_guard<std::mutex> lock(p.mutex);
+                    if (p.headerTemplateInit)
+                    {
+                        headerTemplateInit = true;
+                        headerTemplate = p.headerTemplate;
+                        infoTemplate = p.infoTemplate;
+                    }
+                }
                 IO::Info info;
+                if (headerTemplateInit)
+                {
+                    if (read(io, info, headerTemplate, infoTemplate))
+                    {
+                        return info;
+                    }
+                    io->setPos(0);
+                    io->setEndianConversion(false);
+                }
+
                 info.videoSpeed = _speed;
                 info.videoSequence = _sequence;
                 info.video.push_back(Image::Info());
-                read(io, info, p.colorProfile, _textSystem);
+                const Header header = read(io, info, p.colorProfile, _textSystem);
+                if (_options.headerTemplate && System::File::Type::Sequence == _fileInfo.getType())
+                {
+                    std::lock_guard<std::mutex> lock(p.mutex);
+                    p.headerTemplateInit = true;
+                    p.headerTemplate = header;
+                    p.infoTemplate = info;
+                    p.infoTemplate.tags = Image::Tags();
+                }
                 return info;
             }
 
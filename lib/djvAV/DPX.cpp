@@ -305,230 +305,285 @@ namespace djv
                     transfer = Transfer::FilmPrint;
                 }
 
-                if (Cineon::isValid(out.file.time, 24))
+                readTags(out, info);
+
+                // Set the file position.
+                if (out.file.imageOffset)
                 {
-                    info.tags.set("Time", Cineon::toString(out.file.time, 24));
+                    io->setPos(out.file.imageOffset);
                 }
-                if (Cineon::isValid(out.file.creator, 100))
+                const size_t ioPos = io->getPos();
+                const size_t fileDataByteCount = ioSize > 0 ? (ioSize - ioPos) : 0;
+                if (dataByteCount > fileDataByteCount)
                 {
-                    info.tags.set("Creator", Cineon::toString(out.file.creator, 100));
+                    throw System::File::Error(String::Format("{0}: {1}").
+                        arg(io->getFileName()).
+                        arg(textSystem->getText(DJV_TEXT("error_incomplete_file"))));
                 }
-                if (Cineon::isValid(out.file.project, 200))
+
+                return out;
+            }
+
+            void readTags(const Header& header, IO::Info& info)
+            {
+                if (Cineon::isValid(header.file.time, 24))
                 {
-                    info.tags.set("Project", Cineon::toString(out.file.project, 200));
+                    info.tags.set("Time", Cineon::toString(header.file.time, 24));
                 }
-                if (Cineon::isValid(out.file.copyright, 200))
+                if (Cineon::isValid(header.file.creator, 100))
                 {
-                    info.tags.set("Copyright", Cineon::toString(out.file.copyright, 200));
+                    info.tags.set("Creator", Cineon::toString(header.file.creator, 100));
+                }
+                if (Cineon::isValid(header.file.project, 200))
+                {
+                    info.tags.set("Project", Cineon::toString(header.file.project, 200));
+                }
+                if (Cineon::isValid(header.file.copyright, 200))
+                {
+                    info.tags.set("Copyright", Cineon::toString(header.file.copyright, 200));
                 }
 
-                if (isValid(&out.source.offset[0]) && isValid(&out.source.offset[1]))
+                if (isValid(&header.source.offset[0]) && isValid(&header.source.offset[1]))
                 {
                     std::stringstream ss;
-                    ss << out.source.offset[0] << " " << out.source.offset[1];
+                    ss << header.source.offset[0] << " " << header.source.offset[1];
                     info.tags.set("Source Offset", ss.str());
                 }
-                if (isValid(&out.source.center[0]) && isValid(&out.source.center[1]))
+                if (isValid(&header.source.center[0]) && isValid(&header.source.center[1]))
                 {
                     std::stringstream ss;
-                    ss << out.source.center[0] << " " << out.source.center[1];
+                    ss << header.source.center[0] << " " << header.source.center[1];
                     info.tags.set("Source Center", ss.str());
                 }
-                if (isValid(&out.source.size[0]) && isValid(&out.source.size[1]))
+                if (isValid(&header.source.size[0]) && isValid(&header.source.size[1]))
                 {
                     std::stringstream ss;
-                    ss << out.source.size[0] << " " << out.source.size[1];
+                    ss << header.source.size[0] << " " << header.source.size[1];
                     info.tags.set("Source Size", ss.str());
                 }
-                if (Cineon::isValid(out.source.file, 100))
+                if (Cineon::isValid(header.source.file, 100))
                 {
-                    info.tags.set("Source File", Cineon::toString(out.source.file, 100));
+                    info.tags.set("Source File", Cineon::toString(header.source.file, 100));
                 }
-                if (Cineon::isValid(out.source.time, 24))
+                if (Cineon::isValid(header.source.time, 24))
                 {
-                    info.tags.set("Source Time", Cineon::toString(out.source.time, 24));
+                    info.tags.set("Source Time", Cineon::toString(header.source.time, 24));
                 }
-                if (Cineon::isValid(out.source.inputDevice, 32))
+                if (Cineon::isValid(header.source.inputDevice, 32))
                 {
-                    info.tags.set("Source Input Device", Cineon::toString(out.source.inputDevice, 32));
+                    info.tags.set("Source Input Device", Cineon::toString(header.source.inputDevice, 32));
                 }
-                if (Cineon::isValid(out.source.inputSerial, 32))
+                if (Cineon::isValid(header.source.inputSerial, 32))
                 {
-                    info.tags.set("Source Input Serial", Cineon::toString(out.source.inputSerial, 32));
+                    info.tags.set("Source Input Serial", Cineon::toString(header.source.inputSerial, 32));
                 }
-                if (isValid(&out.source.border[0]) && isValid(&out.source.border[1]) &&
-                    isValid(&out.source.border[2]) && isValid(&out.source.border[3]))
+                if (isValid(&header.source.border[0]) && isValid(&header.source.border[1]) &&
+                    isValid(&header.source.border[2]) && isValid(&header.source.border[3]))
                 {
                     std::stringstream ss;
-                    ss << out.source.border[0] << " ";
-                    ss << out.source.border[1] << " ";
-                    ss << out.source.border[2] << " ";
-                    ss << out.source.border[3];
+                    ss << header.source.border[0] << " ";
+                    ss << header.source.border[1] << " ";
+                    ss << header.source.border[2] << " ";
+                    ss << header.source.border[3];
                     info.tags.set("Source Border", ss.str());
                 }
-                if (isValid(&out.source.pixelAspect[0]) && isValid(&out.source.pixelAspect[1]))
+                if (isValid(&header.source.pixelAspect[0]) && isValid(&header.source.pixelAspect[1]))
                 {
                     std::stringstream ss;
-                    ss << out.source.pixelAspect[0] << " " << out.source.pixelAspect[1];
+                    ss << header.source.pixelAspect[0] << " " << header.source.pixelAspect[1];
                     info.tags.set("Source Pixel Aspect", ss.str());
                 }
-                if (isValid(&out.source.scanSize[0]) && isValid(&out.source.scanSize[1]))
+                if (isValid(&header.source.scanSize[0]) && isValid(&header.source.scanSize[1]))
                 {
                     std::stringstream ss;
-                    ss << out.source.scanSize[0] << " " << out.source.scanSize[1];
+                    ss << header.source.scanSize[0] << " " << header.source.scanSize[1];
                     info.tags.set("Source Scan Size", ss.str());
                 }
 
-                if (Cineon::isValid(out.film.id, 2) && Cineon::isValid(out.film.type, 2) &&
-                    Cineon::isValid(out.film.offset, 2) && Cineon::isValid(out.film.prefix, 6) &&
-                    Cineon::isValid(out.film.count, 4))
+                if (Cineon::isValid(header.film.id, 2) && Cineon::isValid(header.film.type, 2) &&
+                    Cineon::isValid(header.film.offset, 2) && Cineon::isValid(header.film.prefix, 6) &&
+                    Cineon::isValid(header.film.count, 4))
                 {
                     info.tags.set("Keycode", Time::keycodeToString(
-                        std::stoi(std::string(out.film.id, 2)),
-                        std::stoi(std::string(out.film.type, 2)),
-                        std::stoi(std::string(out.film.prefix, 6)),
-                        std::stoi(std::string(out.film.count, 4)),
-                        std::stoi(std::string(out.film.offset, 2))));
+                        std::stoi(std::string(header.film.id, 2)),
+                        std::stoi(std::string(header.film.type, 2)),
+                        std::stoi(std::string(header.film.prefix, 6)),
+                        std::stoi(std::string(header.film.count, 4)),
+                        std::stoi(std::string(header.film.offset, 2))));
                 }
-                if (Cineon::isValid(out.film.format, 32))
+                if (Cineon::isValid(header.film.format, 32))
                 {
-                    info.tags.set("Film Format", Cineon::toString(out.film.format, 32));
+                    info.tags.set("Film Format", Cineon::toString(header.film.format, 32));
                 }
-                if (isValid(&out.film.frame))
+                if (isValid(&header.film.frame))
                 {
                     std::stringstream ss;
-                    ss << out.film.frame;
+                    ss << header.film.frame;
                     info.tags.set("Film Frame", ss.str());
                 }
-                if (isValid(&out.film.sequence))
+                if (isValid(&header.film.sequence))
                 {
                     std::stringstream ss;
-                    ss << out.film.sequence;
+                    ss << header.film.sequence;
                     info.tags.set("Film Sequence", ss.str());
                 }
-                if (isValid(&out.film.hold))
+                if (isValid(&header.film.hold))
                 {
                     std::stringstream ss;
-                    ss << out.film.hold;
+                    ss << header.film.hold;
                     info.tags.set("Film Hold", ss.str());
                 }
-                if (isValid(&out.film.frameRate) && out.film.frameRate > _minSpeed)
+                if (isValid(&header.film.frameRate) && header.film.frameRate > _minSpeed)
                 {
-                    info.videoSpeed = fromSpeed(out.film.frameRate);
+                    info.videoSpeed = fromSpeed(header.film.frameRate);
                     std::stringstream ss;
-                    ss << out.film.frameRate;
+                    ss << header.film.frameRate;
                     info.tags.set("Film Frame Rate", ss.str());
                 }
-                if (isValid(&out.film.shutter))
+                if (isValid(&header.film.shutter))
                 {
                     std::stringstream ss;
-                    ss << out.film.shutter;
+                    ss << header.film.shutter;
                     info.tags.set("Film Shutter", ss.str());
                 }
-                if (Cineon::isValid(out.film.frameId, 32))
+                if (Cineon::isValid(header.film.frameId, 32))
                 {
-                    info.tags.set("Film Frame ID", Cineon::toString(out.film.frameId, 32));
+                    info.tags.set("Film Frame ID", Cineon::toString(header.film.frameId, 32));
                 }
-                if (Cineon::isValid(out.film.slate, 100))
+                if (Cineon::isValid(header.film.slate, 100))
                 {
-                    info.tags.set("Film Slate", Cineon::toString(out.film.slate, 100));
+                    info.tags.set("Film Slate", Cineon::toString(header.film.slate, 100));
                 }
 
-                if (isValid(&out.tv.timecode))
+                if (isValid(&header.tv.timecode))
                 {
                     std::stringstream ss;
-                    ss << out.tv.timecode;
+                    ss << header.tv.timecode;
                     info.tags.set("Timecode", ss.str());
                 }
-                if (isValid(&out.tv.interlace))
+                if (isValid(&header.tv.interlace))
                 {
                     std::stringstream ss;
-                    ss << static_cast<unsigned int>(out.tv.interlace);
+                    ss << static_cast<unsigned int>(header.tv.interlace);
                     info.tags.set("TV Interlace", ss.str());
                 }
-                if (isValid(&out.tv.field))
+                if (isValid(&header.tv.field))
                 {
                     std::stringstream ss;
-                    ss << static_cast<unsigned int>(out.tv.field);
+                    ss << static_cast<unsigned int>(header.tv.field);
                     info.tags.set("TV Field", ss.str());
                 }
-                if (isValid(&out.tv.videoSignal))
+                if (isValid(&header.tv.videoSignal))
                 {
                     std::stringstream ss;
-                    ss << static_cast<unsigned int>(out.tv.videoSignal);
+                    ss << static_cast<unsigned int>(header.tv.videoSignal);
                     info.tags.set("TV Video Signal", ss.str());
                 }
-                if (isValid(&out.tv.sampleRate[0]) && isValid(&out.tv.sampleRate[1]))
+                if (isValid(&header.tv.sampleRate[0]) && isValid(&header.tv.sampleRate[1]))
                 {
                     std::stringstream ss;
-                    ss << out.tv.sampleRate[0] << " " << out.tv.sampleRate[1];
+                    ss << header.tv.sampleRate[0] << " " << header.tv.sampleRate[1];
                     info.tags.set("TV Sample Rate", ss.str());
                 }
-                if (isValid(&out.tv.frameRate) && out.tv.frameRate > _minSpeed)
+                if (isValid(&header.tv.frameRate) && header.tv.frameRate > _minSpeed)
                 {
-                    info.videoSpeed = fromSpeed(out.tv.frameRate);
+                    info.videoSpeed = fromSpeed(header.tv.frameRate);
                     std::stringstream ss;
-                    ss << out.tv.frameRate;
+                    ss << header.tv.frameRate;
                     info.tags.set("TV Frame Rate", ss.str());
                 }
-                if (isValid(&out.tv.timeOffset))
+                if (isValid(&header.tv.timeOffset))
                 {
                     std::stringstream ss;
-                    ss << out.tv.timeOffset;
+                    ss << header.tv.timeOffset;
                     info.tags.set("TV Time Offset", ss.str());
                 }
-                if (isValid(&out.tv.gamma))
+                if (isValid(&header.tv.gamma))
                 {
                     std::stringstream ss;
-                    ss << out.tv.gamma;
+                    ss << header.tv.gamma;
                     info.tags.set("TV Gamma", ss.str());
                 }
-                if (isValid(&out.tv.blackLevel))
+                if (isValid(&header.tv.blackLevel))
                 {
                     std::stringstream ss;
-                    ss << out.tv.blackLevel;
+                    ss << header.tv.blackLevel;
                     info.tags.set("TV Black Level", ss.str());
                 }
-                if (isValid(&out.tv.blackGain))
+                if (isValid(&header.tv.blackGain))
                 {
                     std::stringstream ss;
-                    ss << out.tv.blackGain;
+                    ss << header.tv.blackGain;
                     info.tags.set("TV Black Gain", ss.str());
                 }
-                if (isValid(&out.tv.breakpoint))
+                if (isValid(&header.tv.breakpoint))
                 {
                     std::stringstream ss;
-                    ss << out.tv.breakpoint;
+                    ss << header.tv.breakpoint;
                     info.tags.set("TV Breakpoint", ss.str());
                 }
-                if (isValid(&out.tv.whiteLevel))
+                if (isValid(&header.tv.whiteLevel))
                 {
                     std::stringstream ss;
-                    ss << out.tv.whiteLevel;
+                    ss << header.tv.whiteLevel;
                     info.tags.set("TV White Level", ss.str());
                 }
-                if (isValid(&out.tv.integrationTimes))
+                if (isValid(&header.tv.integrationTimes))
                 {
                     std::stringstream ss;
-                    ss << out.tv.integrationTimes;
+                    ss << header.tv.integrationTimes;
                     info.tags.set("TV Integration Times", ss.str());
                 }
+            }
 
-                // Set the file position.
-                if (out.file.imageOffset)
+            bool read(
+                const std::shared_ptr<System::File::IO>& io,
+                IO::Info& info,
+                const Header& headerTemplate,
+                const IO::Info& infoTemplate)
+            {
+                Header header;
+                io->read(&header.file, sizeof(Header::File));
+                if (memcmp(&header.file.magic, &headerTemplate.file.magic, 4) != 0)
                 {
-                    io->setPos(out.file.imageOffset);
+                    return false;
                 }
-                const size_t ioPos = io->getPos();
-                const size_t fileDataByteCount = ioSize > 0 ? (ioSize - ioPos) : 0;
-                if (dataByteCount > fileDataByteCount)
+                io->read(&header.image, sizeof(Header::Image));
+                io->read(&header.source, sizeof(Header::Source));
+                io->read(&header.film, sizeof(Header::Film));
+                io->read(&header.tv, sizeof(Header::TV));
+                if (infoTemplate.video[0].layout.endian != Memory::getEndian())
                 {
-                    throw System::File::Error(String::Format("{0}: {1}").
-                        arg(io->getFileName()).
-                        arg(textSystem->getText(DJV_TEXT("error_incomplete_file"))));
+                    io->setEndianConversion(true);
+                    convertEndian(header);
                 }
 
-                return out;
+                // The image section describes the layout of the pixel data,
+                // if it matches the template the rest of the validation can
+                // be skipped.
+                if (header.file.imageOffset != headerTemplate.file.imageOffset ||
+                    memcmp(&header.image, &headerTemplate.image, sizeof(Header::Image)) != 0)
+                {
+                    return false;
+                }
+                const size_t dataByteCount = infoTemplate.video[0].getDataByteCount();
+                const size_t ioSize = io->getSize();
+                if (ioSize < header.file.imageOffset ||
+                    dataByteCount > ioSize - header.file.imageOffset)
+                {
+                    return false;
+                }
+
+                info = infoTemplate;
+                info.fileName = io->getFileName();
+                info.tags = Image::Tags();
+                readTags(header, info);
+
+                if (header.file.imageOffset)
+                {
+                    io->setPos(header.file.imageOffset);
+                }
+                return true;
             }
 
             void write(
@@ -292,6 +292,20 @@ namespace djv
                 IO::Info&,
                 Transfer&,
                 const std::shared_ptr<System::TextSystem>&);
+
+            //! Read a DPX header using the header of another file in the same
+            //! sequence as a template. Only the magic number, image offset,
+            //! file size, and image section are checked, the image information
+            //! is copied from the template and only the tags are read. Returns
+            //! false if the header does not match the template.
+            bool read(
+                const std::shared_ptr<System::File::IO>&,
+                IO::Info&,
+                const Header& headerTemplate,
+                const IO::Info& infoTemplate);
+
+            //! Read the tags from a DPX header.
+            void readTags(const Header&, IO::Info&);
                 
             //! Write a DPX header.
             //!
@@ -335,9 +349,16 @@ namespace djv
                     const std::shared_ptr<System::ResourceSystem>&,
                     const std::shared_ptr<System::LogSystem>&);
 
+                bool canReadTiles() const override;
+
             protected:
                 IO::Info _readInfo(const std::string&) override;
                 std::shared_ptr<Image::Data> _readImage(const std::string&) override;
+                std::shared_ptr<Image::Data> _readRegion(
+                    const std::string&,
+                    size_t layer,
+                    const Math::BBox2i&,
+                    uint8_t level) override;
 
             private:
                 IO::Info _open(const std::string&, const std::shared_ptr<System::File::IO>&);
@@ -8,6 +8,10 @@
 
 #include <djvSystem/FileIO.h>
 
+#include <djvCore/Memory.h>
+
+#include <mutex>
+
 using namespace djv::Core;
 
 namespace djv
@@ -20,6 +24,11 @@ namespace djv
             {
                 Transfer transfer = Transfer::FilmPrint;
                 Options options;
+
+                std::mutex mutex;
+                bool headerTemplateInit = false;
+                Header headerTemplate;
+                IO::Info infoTemplate;
             };
 
             Read::Read() :
@@ -45,6 +54,11 @@ namespace djv
                 return out;
             }
 
+            bool Read::canReadTiles() const
+            {
+                return true;
+            }
+
             IO::Info Read::_readInfo(const std::string& fileName)
             {
                 auto io = System::File::IO::create();
@@ -55,20 +69,90 @@ namespace djv
             {
                 auto io = System::File::IO::create();
                 const auto info = _open(fileName, io);
-                auto out = Cineon::Read::readImage(info, io);
+                auto out = Cineon::Read::readImage(info, io, _options.dataPool);
                 out->setPluginName(pluginName);
                 return out;
             }
 
+            std::shared_ptr<Image::Data> Read::_readRegion(
+                const std::string& fileName,
+                size_t,
+                const Math::BBox2i& window,
+                uint8_t level)
+            {
+                std::shared_ptr<Image::Data> out;
+                auto io = System::File::IO::create();
+                const auto info = _open(fileName, io);
+                const auto& imageInfo = info.video[0];
+                if (0 == level && !imageInfo.layout.mirror.x)
+                {
+                    // Read the row range of the window, each row is read
+                    // starting at the first column of the window.
+                    Image::Info outInfo(window.w(), window.h(), imageInfo.type);
+                    outInfo.pixelAspectRatio = imageInfo.pixelAspectRatio;
+                    out = Image::Data::create(outInfo);
+                    const size_t pos = io->getPos();
+                    const size_t scanlineByteCount = imageInfo.getScanlineByteCount();
+                    const size_t pixelByteCount = imageInfo.getPixelByteCount();
+                    const size_t byteCount = static_cast<size_t>(window.w()) * pixelByteCount;
+                    for (int y = window.min.y; y <= window.max.y; ++y)
+                    {
+                        const size_t fileY = imageInfo.layout.mirror.y ? (imageInfo.size.h - 1 - y) : y;
+                        io->setPos(pos + fileY * scanlineByteCount + window.min.x * pixelByteCount);
+                        io->read(out->getData(y - window.min.y), byteCount);
+                    }
+                    if (imageInfo.layout.endian != Memory::getEndian() &&
+                        Image::DataType::U10 == Image::getDataType(imageInfo.type))
+                    {
+                        Memory::endian(out->getData(), out->getDataByteCount() / 4, 4);
+                    }
+                    out->setPluginName(pluginName);
+                }
+                return out;
+            }
+
             IO::Info Read::_open(const std::string& fileName, const std::shared_ptr<System::File::IO>& io)
             {
                 DJV_PRIVATE_PTR();
                 io->open(fileName, System::File::Mode::Read);
+
+                // Try reading the header with the template from a previous
+                // file in the sequence.
+                bool headerTemplateInit = false;
+                Header headerTemplate;
+                IO::Info infoTemplate;
+                {
+                    std::lock_guard<std::mutex> lock(p.mutex);
+                    if (p.headerTemplateInit)
+                    {
+                        headerTemplateInit = true;
+                        headerTemplate = p.headerTemplate;
+                        infoTemplate = p.infoTemplate;
+                    }
+                }
                 IO::Info info;
+                if (headerTemplateInit)
+                {
+                    if (DPX::read(io, info, headerTemplate, infoTemplate))
+                    {
+                        return info;
+                    }
+                    io->setPos(0);
+                    io->setEndianConversion(false);
+                }
+
                 info.videoSpeed = _speed;
                 info.videoSequence = _sequence;
                 info.video.push_back(Image::Info());
-                DPX::read(io, info, p.transfer, _textSystem);
+                const Header header = DPX::read(io, info, p.transfer, _textSystem);
+                if (_options.headerTemplate && System::File::Type::Sequence == _fileInfo.getType())
+                {
+                    std::lock_guard<std::mutex> lock(p.mutex);
+                    p.headerTemplateInit = true;
+                    p.headerTemplate = header;
+                    p.infoTemplate = info;
+                    p.infoTemplate.tags = Image::Tags();
+                }
                 return info;
             }
 
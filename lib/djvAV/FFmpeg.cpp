@@ -7,16 +7,23 @@
 #include <djvAudio/Data.h>
 
 #include <djvSystem/File.h>
+#include <djvSystem/FileIO.h>
 #include <djvSystem/Context.h>
 #include <djvSystem/LogSystem.h>
 
 #include <djvCore/String.h>
+#include <djvCore/StringFormat.h>
 
 extern "C"
 {
 #include <libavformat/avformat.h>
+#include <libavutil/pixdesc.h>
 }
 
+#include <algorithm>
+#include <array>
+#include <iomanip>
+
 using namespace djv::Core;
 
 namespace djv
@@ -25,6 +32,135 @@ namespace djv
     {
         namespace FFmpeg
         {
+            DJV_ENUM_HELPERS_IMPLEMENTATION(ThreadType);
+
+            int toFFmpeg(ThreadType value)
+            {
+                const std::array<int, static_cast<size_t>(ThreadType::Count)> data =
+                {
+                    FF_THREAD_SLICE,
+                    FF_THREAD_FRAME,
+                    FF_THREAD_FRAME | FF_THREAD_SLICE
+                };
+                return data[static_cast<size_t>(value)];
+            }
+
+            DJV_ENUM_HELPERS_IMPLEMENTATION(Codec);
+
+            AVCodec* findEncoder(Codec value)
+            {
+                AVCodec* out = nullptr;
+                switch (value)
+                {
+                case Codec::MPEG4: out = avcodec_find_encoder(AV_CODEC_ID_MPEG4); break;
+                case Codec::MJPEG: out = avcodec_find_encoder(AV_CODEC_ID_MJPEG); break;
+                case Codec::ProRes:
+                    out = avcodec_find_encoder_by_name("prores_ks");
+                    if (!out)
+                    {
+                        out = avcodec_find_encoder(AV_CODEC_ID_PRORES);
+                    }
+                    break;
+                case Codec::H264:  out = avcodec_find_encoder(AV_CODEC_ID_H264);  break;
+                default: break;
+                }
+                return out;
+            }
+
+            Image::Type toImageType(AVPixelFormat value)
+            {
+                Image::Type out = Image::Type::None;
+                switch (value)
+                {
+                case AV_PIX_FMT_GRAY8:       out = Image::Type::L_U8;         break;
+                case AV_PIX_FMT_RGB24:       out = Image::Type::RGB_U8;       break;
+                case AV_PIX_FMT_RGBA:        out = Image::Type::RGBA_U8;      break;
+                case AV_PIX_FMT_RGBA64LE:    out = Image::Type::RGBA_U16;     break;
+                case AV_PIX_FMT_YUV420P:
+                case AV_PIX_FMT_YUVJ420P:    out = Image::Type::YUV_420P_U8;  break;
+                case AV_PIX_FMT_YUV422P:
+                case AV_PIX_FMT_YUVJ422P:    out = Image::Type::YUV_422P_U8;  break;
+                case AV_PIX_FMT_YUV444P:
+                case AV_PIX_FMT_YUVJ444P:    out = Image::Type::YUV_444P_U8;  break;
+                case AV_PIX_FMT_YUV420P10LE: out = Image::Type::YUV_420P_U10; break;
+                case AV_PIX_FMT_YUV422P10LE: out = Image::Type::YUV_422P_U10; break;
+                case AV_PIX_FMT_YUV444P10LE: out = Image::Type::YUV_444P_U10; break;
+                case AV_PIX_FMT_YUV420P16LE: out = Image::Type::YUV_420P_U16; break;
+                case AV_PIX_FMT_YUV422P16LE: out = Image::Type::YUV_422P_U16; break;
+                case AV_PIX_FMT_YUV444P16LE: out = Image::Type::YUV_444P_U16; break;
+                default: break;
+                }
+                return out;
+            }
+
+            AVPixelFormat toFFmpeg(Image::Type type, Memory::Endian endian)
+            {
+                const bool lsb = Memory::Endian::LSB == endian;
+                AVPixelFormat out = AV_PIX_FMT_NONE;
+                switch (type)
+                {
+                case Image::Type::L_U8:         out = AV_PIX_FMT_GRAY8; break;
+                case Image::Type::L_U16:        out = lsb ? AV_PIX_FMT_GRAY16LE : AV_PIX_FMT_GRAY16BE; break;
+                case Image::Type::LA_U8:        out = AV_PIX_FMT_YA8; break;
+                case Image::Type::LA_U16:       out = lsb ? AV_PIX_FMT_YA16LE : AV_PIX_FMT_YA16BE; break;
+                case Image::Type::RGB_U8:       out = AV_PIX_FMT_RGB24; break;
+                case Image::Type::RGB_U16:      out = lsb ? AV_PIX_FMT_RGB48LE : AV_PIX_FMT_RGB48BE; break;
+                case Image::Type::RGBA_U8:      out = AV_PIX_FMT_RGBA; break;
+                case Image::Type::RGBA_U16:     out = lsb ? AV_PIX_FMT_RGBA64LE : AV_PIX_FMT_RGBA64BE; break;
+                case Image::Type::YUV_420P_U8:  out = AV_PIX_FMT_YUV420P; break;
+                case Image::Type::YUV_422P_U8:  out = AV_PIX_FMT_YUV422P; break;
+                case Image::Type::YUV_444P_U8:  out = AV_PIX_FMT_YUV444P; break;
+                case Image::Type::YUV_420P_U10: out = lsb ? AV_PIX_FMT_YUV420P10LE : AV_PIX_FMT_YUV420P10BE; break;
+                case Image::Type::YUV_422P_U10: out = lsb ? AV_PIX_FMT_YUV422P10LE : AV_PIX_FMT_YUV422P10BE; break;
+                case Image::Type::YUV_444P_U10: out = lsb ? AV_PIX_FMT_YUV444P10LE : AV_PIX_FMT_YUV444P10BE; break;
+                case Image::Type::YUV_420P_U16: out = lsb ? AV_PIX_FMT_YUV420P16LE : AV_PIX_FMT_YUV420P16BE; break;
+                case Image::Type::YUV_422P_U16: out = lsb ? AV_PIX_FMT_YUV422P16LE : AV_PIX_FMT_YUV422P16BE; break;
+                case Image::Type::YUV_444P_U16: out = lsb ? AV_PIX_FMT_YUV444P16LE : AV_PIX_FMT_YUV444P16BE; break;
+                default: break;
+                }
+                return out;
+            }
+
+            AVPixelFormat getSupportedFormat(AVPixelFormat value)
+            {
+                AVPixelFormat out = AV_PIX_FMT_RGBA;
+                if (toImageType(value) != Image::Type::None)
+                {
+                    out = value;
+                }
+                else if (const AVPixFmtDescriptor* desc = av_pix_fmt_desc_get(value))
+                {
+                    const bool yuv =
+                        3 == desc->nb_components &&
+                        (desc->flags & AV_PIX_FMT_FLAG_PLANAR) &&
+                        !(desc->flags & AV_PIX_FMT_FLAG_RGB);
+                    if (yuv && desc->comp[0].depth > 8)
+                    {
+                        if (1 == desc->log2_chroma_w && 1 == desc->log2_chroma_h)
+                        {
+                            out = AV_PIX_FMT_YUV420P16LE;
+                        }
+                        else if (1 == desc->log2_chroma_w && 0 == desc->log2_chroma_h)
+                        {
+                            out = AV_PIX_FMT_YUV422P16LE;
+                        }
+                        else if (0 == desc->log2_chroma_w && 0 == desc->log2_chroma_h)
+                        {
+                            out = AV_PIX_FMT_YUV444P16LE;
+                        }
+                        else
+                        {
+                            out = AV_PIX_FMT_RGBA64LE;
+                        }
+                    }
+                    else if (desc->comp[0].depth > 8)
+                    {
+                        out = AV_PIX_FMT_RGBA64LE;
+                    }
+                }
+                return out;
+            }
+
             Audio::Type toAudioType(AVSampleFormat value)
             {
                 Audio::Type out = Audio::Type::None;
@@ -210,9 +346,212 @@ namespace djv
                 return std::string(buf);
             }
 
+            Keyframe::Keyframe()
+            {}
+
+            Keyframe::Keyframe(Math::Frame::Number frame, int64_t timestamp) :
+                frame(frame),
+                timestamp(timestamp)
+            {}
+
+            bool Keyframe::isValid() const
+            {
+                return frame != Math::Frame::invalid;
+            }
+
+            bool Keyframe::operator == (const Keyframe& other) const
+            {
+                return frame == other.frame && timestamp == other.timestamp;
+            }
+
+            KeyframeIndex::KeyframeIndex()
+            {}
+
+            KeyframeIndex::KeyframeIndex(const std::vector<Keyframe>& keyframes, Math::Frame::Number lastFrame) :
+                _keyframes(keyframes),
+                _lastFrame(lastFrame)
+            {
+                if (_keyframes.size())
+                {
+                    const Math::Frame::Number first = _keyframes[0].frame;
+                    _table.resize(_lastFrame > first ? static_cast<size_t>(_lastFrame - first + 1) : 1);
+                    size_t k = 0;
+                    for (size_t i = 0; i < _table.size(); ++i)
+                    {
+                        while (k + 1 < _keyframes.size() &&
+                            _keyframes[k + 1].frame <= first + static_cast<Math::Frame::Number>(i))
+                        {
+                            ++k;
+                        }
+                        _table[i] = static_cast<uint32_t>(k);
+                    }
+                }
+            }
+
+            bool KeyframeIndex::isValid() const
+            {
+                return _keyframes.size() > 0;
+            }
+
+            const std::vector<Keyframe>& KeyframeIndex::getKeyframes() const
+            {
+                return _keyframes;
+            }
+
+            Math::Frame::Number KeyframeIndex::getLastFrame() const
+            {
+                return _lastFrame;
+            }
+
+            Keyframe KeyframeIndex::getKeyframe(Math::Frame::Number value) const
+            {
+                Keyframe out;
+                if (_keyframes.size() && value >= _keyframes[0].frame)
+                {
+                    const Math::Frame::Number i = value - _keyframes[0].frame;
+                    out = i < static_cast<Math::Frame::Number>(_table.size()) ?
+                        _keyframes[_table[i]] :
+                        _keyframes.back();
+                }
+                return out;
+            }
+
+            bool KeyframeIndex::operator == (const KeyframeIndex& other) const
+            {
+                return _keyframes == other._keyframes && _lastFrame == other._lastFrame;
+            }
+
+            KeyframeIndex readKeyframeIndex(
+                const std::string&           fileName,
+                int                          stream,
+                const std::function<bool()>& cancel)
+            {
+                AVFormatContext* avFormatContext = nullptr;
+                int r = avformat_open_input(&avFormatContext, fileName.c_str(), nullptr, nullptr);
+                if (r < 0)
+                {
+                    throw System::File::Error(String::Format("{0}: {1}").
+                        arg(fileName).
+                        arg(getErrorString(r)));
+                }
+                std::vector<Keyframe> keyframes;
+                Math::Frame::Number lastFrame = Math::Frame::invalid;
+                if (stream >= 0 && stream < static_cast<int>(avFormatContext->nb_streams))
+                {
+                    const auto avStream = avFormatContext->streams[stream];
+                    AVRational rate;
+                    rate.num = avStream->r_frame_rate.den;
+                    rate.den = avStream->r_frame_rate.num;
+                    AVPacket packet;
+                    while (av_read_frame(avFormatContext, &packet) >= 0)
+                    {
+                        if (cancel && cancel())
+                        {
+                            av_packet_unref(&packet);
+                            keyframes.clear();
+                            break;
+                        }
+                        if (stream == packet.stream_index)
+                        {
+                            const int64_t timestamp = packet.pts != AV_NOPTS_VALUE ? packet.pts : packet.dts;
+                            if (timestamp != AV_NOPTS_VALUE)
+                            {
+                                const Math::Frame::Number frame = av_rescale_q(timestamp, avStream->time_base, rate);
+                                if (packet.flags & AV_PKT_FLAG_KEY)
+                                {
+                                    keyframes.push_back(Keyframe(frame, timestamp));
+                                }
+                                lastFrame = std::max(lastFrame, frame);
+                            }
+                        }
+                        av_packet_unref(&packet);
+                    }
+                }
+                avformat_close_input(&avFormatContext);
+                std::sort(
+                    keyframes.begin(),
+                    keyframes.end(),
+                    [](const Keyframe& a, const Keyframe& b)
+                    {
+                        return a.frame < b.frame;
+                    });
+                return KeyframeIndex(keyframes, lastFrame);
+            }
+
+            std::string getKeyframeIndexFileName(const System::File::Path& directory, const System::File::Info& fileInfo)
+            {
+                std::stringstream ss;
+                ss << std::hex << std::setfill('0') << std::setw(16) << std::hash<std::string>()(fileInfo.getFileName()) << ".txt";
+                return System::File::Path(directory, ss.str()).get();
+            }
+
+            namespace
+            {
+                const std::string keyframeIndexHeader = "djv-ffmpeg-keyframe-index 1";
+
+            } // namespace
+
+            KeyframeIndex loadKeyframeIndex(const std::string& fileName, const System::File::Info& fileInfo)
+            {
+                KeyframeIndex out;
+                const auto lines = System::File::readLines(fileName);
+                if (lines.size() >= 3 && keyframeIndexHeader == lines[0])
+                {
+                    // The file size and time are used to check whether the
+                    // file has changed.
+                    uint64_t size = 0;
+                    time_t time = 0;
+                    {
+                        std::stringstream ss(lines[1]);
+                        ss >> size >> time;
+                    }
+                    if (size == fileInfo.getSize() && time == fileInfo.getTime())
+                    {
+                        Math::Frame::Number lastFrame = Math::Frame::invalid;
+                        {
+                            std::stringstream ss(lines[2]);
+                            ss >> lastFrame;
+                        }
+                        std::vector<Keyframe> keyframes;
+                        for (size_t i = 3; i < lines.size(); ++i)
+                        {
+                            Keyframe keyframe;
+                            std::stringstream ss(lines[i]);
+                            ss >> keyframe.frame >> keyframe.timestamp;
+                            keyframes.push_back(keyframe);
+                        }
+                        out = KeyframeIndex(keyframes, lastFrame);
+                    }
+                }
+                return out;
+            }
+
+            void saveKeyframeIndex(const std::string& fileName, const System::File::Info& fileInfo, const KeyframeIndex& value)
+            {
+                std::vector<std::string> lines;
+                lines.push_back(keyframeIndexHeader);
+                {
+                    std::stringstream ss;
+                    ss << fileInfo.getSize() << " " << fileInfo.getTime();
+                    lines.push_back(ss.str());
+                }
+                lines.push_back(std::to_string(value.getLastFrame()));
+                for (const auto& i : value.getKeyframes())
+                {
+                    std::stringstream ss;
+                    ss << i.frame << " " << i.timestamp;
+                    lines.push_back(ss.str());
+                }
+                System::File::writeLines(fileName, lines);
+            }
+
             bool Options::operator == (const Options& other) const
             {
-                return threadCount == other.threadCount;
+                return
+                    threadCount == other.threadCount &&
+                    threadType == other.threadType &&
+                    saveKeyframeIndex == other.saveKeyframeIndex &&
+                    codec == other.codec;
             }
                 
             namespace
@@ -280,14 +619,55 @@ namespace djv
                 return Read::create(fileInfo, options, p.options, _textSystem, _resourceSystem, _logSystem);
             }
 
+            bool Plugin::canWrite(const System::File::Info& fileInfo, const IO::Info& info) const
+            {
+                std::string extension = fileInfo.getPath().getExtension();
+                std::transform(extension.begin(), extension.end(), extension.begin(), tolower);
+                return info.video.size() && writeFileExtensions.find(extension) != writeFileExtensions.end();
+            }
+
+            std::shared_ptr<IO::IWrite> Plugin::write(const System::File::Info& fileInfo, const IO::Info& info, const IO::WriteOptions& options) const
+            {
+                DJV_PRIVATE_PTR();
+                return Write::create(fileInfo, info, options, p.options, _textSystem, _resourceSystem, _logSystem);
+            }
+
         } // namespace FFmpeg
     } // namespace AV
 
+    DJV_ENUM_SERIALIZE_HELPERS_IMPLEMENTATION(
+        AV::FFmpeg,
+        ThreadType,
+        DJV_TEXT("ffmpeg_thread_type_slice"),
+        DJV_TEXT("ffmpeg_thread_type_frame"),
+        DJV_TEXT("ffmpeg_thread_type_frame_slice"));
+
+    DJV_ENUM_SERIALIZE_HELPERS_IMPLEMENTATION(
+        AV::FFmpeg,
+        Codec,
+        DJV_TEXT("ffmpeg_codec_mpeg4"),
+        DJV_TEXT("ffmpeg_codec_mjpeg"),
+        DJV_TEXT("ffmpeg_codec_prores"),
+        DJV_TEXT("ffmpeg_codec_h264"));
+
     rapidjson::Value toJSON(const AV::FFmpeg::Options& value, rapidjson::Document::AllocatorType& allocator)
     {
         rapidjson::Value out(rapidjson::kObjectType);
         {
             out.AddMember("ThreadCount", toJSON(value.threadCount, allocator), allocator);
+            {
+                std::stringstream ss;
+                ss << value.threadType;
+                const std::string& s = ss.str();
+                out.AddMember("ThreadType", rapidjson::Value(s.c_str(), s.size(), allocator), allocator);
+            }
+            out.AddMember("SaveKeyframeIndex", toJSON(value.saveKeyframeIndex, allocator), allocator);
+            {
+                std::stringstream ss;
+                ss << value.codec;
+                const std::string& s = ss.str();
+                out.AddMember("Codec", rapidjson::Value(s.c_str(), s.size(), allocator), allocator);
+            }
         }
         return out;
     }
@@ -302,6 +682,20 @@ namespace djv
                 {
                     fromJSON(i.value, out.threadCount);
                 }
+                else if (0 == strcmp("ThreadType", i.name.GetString()) && i.value.IsString())
+                {
+                    std::stringstream ss(i.value.GetString());
+                    ss >> out.threadType;
+                }
+                else if (0 == strcmp("SaveKeyframeIndex", i.name.GetString()))
+                {
+                    fromJSON(i.value, out.saveKeyframeIndex);
+                }
+                else if (0 == strcmp("Codec", i.name.GetString()) && i.value.IsString())
+                {
+                    std::stringstream ss(i.value.GetString());
+                    ss >> out.codec;
+                }
             }
         }
         else
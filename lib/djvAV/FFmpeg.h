@@ -48,7 +48,31 @@ namespace djv
                 ".wav",
                 ".webp"
             };
+
+            //! The file extensions that can be written.
+            static const std::set<std::string> writeFileExtensions =
+            {
+                ".avi",
+                ".mkv",
+                ".mov",
+                ".mp4",
+                ".m4v"
+            };
                 
+            //! Convert from FFmpeg. Formats that are not supported return
+            //! Image::Type::None.
+            Image::Type toImageType(AVPixelFormat);
+
+            //! Convert to FFmpeg. Types that are not supported return
+            //! AV_PIX_FMT_NONE.
+            AVPixelFormat toFFmpeg(Image::Type, Core::Memory::Endian);
+
+            //! Get the supported pixel format closest to the given format.
+            //! Planar YUV formats with more than eight and less than sixteen
+            //! bits are promoted to sixteen bits, and other unsupported
+            //! formats are converted to RGBA.
+            AVPixelFormat getSupportedFormat(AVPixelFormat);
+
             //! Convert from FFmpeg.
             Audio::Type toAudioType(AVSampleFormat);
                 
@@ -65,10 +89,127 @@ namespace djv
             //! Get error string.
             std::string getErrorString(int);
 
+            //! FFmpeg decoder threading.
+            //!
+            //! Slice threading decodes the slices of a single frame in
+            //! parallel and does not add latency. Frame threading decodes
+            //! multiple frames in parallel, which scales better for long GOP
+            //! codecs like H.264 and HEVC, but delays the decoder output by
+            //! up to one frame per thread.
+            enum class ThreadType
+            {
+                Slice,
+                Frame,
+                FrameSlice,
+
+                Count,
+                First = Slice
+            };
+            DJV_ENUM_HELPERS(ThreadType);
+
+            //! Convert to FFmpeg.
+            int toFFmpeg(ThreadType);
+
+            //! FFmpeg video encoders.
+            //!
+            //! Which encoders are available depends on how FFmpeg was built,
+            //! for example H.264 requires libx264.
+            enum class Codec
+            {
+                MPEG4,
+                MJPEG,
+                ProRes,
+                H264,
+
+                Count,
+                First = MPEG4
+            };
+            DJV_ENUM_HELPERS(Codec);
+
+            //! Find the encoder. If the encoder is not available nullptr is
+            //! returned.
+            AVCodec* findEncoder(Codec);
+
+            //! Video keyframe.
+            struct Keyframe
+            {
+                Keyframe();
+                Keyframe(Math::Frame::Number, int64_t timestamp);
+
+                Math::Frame::Number frame     = Math::Frame::invalid;
+                int64_t             timestamp = AV_NOPTS_VALUE;
+
+                bool isValid() const;
+
+                bool operator == (const Keyframe&) const;
+            };
+
+            //! Video keyframe index.
+            //!
+            //! The index is used to find the keyframe at the start of the
+            //! group of pictures (GOP) that contains a frame. The keyframe for
+            //! each frame is stored in a table so the lookup is constant time.
+            class KeyframeIndex
+            {
+            public:
+                KeyframeIndex();
+
+                //! The keyframes must be sorted by frame.
+                KeyframeIndex(const std::vector<Keyframe>&, Math::Frame::Number lastFrame);
+
+                bool isValid() const;
+                const std::vector<Keyframe>& getKeyframes() const;
+                Math::Frame::Number getLastFrame() const;
+
+                //! Get the keyframe at or before the given frame. If there is
+                //! no keyframe an invalid keyframe is returned.
+                Keyframe getKeyframe(Math::Frame::Number) const;
+
+                bool operator == (const KeyframeIndex&) const;
+
+            private:
+                std::vector<Keyframe> _keyframes;
+                Math::Frame::Number _lastFrame = Math::Frame::invalid;
+                std::vector<uint32_t> _table;
+            };
+
+            //! Create a keyframe index by reading the video packets of a
+            //! file. The file is opened separately, so this can run in
+            //! parallel with decoding. If the cancel callback returns true an
+            //! invalid index is returned.
+            //!
+            //! Throws:
+            //! - System::File::Error
+            KeyframeIndex readKeyframeIndex(
+                const std::string&           fileName,
+                int                          stream,
+                const std::function<bool()>& cancel = nullptr);
+
+            //! Get the file name used to store the keyframe index for the
+            //! given file.
+            std::string getKeyframeIndexFileName(const System::File::Path& directory, const System::File::Info&);
+
+            //! Load a keyframe index that was saved for the given file. An
+            //! invalid index is returned if the file has changed since it was
+            //! saved.
+            //!
+            //! Throws:
+            //! - System::File::Error
+            KeyframeIndex loadKeyframeIndex(const std::string& fileName, const System::File::Info&);
+
+            //! Save a keyframe index for the given file.
+            //!
+            //! Throws:
+            //! - System::File::Error
+            void saveKeyframeIndex(const std::string& fileName, const System::File::Info&, const KeyframeIndex&);
+
             //! FFmpeg I/O optioms.
             struct Options
             {
-                size_t threadCount = 4;
+                size_t     threadCount       = 4;
+                ThreadType threadType        = ThreadType::FrameSlice;
+                bool       saveKeyframeIndex = true;
+                Codec      codec             = Codec::MPEG4;
                     
                 bool operator == (const Options&) const;
             };
@@ -106,11 +247,21 @@ namespace djv
                 void seek(int64_t, IO::Direction) override;
 
             private:
+                KeyframeIndex _getKeyframeIndex();
+                void _seekVideo(int64_t timestamp);
+                void _readReverse(Math::Frame::Number);
+
                 struct DecodeVideo
                 {
                     AVPacket*           packet       = nullptr;
                     Math::Frame::Number seek         = -1;
                     bool                cacheEnabled = false;
+
+                    //! If this is set the decoded frames from the seek frame
+                    //! to the end frame are added to this list instead of the
+                    //! video queue.
+                    std::vector<IO::VideoFrame>* frames = nullptr;
+                    Math::Frame::Number end = Math::Frame::invalid;
                 };
                 int _decodeVideo(const DecodeVideo&, Math::Frame::Number&);
 
@@ -124,6 +275,47 @@ namespace djv
                 DJV_PRIVATE();
             };
 
+            //! FFmpeg writer.
+            //!
+            //! Images are converted to the encoder pixel format in parallel
+            //! and encoded on a separate thread, so the encoder does not wait
+            //! for the conversion of the next image. Only video is written.
+            class Write : public IO::IWrite
+            {
+                DJV_NON_COPYABLE(Write);
+
+            protected:
+                void _init(
+                    const System::File::Info&,
+                    const IO::Info&,
+                    const IO::WriteOptions&,
+                    const Options&,
+                    const std::shared_ptr<System::TextSystem>&,
+                    const std::shared_ptr<System::ResourceSystem>&,
+                    const std::shared_ptr<System::LogSystem>&);
+                Write();
+
+            public:
+                ~Write() override;
+
+                static std::shared_ptr<Write> create(
+                    const System::File::Info&,
+                    const IO::Info&,
+                    const IO::WriteOptions&,
+                    const Options&,
+                    const std::shared_ptr<System::TextSystem>&,
+                    const std::shared_ptr<System::ResourceSystem>&,
+                    const std::shared_ptr<System::LogSystem>&);
+
+                bool isRunning() const override;
+
+            private:
+                AVFrame* _convert(const std::shared_ptr<Image::Data>&, int64_t pts);
+                void _encode(AVFrame*);
+
+                DJV_PRIVATE();
+            };
+
             //! FFmpeg I/O plugin.
             class Plugin : public IO::IPlugin
             {
@@ -140,7 +332,10 @@ namespace djv
                 rapidjson::Value getOptions(rapidjson::Document::AllocatorType&) const override;
                 void setOptions(const rapidjson::Value&) override;
 
+                bool canWrite(const System::File::Info&, const IO::Info&) const override;
+
                 std::shared_ptr<IO::IRead> read(const System::File::Info&, const IO::ReadOptions&) const override;
+                std::shared_ptr<IO::IWrite> write(const System::File::Info&, const IO::Info&, const IO::WriteOptions&) const override;
 
             private:
                 DJV_PRIVATE();
@@ -149,6 +344,9 @@ namespace djv
         } // namespace FFmpeg
     } // namespace AV
 
+    DJV_ENUM_SERIALIZE_HELPERS(AV::FFmpeg::ThreadType);
+    DJV_ENUM_SERIALIZE_HELPERS(AV::FFmpeg::Codec);
+
     rapidjson::Value toJSON(const AV::FFmpeg::Options&, rapidjson::Document::AllocatorType&);
 
     //! Throws:
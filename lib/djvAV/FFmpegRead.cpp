@@ -4,8 +4,12 @@
 
 #include <djvAV/FFmpeg.h>
 
+#include <djvMath/Math.h>
+
 #include <djvSystem/File.h>
+#include <djvSystem/FileInfo.h>
 #include <djvSystem/LogSystem.h>
+#include <djvSystem/ResourceSystem.h>
 #include <djvSystem/Timer.h>
 #include <djvSystem/TextSystem.h>
 
@@ -28,6 +32,35 @@ namespace djv
     {
         namespace FFmpeg
         {
+            namespace
+            {
+                //! \todo Should this be configurable?
+                const size_t reverseFrameMax = 64;
+
+                //! Get the number of frames added to the video queue at a time
+                //! in reverse. This is half of the video queue so that the queue
+                //! never holds more than its maximum, and there are frames left
+                //! to display while the next section is read.
+                size_t getReverseFrameCount(size_t queueMax)
+                {
+                    return Math::clamp(queueMax / 2, static_cast<size_t>(1), reverseFrameMax);
+                }
+
+                //! Get the number of frames decoded at a time in reverse. This
+                //! is the number of frames that fit in the frame cache, or the
+                //! given GOP size if it is smaller or the cache is not limited.
+                size_t getReverseDecodeCount(size_t maxByteCount, size_t dataByteCount, size_t gopSize)
+                {
+                    size_t out = gopSize;
+                    if (maxByteCount > 0 && dataByteCount > 0)
+                    {
+                        out = std::min(out, std::max(maxByteCount / dataByteCount, static_cast<size_t>(1)));
+                    }
+                    return out;
+                }
+
+            } // namespace
+
             struct Read::Private
             {
                 Options options;
@@ -45,8 +78,13 @@ namespace djv
                 std::map<int, AVCodecParameters*> avCodecParameters;
                 std::map<int, AVCodecContext*> avCodecContext;
                 AVFrame* avFrame = nullptr;
-                AVFrame* avFrameRgb = nullptr;
                 SwsContext* swsContext = nullptr;
+                Image::Size videoSize;
+
+                std::future<KeyframeIndex> keyframeIndexFuture;
+                KeyframeIndex keyframeIndex;
+                Math::Frame::Number videoFrame = Math::Frame::invalid;
+                Math::Frame::Number reverseFrame = Math::Frame::invalid;
             };
 
             void Read::_init(
@@ -150,7 +188,16 @@ namespace djv
                                     arg(FFmpeg::getErrorString(r)));
                             }
                             p.avCodecContext[p.avVideoStream]->thread_count = p.options.threadCount;
-                            p.avCodecContext[p.avVideoStream]->thread_type = FF_THREAD_SLICE;
+                            p.avCodecContext[p.avVideoStream]->thread_type = FFmpeg::toFFmpeg(p.options.threadType);
+
+                            // Let the decoder output a smaller image if a
+                            // preferred size is given and the codec supports
+                            // it.
+                            p.avCodecContext[p.avVideoStream]->lowres = static_cast<int>(IO::getReduction(
+                                Image::Size(avVideoCodecParameters->width, avVideoCodecParameters->height),
+                                _options.preferredSize,
+                                avVideoCodec->max_lowres));
+
                             r = avcodec_open2(p.avCodecContext[p.avVideoStream], avVideoCodec, 0);
                             if (r < 0)
                             {
@@ -158,28 +205,71 @@ namespace djv
                                     arg(_fileInfo.getFileName()).
                                     arg(FFmpeg::getErrorString(r)));
                             }
+                            p.videoSize = Image::Size(
+                                p.avCodecContext[p.avVideoStream]->width,
+                                p.avCodecContext[p.avVideoStream]->height);
 
-                            // Initialize the buffers.
-                            p.avFrameRgb = av_frame_alloc();
-
-                            // Initialize the software scaler.
-                            p.swsContext = sws_getContext(
-                                p.avCodecParameters[p.avVideoStream]->width,
-                                p.avCodecParameters[p.avVideoStream]->height,
-                                static_cast<AVPixelFormat>(p.avCodecParameters[p.avVideoStream]->format),
-                                p.avCodecParameters[p.avVideoStream]->width,
-                                p.avCodecParameters[p.avVideoStream]->height,
-                                AV_PIX_FMT_RGBA,
-                                SWS_BILINEAR,
-                                0,
-                                0,
-                                0);
+                            // Decoded frames in a supported pixel format, including
+                            // planar YUV, are copied without conversion. Other
+                            // formats are converted with the software scaler.
+                            const auto avPixelFormat = static_cast<AVPixelFormat>(p.avCodecParameters[p.avVideoStream]->format);
+                            const auto avSupportedFormat = FFmpeg::getSupportedFormat(avPixelFormat);
+                            if (avSupportedFormat != avPixelFormat)
+                            {
+                                p.swsContext = sws_getContext(
+                                    p.videoSize.w,
+                                    p.videoSize.h,
+                                    avPixelFormat,
+                                    p.videoSize.w,
+                                    p.videoSize.h,
+                                    avSupportedFormat,
+                                    SWS_BILINEAR,
+                                    0,
+                                    0,
+                                    0);
+                            }
 
                             // Get information.
                             Image::Info imageInfo;
                             imageInfo.size.w = p.avCodecParameters[p.avVideoStream]->width;
                             imageInfo.size.h = p.avCodecParameters[p.avVideoStream]->height;
-                            imageInfo.type = Image::Type::RGBA_U8;
+                            imageInfo.type = FFmpeg::toImageType(avSupportedFormat);
+                            if (Image::getDataType(imageInfo.type) != Image::DataType::U8)
+                            {
+                                imageInfo.layout.endian = Memory::Endian::LSB;
+                            }
+                            switch (p.avCodecParameters[p.avVideoStream]->color_space)
+                            {
+                            case AVCOL_SPC_BT470BG:
+                            case AVCOL_SPC_SMPTE170M:
+                                imageInfo.yuvCoefficients = Image::YUVCoefficients::Rec601;
+                                break;
+                            case AVCOL_SPC_BT2020_NCL:
+                            case AVCOL_SPC_BT2020_CL:
+                                imageInfo.yuvCoefficients = Image::YUVCoefficients::Rec2020;
+                                break;
+                            case AVCOL_SPC_BT709:
+                                imageInfo.yuvCoefficients = Image::YUVCoefficients::Rec709;
+                                break;
+                            default:
+                                imageInfo.yuvCoefficients = imageInfo.size.h < 720 ?
+                                    Image::YUVCoefficients::Rec601 :
+                                    Image::YUVCoefficients::Rec709;
+                                break;
+                            }
+                            switch (avPixelFormat)
+                            {
+                            case AV_PIX_FMT_YUVJ420P:
+                            case AV_PIX_FMT_YUVJ422P:
+                            case AV_PIX_FMT_YUVJ444P:
+                                imageInfo.yuvRange = Image::YUVRange::Full;
+                                break;
+                            default:
+                                imageInfo.yuvRange = AVCOL_RANGE_JPEG == p.avCodecParameters[p.avVideoStream]->color_range ?
+                                    Image::YUVRange::Full :
+                                    Image::YUVRange::Video;
+                                break;
+                            }
                             imageInfo.codec = avVideoCodec->long_name;
                             if (avVideoStream->duration != AV_NOPTS_VALUE)
                             {
@@ -294,9 +384,39 @@ namespace djv
                         }
 
                         p.infoPromise.set_value(p.info);
+                        _wake();
+
+                        // The frames decoded in reverse are stored in the frame
+                        // cache.
+                        _cache.setSequenceSize(sequenceSize);
+                        _cache.setDirection(IO::Direction::Reverse);
+
+                        // Create the keyframe index in the background.
+                        if (p.avVideoStream != -1)
+                        {
+                            p.keyframeIndexFuture = std::async(
+                                std::launch::async,
+                                [this]
+                                {
+                                    return _getKeyframeIndex();
+                                });
+                        }
 
                         while (p.running)
                         {
+                            if (p.keyframeIndexFuture.valid() &&
+                                p.keyframeIndexFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+                            {
+                                try
+                                {
+                                    p.keyframeIndex = p.keyframeIndexFuture.get();
+                                }
+                                catch (const std::exception& e)
+                                {
+                                    _logSystem->log("djv::AV::IO::FFmpeg::Read", e.what(), System::LogLevel::Warning);
+                                }
+                            }
+
                             //! \todo Implement me!
                             /*bool cacheEnabled = false;
                             size_t cacheMaxByteCount = 0;
@@ -332,8 +452,14 @@ namespace djv
                                     //[this, sequenceSize, cacheEnabled, &cachedFrames]
                                 {
                                     DJV_PRIVATE_PTR();
-                                    const bool video = p.avVideoStream != -1 && (_videoQueue.isFinished() ? false : (_videoQueue.getCount() < _videoQueue.getMax()));
-                                    const bool audio = p.avAudioStream != -1 && (_audioQueue.isFinished() ? false : (_audioQueue.getCount() < _audioQueue.getMax()));
+                                    const size_t videoQueueMax = _videoQueue.getMax();
+                                    const size_t videoQueueCount = _videoQueue.getCount();
+                                    const bool video = p.avVideoStream != -1 && !_videoQueue.isFinished() &&
+                                        (IO::Direction::Reverse == _direction ?
+                                            (videoQueueCount + getReverseFrameCount(videoQueueMax) <= videoQueueMax) :
+                                            (videoQueueCount < videoQueueMax));
+                                    const bool audio = p.avAudioStream != -1 && IO::Direction::Forward == p.direction &&
+                                        (_audioQueue.isFinished() ? false : (_audioQueue.getCount() < _audioQueue.getMax()));
 
                                     /*bool cache = false;
                                     if (cacheEnabled && !_videoQueue.isFinished() && !_audioQueue.isFinished())
@@ -362,6 +488,7 @@ namespace djv
                                     if (p.direction != _direction)
                                     {
                                         p.direction = _direction;
+                                        p.reverseFrame = p.videoFrame;
                                         _videoQueue.setFinished(false);
                                         _videoQueue.clearFrames();
                                         _audioQueue.setFinished(false);
@@ -378,9 +505,26 @@ namespace djv
                                     }
                                 }
                             }
+
+                            // In reverse the video is decoded a GOP at a time.
+                            if (IO::Direction::Reverse == p.direction && p.avVideoStream != -1)
+                            {
+                                p.videoFrame = Math::Frame::invalid;
+                                if (seek != Math::Frame::invalid)
+                                {
+                                    p.reverseFrame = seek;
+                                }
+                                if (read && p.reverseFrame != Math::Frame::invalid)
+                                {
+                                    _readReverse(p.reverseFrame);
+                                }
+                                continue;
+                            }
+
                             AVPacket packet;
                             try
                             {
+                                bool seekStream = true;
                                 if (seek != Math::Frame::invalid)
                                 {
                                     int64_t t = 0;
@@ -388,11 +532,27 @@ namespace djv
                                     if (p.avVideoStream != -1)
                                     {
                                         stream = p.avVideoStream;
-                                        AVRational r;
-                                        r.num = p.info.videoSpeed.getDen();
-                                        r.den = p.info.videoSpeed.getNum();
-                                        t = av_rescale_q(seek, r, p.avFormatContext->streams[p.avVideoStream]->time_base);
-                                        //t = av_rescale_q(seek, r, av_get_time_base_q());
+                                        const Keyframe keyframe = p.keyframeIndex.getKeyframe(seek);
+                                        if (keyframe.isValid() && keyframe.timestamp != AV_NOPTS_VALUE)
+                                        {
+                                            // Seek directly to the keyframe at the start
+                                            // of the GOP. If the decoder is already in the
+                                            // GOP and before the seek frame it only needs
+                                            // to continue decoding.
+                                            t = keyframe.timestamp;
+                                            seekStream = !(
+                                                p.videoFrame != Math::Frame::invalid &&
+                                                p.videoFrame < seek &&
+                                                keyframe.frame <= p.videoFrame);
+                                        }
+                                        else
+                                        {
+                                            AVRational r;
+                                            r.num = p.info.videoSpeed.getDen();
+                                            r.den = p.info.videoSpeed.getNum();
+                                            t = av_rescale_q(seek, r, p.avFormatContext->streams[p.avVideoStream]->time_base);
+                                            //t = av_rescale_q(seek, r, av_get_time_base_q());
+                                        }
                                     }
                                     else if (p.avAudioStream != -1)
                                     {
@@ -403,25 +563,34 @@ namespace djv
                                         t = av_rescale_q(seek, r, p.avFormatContext->streams[p.avAudioStream]->time_base);
                                         //t = av_rescale_q(seek, r, av_get_time_base_q());
                                     }
-                                    if (p.avVideoStream != -1)
-                                    {
-                                        avcodec_flush_buffers(p.avCodecContext[p.avVideoStream]);
-                                    }
-                                    if (p.avAudioStream != -1)
-                                    {
-                                        avcodec_flush_buffers(p.avCodecContext[p.avAudioStream]);
-                                    }
-                                    if (av_seek_frame(
-                                        p.avFormatContext,
-                                        stream,
-                                        t,
-                                        AVSEEK_FLAG_BACKWARD) < 0)
+                                    if (seekStream)
                                     {
-                                        throw std::exception();
+                                        if (p.avVideoStream != -1)
+                                        {
+                                            avcodec_flush_buffers(p.avCodecContext[p.avVideoStream]);
+                                        }
+                                        if (p.avAudioStream != -1)
+                                        {
+                                            avcodec_flush_buffers(p.avCodecContext[p.avAudioStream]);
+                                        }
+                                        if (av_seek_frame(
+                                            p.avFormatContext,
+                                            stream,
+                                            t,
+                                            AVSEEK_FLAG_BACKWARD) < 0)
+                                        {
+                                            throw std::exception();
+                                        }
                                     }
+                                    // Decode until each stream reaches the seek frame.
+                                    // With frame threading the decoder output lags
+                                    // behind the packets by up to one frame per
+                                    // thread, so the frame numbers come from the
+                                    // decoded frames and not the packets.
                                     Math::Frame::Number videoFrame = Math::Frame::invalid;
                                     Math::Frame::Number audioFrame = Math::Frame::invalid;
-                                    while (videoFrame < seek - 1 || audioFrame < seek - 1)
+                                    while ((p.avVideoStream != -1 && videoFrame < seek - 1) ||
+                                        (p.avAudioStream != -1 && audioFrame < seek - 1))
                                     {
                                         if (av_read_frame(p.avFormatContext, &packet) < 0)
                                         {
@@ -465,6 +634,7 @@ namespace djv
                                         }
                                         av_packet_unref(&packet);
                                     }
+                                    p.videoFrame = videoFrame;
                                 }
                                 if (read)
                                 {
@@ -497,6 +667,10 @@ namespace djv
                                         {
                                             throw std::exception();
                                         }
+                                        if (videoFrame != Math::Frame::invalid)
+                                        {
+                                            p.videoFrame = videoFrame;
+                                        }
                                     }
                                     else if (p.avAudioStream == packet.stream_index)
                                     {
@@ -518,26 +692,29 @@ namespace djv
                                     _logSystem->log("djv::AV::IO::FFmpeg::Read", ss.str());
                                 }*/
                                 av_packet_unref(&packet);
+                                p.videoFrame = Math::Frame::invalid;
                                 {
                                     std::lock_guard<std::mutex> lock(_mutex);
                                     _videoQueue.setFinished(true);
                                     _audioQueue.setFinished(true);
                                 }
+                                _wake();
                             }
                         }
                     }
                     catch (const std::exception& e)
                     {
                         p.infoPromise.set_value(IO::Info());
+                        _wake();
                         _logSystem->log("djvAV::IO::FFmpeg::Read", e.what(), System::LogLevel::Error);
                     }
-                    if (p.swsContext)
+                    if (p.keyframeIndexFuture.valid())
                     {
-                        sws_freeContext(p.swsContext);
+                        p.keyframeIndexFuture.wait();
                     }
-                    if (p.avFrameRgb)
+                    if (p.swsContext)
                     {
-                        av_frame_free(&p.avFrameRgb);
+                        sws_freeContext(p.swsContext);
                     }
                     if (p.avFrame)
                     {
@@ -597,7 +774,7 @@ namespace djv
                 return _p->infoPromise.get_future();
             }
 
-            void Read::seek(Math::Frame::Number value, IO::Direction)
+            void Read::seek(Math::Frame::Number value, IO::Direction direction)
             {
                 DJV_PRIVATE_PTR();
                 {
@@ -605,10 +782,185 @@ namespace djv
                     _videoQueue.clearFrames();
                     _audioQueue.clearFrames();
                     p.seek = value;
+                    _direction = direction;
                 }
                 p.queueCV.notify_one();
             }
 
+            KeyframeIndex Read::_getKeyframeIndex()
+            {
+                DJV_PRIVATE_PTR();
+                KeyframeIndex out;
+                System::File::Path directory;
+                std::string fileName;
+                if (p.options.saveKeyframeIndex)
+                {
+                    directory = System::File::Path(
+                        _resourceSystem->getPath(System::File::ResourcePath::Documents),
+                        "FFmpegKeyframeIndex");
+                    fileName = getKeyframeIndexFileName(directory, _fileInfo);
+                    if (System::File::Info(fileName).doesExist())
+                    {
+                        out = loadKeyframeIndex(fileName, _fileInfo);
+                    }
+                }
+                if (!out.isValid())
+                {
+                    out = readKeyframeIndex(
+                        _fileInfo.getFileName(),
+                        p.avVideoStream,
+                        [this]
+                        {
+                            return !_p->running;
+                        });
+                    if (out.isValid() && !fileName.empty())
+                    {
+                        if (!System::File::Info(directory).doesExist())
+                        {
+                            System::File::mkdir(directory);
+                        }
+                        saveKeyframeIndex(fileName, _fileInfo, out);
+                    }
+                }
+                return out;
+            }
+
+            void Read::_seekVideo(int64_t timestamp)
+            {
+                DJV_PRIVATE_PTR();
+                avcodec_flush_buffers(p.avCodecContext[p.avVideoStream]);
+                if (p.avAudioStream != -1)
+                {
+                    avcodec_flush_buffers(p.avCodecContext[p.avAudioStream]);
+                }
+                av_seek_frame(p.avFormatContext, p.avVideoStream, timestamp, AVSEEK_FLAG_BACKWARD);
+            }
+
+            void Read::_readReverse(Math::Frame::Number frame)
+            {
+                DJV_PRIVATE_PTR();
+
+                size_t frameCount = 0;
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    frameCount = getReverseFrameCount(_videoQueue.getMax());
+                }
+                const Math::Frame::Number firstFrame = p.keyframeIndex.isValid() ?
+                    p.keyframeIndex.getKeyframes().front().frame :
+                    0;
+                const Keyframe keyframe = p.keyframeIndex.getKeyframe(frame);
+                std::vector<IO::VideoFrame> frames;
+                std::shared_ptr<Image::Data> image;
+                if (_cache.get(frame, image))
+                {
+                    // Use the frames that are already in the cache.
+                    _cache.setCurrentFrame(frame);
+                    for (; frame >= firstFrame && frames.size() < frameCount && _cache.get(frame, image); --frame)
+                    {
+                        frames.push_back(IO::VideoFrame(frame, image));
+                    }
+                }
+                else
+                {
+                    // Decode the GOP forward up to the frame, storing the
+                    // frames in the cache so the GOP is only decoded once. If
+                    // the frames don't fit in the cache memory budget only the
+                    // frames closest to the end of the GOP are stored, and the
+                    // rest of the GOP is decoded again when it is reached.
+                    const auto avVideoStream = p.avFormatContext->streams[p.avVideoStream];
+                    int64_t t = 0;
+                    if (keyframe.isValid() && keyframe.timestamp != AV_NOPTS_VALUE)
+                    {
+                        t = keyframe.timestamp;
+                    }
+                    else
+                    {
+                        AVRational r;
+                        r.num = p.info.videoSpeed.getDen();
+                        r.den = p.info.videoSpeed.getNum();
+                        t = av_rescale_q(frame, r, avVideoStream->time_base);
+                    }
+                    const size_t decodeCount = getReverseDecodeCount(
+                        _cache.getFrameCache()->getMaxByteCount(),
+                        p.info.video.size() ? p.info.video[0].getDataByteCount() : 0,
+                        keyframe.isValid() ? static_cast<size_t>(frame - keyframe.frame + 1) : reverseFrameMax);
+                    _cache.setMax(decodeCount + _cache.getReadBehind());
+                    _cache.setCurrentFrame(frame);
+                    DecodeVideo dv;
+                    std::vector<IO::VideoFrame> decoded;
+                    dv.frames = &decoded;
+                    dv.cacheEnabled = true;
+                    dv.seek = frame - static_cast<Math::Frame::Number>(decodeCount) + 1;
+                    dv.end = frame;
+                    const int64_t startTime = avVideoStream->start_time != AV_NOPTS_VALUE ? avVideoStream->start_time : 0;
+                    for (const int64_t i : { t, startTime })
+                    {
+                        _seekVideo(i);
+                        Math::Frame::Number videoFrame = Math::Frame::invalid;
+                        AVPacket packet;
+                        while (videoFrame <= frame)
+                        {
+                            {
+                                std::lock_guard<std::mutex> lock(_mutex);
+                                if (p.seek != Math::Frame::invalid || p.direction != _direction)
+                                {
+                                    return;
+                                }
+                            }
+                            if (av_read_frame(p.avFormatContext, &packet) < 0)
+                            {
+                                dv.packet = nullptr;
+                                _decodeVideo(dv, videoFrame);
+                                break;
+                            }
+                            int r = 0;
+                            if (p.avVideoStream == packet.stream_index)
+                            {
+                                dv.packet = &packet;
+                                r = _decodeVideo(dv, videoFrame);
+                            }
+                            av_packet_unref(&packet);
+                            if (r < 0)
+                            {
+                                break;
+                            }
+                        }
+
+                        // If the seek landed after the frame, try again from the
+                        // start of the file.
+                        if (decoded.size() || i <= startTime)
+                        {
+                            break;
+                        }
+                    }
+                    for (auto i = decoded.rbegin(); i != decoded.rend() && frames.size() < frameCount; ++i)
+                    {
+                        frames.push_back(*i);
+                    }
+                }
+
+                // Add the frames to the queue in reverse order.
+                bool finished = frames.empty();
+                if (!finished)
+                {
+                    const Math::Frame::Number last = frames.back().frame;
+                    p.reverseFrame = last - 1;
+                    finished = last <= firstFrame;
+                }
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    if (Math::Frame::invalid == p.seek && p.direction == _direction)
+                    {
+                        for (const auto& i : frames)
+                        {
+                            _videoQueue.addFrame(i);
+                        }
+                        _videoQueue.setFinished(finished);
+                    }
+                }
+                _wake();
+            }
+
             int Read::_decodeVideo(const DecodeVideo& dv, Math::Frame::Number& frame)
             {
                 DJV_PRIVATE_PTR();
@@ -630,12 +982,13 @@ namespace djv
                     r.num = p.info.videoSpeed.getDen();
                     r.den = p.info.videoSpeed.getNum();
                     frame = av_rescale_q(
-                        p.avFrame->pts,
+                        p.avFrame->best_effort_timestamp,
                         p.avFormatContext->streams[p.avVideoStream]->time_base,
                         r);
                     //std::cout << "decode video = " << frame << std::endl;
 
-                    if (Math::Frame::invalid == dv.seek || frame >= dv.seek)
+                    if ((Math::Frame::invalid == dv.seek || frame >= dv.seek) &&
+                        (Math::Frame::invalid == dv.end || frame <= dv.end))
                     {
                         std::shared_ptr<Image::Data> image;
                         if (dv.cacheEnabled && _cache.get(frame, image))
@@ -646,41 +999,67 @@ namespace djv
                             if (p.info.video.size())
                             {
                                 imageInfo = p.info.video[0];
+                                imageInfo.size = p.videoSize;
                             }
                             if (!((0 == p.avFrame->sample_aspect_ratio.num && 1 == p.avFrame->sample_aspect_ratio.den) ||
                                 0 == p.avFrame->sample_aspect_ratio.den))
                             {
                                 imageInfo.pixelAspectRatio = p.avFrame->sample_aspect_ratio.num / static_cast<float>(p.avFrame->sample_aspect_ratio.den);
                             }
-                            image = Image::Data::create(imageInfo);
+                            image = Image::Data::create(imageInfo, _options.dataPool);
                             image->setPluginName(pluginName);
-                            av_image_fill_arrays(
-                                p.avFrameRgb->data,
-                                p.avFrameRgb->linesize,
-                                image->getData(),
-                                AV_PIX_FMT_RGBA,
-                                image->getWidth(),
-                                image->getHeight(),
-                                1);
-                            sws_scale(
-                                p.swsContext,
-                                (uint8_t const* const*)p.avFrame->data,
-                                p.avFrame->linesize,
-                                0,
-                                p.avCodecParameters[p.avVideoStream]->height,
-                                p.avFrameRgb->data,
-                                p.avFrameRgb->linesize);
+                            const uint8_t planeCount = imageInfo.getPlaneCount();
+                            if (p.swsContext)
+                            {
+                                uint8_t* data[4] = { nullptr, nullptr, nullptr, nullptr };
+                                int linesize[4] = { 0, 0, 0, 0 };
+                                for (uint8_t i = 0; i < planeCount; ++i)
+                                {
+                                    data[i] = image->getPlaneData(i);
+                                    linesize[i] = static_cast<int>(imageInfo.getPlaneScanlineByteCount(i));
+                                }
+                                sws_scale(
+                                    p.swsContext,
+                                    (uint8_t const* const*)p.avFrame->data,
+                                    p.avFrame->linesize,
+                                    0,
+                                    p.videoSize.h,
+                                    data,
+                                    linesize);
+                            }
+                            else
+                            {
+                                for (uint8_t i = 0; i < planeCount; ++i)
+                                {
+                                    const Image::Size planeSize = imageInfo.getPlaneSize(i);
+                                    av_image_copy_plane(
+                                        image->getPlaneData(i),
+                                        static_cast<int>(imageInfo.getPlaneScanlineByteCount(i)),
+                                        p.avFrame->data[i],
+                                        p.avFrame->linesize[i],
+                                        static_cast<int>(planeSize.w * imageInfo.getPixelByteCount()),
+                                        planeSize.h);
+                                }
+                            }
                             if (dv.cacheEnabled)
                             {
                                 _cache.add(frame, image);
                             }
                         }
+                        if (dv.frames)
+                        {
+                            dv.frames->push_back(IO::VideoFrame(frame, image));
+                        }
+                        else
                         {
-                            std::lock_guard<std::mutex> lock(_mutex);
-                            if (Math::Frame::invalid == p.seek)
                             {
-                                _videoQueue.addFrame(IO::VideoFrame(frame, image));
+                                std::lock_guard<std::mutex> lock(_mutex);
+                                if (Math::Frame::invalid == p.seek)
+                                {
+                                    _videoQueue.addFrame(IO::VideoFrame(frame, image));
+                                }
                             }
+                            _wake();
                         }
                     }
                 }
@@ -0,0 +1,723 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAV/FFmpeg.h>
+
+#include <djvAV/Speed.h>
+#include <djvAV/ThreadPool.h>
+
+#include <djvGL/ImageConvert.h>
+
+#include <djvImage/Convert.h>
+
+#include <djvSystem/File.h>
+#include <djvSystem/FileInfo.h>
+#include <djvSystem/LogSystem.h>
+#include <djvSystem/ResourceSystem.h>
+#include <djvSystem/TextSystem.h>
+#include <djvSystem/Timer.h>
+
+#include <djvCore/OS.h>
+#include <djvCore/StringFormat.h>
+
+extern "C"
+{
+#include <libavformat/avformat.h>
+#include <libavutil/dict.h>
+#include <libavutil/imgutils.h>
+#include <libavutil/pixdesc.h>
+#include <libswscale/swscale.h>
+
+} // extern "C"
+
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include <condition_variable>
+#include <list>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace FFmpeg
+        {
+            namespace
+            {
+                //! \todo Should this be configurable?
+                const int qscale = 2;
+
+                //! \todo Should this be configurable?
+                const char* h264CRF = "18";
+
+                //! Get whether an image needs to be converted with OpenGL (or
+                //! the CPU) before FFmpeg can convert it to the encoder format.
+                bool isConvertNeeded(const Image::Info& info)
+                {
+                    return AV_PIX_FMT_NONE == toFFmpeg(info.type, info.layout.endian) || info.layout.mirror.x;
+                }
+
+                Image::Type getConvertType(Image::Type value)
+                {
+                    const uint8_t channelCount = Image::getChannelCount(value);
+                    return Image::getIntType(channelCount, Image::getBitDepth(value) > 8 ? 16 : 8);
+                }
+
+                int toSwsColorSpace(Image::YUVCoefficients value)
+                {
+                    int out = SWS_CS_ITU709;
+                    switch (value)
+                    {
+                    case Image::YUVCoefficients::Rec601:  out = SWS_CS_ITU601; break;
+                    case Image::YUVCoefficients::Rec2020: out = SWS_CS_BT2020; break;
+                    default: break;
+                    }
+                    return out;
+                }
+
+                AVColorSpace toAVColorSpace(Image::YUVCoefficients value)
+                {
+                    AVColorSpace out = AVCOL_SPC_BT709;
+                    switch (value)
+                    {
+                    case Image::YUVCoefficients::Rec601:  out = AVCOL_SPC_SMPTE170M;  break;
+                    case Image::YUVCoefficients::Rec2020: out = AVCOL_SPC_BT2020_NCL; break;
+                    default: break;
+                    }
+                    return out;
+                }
+
+                bool isYUVFormat(AVPixelFormat value)
+                {
+                    bool out = false;
+                    if (const AVPixFmtDescriptor* desc = av_pix_fmt_desc_get(value))
+                    {
+                        out = desc->nb_components >= 3 && !(desc->flags & AV_PIX_FMT_FLAG_RGB);
+                    }
+                    return out;
+                }
+
+                bool isFullRangeFormat(AVPixelFormat value)
+                {
+                    return
+                        AV_PIX_FMT_YUVJ420P == value ||
+                        AV_PIX_FMT_YUVJ422P == value ||
+                        AV_PIX_FMT_YUVJ444P == value;
+                }
+
+            } // namespace
+
+            struct Write::Private
+            {
+                Options options;
+                Image::Info imageInfo;
+                AVPixelFormat avPixelFormatIn = AV_PIX_FMT_NONE;
+                AVFormatContext* avFormatContext = nullptr;
+                AVCodecContext* avCodecContext = nullptr;
+                AVStream* avStream = nullptr;
+                AVPacket* avPacket = nullptr;
+                GLFWwindow* glfwWindow = nullptr;
+                std::shared_ptr<GL::ImageConvert> convert;
+                std::shared_ptr<Image::Convert> cpuConvert;
+
+                // The frames are converted to the encoder format by jobs on
+                // the thread pool.
+                Core::UID uid = 0;
+                std::shared_ptr<IO::ThreadPool> threadPool;
+
+                // The scaling contexts are re-used by the conversion tasks.
+                std::mutex swsMutex;
+                std::vector<SwsContext*> swsContexts;
+
+                // The conversion tasks are queued in order for the encoder.
+                std::mutex encodeMutex;
+                std::condition_variable encodeCV;
+                std::list<std::future<AVFrame*> > encodeQueue;
+                bool convertFinished = false;
+
+                std::thread convertThread;
+                std::thread encodeThread;
+                std::atomic<bool> running;
+            };
+
+            void Write::_init(
+                const System::File::Info& fileInfo,
+                const IO::Info& info,
+                const IO::WriteOptions& writeOptions,
+                const Options& options,
+                const std::shared_ptr<System::TextSystem>& textSystem,
+                const std::shared_ptr<System::ResourceSystem>& resourceSystem,
+                const std::shared_ptr<System::LogSystem>& logSystem)
+            {
+                IWrite::_init(fileInfo, info, writeOptions, textSystem, resourceSystem, logSystem);
+
+                DJV_PRIVATE_PTR();
+                p.options = options;
+                p.uid = createUID();
+                p.threadPool = writeOptions.threadPool ? writeOptions.threadPool : IO::ThreadPool::create(_threadCount);
+                const std::string fileName = fileInfo.getFileName();
+                if (_info.video.empty())
+                {
+                    throw System::File::Error(String::Format("{0}: {1}").
+                        arg(fileName).
+                        arg(_textSystem->getText(DJV_TEXT("error_no_streams"))));
+                }
+
+                // Images that FFmpeg cannot convert directly are converted
+                // with OpenGL first, or with the CPU if there is no OpenGL
+                // context available.
+                p.imageInfo = _info.video[0];
+                if (isConvertNeeded(p.imageInfo))
+                {
+                    p.imageInfo.type = getConvertType(p.imageInfo.type);
+                    p.imageInfo.layout = Image::Layout();
+#if defined(DJV_GL_ES2)
+                    glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_ES_API);
+                    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 2);
+                    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
+#else // DJV_GL_ES2
+                    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+                    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 1);
+                    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+                    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#endif // DJV_GL_ES2
+                    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+                    int env = 0;
+                    if (OS::getIntEnv("DJV_GL_DEBUG", env) && env != 0)
+                    {
+                        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);
+                    }
+                    p.glfwWindow = glfwCreateWindow(100, 100, "djv::AV::FFmpeg::Write", NULL, NULL);
+                    if (!p.glfwWindow)
+                    {
+                        _logSystem->log(
+                            "djv::AV::FFmpeg::Write",
+                            _textSystem->getText(DJV_TEXT("error_glfw_window_creation")),
+                            System::LogLevel::Warning);
+                    }
+                }
+                p.avPixelFormatIn = toFFmpeg(p.imageInfo.type, p.imageInfo.layout.endian);
+                if (AV_PIX_FMT_NONE == p.avPixelFormatIn)
+                {
+                    throw System::File::Error(String::Format("{0}: {1}").
+                        arg(fileName).
+                        arg(_textSystem->getText(DJV_TEXT("error_unsupported_image_type"))));
+                }
+
+                AVCodec* avCodec = findEncoder(p.options.codec);
+                if (!avCodec)
+                {
+                    throw System::File::Error(String::Format("{0}: {1}").
+                        arg(fileName).
+                        arg(_textSystem->getText(DJV_TEXT("error_no_video_codecs"))));
+                }
+
+                // Create the output.
+                int r = avformat_alloc_output_context2(&p.avFormatContext, nullptr, nullptr, fileName.c_str());
+                if (r < 0)
+                {
+                    throw System::File::Error(String::Format("{0}: {1}").
+                        arg(fileName).
+                        arg(getErrorString(r)));
+                }
+                p.avStream = avformat_new_stream(p.avFormatContext, avCodec);
+                if (!p.avStream)
+                {
+                    throw System::File::Error(String::Format("{0}: {1}").
+                        arg(fileName).
+                        arg(_textSystem->getText(DJV_TEXT("error_file_open"))));
+                }
+
+                // Set up the encoder.
+                p.avCodecContext = avcodec_alloc_context3(avCodec);
+                if (!p.avCodecContext)
+                {
+                    throw System::File::Error(String::Format("{0}: {1}").
+                        arg(fileName).
+                        arg(_textSystem->getText(DJV_TEXT("error_file_open"))));
+                }
+                const Math::IntRational speed = _info.videoSpeed.isValid() ? _info.videoSpeed : fromSpeed(getDefaultSpeed());
+                p.avCodecContext->width = p.imageInfo.size.w;
+                p.avCodecContext->height = p.imageInfo.size.h;
+                p.avCodecContext->sample_aspect_ratio = av_d2q(p.imageInfo.pixelAspectRatio, 255);
+                p.avCodecContext->time_base = { speed.getDen(), speed.getNum() };
+                p.avCodecContext->framerate = { speed.getNum(), speed.getDen() };
+                p.avCodecContext->pix_fmt = avCodec->pix_fmts ?
+                    avcodec_find_best_pix_fmt_of_list(
+                        avCodec->pix_fmts,
+                        p.avPixelFormatIn,
+                        Image::getChannelCount(p.imageInfo.type) == 2 || Image::getChannelCount(p.imageInfo.type) == 4,
+                        nullptr) :
+                    p.avPixelFormatIn;
+                if (isYUVFormat(p.avCodecContext->pix_fmt))
+                {
+                    p.avCodecContext->colorspace = toAVColorSpace(p.imageInfo.yuvCoefficients);
+                    p.avCodecContext->color_range = isFullRangeFormat(p.avCodecContext->pix_fmt) ? AVCOL_RANGE_JPEG : AVCOL_RANGE_MPEG;
+                }
+                p.avCodecContext->thread_count = p.options.threadCount;
+                p.avCodecContext->thread_type = toFFmpeg(p.options.threadType);
+                if (p.avFormatContext->oformat->flags & AVFMT_GLOBALHEADER)
+                {
+                    p.avCodecContext->flags |= AV_CODEC_FLAG_GLOBAL_HEADER;
+                }
+                AVDictionary* codecOptions = nullptr;
+                switch (p.options.codec)
+                {
+                case Codec::MPEG4:
+                case Codec::MJPEG:
+                    p.avCodecContext->flags |= AV_CODEC_FLAG_QSCALE;
+                    p.avCodecContext->global_quality = FF_QP2LAMBDA * qscale;
+                    break;
+                case Codec::ProRes:
+                    av_dict_set(&codecOptions, "vendor", "apl0", 0);
+                    break;
+                case Codec::H264:
+                    av_dict_set(&codecOptions, "crf", h264CRF, 0);
+                    break;
+                default: break;
+                }
+                r = avcodec_open2(p.avCodecContext, avCodec, &codecOptions);
+                av_dict_free(&codecOptions);
+                if (r < 0)
+                {
+                    throw System::File::Error(String::Format("{0}: {1}").
+                        arg(fileName).
+                        arg(getErrorString(r)));
+                }
+                r = avcodec_parameters_from_context(p.avStream->codecpar, p.avCodecContext);
+                if (r < 0)
+                {
+                    throw System::File::Error(String::Format("{0}: {1}").
+                        arg(fileName).
+                        arg(getErrorString(r)));
+                }
+                p.avStream->time_base = p.avCodecContext->time_base;
+                p.avStream->avg_frame_rate = p.avCodecContext->framerate;
+                p.avStream->sample_aspect_ratio = p.avCodecContext->sample_aspect_ratio;
+                for (const auto& i : _info.tags.get())
+                {
+                    av_dict_set(&p.avFormatContext->metadata, i.first.c_str(), i.second.c_str(), 0);
+                }
+
+                // Open the file.
+                if (!(p.avFormatContext->oformat->flags & AVFMT_NOFILE))
+                {
+                    r = avio_open(&p.avFormatContext->pb, fileName.c_str(), AVIO_FLAG_WRITE);
+                    if (r < 0)
+                    {
+                        throw System::File::Error(String::Format("{0}: {1}").
+                            arg(fileName).
+                            arg(getErrorString(r)));
+                    }
+                }
+                r = avformat_write_header(p.avFormatContext, nullptr);
+                if (r < 0)
+                {
+                    throw System::File::Error(String::Format("{0}: {1}").
+                        arg(fileName).
+                        arg(getErrorString(r)));
+                }
+                p.avPacket = av_packet_alloc();
+
+                p.running = true;
+                p.convertThread = std::thread(
+                    [this]
+                {
+                    DJV_PRIVATE_PTR();
+                    try
+                    {
+                        if (p.glfwWindow)
+                        {
+                            glfwMakeContextCurrent(p.glfwWindow);
+#if defined(DJV_GL_ES2)
+                            if (!gladLoadGLES2Loader((GLADloadproc)glfwGetProcAddress))
+#else // DJV_GL_ES2
+                            if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+#endif // DJV_GL_ES2
+                            {
+                                throw System::File::Error(_textSystem->getText(DJV_TEXT("error_glad_init")));
+                            }
+                            p.convert = GL::ImageConvert::create(_textSystem, _resourceSystem);
+                        }
+
+                        const auto timeout = System::getTimerValue(System::TimerValue::VeryFast);
+                        int64_t pts = 0;
+                        while (p.running)
+                        {
+                            std::vector<std::shared_ptr<Image::Data> > images;
+                            bool finished = false;
+                            {
+                                std::unique_lock<std::mutex> lock(_mutex, std::try_to_lock);
+                                if (lock.owns_lock())
+                                {
+                                    while (!_videoQueue.isEmpty() && images.size() < _threadCount)
+                                    {
+                                        auto frame = _videoQueue.popFrame();
+                                        images.push_back(frame.data);
+                                    }
+                                    finished = _videoQueue.isEmpty() && _videoQueue.isFinished();
+                                }
+                            }
+                            if (images.size())
+                            {
+                                // There is now room in the queue.
+                                _wake();
+
+                                for (auto image : images)
+                                {
+                                    if (!image)
+                                    {
+                                        continue;
+                                    }
+                                    if (isConvertNeeded(image->getInfo()))
+                                    {
+                                        const Image::Info imageInfo(image->getSize(), getConvertType(image->getType()));
+                                        auto tmp = Image::Data::create(imageInfo);
+                                        tmp->setTags(image->getTags());
+                                        if (p.convert)
+                                        {
+                                            p.convert->process(*image, imageInfo, *tmp);
+                                        }
+                                        else
+                                        {
+                                            if (!p.cpuConvert)
+                                            {
+                                                p.cpuConvert = Image::Convert::create();
+                                            }
+                                            p.cpuConvert->process(*image, imageInfo, *tmp);
+                                        }
+                                        image = tmp;
+                                    }
+
+                                    // Wait for room in the encoder queue.
+                                    std::unique_lock<std::mutex> lock(p.encodeMutex);
+                                    p.encodeCV.wait(
+                                        lock,
+                                        [this]
+                                        {
+                                            return _p->encodeQueue.size() < _threadCount * 2 || !_p->running;
+                                        });
+                                    if (!p.running)
+                                    {
+                                        break;
+                                    }
+                                    auto promise = std::make_shared<std::promise<AVFrame*> >();
+                                    p.encodeQueue.push_back(promise->get_future());
+                                    p.threadPool->addJob(
+                                        p.uid,
+                                        IO::JobPriority::High,
+                                        [this, promise, image, pts]
+                                        {
+                                            try
+                                            {
+                                                promise->set_value(_convert(image, pts));
+                                            }
+                                            catch (const std::exception&)
+                                            {
+                                                promise->set_exception(std::current_exception());
+                                            }
+                                        });
+                                    ++pts;
+                                    p.encodeCV.notify_all();
+                                }
+                            }
+                            else if (finished)
+                            {
+                                break;
+                            }
+                            else
+                            {
+                                std::this_thread::sleep_for(std::chrono::milliseconds(timeout));
+                            }
+                        }
+
+                        p.convert.reset();
+                        p.cpuConvert.reset();
+                    }
+                    catch (const std::exception& e)
+                    {
+                        _logSystem->log("djv::AV::FFmpeg::Write", e.what(), System::LogLevel::Error);
+                        p.running = false;
+                    }
+
+                    {
+                        std::unique_lock<std::mutex> lock(p.encodeMutex);
+                        p.convertFinished = true;
+                    }
+                    p.encodeCV.notify_all();
+                });
+
+                p.encodeThread = std::thread(
+                    [this]
+                {
+                    DJV_PRIVATE_PTR();
+                    try
+                    {
+                        while (p.running)
+                        {
+                            std::future<AVFrame*> future;
+                            {
+                                std::unique_lock<std::mutex> lock(p.encodeMutex);
+                                p.encodeCV.wait(
+                                    lock,
+                                    [this]
+                                    {
+                                        return _p->encodeQueue.size() || _p->convertFinished || !_p->running;
+                                    });
+                                if (p.encodeQueue.empty())
+                                {
+                                    break;
+                                }
+                                future = std::move(p.encodeQueue.front());
+                                p.encodeQueue.pop_front();
+                            }
+                            p.encodeCV.notify_all();
+
+                            AVFrame* avFrame = future.get();
+                            try
+                            {
+                                _encode(avFrame);
+                            }
+                            catch (const std::exception&)
+                            {
+                                av_frame_free(&avFrame);
+                                throw;
+                            }
+                            av_frame_free(&avFrame);
+                        }
+                        if (p.running)
+                        {
+                            // Flush the encoder.
+                            _encode(nullptr);
+                            const int r = av_write_trailer(p.avFormatContext);
+                            if (r < 0)
+                            {
+                                throw System::File::Error(String::Format("{0}: {1}").
+                                    arg(_fileInfo.getFileName()).
+                                    arg(getErrorString(r)));
+                            }
+                        }
+                    }
+                    catch (const std::exception& e)
+                    {
+                        _logSystem->log("djv::AV::FFmpeg::Write", e.what(), System::LogLevel::Error);
+                    }
+
+                    p.running = false;
+                    p.encodeCV.notify_all();
+                    _wake();
+                });
+            }
+
+            Write::Write() :
+                _p(new Private)
+            {}
+
+            Write::~Write()
+            {
+                DJV_PRIVATE_PTR();
+                p.running = false;
+                p.encodeCV.notify_all();
+                if (p.convertThread.joinable())
+                {
+                    p.convertThread.join();
+                }
+                if (p.encodeThread.joinable())
+                {
+                    p.encodeThread.join();
+                }
+
+                // Cancel the conversion jobs that have not started and wait
+                // for the rest.
+                p.threadPool->cancelJobs(p.uid);
+                for (auto& i : p.encodeQueue)
+                {
+                    try
+                    {
+                        AVFrame* avFrame = i.get();
+                        av_frame_free(&avFrame);
+                    }
+                    catch (const std::exception&)
+                    {}
+                }
+                for (auto i : p.swsContexts)
+                {
+                    sws_freeContext(i);
+                }
+                if (p.avPacket)
+                {
+                    av_packet_free(&p.avPacket);
+                }
+                if (p.avCodecContext)
+                {
+                    avcodec_free_context(&p.avCodecContext);
+                }
+                if (p.avFormatContext)
+                {
+                    if (p.avFormatContext->pb)
+                    {
+                        avio_closep(&p.avFormatContext->pb);
+                    }
+                    avformat_free_context(p.avFormatContext);
+                }
+                if (p.glfwWindow)
+                {
+                    glfwDestroyWindow(p.glfwWindow);
+                }
+            }
+
+            std::shared_ptr<Write> Write::create(
+                const System::File::Info& fileInfo,
+                const IO::Info& info,
+                const IO::WriteOptions& writeOptions,
+                const Options& options,
+                const std::shared_ptr<System::TextSystem>& textSystem,
+                const std::shared_ptr<System::ResourceSystem>& resourceSystem,
+                const std::shared_ptr<System::LogSystem>& logSystem)
+            {
+                auto out = std::shared_ptr<Write>(new Write);
+                out->_init(fileInfo, info, writeOptions, options, textSystem, resourceSystem, logSystem);
+                return out;
+            }
+
+            bool Write::isRunning() const
+            {
+                return _p->running;
+            }
+
+            AVFrame* Write::_convert(const std::shared_ptr<Image::Data>& image, int64_t pts)
+            {
+                DJV_PRIVATE_PTR();
+                const Image::Info& info = image->getInfo();
+                AVFrame* avFrame = av_frame_alloc();
+                if (!avFrame)
+                {
+                    throw System::File::Error(String::Format("{0}: {1}").
+                        arg(_fileInfo.getFileName()).
+                        arg(_textSystem->getText(DJV_TEXT("error_file_write"))));
+                }
+                avFrame->format = p.avCodecContext->pix_fmt;
+                avFrame->width = p.avCodecContext->width;
+                avFrame->height = p.avCodecContext->height;
+                avFrame->pts = pts;
+                int r = av_frame_get_buffer(avFrame, 0);
+                if (r < 0)
+                {
+                    av_frame_free(&avFrame);
+                    throw System::File::Error(String::Format("{0}: {1}").
+                        arg(_fileInfo.getFileName()).
+                        arg(getErrorString(r)));
+                }
+
+                SwsContext* swsContext = nullptr;
+                {
+                    std::lock_guard<std::mutex> lock(p.swsMutex);
+                    if (p.swsContexts.size())
+                    {
+                        swsContext = p.swsContexts.back();
+                        p.swsContexts.pop_back();
+                    }
+                }
+                const AVPixelFormat avPixelFormat = toFFmpeg(info.type, info.layout.endian);
+                swsContext = sws_getCachedContext(
+                    swsContext,
+                    info.size.w,
+                    info.size.h,
+                    avPixelFormat,
+                    avFrame->width,
+                    avFrame->height,
+                    static_cast<AVPixelFormat>(avFrame->format),
+                    SWS_BICUBIC,
+                    0,
+                    0,
+                    0);
+                if (!swsContext)
+                {
+                    av_frame_free(&avFrame);
+                    throw System::File::Error(String::Format("{0}: {1}").
+                        arg(_fileInfo.getFileName()).
+                        arg(_textSystem->getText(DJV_TEXT("error_unsupported_image_type"))));
+                }
+                const bool yuvIn = Image::isYUVType(info.type);
+                sws_setColorspaceDetails(
+                    swsContext,
+                    sws_getCoefficients(toSwsColorSpace(yuvIn ? info.yuvCoefficients : p.imageInfo.yuvCoefficients)),
+                    yuvIn ? (Image::YUVRange::Full == info.yuvRange) : 1,
+                    sws_getCoefficients(toSwsColorSpace(p.imageInfo.yuvCoefficients)),
+                    AVCOL_RANGE_JPEG == p.avCodecContext->color_range || !isYUVFormat(p.avCodecContext->pix_fmt),
+                    0,
+                    1 << 16,
+                    1 << 16);
+
+                // Images that are mirrored vertically are converted with a
+                // negative stride.
+                const uint8_t* data[4] = { nullptr, nullptr, nullptr, nullptr };
+                int lineSize[4] = { 0, 0, 0, 0 };
+                for (uint8_t i = 0; i < info.getPlaneCount(); ++i)
+                {
+                    const size_t scanlineByteCount = info.getPlaneScanlineByteCount(i);
+                    data[i] = image->getPlaneData(i);
+                    lineSize[i] = static_cast<int>(scanlineByteCount);
+                    if (info.layout.mirror.y)
+                    {
+                        data[i] += scanlineByteCount * (info.getPlaneSize(i).h - 1);
+                        lineSize[i] = -lineSize[i];
+                    }
+                }
+                sws_scale(
+                    swsContext,
+                    data,
+                    lineSize,
+                    0,
+                    info.size.h,
+                    avFrame->data,
+                    avFrame->linesize);
+
+                {
+                    std::lock_guard<std::mutex> lock(p.swsMutex);
+                    p.swsContexts.push_back(swsContext);
+                }
+                return avFrame;
+            }
+
+            void Write::_encode(AVFrame* avFrame)
+            {
+                DJV_PRIVATE_PTR();
+                int r = avcodec_send_frame(p.avCodecContext, avFrame);
+                if (r < 0)
+                {
+                    throw System::File::Error(String::Format("{0}: {1}").
+                        arg(_fileInfo.getFileName()).
+                        arg(getErrorString(r)));
+                }
+                while (r >= 0)
+                {
+                    r = avcodec_receive_packet(p.avCodecContext, p.avPacket);
+                    if (AVERROR(EAGAIN) == r || AVERROR_EOF == r)
+                    {
+                        break;
+                    }
+                    else if (r < 0)
+                    {
+                        throw System::File::Error(String::Format("{0}: {1}").
+                            arg(_fileInfo.getFileName()).
+                            arg(getErrorString(r)));
+                    }
+                    av_packet_rescale_ts(p.avPacket, p.avCodecContext->time_base, p.avStream->time_base);
+                    p.avPacket->stream_index = p.avStream->index;
+                    r = av_interleaved_write_frame(p.avFormatContext, p.avPacket);
+                    if (r < 0)
+                    {
+                        throw System::File::Error(String::Format("{0}: {1}").
+                            arg(_fileInfo.getFileName()).
+                            arg(getErrorString(r)));
+                    }
+                }
+            }
+
+        } // namespace FFmpeg
+    } // namespace AV
+} // namespace djv
@@ -0,0 +1,537 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAV/FrameCache.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <vector>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace IO
+        {
+            namespace
+            {
+                const Math::Frame::Index bitsPerWord = 64;
+
+                Math::Frame::Index alignDown(Math::Frame::Index value)
+                {
+                    return (value < 0 ? (value - (bitsPerWord - 1)) : value) / bitsPerWord * bitsPerWord;
+                }
+
+                size_t getLowestBit(uint64_t value)
+                {
+                    size_t out = 0;
+                    for (; !(value & 1); value >>= 1, ++out)
+                        ;
+                    return out;
+                }
+
+                size_t getHighestBit(uint64_t value)
+                {
+                    size_t out = 0;
+                    for (value >>= 1; value; value >>= 1, ++out)
+                        ;
+                    return out;
+                }
+
+                //! Frame storage for a media.
+                //!
+                //! The frames are stored in a vector indexed by the frame
+                //! relative to an offset. A bitset marks which entries are
+                //! used since a cached frame may be null (e.g., when the
+                //! frame failed to read).
+                class Frames
+                {
+                public:
+                    size_t getCount() const { return _count; }
+                    size_t getByteCount() const { return _byteCount; }
+                    Math::Frame::Index getFirst() const { return _first; }
+                    Math::Frame::Index getLast() const { return _last; }
+
+                    bool contains(Math::Frame::Index value) const
+                    {
+                        const Math::Frame::Index i = value - _offset;
+                        return i >= 0 &&
+                            i < static_cast<Math::Frame::Index>(_images.size()) &&
+                            ((_bits[i / bitsPerWord] >> (i % bitsPerWord)) & 1);
+                    }
+
+                    const std::shared_ptr<Image::Data>& get(Math::Frame::Index value) const
+                    {
+                        return _images[value - _offset];
+                    }
+
+                    void set(Math::Frame::Index value, const std::shared_ptr<Image::Data>& image)
+                    {
+                        _reserve(value);
+                        const Math::Frame::Index i = value - _offset;
+                        _images[i] = image;
+                        _bits[i / bitsPerWord] |= static_cast<uint64_t>(1) << (i % bitsPerWord);
+                        _byteCount += image ? image->getDataByteCount() : 0;
+                        _first = _count ? std::min(_first, value) : value;
+                        _last = _count ? std::max(_last, value) : value;
+                        ++_count;
+                    }
+
+                    //! Returns the number of bytes that were released.
+                    size_t reset(Math::Frame::Index value)
+                    {
+                        const Math::Frame::Index i = value - _offset;
+                        const size_t out = _images[i] ? _images[i]->getDataByteCount() : 0;
+                        _images[i].reset();
+                        _bits[i / bitsPerWord] &= ~(static_cast<uint64_t>(1) << (i % bitsPerWord));
+                        _byteCount -= out;
+                        --_count;
+                        if (!_count)
+                        {
+                            clear();
+                        }
+                        else if (value == _first)
+                        {
+                            _first = findFirst(value + 1, _last);
+                        }
+                        else if (value == _last)
+                        {
+                            _last = findLast(_first, value - 1);
+                        }
+                        return out;
+                    }
+
+                    //! Find the first frame in the range [min, max].
+                    Math::Frame::Index findFirst(Math::Frame::Index min, Math::Frame::Index max) const
+                    {
+                        min = std::max(min, _first);
+                        max = std::min(max, _last);
+                        if (!_count || min > max)
+                            return Math::Frame::invalidIndex;
+                        const Math::Frame::Index i = min - _offset;
+                        size_t word = i / bitsPerWord;
+                        uint64_t bits = _bits[word] & (~static_cast<uint64_t>(0) << (i % bitsPerWord));
+                        const size_t maxWord = (max - _offset) / bitsPerWord;
+                        while (!bits && word < maxWord)
+                        {
+                            bits = _bits[++word];
+                        }
+                        const Math::Frame::Index out = bits ?
+                            (_offset + word * bitsPerWord + getLowestBit(bits)) :
+                            Math::Frame::invalidIndex;
+                        return out <= max ? out : Math::Frame::invalidIndex;
+                    }
+
+                    //! Find the last frame in the range [min, max].
+                    Math::Frame::Index findLast(Math::Frame::Index min, Math::Frame::Index max) const
+                    {
+                        min = std::max(min, _first);
+                        max = std::min(max, _last);
+                        if (!_count || min > max)
+                            return Math::Frame::invalidIndex;
+                        const Math::Frame::Index i = max - _offset;
+                        size_t word = i / bitsPerWord;
+                        const Math::Frame::Index bit = i % bitsPerWord;
+                        uint64_t bits = _bits[word] &
+                            (bit == bitsPerWord - 1 ?
+                                ~static_cast<uint64_t>(0) :
+                                ((static_cast<uint64_t>(1) << (bit + 1)) - 1));
+                        const size_t minWord = (min - _offset) / bitsPerWord;
+                        while (!bits && word > minWord)
+                        {
+                            bits = _bits[--word];
+                        }
+                        const Math::Frame::Index out = bits ?
+                            (_offset + word * bitsPerWord + getHighestBit(bits)) :
+                            Math::Frame::invalidIndex;
+                        return out != Math::Frame::invalidIndex && out >= min ? out : Math::Frame::invalidIndex;
+                    }
+
+                    void clear()
+                    {
+                        _offset = 0;
+                        std::vector<std::shared_ptr<Image::Data> >().swap(_images);
+                        std::vector<uint64_t>().swap(_bits);
+                        _count = 0;
+                        _byteCount = 0;
+                        _first = 0;
+                        _last = -1;
+                    }
+
+                private:
+                    void _reserve(Math::Frame::Index value)
+                    {
+                        const Math::Frame::Index size = static_cast<Math::Frame::Index>(_images.size());
+                        Math::Frame::Index offset = _offset;
+                        Math::Frame::Index newSize = size;
+                        if (!size)
+                        {
+                            offset = alignDown(value);
+                            newSize = bitsPerWord;
+                        }
+                        else if (value < _offset)
+                        {
+                            // Grow geometrically so that adding frames in
+                            // reverse order is amortized constant time.
+                            offset = alignDown(std::min(value, _offset - size));
+                            newSize = size + (_offset - offset);
+                        }
+                        else if (value >= _offset + size)
+                        {
+                            newSize = std::max(alignDown(value - _offset) + bitsPerWord, size * 2);
+                        }
+                        if (offset == _offset && newSize == size)
+                            return;
+                        std::vector<std::shared_ptr<Image::Data> > images(newSize);
+                        std::vector<uint64_t> bits(newSize / bitsPerWord, 0);
+                        const Math::Frame::Index shift = _offset - offset;
+                        for (Math::Frame::Index i = 0; i < size; ++i)
+                        {
+                            images[shift + i] = std::move(_images[i]);
+                        }
+                        for (size_t i = 0; i < _bits.size(); ++i)
+                        {
+                            bits[shift / bitsPerWord + i] = _bits[i];
+                        }
+                        _offset = offset;
+                        std::swap(images, _images);
+                        std::swap(bits, _bits);
+                    }
+
+                    Math::Frame::Index _offset = 0;
+                    std::vector<std::shared_ptr<Image::Data> > _images;
+                    std::vector<uint64_t> _bits;
+                    size_t _count = 0;
+                    size_t _byteCount = 0;
+                    Math::Frame::Index _first = 0;
+                    Math::Frame::Index _last = -1;
+                };
+
+                struct Media
+                {
+                    float priority = 1.F;
+                    Math::Frame::Index currentFrame = 0;
+                    Math::Frame::Sequence window;
+                    Frames frames;
+                    size_t evictionCount = 0;
+                };
+
+                //! A frame that may be removed from the cache.
+                struct Candidate
+                {
+                    Media* media = nullptr;
+                    Math::Frame::Index frame = Math::Frame::invalidIndex;
+                    int tier = 0;
+                    float score = 0.F;
+
+                    bool isBetter(const Candidate& other) const
+                    {
+                        return !other.media ||
+                            tier < other.tier ||
+                            (tier == other.tier && score > other.score);
+                    }
+                };
+
+                //! Find the frames in the range [min, max] that are furthest
+                //! from the current frame and compare them with the best
+                //! candidate so far.
+                void findCandidate(
+                    Media& media,
+                    Math::Frame::Index min,
+                    Math::Frame::Index max,
+                    int tier,
+                    Candidate& out)
+                {
+                    for (const auto frame : {
+                        media.frames.findFirst(min, max),
+                        media.frames.findLast(min, max) })
+                    {
+                        if (frame != Math::Frame::invalidIndex)
+                        {
+                            Candidate candidate;
+                            candidate.media = &media;
+                            candidate.frame = frame;
+                            candidate.tier = tier;
+                            const float distance = static_cast<float>(std::abs(frame - media.currentFrame) + 1);
+                            candidate.score = media.priority > 0.F ?
+                                (distance / media.priority) :
+                                std::numeric_limits<float>::max();
+                            if (candidate.isBetter(out))
+                            {
+                                out = candidate;
+                            }
+                        }
+                    }
+                }
+
+            } // namespace
+
+            struct FrameCache::Private
+            {
+                size_t maxByteCount = 0;
+                size_t byteCount = 0;
+                size_t count = 0;
+                std::map<Core::UID, Media> media;
+                mutable std::mutex mutex;
+
+                void remove(Media&, Math::Frame::Index);
+                void maxUpdate(Core::UID);
+            };
+
+            FrameCache::FrameCache() :
+                _p(new Private)
+            {}
+
+            FrameCache::~FrameCache()
+            {}
+
+            std::shared_ptr<FrameCache> FrameCache::create()
+            {
+                return std::shared_ptr<FrameCache>(new FrameCache);
+            }
+
+            size_t FrameCache::getMaxByteCount() const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                return p.maxByteCount;
+            }
+
+            size_t FrameCache::getByteCount() const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                return p.byteCount;
+            }
+
+            size_t FrameCache::getCount() const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                return p.count;
+            }
+
+            float FrameCache::getPercentageUsed() const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                return p.maxByteCount > 0 ? (p.byteCount / static_cast<float>(p.maxByteCount) * 100.F) : 0.F;
+            }
+
+            void FrameCache::setMaxByteCount(size_t value)
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                p.maxByteCount = value;
+                p.maxUpdate(0);
+            }
+
+            size_t FrameCache::getByteCount(Core::UID uid) const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                const auto i = p.media.find(uid);
+                return i != p.media.end() ? i->second.frames.getByteCount() : 0;
+            }
+
+            size_t FrameCache::getCount(Core::UID uid) const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                const auto i = p.media.find(uid);
+                return i != p.media.end() ? i->second.frames.getCount() : 0;
+            }
+
+            size_t FrameCache::getEvictionCount(Core::UID uid) const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                const auto i = p.media.find(uid);
+                return i != p.media.end() ? i->second.evictionCount : 0;
+            }
+
+            Math::Frame::Sequence FrameCache::getFrames(Core::UID uid) const
+            {
+                DJV_PRIVATE_PTR();
+                Math::Frame::Sequence out;
+                std::lock_guard<std::mutex> lock(p.mutex);
+                const auto i = p.media.find(uid);
+                if (i != p.media.end())
+                {
+                    // The frames are stored in order so the ranges can be
+                    // built in a single pass.
+                    const auto& frames = i->second.frames;
+                    const Math::Frame::Index last = frames.getLast();
+                    Math::Frame::Index frame = frames.findFirst(frames.getFirst(), last);
+                    while (frame != Math::Frame::invalidIndex)
+                    {
+                        Math::Frame::Index rangeEnd = frame;
+                        while (rangeEnd < last && frames.contains(rangeEnd + 1))
+                        {
+                            ++rangeEnd;
+                        }
+                        out.add(Math::Frame::Range(frame, rangeEnd));
+                        frame = rangeEnd < last ? frames.findFirst(rangeEnd + 1, last) : Math::Frame::invalidIndex;
+                    }
+                }
+                return out;
+            }
+
+            void FrameCache::setPriority(Core::UID uid, float value)
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                p.media[uid].priority = value;
+            }
+
+            void FrameCache::setWindow(Core::UID uid, Math::Frame::Index currentFrame, const Math::Frame::Sequence& window)
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                auto& media = p.media[uid];
+                media.currentFrame = currentFrame;
+                media.window = window;
+            }
+
+            void FrameCache::remove(Core::UID uid)
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                const auto i = p.media.find(uid);
+                if (i != p.media.end())
+                {
+                    p.byteCount -= i->second.frames.getByteCount();
+                    p.count -= i->second.frames.getCount();
+                    p.media.erase(i);
+                }
+            }
+
+            void FrameCache::remove(Core::UID uid, const Math::Frame::Range& range)
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                const auto i = p.media.find(uid);
+                if (i != p.media.end())
+                {
+                    auto& media = i->second;
+                    Math::Frame::Index frame = media.frames.findFirst(range.getMin(), range.getMax());
+                    while (frame != Math::Frame::invalidIndex)
+                    {
+                        p.remove(media, frame);
+                        frame = frame < range.getMax() ?
+                            media.frames.findFirst(frame + 1, range.getMax()) :
+                            Math::Frame::invalidIndex;
+                    }
+                }
+            }
+
+            bool FrameCache::contains(Core::UID uid, Math::Frame::Index frame) const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                const auto i = p.media.find(uid);
+                return i != p.media.end() && i->second.frames.contains(frame);
+            }
+
+            bool FrameCache::get(Core::UID uid, Math::Frame::Index frame, std::shared_ptr<Image::Data>& out) const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                bool found = false;
+                const auto i = p.media.find(uid);
+                if (i != p.media.end() && i->second.frames.contains(frame))
+                {
+                    out = i->second.frames.get(frame);
+                    found = true;
+                }
+                return found;
+            }
+
+            void FrameCache::add(Core::UID uid, Math::Frame::Index frame, const std::shared_ptr<Image::Data>& image)
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                auto& media = p.media[uid];
+                if (media.frames.contains(frame))
+                {
+                    p.remove(media, frame);
+                }
+                media.frames.set(frame, image);
+                p.byteCount += image ? image->getDataByteCount() : 0;
+                ++p.count;
+                p.maxUpdate(uid);
+            }
+
+            void FrameCache::clear(Core::UID uid)
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                const auto i = p.media.find(uid);
+                if (i != p.media.end())
+                {
+                    p.byteCount -= i->second.frames.getByteCount();
+                    p.count -= i->second.frames.getCount();
+                    i->second.frames.clear();
+                }
+            }
+
+            void FrameCache::clear()
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                for (auto& i : p.media)
+                {
+                    i.second.frames.clear();
+                }
+                p.byteCount = 0;
+                p.count = 0;
+            }
+
+            void FrameCache::Private::remove(Media& media, Math::Frame::Index frame)
+            {
+                byteCount -= media.frames.reset(frame);
+                --count;
+            }
+
+            void FrameCache::Private::maxUpdate(Core::UID uid)
+            {
+                while (maxByteCount > 0 && byteCount > maxByteCount)
+                {
+                    // Each media window is a sorted list of ranges, so only
+                    // the first and last cached frames of each range and of
+                    // each gap between the ranges need to be considered.
+                    Candidate candidate;
+                    for (auto& i : media)
+                    {
+                        auto& m = i.second;
+                        if (!m.frames.getCount())
+                            continue;
+                        const bool protect = uid != 0 && i.first == uid;
+                        Math::Frame::Index min = std::numeric_limits<Math::Frame::Index>::min();
+                        for (const auto& range : m.window.getRanges())
+                        {
+                            findCandidate(m, min, range.getMin() - 1, 0, candidate);
+                            if (!protect)
+                            {
+                                findCandidate(m, range.getMin(), range.getMax(), 1, candidate);
+                            }
+                            min = range.getMax() + 1;
+                        }
+                        findCandidate(m, min, std::numeric_limits<Math::Frame::Index>::max(), 0, candidate);
+                    }
+                    if (!candidate.media)
+                        break;
+                    remove(*candidate.media, candidate.frame);
+                    ++candidate.media->evictionCount;
+                }
+            }
+
+        } // namespace IO
+    } // namespace AV
+} // namespace djv
@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvImage/Data.h>
+
+#include <djvMath/FrameNumber.h>
+
+#include <djvCore/UID.h>
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace IO
+        {
+            //! Frame cache shared between media.
+            //!
+            //! The frames for all of the media are stored with a single
+            //! memory budget. When the budget is exceeded frames are removed
+            //! in this order:
+            //! - Frames outside of the media cache windows
+            //! - Frames inside of the media cache windows
+            //!
+            //! Within each group the frame with the largest distance from the
+            //! current frame of its media, divided by the media priority, is
+            //! removed first. Frames inside the window of the media that is
+            //! being added to are never removed to make room for it.
+            //!
+            //! Frames are stored per media in a vector indexed by frame, so
+            //! adding, finding, and removing a frame is constant time.
+            class FrameCache : public std::enable_shared_from_this<FrameCache>
+            {
+                DJV_NON_COPYABLE(FrameCache);
+
+            protected:
+                FrameCache();
+
+            public:
+                ~FrameCache();
+
+                static std::shared_ptr<FrameCache> create();
+
+                //! \name Size
+                ///@{
+
+                //! Get the maximum number of bytes. A value of zero means the
+                //! size is not limited.
+                size_t getMaxByteCount() const;
+                size_t getByteCount() const;
+                size_t getCount() const;
+                float getPercentageUsed() const;
+
+                void setMaxByteCount(size_t);
+
+                ///@}
+
+                //! \name Media
+                ///@{
+
+                size_t getByteCount(Core::UID) const;
+                size_t getCount(Core::UID) const;
+                Math::Frame::Sequence getFrames(Core::UID) const;
+
+                //! Get the number of media frames that have been removed to
+                //! stay within the memory budget.
+                size_t getEvictionCount(Core::UID) const;
+
+                //! Set the media priority. Frames from media with a lower
+                //! priority are removed first.
+                void setPriority(Core::UID, float);
+
+                //! Set the current frame and cache window of the media.
+                void setWindow(Core::UID, Math::Frame::Index currentFrame, const Math::Frame::Sequence& window);
+
+                //! Remove the media and all of its frames.
+                void remove(Core::UID);
+
+                //! Remove the media frames in the given range.
+                void remove(Core::UID, const Math::Frame::Range&);
+
+                ///@}
+
+                //! \name Frames
+                ///@{
+
+                bool contains(Core::UID, Math::Frame::Index) const;
+                bool get(Core::UID, Math::Frame::Index, std::shared_ptr<Image::Data>&) const;
+
+                void add(Core::UID, Math::Frame::Index, const std::shared_ptr<Image::Data>&);
+                void clear(Core::UID);
+                void clear();
+
+                ///@}
+
+            private:
+                DJV_PRIVATE();
+            };
+
+        } // namespace IO
+    } // namespace AV
+} // namespace djv
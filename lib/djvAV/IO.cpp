@@ -6,6 +6,8 @@
 
 #include <djvAV/Speed.h>
 
+#include <djvMath/Math.h>
+
 using namespace djv::Core;
 
 namespace djv
@@ -116,8 +118,77 @@ namespace djv
                 _out(std::max(in, out))
             {}
 
-            Cache::Cache()
-            {}
+            namespace
+            {
+                //! Get the parts of the range that are not in the sequence.
+                std::vector<Math::Frame::Range> subtract(const Math::Frame::Range& range, const Math::Frame::Sequence& sequence)
+                {
+                    std::vector<Math::Frame::Range> out;
+                    Math::Frame::Index frame = range.getMin();
+                    for (const auto& i : sequence.getRanges())
+                    {
+                        if (i.getMax() < frame)
+                            continue;
+                        if (i.getMin() > range.getMax())
+                            break;
+                        if (i.getMin() > frame)
+                        {
+                            out.push_back(Math::Frame::Range(frame, i.getMin() - 1));
+                        }
+                        frame = i.getMax() + 1;
+                    }
+                    if (frame <= range.getMax())
+                    {
+                        out.push_back(Math::Frame::Range(frame, range.getMax()));
+                    }
+                    return out;
+                }
+
+            } // namespace
+
+            Cache::Cache() :
+                _frameCache(FrameCache::create()),
+                _uid(createUID())
+            {
+                _layerUIDs[_layer] = _uid;
+            }
+
+            Cache::~Cache()
+            {
+                for (const auto& i : _layerUIDs)
+                {
+                    _frameCache->remove(i.second);
+                }
+            }
+
+            void Cache::setFrameCache(const std::shared_ptr<FrameCache>& value)
+            {
+                if (!value || value == _frameCache)
+                    return;
+                for (const auto& i : _layerUIDs)
+                {
+                    _frameCache->remove(i.second);
+                }
+                _frameCache = value;
+                _shared = true;
+                _cachedBegin = 0;
+                _cachedEnd = 0;
+                _evictionCount = 0;
+                for (const auto& i : _layerUIDs)
+                {
+                    _frameCache->setWindow(i.second, _currentFrame, _sequence);
+                    _frameCache->setPriority(i.second, _priority);
+                }
+            }
+
+            void Cache::setPriority(float value)
+            {
+                _priority = value;
+                for (const auto& i : _layerUIDs)
+                {
+                    _frameCache->setPriority(i.second, value);
+                }
+            }
 
             void Cache::setMax(size_t value)
             {
@@ -127,39 +198,20 @@ namespace djv
                 _cacheUpdate();
             }
 
+            void Cache::setLayer(size_t value)
+            {
+                if (value == _layer)
+                    return;
+                _layer = value;
+                _uid = _getUID(value);
+                _cachedBegin = 0;
+                _cachedEnd = 0;
+                _evictionCount = _frameCache->getEvictionCount(_uid);
+            }
+
             Math::Frame::Sequence Cache::getFrames() const
             {
-                Math::Frame::Sequence out;
-                std::vector<Math::Frame::Index> frames;
-                for (const auto& i : _cache)
-                {
-                    frames.push_back(i.first);
-                }
-                const size_t size = frames.size();
-                if (size)
-                {
-                    std::sort(frames.begin(), frames.end());
-                    Math::Frame::Number rangeStart = frames[0];
-                    Math::Frame::Number prevFrame = frames[0];
-                    size_t i = 1;
-                    for (; i < size; prevFrame = frames[i], ++i)
-                    {
-                        if (frames[i] != prevFrame + 1)
-                        {
-                            out.add(Math::Frame::Range(rangeStart, prevFrame));
-                            rangeStart = frames[i];
-                        }
-                    }
-                    if (size > 1)
-                    {
-                        out.add(Math::Frame::Range(rangeStart, prevFrame));
-                    }
-                    else
-                    {
-                        out.add(Math::Frame::Range(rangeStart));
-                    }
-                }
-                return out;
+                return _frameCache->getFrames(_uid);
             }
 
             void Cache::setSequenceSize(size_t value)
@@ -194,99 +246,216 @@ namespace djv
                 _cacheUpdate();
             }
 
-            void Cache::add(Math::Frame::Index index, const std::shared_ptr<Image::Data>& image)
-            {
-                _cache[index] = image;
-                _cacheUpdate();
-            }
-
-            void Cache::_cacheUpdate()
+            std::vector<Math::Frame::Index> Cache::getUncachedFrames(
+                size_t count,
+                const std::set<Math::Frame::Index>& pending)
             {
-                const auto range = _inOutPoints.getRange(_sequenceSize);
-                Math::Frame::Index frame = _currentFrame;
-                _sequence = Math::Frame::Sequence();
-                switch (_direction)
+                std::vector<Math::Frame::Index> out;
+                if (!count)
+                    return out;
+
+                // Frames inside of the window may have been removed to make
+                // room for other media.
+                const size_t evictionCount = _frameCache->getEvictionCount(_uid);
+                if (evictionCount != _evictionCount)
                 {
-                case Direction::Forward:
+                    _evictionCount = evictionCount;
+                    _cachedBegin = 0;
+                    _cachedEnd = 0;
+                }
+
+                // Check the frames before the known cached frames.
+                bool cached = true;
+                for (size_t i = 0; i < _cachedBegin && out.size() < count; ++i)
                 {
-                    for (size_t i = 0; i < _readBehind; ++i)
+                    const Math::Frame::Index frame = _getWindowFrame(i);
+                    if (!_frameCache->contains(_uid, frame))
                     {
-                        --frame;
-                        if (frame < range.getMin())
+                        cached = false;
+                        if (pending.find(frame) == pending.end())
                         {
-                            frame = range.getMax();
+                            out.push_back(frame);
                         }
                     }
-                    _sequence.add(Math::Frame::Range(frame));
-                    const Math::Frame::Index first = frame;
-                    for (size_t i = 0; i < _max; ++i)
+                }
+                if (cached)
+                {
+                    _cachedBegin = 0;
+                }
+
+                // Check the frames after the known cached frames, extending
+                // them while they are contiguous. Past the first uncached
+                // frame the number of cached frames that are skipped is
+                // limited, since frames are normally read in order.
+                size_t limit = count + pending.size();
+                for (size_t i = _cachedEnd; i < _windowCount && out.size() < count && limit > 0; ++i)
+                {
+                    const Math::Frame::Index frame = _getWindowFrame(i);
+                    if (_frameCache->contains(_uid, frame))
                     {
-                        ++frame;
-                        if (first == frame)
+                        if (i == _cachedEnd)
                         {
-                            break;
-                        }
-                        if (frame > range.getMax())
-                        {
-                            frame = range.getMin();
-                            if (frame != _sequence.getRanges().back().getMax())
-                            {
-                                _sequence.add(Math::Frame::Range(frame));
-                            }
+                            ++_cachedEnd;
                         }
                         else
                         {
-                            _sequence.add(Math::Frame::Range(frame));
+                            --limit;
                         }
                     }
-                    break;
+                    else if (pending.find(frame) == pending.end())
+                    {
+                        out.push_back(frame);
+                    }
                 }
+                return out;
+            }
+
+            void Cache::add(Math::Frame::Index index, const std::shared_ptr<Image::Data>& image)
+            {
+                if (_shared || _sequence.contains(index))
+                {
+                    _frameCache->add(_uid, index, image);
+                }
+            }
+
+            void Cache::add(Math::Frame::Index index, const std::shared_ptr<Image::Data>& image, size_t layer)
+            {
+                if (_shared || _sequence.contains(index))
+                {
+                    _frameCache->add(_getUID(layer), index, image);
+                }
+            }
+
+            Core::UID Cache::_getUID(size_t layer)
+            {
+                const auto i = _layerUIDs.find(layer);
+                if (i != _layerUIDs.end())
+                {
+                    return i->second;
+                }
+                const Core::UID out = createUID();
+                _layerUIDs[layer] = out;
+                _frameCache->setWindow(out, _currentFrame, _sequence);
+                _frameCache->setPriority(out, _priority);
+                return out;
+            }
+
+            Math::Frame::Index Cache::_getWindowFrame(size_t value) const
+            {
+                const Math::Frame::Index size = _windowRange.getMax() - _windowRange.getMin() + 1;
+                Math::Frame::Index offset = 0;
+                switch (_windowDirection)
+                {
+                case Direction::Forward:
+                    offset = (_windowStart + static_cast<Math::Frame::Index>(value)) % size;
+                    break;
                 case Direction::Reverse:
+                    offset = (_windowStart - static_cast<Math::Frame::Index>(value) % size + size) % size;
+                    break;
+                default: break;
+                }
+                return _windowRange.getMin() + offset;
+            }
+
+            void Cache::_cacheUpdate()
+            {
+                // Find the first frame of the window in read order.
+                const auto range = _inOutPoints.getRange(_sequenceSize);
+                const Math::Frame::Index size = range.getMax() - range.getMin() + 1;
+                const Math::Frame::Index current = Math::clamp(_currentFrame, range.getMin(), range.getMax()) - range.getMin();
+                const Math::Frame::Index readBehind = static_cast<Math::Frame::Index>(_readBehind) % size;
+                const size_t count = std::min(_max + 1, static_cast<size_t>(size));
+                Math::Frame::Index start = 0;
+                switch (_direction)
                 {
-                    for (size_t i = 0; i < _readBehind; ++i)
+                case Direction::Forward: start = (current - readBehind + size) % size; break;
+                case Direction::Reverse: start = (current + readBehind) % size; break;
+                default: break;
+                }
+
+                // Move the known cached frames with the window.
+                if (range == _windowRange && _direction == _windowDirection)
+                {
+                    const Math::Frame::Index delta = Direction::Forward == _direction ?
+                        ((start - _windowStart + size) % size) :
+                        ((_windowStart - start + size) % size);
+                    if (0 == delta)
+                    {}
+                    else if (delta < static_cast<Math::Frame::Index>(_windowCount))
                     {
-                        ++frame;
-                        if (frame > range.getMax())
-                        {
-                            frame = range.getMin();
-                        }
+                        _cachedBegin = _cachedBegin > static_cast<size_t>(delta) ? (_cachedBegin - delta) : 0;
+                        _cachedEnd = _cachedEnd > static_cast<size_t>(delta) ? (_cachedEnd - delta) : 0;
                     }
-                    _sequence.add(Math::Frame::Range(frame));
-                    const Math::Frame::Index first = frame;
-                    for (size_t i = 0; i < _max; ++i)
+                    else if (size - delta < static_cast<Math::Frame::Index>(count))
                     {
-                        --frame;
-                        if (first == frame)
-                        {
-                            break;
-                        }
-                        if (frame < range.getMin())
-                        {
-                            frame = range.getMax();
-                            if (frame != _sequence.getRanges().back().getMin())
-                            {
-                                _sequence.add(Math::Frame::Range(frame));
-                            }
-                        }
-                        else
-                        {
-                            _sequence.add(Math::Frame::Range(frame));
-                        }
+                        _cachedBegin += size - delta;
+                        _cachedEnd += size - delta;
+                    }
+                    else
+                    {
+                        _cachedBegin = 0;
+                        _cachedEnd = 0;
+                    }
+                    _cachedEnd = std::min(_cachedEnd, count);
+                    _cachedBegin = std::min(_cachedBegin, _cachedEnd);
+                }
+                else
+                {
+                    _cachedBegin = 0;
+                    _cachedEnd = 0;
+                }
+                _windowRange = range;
+                _windowDirection = _direction;
+                _windowStart = start;
+                _windowCount = count;
+
+                // Convert the window to a sequence of at most two ranges.
+                Math::Frame::Sequence sequence;
+                switch (_direction)
+                {
+                case Direction::Forward:
+                {
+                    const Math::Frame::Index end = start + count - 1;
+                    sequence.add(Math::Frame::Range(range.getMin() + start, range.getMin() + std::min(end, size - 1)));
+                    if (end >= size)
+                    {
+                        sequence.add(Math::Frame::Range(range.getMin(), range.getMin() + end - size));
+                    }
+                    break;
+                }
+                case Direction::Reverse:
+                {
+                    const Math::Frame::Index end = start - static_cast<Math::Frame::Index>(count) + 1;
+                    sequence.add(Math::Frame::Range(range.getMin() + std::max(end, static_cast<Math::Frame::Index>(0)), range.getMin() + start));
+                    if (end < 0)
+                    {
+                        sequence.add(Math::Frame::Range(range.getMin() + end + size, range.getMax()));
                     }
                     break;
                 }
                 default: break;
                 }
-                auto i = _cache.begin();
-                while (i != _cache.end())
+
+                // Without a shared frame cache only the frames that have left
+                // the window need to be removed.
+                if (!_shared)
                 {
-                    auto j = i;
-                    ++i;
-                    if (!_sequence.contains(j->first))
+                    for (const auto& i : _sequence.getRanges())
                     {
-                        _cache.erase(j);
+                        for (const auto& j : subtract(i, sequence))
+                        {
+                            for (const auto& k : _layerUIDs)
+                            {
+                                _frameCache->remove(k.second, j);
+                            }
+                        }
                     }
                 }
+                _sequence = sequence;
+                for (const auto& i : _layerUIDs)
+                {
+                    _frameCache->setWindow(i.second, _currentFrame, _sequence);
+                }
             }
 
         } // namespace IO
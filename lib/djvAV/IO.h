@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <djvAV/FrameCache.h>
+
 #include <djvImage/Data.h>
 
 #include <djvAudio/Data.h>
@@ -12,6 +14,7 @@
 #include <djvMath/Rational.h>
 
 #include <future>
+#include <map>
 #include <queue>
 #include <set>
 
@@ -193,11 +196,39 @@ namespace djv
             };
 
             //! Frame cache.
+            //!
+            //! The cache keeps the frames inside of a window around the
+            //! current frame. By default the frames are stored privately and
+            //! frames outside of the window are removed, when a shared frame
+            //! cache is set they are kept until its memory budget is needed.
+            //!
+            //! The window is a span on the ring of frames formed by the in/out
+            //! points, so moving the current frame only updates the edges of
+            //! the window.
+            //!
+            //! The frames of each image layer are stored separately, the
+            //! frame functions refer to the current layer.
             class Cache
             {
+                DJV_NON_COPYABLE(Cache);
+
             public:
                 Cache();
-                
+                ~Cache();
+
+                //! \name Storage
+                ///@{
+
+                const std::shared_ptr<FrameCache>& getFrameCache() const;
+
+                //! Set the frame cache used to store the frames. Any frames
+                //! that have already been cached are discarded.
+                void setFrameCache(const std::shared_ptr<FrameCache>&);
+
+                void setPriority(float);
+
+                ///@}
+
                 //! \name Size
                 ///@{
 
@@ -209,6 +240,15 @@ namespace djv
 
                 ///@}
 
+                //! \name Layers
+                ///@{
+
+                size_t getLayer() const;
+
+                void setLayer(size_t);
+
+                ///@}
+
                 //! \name Frames
                 ///@{
 
@@ -224,14 +264,31 @@ namespace djv
                 bool contains(Math::Frame::Index) const;
                 bool get(Math::Frame::Index, std::shared_ptr<Image::Data>&) const;
 
+                //! Get the frames inside of the window that are not cached,
+                //! in the order they should be read.
+                //! \param count The maximum number of frames.
+                //! \param pending Frames that are already being read.
+                std::vector<Math::Frame::Index> getUncachedFrames(
+                    size_t count,
+                    const std::set<Math::Frame::Index>& pending);
+
                 void add(Math::Frame::Index, const std::shared_ptr<Image::Data>&);
+                void add(Math::Frame::Index, const std::shared_ptr<Image::Data>&, size_t layer);
                 void clear();
 
                 ///@}
 
             private:
+                Core::UID _getUID(size_t layer);
+                Math::Frame::Index _getWindowFrame(size_t) const;
                 void _cacheUpdate();
 
+                std::shared_ptr<FrameCache> _frameCache;
+                bool _shared = false;
+                float _priority = 1.F;
+                size_t _layer = 0;
+                Core::UID _uid = 0;
+                std::map<size_t, Core::UID> _layerUIDs;
                 size_t _max = 0;
                 size_t _sequenceSize = 0;
                 InOutPoints _inOutPoints;
@@ -240,7 +297,20 @@ namespace djv
                 //! \todo Should this be configurable?
                 size_t _readBehind = 10;
                 Math::Frame::Sequence _sequence;
-                std::map<Math::Frame::Index, std::shared_ptr<Image::Data> > _cache;
+
+                // The window is stored as the first frame in read order, as
+                // an offset from the start of the range, and a frame count.
+                Math::Frame::Range _windowRange;
+                Direction _windowDirection = Direction::Forward;
+                Math::Frame::Index _windowStart = 0;
+                size_t _windowCount = 0;
+
+                // The frames in the window, in read order, that are known to
+                // be cached. This avoids checking the whole window each time
+                // the uncached frames are requested.
+                size_t _cachedBegin = 0;
+                size_t _cachedEnd = 0;
+                size_t _evictionCount = 0;
             };
 
         } // namespace IO
@@ -120,6 +120,11 @@ namespace djv
                     _out == other._out;
             }
             
+            inline const std::shared_ptr<FrameCache>& Cache::getFrameCache() const
+            {
+                return _frameCache;
+            }
+
             inline size_t Cache::getMax() const
             {
                 return _max;
@@ -127,22 +132,24 @@ namespace djv
             
             inline size_t Cache::getCount() const
             {
-                return _cache.size();
+                return _frameCache->getCount(_uid);
             }
 
             inline size_t Cache::getTotalByteCount() const
             {
                 size_t out = 0;
-                for (const auto& i : _cache)
+                for (const auto& i : _layerUIDs)
                 {
-                    if (i.second)
-                    {
-                        out += i.second->getDataByteCount();
-                    }
+                    out += _frameCache->getByteCount(i.second);
                 }
                 return out;
             }
 
+            inline size_t Cache::getLayer() const
+            {
+                return _layer;
+            }
+
             inline size_t Cache::getReadBehind() const
             {
                 return _readBehind;
@@ -155,23 +162,22 @@ namespace djv
 
             inline bool Cache::contains(Math::Frame::Index value) const
             {
-                return _cache.find(value) != _cache.end();
+                return _frameCache->contains(_uid, value);
             }
 
             inline bool Cache::get(Math::Frame::Index index, std::shared_ptr<Image::Data>& out) const
             {
-                const auto i = _cache.find(index);
-                const bool found = i != _cache.end();
-                if (found)
-                {
-                    out = i->second;
-                }
-                return found;
+                return _frameCache->get(_uid, index, out);
             }
 
             inline void Cache::clear()
             {
-                _cache.clear();
+                for (const auto& i : _layerUIDs)
+                {
+                    _frameCache->clear(i.second);
+                }
+                _cachedBegin = 0;
+                _cachedEnd = 0;
             }
 
         } // namespace IO
@@ -19,6 +19,25 @@ namespace djv
         {
             ReadOptions::ReadOptions()
             {}
+
+            size_t getReduction(const Image::Size& size, const Image::Size& preferredSize, size_t max)
+            {
+                size_t out = 0;
+                if (preferredSize.isValid())
+                {
+                    while (out < max)
+                    {
+                        const size_t scale = static_cast<size_t>(1) << (out + 1);
+                        if ((size.w + scale - 1) / scale < preferredSize.w ||
+                            (size.h + scale - 1) / scale < preferredSize.h)
+                        {
+                            break;
+                        }
+                        ++out;
+                    }
+                }
+                return out;
+            }
             
             void IIO::_init(
                 const System::File::Info& fileInfo,
@@ -31,6 +50,7 @@ namespace djv
                 _textSystem     = textSystem;
                 _resourceSystem = resourceSystem;
                 _fileInfo       = fileInfo;
+                _wakeCallback   = options.wakeCallback;
                 _videoQueue.setMax(options.videoQueueSize);
                 _audioQueue.setMax(options.audioQueueSize);
             }
@@ -44,6 +64,14 @@ namespace djv
                 _threadCount = value;
             }
 
+            void IIO::_wake()
+            {
+                if (_wakeCallback)
+                {
+                    _wakeCallback();
+                }
+            }
+
             void IRead::_init(
                 const System::File::Info& fileInfo,
                 const ReadOptions& options,
@@ -53,6 +81,11 @@ namespace djv
             {
                 IIO::_init(fileInfo, options, textSystem, resourceSystem, logSystem);
                 _options = options;
+                _layer = options.layer;
+                if (options.frameCache)
+                {
+                    _cache.setFrameCache(options.frameCache);
+                }
             }
 
             IRead::~IRead()
@@ -76,6 +109,31 @@ namespace djv
                 _inOutPoints = value;
             }
 
+            void IRead::setLayer(size_t value)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _layer = value;
+            }
+
+            void IRead::setCacheLayers(const std::set<size_t>& value)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _cacheLayers = value;
+            }
+
+            std::future<std::shared_ptr<Image::Data> > IRead::readTile(const Tile&)
+            {
+                std::promise<std::shared_ptr<Image::Data> > promise;
+                promise.set_value(nullptr);
+                return promise.get_future();
+            }
+
+            void IRead::setTilesEnabled(bool value)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _tilesEnabled = value;
+            }
+
             size_t IRead::getCacheByteCount()
             {
                 std::lock_guard<std::mutex> lock(_mutex);
@@ -106,6 +164,12 @@ namespace djv
                 _cacheMaxByteCount = value;
             }
 
+            void IRead::setCachePriority(float value)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _cachePriority = value;
+            }
+
             void IWrite::_init(
                 const System::File::Info& fileInfo,
                 const Info& info,
@@ -5,9 +5,15 @@
 #pragma once
 
 #include <djvAV/IO.h>
+#include <djvAV/ThreadPool.h>
+#include <djvAV/TileCache.h>
+
+#include <djvOCIO/OCIO.h>
 
 #include <djvSystem/FileInfo.h>
 
+#include <functional>
+
 namespace djv
 {
     namespace System
@@ -29,6 +35,12 @@ namespace djv
                 size_t videoQueueSize = 1;
                 //! \todo What is a good default for this value?
                 size_t audioQueueSize = 30;
+
+                //! This callback is called from the I/O threads when new
+                //! information or frames are available, or when there is
+                //! room in the queues. It is normally provided by the I/O
+                //! system to wake up the application event loop.
+                std::function<void(void)> wakeCallback;
             };
 
             //! Base interface for I/O.
@@ -71,10 +83,14 @@ namespace djv
                 ///@}
 
             protected:
+                //! Call the wake up callback. This function is thread safe.
+                void _wake();
+
                 std::shared_ptr<System::LogSystem> _logSystem;
                 std::shared_ptr<System::ResourceSystem> _resourceSystem;
                 std::shared_ptr<System::TextSystem> _textSystem;
                 System::File::Info _fileInfo;
+                std::function<void(void)> _wakeCallback;
                 std::mutex _mutex;
                 VideoQueue _videoQueue;
                 AudioQueue _audioQueue;
@@ -88,8 +104,39 @@ namespace djv
                 
                 size_t layer = 0;
                 std::string colorSpace;
+
+                //! Reuse the header of the first file of a sequence to speed
+                //! up reading the other files, for the plugins that support
+                //! it.
+                bool headerTemplate = true;
+
+                //! The size the images will be displayed at, for example the
+                //! size of a thumbnail. Readers that support it may decode
+                //! smaller images that are still at least this size, while
+                //! the information keeps the full size. An invalid size reads
+                //! the full resolution.
+                Image::Size preferredSize;
+
+                //! The thread pool used for reading. This is normally provided
+                //! by the I/O system, if it is not set the reader will create
+                //! its own.
+                std::shared_ptr<ThreadPool> threadPool;
+
+                //! The frame cache shared between readers. This is normally
+                //! provided by the I/O system, if it is not set the reader
+                //! will cache frames privately.
+                std::shared_ptr<FrameCache> frameCache;
+
+                //! The memory pool used for decoded images. This is normally
+                //! provided by the I/O system, if it is not set the images
+                //! are allocated individually.
+                std::shared_ptr<Image::DataPool> dataPool;
             };
 
+            //! Get the number of times an image can be reduced by half,
+            //! rounding up, while it is still at least the preferred size.
+            size_t getReduction(const Image::Size&, const Image::Size& preferredSize, size_t max);
+
             //! Base interface for readers.
             class IRead : public IIO
             {
@@ -124,6 +171,45 @@ namespace djv
 
                 ///@}
 
+                //! \name Layers
+                ///@{
+
+                //! Get whether the layer can be changed without opening the
+                //! file again.
+                virtual bool canChangeLayer() const;
+
+                //! Set the current layer. This is only supported if
+                //! canChangeLayer() returns true.
+                void setLayer(size_t);
+
+                //! Set the layers that are read and cached together with the
+                //! current layer. This is only supported if canChangeLayer()
+                //! returns true.
+                void setCacheLayers(const std::set<size_t>&);
+
+                ///@}
+
+                //! \name Tiles
+                ///@{
+
+                //! Get whether regions of the images can be read as tiles.
+                virtual bool canReadTiles() const;
+
+                //! Read a tile of the current layer. The tile is read in the
+                //! background and the wake up callback is called when it is
+                //! finished. The image is null if the tile cannot be read.
+                //! This function is thread safe.
+                virtual std::future<std::shared_ptr<Image::Data> > readTile(const Tile&);
+
+                //! Set whether the images are read as tiles. When enabled and
+                //! playback is stopped, the video queue contains the last mip
+                //! level of the images as a placeholder instead of the full
+                //! resolution images, which are read with readTile(). This is
+                //! only supported if canReadTiles() returns true.
+                void setTilesEnabled(bool);
+
+                ///@}
+
                 //! \name Cache
                 ///@{
 
@@ -137,16 +223,25 @@ namespace djv
                 void setCacheEnabled(bool);
                 void setCacheMaxByteCount(size_t);
 
+                //! Set the cache priority. When the shared frame cache is
+                //! full, frames from readers with a lower priority are
+                //! removed first.
+                void setCachePriority(float);
+
                 ///@}
 
             protected:
                 ReadOptions _options;
                 InOutPoints _inOutPoints;
                 Direction _direction = Direction::Forward;
+                size_t _layer = 0;
+                std::set<size_t> _cacheLayers;
                 bool _playback = false;
                 bool _loop = false;
+                bool _tilesEnabled = false;
                 bool _cacheEnabled = false;
                 size_t _cacheMaxByteCount = 0;
+                float _cachePriority = 1.F;
                 size_t _cacheByteCount = 0;
                 Math::Frame::Sequence _cacheSequence;
                 Math::Frame::Sequence _cachedFrames;
@@ -157,6 +252,18 @@ namespace djv
             struct WriteOptions : IOOptions
             {
                 std::string colorSpace;
+
+                //! Color space conversion that is applied to the images
+                //! before they are written, using the current OpenColorIO
+                //! configuration. This is supported by the image sequence
+                //! writers, and does not require OpenGL. Images without
+                //! color channels are converted to RGB or RGBA.
+                OCIO::Convert colorSpaceConvert;
+
+                //! The thread pool used by writers that process frames in
+                //! parallel. This is normally provided by the I/O system, if
+                //! it is not set the writer will create its own.
+                std::shared_ptr<ThreadPool> threadPool;
             };
 
             //! Base interface for writers.
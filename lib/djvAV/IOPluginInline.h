@@ -28,6 +28,16 @@ namespace djv
                 return  _audioQueue;
             }
 
+            inline bool IRead::canChangeLayer() const
+            {
+                return false;
+            }
+
+            inline bool IRead::canReadTiles() const
+            {
+                return false;
+            }
+
             inline bool IRead::hasCache() const
             {
                 return false;
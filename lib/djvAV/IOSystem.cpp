@@ -31,10 +31,14 @@
 
 #include <djvGL/GLFWSystem.h>
 
+#include <djvImage/DataPool.h>
+
 #include <djvSystem/Context.h>
 #include <djvSystem/File.h>
 #include <djvSystem/TextSystem.h>
 
+#include <djvCore/Memory.h>
+#include <djvCore/OS.h>
 #include <djvCore/StringFormat.h>
 #include <djvCore/String.h>
 
@@ -46,6 +50,13 @@ namespace djv
     {
         namespace IO
         {
+            namespace
+            {
+                const size_t threadCountDefault = 4;
+                const size_t frameCacheMaxByteCountDefault = 4 * Memory::gigabyte;
+
+            } // namespace
+
             struct IOSystem::Private
             {
                 std::shared_ptr<System::TextSystem> textSystem;
@@ -53,6 +64,10 @@ namespace djv
                 std::map<std::string, std::shared_ptr<IPlugin> > plugins;
                 std::set<std::string> sequenceExtensions;
                 std::set<std::string> nonSequenceExtensions;
+                std::shared_ptr<ThreadPool> threadPool;
+                std::shared_ptr<FrameCache> frameCache;
+                std::shared_ptr<Image::DataPool> dataPool;
+                std::function<void(void)> wakeCallback;
             };
 
             void IOSystem::_init(const std::shared_ptr<System::Context>& context)
@@ -67,6 +82,26 @@ namespace djv
 
                 p.optionsChanged = Observer::ValueSubject<bool>::create();
 
+                p.threadPool = ThreadPool::create(threadCountDefault);
+                p.frameCache = FrameCache::create();
+                p.frameCache->setMaxByteCount(frameCacheMaxByteCountDefault);
+                p.dataPool = Image::DataPool::create();
+                int hugePages = 0;
+                if (OS::getIntEnv("DJV_HUGE_PAGES", hugePages) && hugePages != 0)
+                {
+                    p.dataPool->setHugePages(true);
+                    _log("Huge pages enabled by DJV_HUGE_PAGES");
+                }
+
+                auto contextWeak = std::weak_ptr<System::Context>(context);
+                p.wakeCallback = [contextWeak]
+                {
+                    if (auto context = contextWeak.lock())
+                    {
+                        context->wake();
+                    }
+                };
+
                 p.plugins[Cineon::pluginName] = Cineon::Plugin::create(context);
                 p.plugins[DPX::pluginName] = DPX::Plugin::create(context);
                 p.plugins[IFF::pluginName] = IFF::Plugin::create(context);
@@ -182,6 +217,31 @@ namespace djv
                 return _p->optionsChanged;
             }
 
+            size_t IOSystem::getThreadCount() const
+            {
+                return _p->threadPool->getThreadCount();
+            }
+
+            void IOSystem::setThreadCount(size_t value)
+            {
+                _p->threadPool->setThreadCount(value);
+            }
+
+            const std::shared_ptr<ThreadPool>& IOSystem::getThreadPool() const
+            {
+                return _p->threadPool;
+            }
+
+            const std::shared_ptr<FrameCache>& IOSystem::getFrameCache() const
+            {
+                return _p->frameCache;
+            }
+
+            const std::shared_ptr<Image::DataPool>& IOSystem::getDataPool() const
+            {
+                return _p->dataPool;
+            }
+
             const std::set<std::string>& IOSystem::getSequenceExtensions() const
             {
                 return _p->sequenceExtensions;
@@ -218,11 +278,28 @@ namespace djv
             {
                 DJV_PRIVATE_PTR();
                 std::shared_ptr<IRead> out;
+                ReadOptions readOptions = options;
+                if (!readOptions.threadPool)
+                {
+                    readOptions.threadPool = p.threadPool;
+                }
+                if (!readOptions.frameCache)
+                {
+                    readOptions.frameCache = p.frameCache;
+                }
+                if (!readOptions.dataPool)
+                {
+                    readOptions.dataPool = p.dataPool;
+                }
+                if (!readOptions.wakeCallback)
+                {
+                    readOptions.wakeCallback = p.wakeCallback;
+                }
                 for (const auto& i : p.plugins)
                 {
                     if (i.second->canRead(fileInfo))
                     {
-                        out = i.second->read(fileInfo, options);
+                        out = i.second->read(fileInfo, readOptions);
                         break;
                     }
                 }
@@ -252,11 +329,20 @@ namespace djv
             {
                 DJV_PRIVATE_PTR();
                 std::shared_ptr<IWrite> out;
+                WriteOptions writeOptions = options;
+                if (!writeOptions.wakeCallback)
+                {
+                    writeOptions.wakeCallback = p.wakeCallback;
+                }
+                if (!writeOptions.threadPool)
+                {
+                    writeOptions.threadPool = p.threadPool;
+                }
                 for (const auto& i : p.plugins)
                 {
                     if (i.second->canWrite(fileInfo, info))
                     {
-                        out = i.second->write(fileInfo, info, options);
+                        out = i.second->write(fileInfo, info, writeOptions);
                         break;
                     }
                 }
@@ -49,6 +49,29 @@ namespace djv
 
                 std::shared_ptr<Core::Observer::IValueSubject<bool> > observeOptionsChanged() const;
 
+                ///@}
+
+                //! \name Threads
+                ///@{
+
+                size_t getThreadCount() const;
+
+                void setThreadCount(size_t);
+
+                //! Get the thread pool shared by the readers.
+                const std::shared_ptr<ThreadPool>& getThreadPool() const;
+
+                ///@}
+
+                //! \name Cache
+                ///@{
+
+                //! Get the frame cache shared by the readers.
+                const std::shared_ptr<FrameCache>& getFrameCache() const;
+
+                //! Get the image data pool shared by the readers.
+                const std::shared_ptr<Image::DataPool>& getDataPool() const;
+
                 ///@}
                 
                 //! \name Sequences
@@ -71,7 +71,14 @@ namespace djv
 
             private:
                 class File;
-                IO::Info _open(const std::string&, const std::shared_ptr<File>&);
+                std::shared_ptr<File> _getFile();
+                void _releaseFile(const std::shared_ptr<File>&);
+                IO::Info _open(
+                    const std::string&,
+                    const std::shared_ptr<File>&,
+                    const Image::Size& preferredSize = Image::Size());
+
+                DJV_PRIVATE();
             };
                 
             //! JPEG writer.
@@ -12,6 +12,8 @@
 #include <djvCore/StringFormat.h>
 #include <djvCore/String.h>
 
+#include <mutex>
+
 using namespace djv::Core;
 
 namespace djv
@@ -55,7 +57,14 @@ namespace djv
                 JPEGErrorStruct        jpegError;
             };
 
-            Read::Read()
+            struct Read::Private
+            {
+                std::mutex mutex;
+                std::vector<std::shared_ptr<File> > files;
+            };
+
+            Read::Read() :
+                _p(new Private)
             {}
 
             Read::~Read()
@@ -77,8 +86,10 @@ namespace djv
 
             IO::Info Read::_readInfo(const std::string& fileName)
             {
-                auto f = File::create();
-                return _open(fileName, f);
+                auto f = _getFile();
+                const auto out = _open(fileName, f);
+                _releaseFile(f);
+                return out;
             }
 
             namespace
@@ -117,13 +128,13 @@ namespace djv
             std::shared_ptr<Image::Data> Read::_readImage(const std::string& fileName)
             {
                 // Open the file.
-                auto f = File::create();
-                const auto info = _open(fileName, f);
+                auto f = _getFile();
+                const auto info = _open(fileName, f, _options.preferredSize);
 
                 // Read the file.
-                auto out = Image::Data::create(info.video[0]);
+                auto out = Image::Data::create(info.video[0], _options.dataPool);
                 out->setPluginName(pluginName);
-                for (uint16_t y = 0; y < info.video[0].size.h; ++y)
+                for (uint32_t y = 0; y < info.video[0].size.h; ++y)
                 {
                     if (!jpegScanline(&f->jpeg, out->getData(y), &f->jpegError))
                     {
@@ -160,9 +171,45 @@ namespace djv
                         System::LogLevel::Warning);
                 }
 
+                _releaseFile(f);
                 return out;
             }
 
+            std::shared_ptr<Read::File> Read::_getFile()
+            {
+                DJV_PRIVATE_PTR();
+                {
+                    std::lock_guard<std::mutex> lock(p.mutex);
+                    if (!p.files.empty())
+                    {
+                        auto out = p.files.back();
+                        p.files.pop_back();
+                        return out;
+                    }
+                }
+                return File::create();
+            }
+
+            void Read::_releaseFile(const std::shared_ptr<File>& f)
+            {
+                // Keep the decompression context so that it can be re-used
+                // by the next file, this avoids re-allocating the libjpeg
+                // memory pools for every frame of a sequence.
+                DJV_PRIVATE_PTR();
+                if (f->jpegInit)
+                {
+                    jpeg_abort_decompress(&f->jpeg);
+                }
+                if (f->f)
+                {
+                    fclose(f->f);
+                    f->f = nullptr;
+                }
+                f->jpegError.messages.clear();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                p.files.push_back(f);
+            }
+
             namespace
             {
                 bool jpegInit(
@@ -180,6 +227,7 @@ namespace djv
                 bool jpegOpen(
                     FILE*                   f,
                     jpeg_decompress_struct* jpeg,
+                    const Image::Size&      preferredSize,
                     JPEGErrorStruct*        error)
                 {
                     if (::setjmp(error->jump))
@@ -192,6 +240,15 @@ namespace djv
                     {
                         return false;
                     }
+
+                    // Let the DCT scaling decode a smaller image, libjpeg
+                    // supports scaling by 1/2, 1/4, and 1/8.
+                    const size_t reduction = IO::getReduction(
+                        Image::Size(jpeg->image_width, jpeg->image_height),
+                        preferredSize,
+                        3);
+                    jpeg->scale_num = 1;
+                    jpeg->scale_denom = 1 << reduction;
                     if (!jpeg_start_decompress(jpeg))
                     {
                         return false;
@@ -201,24 +258,30 @@ namespace djv
 
             } // namespace
 
-            IO::Info Read::_open(const std::string& fileName, const std::shared_ptr<File>& f)
+            IO::Info Read::_open(
+                const std::string& fileName,
+                const std::shared_ptr<File>& f,
+                const Image::Size& preferredSize)
             {
-                f->jpeg.err = jpeg_std_error(&f->jpegError.pub);
-                f->jpegError.pub.error_exit = djvJPEGError;
-                f->jpegError.pub.emit_message = djvJPEGWarning;
-                if (!jpegInit(&f->jpeg, &f->jpegError))
+                if (!f->jpegInit)
                 {
-                    std::vector<std::string> messages;
-                    messages.push_back(String::Format("{0}: {1}").
-                        arg(fileName).
-                        arg(_textSystem->getText(DJV_TEXT("error_file_open"))));
-                    for (const auto& i : f->jpegError.messages)
+                    f->jpeg.err = jpeg_std_error(&f->jpegError.pub);
+                    f->jpegError.pub.error_exit = djvJPEGError;
+                    f->jpegError.pub.emit_message = djvJPEGWarning;
+                    if (!jpegInit(&f->jpeg, &f->jpegError))
                     {
-                        messages.push_back(i);
+                        std::vector<std::string> messages;
+                        messages.push_back(String::Format("{0}: {1}").
+                            arg(fileName).
+                            arg(_textSystem->getText(DJV_TEXT("error_file_open"))));
+                        for (const auto& i : f->jpegError.messages)
+                        {
+                            messages.push_back(i);
+                        }
+                        throw System::File::Error(String::join(messages, ' '));
                     }
-                    throw System::File::Error(String::join(messages, ' '));
+                    f->jpegInit = true;
                 }
-                f->jpegInit = true;
                 f->f = System::File::fopen(fileName, "rb");
                 if (!f->f)
                 {
@@ -226,7 +289,7 @@ namespace djv
                         arg(fileName).
                         arg(_textSystem->getText(DJV_TEXT("error_file_open"))));
                 }
-                if (!jpegOpen(f->f, &f->jpeg, &f->jpegError))
+                if (!jpegOpen(f->f, &f->jpeg, preferredSize, &f->jpegError))
                 {
                     std::vector<std::string> messages;
                     messages.push_back(String::Format("{0}: {1}").
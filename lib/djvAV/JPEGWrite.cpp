@@ -191,6 +191,15 @@ namespace djv
                 case Image::Type::RGBA_U32:
                 case Image::Type::RGBA_F16:
                 case Image::Type::RGBA_F32: out = Image::Type::RGB_U8; break;
+                case Image::Type::YUV_420P_U8:
+                case Image::Type::YUV_422P_U8:
+                case Image::Type::YUV_444P_U8:
+                case Image::Type::YUV_420P_U10:
+                case Image::Type::YUV_422P_U10:
+                case Image::Type::YUV_444P_U10:
+                case Image::Type::YUV_420P_U16:
+                case Image::Type::YUV_422P_U16:
+                case Image::Type::YUV_444P_U16: out = Image::Type::RGB_U8; break;
                 default: break;
                 }
                 return out;
@@ -238,8 +247,8 @@ namespace djv
                 }
 
                 // Write the file.
-                const uint16_t h = image->getHeight();
-                for (uint16_t y = 0; y < h; ++y)
+                const uint32_t h = image->getHeight();
+                for (uint32_t y = 0; y < h; ++y)
                 {
                     if (!jpegScanline(&f->jpeg, image->getData(y), &f->jpegError))
                     {
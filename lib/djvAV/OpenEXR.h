@@ -168,12 +168,28 @@ namespace djv
                     const std::shared_ptr<System::ResourceSystem>&,
                     const std::shared_ptr<System::LogSystem>&);
 
+                bool canChangeLayer() const override;
+                bool canReadTiles() const override;
+
             protected:
                 IO::Info _readInfo(const std::string& fileName) override;
                 std::shared_ptr<Image::Data> _readImage(const std::string& fileName) override;
+                std::vector<std::shared_ptr<Image::Data> > _readImages(
+                    const std::string& fileName,
+                    const std::vector<size_t>& layers) override;
+                std::shared_ptr<Image::Data> _readRegion(
+                    const std::string& fileName,
+                    size_t layer,
+                    const Math::BBox2i&,
+                    uint8_t level) override;
 
             private:
                 struct File;
+                std::shared_ptr<Image::Data> _readReduced(
+                    const std::string& fileName,
+                    File&,
+                    const IO::Info&,
+                    size_t layer);
                 IO::Info _open(const std::string&, File&);
 
                 DJV_PRIVATE();
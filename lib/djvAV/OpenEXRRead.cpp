@@ -13,7 +13,13 @@
 #include <ImfChannelList.h>
 #include <ImfHeader.h>
 #include <ImfInputFile.h>
+#include <ImfPreviewImage.h>
 #include <ImfRgbaYca.h>
+#include <ImfTiledInputFile.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
 
 using namespace djv::Core;
 
@@ -23,13 +29,20 @@ namespace djv
     {
         namespace OpenEXR
         {
+            namespace
+            {
+                //! \todo Should this be configurable?
+                const int scanlineChunkSize = 256;
+
+            } // namespace
+
 #if defined(DJV_MMAP)
             struct MemoryMappedIStream::Private
             {
-                System::File::IO f;
-                uint64_t         size    = 0;
-                uint64_t         pos     = 0;
-                char*            p       = nullptr;
+                std::shared_ptr<System::File::IO> f;
+                uint64_t                          size = 0;
+                uint64_t                          pos  = 0;
+                char*                             p    = nullptr;
             };
 
             MemoryMappedIStream::MemoryMappedIStream(const char fileName[]) :
@@ -37,9 +50,10 @@ namespace djv
                 _p(new Private)
             {
                 DJV_PRIVATE_PTR();
-                p.f.open(fileName, System::File::Mode::Read);
-                p.size = p.f.getSize();
-                p.p = (char*)(p.f.mmapP());
+                p.f = System::File::IO::create();
+                p.f->open(fileName, System::File::Mode::Read);
+                p.size = p.f->getSize();
+                p.p = (char*)(p.f->mmapP());
             }
 
             MemoryMappedIStream::~MemoryMappedIStream()
@@ -98,6 +112,7 @@ namespace djv
                 Math::BBox2i                         intersectedWindow;
                 std::vector<OpenEXR::Layer>          layers;
                 bool                                 fast              = false;
+                bool                                 subsampled        = false;
             };
 
             struct Read::Private
@@ -134,79 +149,485 @@ namespace djv
                 return _open(fileName, f);
             }
 
+            bool Read::canChangeLayer() const
+            {
+                return true;
+            }
+
+            bool Read::canReadTiles() const
+            {
+                return true;
+            }
+
             std::shared_ptr<Image::Data> Read::_readImage(const std::string& fileName)
+            {
+                return _readImages(fileName, { _options.layer })[0];
+            }
+
+            std::vector<std::shared_ptr<Image::Data> > Read::_readImages(
+                const std::string& fileName,
+                const std::vector<size_t>& layers)
             {
                 File f;
                 IO::Info info = _open(fileName, f);
-                Image::Info imageInfo = info.video[std::min(_options.layer, info.video.size() - 1)];
-                std::shared_ptr<Image::Data> out = Image::Data::create(imageInfo);
-                out->setPluginName(pluginName);
-                out->setTags(info.tags);
-                const size_t channels = Image::getChannelCount(imageInfo.type);
-                const size_t channelByteCount = Image::getByteCount(getDataType(imageInfo.type));
-                const size_t cb = channels * channelByteCount;
-                const size_t scb = imageInfo.size.w * channels * channelByteCount;
+
+                // Read a smaller image for thumbnails if possible.
+                if (_options.preferredSize.isValid() && 1 == layers.size())
+                {
+                    if (auto image = _readReduced(fileName, f, info, std::min(layers[0], info.video.size() - 1)))
+                    {
+                        return { image };
+                    }
+                }
+
+                // Create an image for each layer. All of the layers are read
+                // from the file together with a single frame buffer.
+                std::vector<std::shared_ptr<Image::Data> > out;
+                std::vector<size_t> layerIndices;
+                std::vector<size_t> reads;
+                for (const auto i : layers)
+                {
+                    const size_t layer = std::min(i, info.video.size() - 1);
+                    const auto j = std::find(layerIndices.begin(), layerIndices.end(), layer);
+                    if (j != layerIndices.end())
+                    {
+                        out.push_back(out[j - layerIndices.begin()]);
+                    }
+                    else
+                    {
+                        auto image = Image::Data::create(info.video[layer], _options.dataPool);
+                        image->setPluginName(pluginName);
+                        image->setTags(info.tags);
+                        out.push_back(image);
+                        reads.push_back(out.size() - 1);
+                    }
+                    layerIndices.push_back(layer);
+                }
+
                 if (f.fast)
                 {
                     Imf::FrameBuffer frameBuffer;
-                    for (size_t c = 0; c < channels; ++c)
+                    for (const auto i : reads)
                     {
-                        const std::string& name = f.layers[_options.layer].channels[c].name;
-                        const glm::ivec2& sampling = f.layers[_options.layer].channels[c].sampling;
-                        frameBuffer.insert(
-                            name.c_str(),
-                            Imf::Slice(
-                                toImf(Image::getDataType(imageInfo.type)),
-                                (char*)out->getData() + (c * channelByteCount),
-                                cb,
-                                scb,
-                                sampling.x,
-                                sampling.y,
-                                0.F));
+                        const auto& layer = f.layers[layerIndices[i]];
+                        const Image::Info& imageInfo = out[i]->getInfo();
+                        const size_t channels = Image::getChannelCount(imageInfo.type);
+                        const size_t channelByteCount = Image::getByteCount(getDataType(imageInfo.type));
+                        const size_t cb = channels * channelByteCount;
+                        const size_t scb = imageInfo.size.w * cb;
+                        for (size_t c = 0; c < channels; ++c)
+                        {
+                            frameBuffer.insert(
+                                layer.channels[c].name.c_str(),
+                                Imf::Slice(
+                                    toImf(Image::getDataType(imageInfo.type)),
+                                    (char*)out[i]->getData() + (c * channelByteCount),
+                                    cb,
+                                    scb,
+                                    layer.channels[c].sampling.x,
+                                    layer.channels[c].sampling.y,
+                                    0.F));
+                        }
                     }
                     f.f->setFrameBuffer(frameBuffer);
                     f.f->readPixels(f.displayWindow.min.y, f.displayWindow.max.y);
                 }
+                else if (f.intersectedWindow.w() <= 0 || f.intersectedWindow.h() <= 0)
+                {
+                    // The data window is outside of the display window.
+                    for (const auto i : reads)
+                    {
+                        out[i]->zero();
+                    }
+                }
+                else if (!f.subsampled)
+                {
+                    // Clear the areas outside of the data window.
+                    const int intersectedX = f.intersectedWindow.min.x - f.displayWindow.min.x;
+                    const int intersectedY = f.intersectedWindow.min.y - f.displayWindow.min.y;
+                    for (const auto i : reads)
+                    {
+                        const Image::Info& imageInfo = out[i]->getInfo();
+                        const size_t cb = Image::getByteCount(imageInfo.type);
+                        const size_t scb = imageInfo.size.w * cb;
+                        const size_t intersectedScb = f.intersectedWindow.w() * cb;
+                        for (int y = 0; y < imageInfo.size.h; ++y)
+                        {
+                            uint8_t* p = out[i]->getData() + y * scb;
+                            if (y < intersectedY || y >= intersectedY + f.intersectedWindow.h())
+                            {
+                                memset(p, 0, scb);
+                            }
+                            else
+                            {
+                                memset(p, 0, intersectedX * cb);
+                                memset(p + intersectedX * cb + intersectedScb, 0, scb - intersectedX * cb - intersectedScb);
+                            }
+                        }
+                    }
+
+                    Imf::FrameBuffer frameBuffer;
+                    if (f.dataWindow.min.x >= f.displayWindow.min.x && f.dataWindow.max.x <= f.displayWindow.max.x)
+                    {
+                        // The data window fits horizontally inside the display
+                        // window, so the intersected scanlines can be read
+                        // directly into the images with a single call.
+                        for (const auto i : reads)
+                        {
+                            const auto& layer = f.layers[layerIndices[i]];
+                            const Image::Info& imageInfo = out[i]->getInfo();
+                            const size_t channels = Image::getChannelCount(imageInfo.type);
+                            const size_t channelByteCount = Image::getByteCount(getDataType(imageInfo.type));
+                            const size_t cb = channels * channelByteCount;
+                            const size_t scb = imageInfo.size.w * cb;
+                            const ptrdiff_t offset =
+                                static_cast<ptrdiff_t>(f.displayWindow.min.x) * static_cast<ptrdiff_t>(cb) +
+                                static_cast<ptrdiff_t>(f.displayWindow.min.y) * static_cast<ptrdiff_t>(scb);
+                            for (size_t c = 0; c < channels; ++c)
+                            {
+                                frameBuffer.insert(
+                                    layer.channels[c].name.c_str(),
+                                    Imf::Slice(
+                                        toImf(Image::getDataType(imageInfo.type)),
+                                        (char*)out[i]->getData() - offset + (c * channelByteCount),
+                                        cb,
+                                        scb,
+                                        1,
+                                        1,
+                                        0.F));
+                            }
+                        }
+                        f.f->setFrameBuffer(frameBuffer);
+                        f.f->readPixels(f.intersectedWindow.min.y, f.intersectedWindow.max.y);
+                    }
+                    else
+                    {
+                        // Read chunks of scanlines into a buffer for each
+                        // layer and copy the intersected pixels into the
+                        // images.
+                        std::vector<std::vector<char> > bufs(reads.size());
+                        for (size_t j = 0; j < reads.size(); ++j)
+                        {
+                            const size_t cb = Image::getByteCount(out[reads[j]]->getInfo().type);
+                            bufs[j].resize(scanlineChunkSize * f.dataWindow.w() * cb);
+                        }
+                        const int dataX = f.intersectedWindow.min.x - f.dataWindow.min.x;
+                        for (int y = f.intersectedWindow.min.y; y <= f.intersectedWindow.max.y; y += scanlineChunkSize)
+                        {
+                            const int chunkMax = std::min(y + scanlineChunkSize - 1, f.intersectedWindow.max.y);
+                            for (size_t j = 0; j < reads.size(); ++j)
+                            {
+                                const auto& layer = f.layers[layerIndices[reads[j]]];
+                                const Image::Info& imageInfo = out[reads[j]]->getInfo();
+                                const size_t channels = Image::getChannelCount(imageInfo.type);
+                                const size_t channelByteCount = Image::getByteCount(getDataType(imageInfo.type));
+                                const size_t cb = channels * channelByteCount;
+                                const size_t bufScb = f.dataWindow.w() * cb;
+                                const ptrdiff_t offset =
+                                    static_cast<ptrdiff_t>(f.dataWindow.min.x) * static_cast<ptrdiff_t>(cb) +
+                                    static_cast<ptrdiff_t>(y) * static_cast<ptrdiff_t>(bufScb);
+                                for (size_t c = 0; c < channels; ++c)
+                                {
+                                    frameBuffer.insert(
+                                        layer.channels[c].name.c_str(),
+                                        Imf::Slice(
+                                            toImf(Image::getDataType(imageInfo.type)),
+                                            bufs[j].data() - offset + (c * channelByteCount),
+                                            cb,
+                                            bufScb,
+                                            1,
+                                            1,
+                                            0.F));
+                                }
+                            }
+                            f.f->setFrameBuffer(frameBuffer);
+                            f.f->readPixels(y, chunkMax);
+                            for (size_t j = 0; j < reads.size(); ++j)
+                            {
+                                const Image::Info& imageInfo = out[reads[j]]->getInfo();
+                                const size_t cb = Image::getByteCount(imageInfo.type);
+                                const size_t scb = imageInfo.size.w * cb;
+                                const size_t bufScb = f.dataWindow.w() * cb;
+                                for (int i = y; i <= chunkMax; ++i)
+                                {
+                                    memcpy(
+                                        out[reads[j]]->getData() + (i - f.displayWindow.min.y) * scb + intersectedX * cb,
+                                        bufs[j].data() + (i - y) * bufScb + dataX * cb,
+                                        f.intersectedWindow.w() * cb);
+                                }
+                            }
+                        }
+                    }
+                }
                 else
                 {
                     Imf::FrameBuffer frameBuffer;
-                    std::vector<char> buf(f.dataWindow.w() * cb);
-                    for (int c = 0; c < channels; ++c)
+                    std::vector<std::vector<char> > bufs(reads.size());
+                    for (size_t j = 0; j < reads.size(); ++j)
+                    {
+                        const auto& layer = f.layers[layerIndices[reads[j]]];
+                        const Image::Info& imageInfo = out[reads[j]]->getInfo();
+                        const size_t channels = Image::getChannelCount(imageInfo.type);
+                        const size_t channelByteCount = Image::getByteCount(getDataType(imageInfo.type));
+                        const size_t cb = channels * channelByteCount;
+                        bufs[j].resize(f.dataWindow.w() * cb);
+                        for (size_t c = 0; c < channels; ++c)
+                        {
+                            frameBuffer.insert(
+                                layer.channels[c].name.c_str(),
+                                Imf::Slice(
+                                    toImf(Image::getDataType(imageInfo.type)),
+                                    bufs[j].data() - (f.dataWindow.min.x * cb) + (c * channelByteCount),
+                                    cb,
+                                    0,
+                                    layer.channels[c].sampling.x,
+                                    layer.channels[c].sampling.y,
+                                    0.F));
+                        }
+                    }
+                    f.f->setFrameBuffer(frameBuffer);
+                    for (int y = f.displayWindow.min.y; y <= f.displayWindow.max.y; ++y)
+                    {
+                        const bool intersected = y >= f.intersectedWindow.min.y && y <= f.intersectedWindow.max.y;
+                        if (intersected)
+                        {
+                            f.f->readPixels(y, y);
+                        }
+                        for (size_t j = 0; j < reads.size(); ++j)
+                        {
+                            const Image::Info& imageInfo = out[reads[j]]->getInfo();
+                            const size_t cb = Image::getByteCount(imageInfo.type);
+                            const size_t scb = imageInfo.size.w * cb;
+                            uint8_t* p = out[reads[j]]->getData() + ((y - f.displayWindow.min.y) * scb);
+                            uint8_t* end = p + scb;
+                            if (intersected)
+                            {
+                                size_t size = (f.intersectedWindow.min.x - f.displayWindow.min.x) * cb;
+                                memset(p, 0, size);
+                                p += size;
+                                size = f.intersectedWindow.w() * cb;
+                                memcpy(
+                                    p,
+                                    bufs[j].data() + std::max(f.displayWindow.min.x - f.dataWindow.min.x, 0) * cb,
+                                    size);
+                                p += size;
+                            }
+                            memset(p, 0, end - p);
+                        }
+                    }
+                }
+                return out;
+            }
+
+            std::shared_ptr<Image::Data> Read::_readReduced(
+                const std::string& fileName,
+                File& f,
+                const IO::Info& info,
+                size_t layer)
+            {
+                std::shared_ptr<Image::Data> out;
+                const Imf::Header& header = f.f->header();
+                const Image::Size& preferredSize = _options.preferredSize;
+                if (header.hasTileDescription() &&
+                    header.tileDescription().mode != Imf::ONE_LEVEL &&
+                    f.fast)
+                {
+                    // Find the smallest mipmap level that is still at least
+                    // the preferred size.
+#if defined(DJV_MMAP)
+                    MemoryMappedIStream s(fileName.c_str());
+                    Imf::TiledInputFile tf(s);
+#else // DJV_MMAP
+                    Imf::TiledInputFile tf(fileName.c_str());
+#endif // DJV_MMAP
+                    int level = 0;
+                    while (level + 1 < tf.numXLevels() &&
+                        level + 1 < tf.numYLevels() &&
+                        static_cast<uint32_t>(tf.levelWidth(level + 1)) >= preferredSize.w &&
+                        static_cast<uint32_t>(tf.levelHeight(level + 1)) >= preferredSize.h)
+                    {
+                        ++level;
+                    }
+                    if (level > 0)
+                    {
+                        Image::Info imageInfo = info.video[layer];
+                        imageInfo.size.w = tf.levelWidth(level);
+                        imageInfo.size.h = tf.levelHeight(level);
+                        out = Image::Data::create(imageInfo, _options.dataPool);
+                        const size_t channels = Image::getChannelCount(imageInfo.type);
+                        const size_t channelByteCount = Image::getByteCount(getDataType(imageInfo.type));
+                        const size_t cb = channels * channelByteCount;
+                        const size_t scb = imageInfo.size.w * cb;
+                        const Imath::Box2i dataWindow = tf.dataWindowForLevel(level, level);
+                        const ptrdiff_t offset =
+                            static_cast<ptrdiff_t>(dataWindow.min.x) * static_cast<ptrdiff_t>(cb) +
+                            static_cast<ptrdiff_t>(dataWindow.min.y) * static_cast<ptrdiff_t>(scb);
+                        Imf::FrameBuffer frameBuffer;
+                        for (size_t c = 0; c < channels; ++c)
+                        {
+                            frameBuffer.insert(
+                                f.layers[layer].channels[c].name.c_str(),
+                                Imf::Slice(
+                                    toImf(Image::getDataType(imageInfo.type)),
+                                    (char*)out->getData() - offset + (c * channelByteCount),
+                                    cb,
+                                    scb,
+                                    1,
+                                    1,
+                                    0.F));
+                        }
+                        tf.setFrameBuffer(frameBuffer);
+                        tf.readTiles(0, tf.numXTiles(level) - 1, 0, tf.numYTiles(level) - 1, level, level);
+                    }
+                }
+                else if (header.hasPreviewImage() && 0 == layer)
+                {
+                    // Use the preview image, converting the gamma corrected
+                    // values to linear.
+                    const Imf::PreviewImage& preview = header.previewImage();
+                    if (preview.width() >= preferredSize.w &&
+                        preview.height() >= preferredSize.h &&
+                        preview.width() < info.video[layer].size.w)
+                    {
+                        std::array<half, 256> lut;
+                        for (size_t i = 0; i < lut.size(); ++i)
+                        {
+                            lut[i] = powf(i / 255.F, 2.2F);
+                        }
+                        Image::Info imageInfo(preview.width(), preview.height(), Image::Type::RGBA_F16);
+                        imageInfo.pixelAspectRatio = info.video[layer].pixelAspectRatio;
+                        out = Image::Data::create(imageInfo, _options.dataPool);
+                        const Imf::PreviewRgba* in = preview.pixels();
+                        half* p = reinterpret_cast<half*>(out->getData());
+                        const size_t pixelCount = preview.width() * preview.height();
+                        for (size_t i = 0; i < pixelCount; ++i, ++in, p += 4)
+                        {
+                            p[0] = lut[in->r];
+                            p[1] = lut[in->g];
+                            p[2] = lut[in->b];
+                            p[3] = in->a / 255.F;
+                        }
+                    }
+                }
+                if (out)
+                {
+                    out->setPluginName(pluginName);
+                    out->setTags(info.tags);
+                }
+                return out;
+            }
+
+            std::shared_ptr<Image::Data> Read::_readRegion(
+                const std::string& fileName,
+                size_t layer,
+                const Math::BBox2i& window,
+                uint8_t level)
+            {
+                std::shared_ptr<Image::Data> out;
+                File f;
+                const IO::Info info = _open(fileName, f);
+                layer = std::min(layer, info.video.size() - 1);
+                const Imf::Header& header = f.f->header();
+                const bool tiled = header.hasTileDescription();
+                if (!f.fast || (level > 0 && (!tiled || Imf::ONE_LEVEL == header.tileDescription().mode)))
+                {
+                    return out;
+                }
+
+                Image::Info imageInfo = info.video[layer];
+                imageInfo.size = Image::Size(window.w(), window.h());
+                const auto& channels = f.layers[layer].channels;
+                const size_t channelByteCount = Image::getByteCount(getDataType(imageInfo.type));
+                const size_t cb = channels.size() * channelByteCount;
+                const size_t scb = imageInfo.size.w * cb;
+                auto getFrameBuffer = [&imageInfo, &channels, channelByteCount, cb](char* p, size_t yStride)
+                {
+                    Imf::FrameBuffer frameBuffer;
+                    for (size_t c = 0; c < channels.size(); ++c)
                     {
-                        const std::string& name = f.layers[_options.layer].channels[c].name;
-                        const glm::ivec2& sampling = f.layers[_options.layer].channels[c].sampling;
                         frameBuffer.insert(
-                            name.c_str(),
+                            channels[c].name.c_str(),
                             Imf::Slice(
                                 toImf(Image::getDataType(imageInfo.type)),
-                                buf.data() - (f.dataWindow.min.x * cb) + (c * channelByteCount),
+                                p + (c * channelByteCount),
                                 cb,
-                                0,
-                                sampling.x,
-                                sampling.y,
+                                yStride,
+                                1,
+                                1,
                                 0.F));
                     }
-                    f.f->setFrameBuffer(frameBuffer);
-                    for (int y = f.displayWindow.min.y; y <= f.displayWindow.max.y; ++y)
+                    return frameBuffer;
+                };
+
+                if (tiled)
+                {
+                    // Read the tiles that overlap the window into a buffer
+                    // and copy the pixels in the window.
+#if defined(DJV_MMAP)
+                    MemoryMappedIStream s(fileName.c_str());
+                    Imf::TiledInputFile tf(s);
+#else // DJV_MMAP
+                    Imf::TiledInputFile tf(fileName.c_str());
+#endif // DJV_MMAP
+                    if (level > 0)
                     {
-                        uint8_t* p = out->getData() + ((y - f.displayWindow.min.y) * scb);
-                        uint8_t* end = p + scb;
-                        if (y >= f.intersectedWindow.min.y && y <= f.intersectedWindow.max.y)
+                        const Image::Size levelSize = IO::getLevelSize(info.video[layer].size, level);
+                        if (level >= tf.numXLevels() ||
+                            level >= tf.numYLevels() ||
+                            static_cast<uint32_t>(tf.levelWidth(level)) != levelSize.w ||
+                            static_cast<uint32_t>(tf.levelHeight(level)) != levelSize.h)
+                        {
+                            return out;
+                        }
+                    }
+                    const int tileWidth = tf.tileXSize();
+                    const int tileHeight = tf.tileYSize();
+                    const int tx0 = window.min.x / tileWidth;
+                    const int tx1 = window.max.x / tileWidth;
+                    const int ty0 = window.min.y / tileHeight;
+                    const int ty1 = window.max.y / tileHeight;
+                    const size_t bufScb = (tx1 - tx0 + 1) * tileWidth * cb;
+                    std::vector<char> buf((ty1 - ty0 + 1) * tileHeight * bufScb);
+                    const Imath::Box2i dataWindow = tf.dataWindowForLevel(level, level);
+                    const ptrdiff_t offset =
+                        static_cast<ptrdiff_t>(dataWindow.min.x + tx0 * tileWidth) * static_cast<ptrdiff_t>(cb) +
+                        static_cast<ptrdiff_t>(dataWindow.min.y + ty0 * tileHeight) * static_cast<ptrdiff_t>(bufScb);
+                    tf.setFrameBuffer(getFrameBuffer(buf.data() - offset, bufScb));
+                    tf.readTiles(tx0, tx1, ty0, ty1, level, level);
+                    out = Image::Data::create(imageInfo);
+                    const int bufX = window.min.x - tx0 * tileWidth;
+                    const int bufY = window.min.y - ty0 * tileHeight;
+                    for (uint32_t y = 0; y < imageInfo.size.h; ++y)
+                    {
+                        memcpy(out->getData(y), buf.data() + (bufY + y) * bufScb + bufX * cb, scb);
+                    }
+                }
+                else
+                {
+                    // Read chunks of scanlines into a buffer and copy the
+                    // pixels in the window.
+                    const int chunkSize = std::min(scanlineChunkSize, window.h());
+                    const size_t bufScb = f.dataWindow.w() * cb;
+                    std::vector<char> buf(chunkSize * bufScb);
+                    out = Image::Data::create(imageInfo);
+                    for (int y = window.min.y; y <= window.max.y; y += chunkSize)
+                    {
+                        const int chunkMax = std::min(y + chunkSize - 1, window.max.y);
+                        const ptrdiff_t offset =
+                            static_cast<ptrdiff_t>(f.dataWindow.min.x) * static_cast<ptrdiff_t>(cb) +
+                            static_cast<ptrdiff_t>(f.dataWindow.min.y + y) * static_cast<ptrdiff_t>(bufScb);
+                        f.f->setFrameBuffer(getFrameBuffer(buf.data() - offset, bufScb));
+                        f.f->readPixels(f.dataWindow.min.y + y, f.dataWindow.min.y + chunkMax);
+                        for (int i = y; i <= chunkMax; ++i)
                         {
-                            size_t size = (f.intersectedWindow.min.x - f.displayWindow.min.x) * cb;
-                            memset(p, 0, size);
-                            p += size;
-                            size = f.intersectedWindow.w() * cb;
-                            f.f->readPixels(y, y);
                             memcpy(
-                                p,
-                                buf.data() + std::max(f.displayWindow.min.x - f.dataWindow.min.x, 0) * cb,
-                                size);
-                            p += size;
+                                out->getData(i - window.min.y),
+                                buf.data() + (i - y) * bufScb + window.min.x * cb,
+                                scb);
                         }
-                        memset(p, 0, end - p);
                     }
                 }
+                out->setPluginName(pluginName);
                 return out;
             }
 
@@ -244,7 +665,10 @@ namespace djv
                     const auto& layer = f.layers[i];
                     const glm::ivec2 sampling(layer.channels[0].sampling.x, layer.channels[0].sampling.y);
                     if (sampling.x != 1 || sampling.y != 1)
+                    {
                         f.fast = false;
+                        f.subsampled = true;
+                    }
                     auto& info = out.video[i];
                     info.name = layer.name;
                     info.size.w = f.displayWindow.w();
@@ -78,6 +78,15 @@ namespace djv
                 case Image::Type::RGBA_U16: out = Image::Type::RGBA_F16; break;
                 case Image::Type::RGBA_U32:
                 case Image::Type::RGBA_F32: out = value; break;
+                case Image::Type::YUV_420P_U8:
+                case Image::Type::YUV_422P_U8:
+                case Image::Type::YUV_444P_U8:
+                case Image::Type::YUV_420P_U10:
+                case Image::Type::YUV_422P_U10:
+                case Image::Type::YUV_444P_U10:
+                case Image::Type::YUV_420P_U16:
+                case Image::Type::YUV_422P_U16:
+                case Image::Type::YUV_444P_U16: out = Image::Type::RGB_F16; break;
                 default: break;
                 }
                 return out;
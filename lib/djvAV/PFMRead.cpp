@@ -56,12 +56,15 @@ namespace djv
 #if defined(DJV_MMAP)
                 out = Image::Data::create(imageInfo, io);
 #else // DJV_MMAP
-                out = Image::Data::create(imageInfo);
+                out = Image::Data::create(imageInfo, _options.dataPool);
                 io->read(out->getData(), out->getDataByteCount());
 #endif // DJV_MMAP
 
                 if(scale - 1 > 1E-6)
                 {
+#if defined(DJV_MMAP)
+                    out->detach(_options.dataPool);
+#endif // DJV_MMAP
                     auto* data = reinterpret_cast<float*>(out->getData());
                     const size_t floats = out->getDataByteCount() / sizeof(float);
                     for (size_t i = 0; i < floats; ++i)
@@ -98,8 +98,8 @@ namespace djv
                     png_structp png,
                     png_infop*  pngInfo,
                     png_infop*  pngInfoEnd,
-                    uint16_t&   width,
-                    uint16_t&   height,
+                    uint32_t&   width,
+                    uint32_t&   height,
                     uint8_t&    channels,
                     uint8_t&    bitDepth)
                 {
@@ -209,9 +209,9 @@ namespace djv
                 const auto info = _open(fileName, f);
 
                 // Read the file.
-                auto out = Image::Data::create(info.video[0]);
+                auto out = Image::Data::create(info.video[0], _options.dataPool);
                 out->setPluginName(pluginName);
-                for (uint16_t y = 0; y < info.video[0].size.h; ++y)
+                for (uint32_t y = 0; y < info.video[0].size.h; ++y)
                 {
                     if (!pngScanline(f->png, out->getData(y)))
                     {
@@ -260,8 +260,8 @@ namespace djv
                         arg(fileName).
                         arg(_textSystem->getText(DJV_TEXT("error_file_open"))));
                 }
-                uint16_t width    = 0;
-                uint16_t height   = 0;
+                uint32_t width    = 0;
+                uint32_t height   = 0;
                 uint8_t  channels = 0;
                 uint8_t  bitDepth = 0;
                 if (!pngOpen(f->f, f->png, &f->pngInfo, &f->pngInfoEnd, width, height, channels, bitDepth))
@@ -56,11 +56,11 @@ namespace djv
                 {
                 case Data::ASCII:
                 {
-                    out = Image::Data::create(imageInfo);
+                    out = Image::Data::create(imageInfo, _options.dataPool);
                     out->setPluginName(pluginName);
                     const size_t channelCount = Image::getChannelCount(imageInfo.type);
                     const size_t bitDepth = Image::getBitDepth(imageInfo.type);
-                    for (uint16_t y = 0; y < imageInfo.size.h; ++y)
+                    for (uint32_t y = 0; y < imageInfo.size.h; ++y)
                     {
                         readASCII(io, out->getData(y), imageInfo.size.w * channelCount, bitDepth);
                     }
@@ -68,14 +68,12 @@ namespace djv
                 }
                 case Data::Binary:
                 {
-                    if (imageInfo.layout.endian != Memory::getEndian())
-                    {
-                        imageInfo.layout.endian = Memory::getEndian();
-                    }
+                    // The data is kept in the file endian, the image layout
+                    // is used to convert it when it is uploaded.
 #if defined(DJV_MMAP)
                     out = Image::Data::create(imageInfo, io);
 #else // DJV_MMAP
-                    out = Image::Data::create(imageInfo);
+                    out = Image::Data::create(imageInfo, _options.dataPool);
                     io->read(out->getData(), out->getDataByteCount());
 #endif // DJV_MMAP
                     out->setPluginName(pluginName);
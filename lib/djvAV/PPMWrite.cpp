@@ -69,6 +69,15 @@ namespace djv
                 case Image::Type::RGBA_U32:
                 case Image::Type::RGBA_F16:
                 case Image::Type::RGBA_F32: out = Image::Type::RGB_U16; break;
+                case Image::Type::YUV_420P_U8:
+                case Image::Type::YUV_422P_U8:
+                case Image::Type::YUV_444P_U8: out = Image::Type::RGB_U8; break;
+                case Image::Type::YUV_420P_U10:
+                case Image::Type::YUV_422P_U10:
+                case Image::Type::YUV_444P_U10:
+                case Image::Type::YUV_420P_U16:
+                case Image::Type::YUV_422P_U16:
+                case Image::Type::YUV_444P_U16: out = Image::Type::RGB_U16; break;
                 default: break;
                 }
                 return out;
@@ -117,7 +126,7 @@ namespace djv
                         info.size.w,
                         Image::getChannelCount(info.type),
                         Image::getBitDepth(info.type)));
-                    for (uint16_t y = 0; y < info.size.h; ++y)
+                    for (uint32_t y = 0; y < info.size.h; ++y)
                     {
                         const size_t size = writeASCII(
                             image->getData(y),
@@ -130,7 +130,7 @@ namespace djv
                 std::shared_ptr<Image::Data> out;
                 auto io = System::File::IO::create();
                 const auto info = _open(fileName, io);
-                out = Image::Data::create(info.video[0]);
+                out = Image::Data::create(info.video[0], _options.dataPool);
                 out->setPluginName(pluginName);
 
                 const size_t w = info.video[0].size.w;
@@ -139,7 +139,7 @@ namespace djv
                 const size_t bytes = Image::getByteCount(Image::getDataType(info.video[0].type));
                 const Image::DataType dataType = Image::getDataType(info.video[0].type);
                 uint8_t* dataP = out->getData();
-                for (uint16_t y = 0; y < h; ++y, dataP += w * channels * bytes)
+                for (uint32_t y = 0; y < h; ++y, dataP += w * channels * bytes)
                 {
                     io->setPos(_rleOffset[y]);
                     for (int c = 0; c < channels; ++c)
@@ -4,9 +4,14 @@
 
 #include <djvAV/SequenceIO.h>
 
+#include <djvOCIO/ImageConvert.h>
+
 #include <djvGL/ImageConvert.h>
 
+#include <djvImage/Convert.h>
+
 #include <djvAV/Speed.h>
+#include <djvAV/ThreadPool.h>
 
 #include <djvSystem/Context.h>
 #include <djvSystem/File.h>
@@ -16,6 +21,7 @@
 #include <djvSystem/TextSystem.h>
 #include <djvSystem/Timer.h>
 
+#include <djvCore/Memory.h>
 #include <djvCore/OS.h>
 #include <djvCore/String.h>
 #include <djvCore/StringFormat.h>
@@ -38,25 +44,40 @@ namespace djv
                 //! \todo Should this be configurable?
                 const double infoTimeout = 0.5;
 
+                //! \todo Should this be configurable?
+                const size_t tileCacheMaxByteCount = 256 * Memory::megabyte;
+
             } // namespace
 
             struct ISequenceRead::Future
             {
                 Math::Frame::Number frame = Math::Frame::invalid;
-                std::shared_ptr<Image::Data> image;
+                std::vector<size_t> layers;
+                std::vector<std::shared_ptr<Image::Data> > images;
             };
 
             struct ISequenceRead::Private
             {
+                Core::UID uid = 0;
+                std::shared_ptr<ThreadPool> threadPool;
                 Math::Frame::Number frame = Math::Frame::invalid;
                 std::promise<Info> infoPromise;
                 std::vector<std::future<Future> > cacheFutures;
+                std::set<Math::Frame::Index> cachePending;
                 std::condition_variable queueCV;
                 Direction direction = Direction::Forward;
                 Math::Frame::Number seek = Math::Frame::invalid;
+                size_t layer = 0;
+                std::vector<size_t> layers;
                 std::thread thread;
                 std::atomic<bool> running;
                 std::chrono::steady_clock::time_point infoTimer;
+                Info info;
+                std::shared_ptr<TileCache> tileCache;
+                size_t tileLayer = 0;
+                std::vector<std::future<void> > tileFutures;
+                bool tileFinished = false;
+                bool tiles = false;
             };
 
             void ISequenceRead::_init(
@@ -68,6 +89,14 @@ namespace djv
             {
                 IRead::_init(fileInfo, options, textSystem, resourceSystem, logSystem);
                 _speed = fromSpeed(getDefaultSpeed());
+                _p->uid = createUID();
+                _p->layer = options.layer;
+                _p->layers.push_back(options.layer);
+                _cache.setLayer(options.layer);
+                _p->threadPool = options.threadPool ? options.threadPool : ThreadPool::create(_threadCount);
+                _p->tileCache = TileCache::create();
+                _p->tileCache->setMaxByteCount(tileCacheMaxByteCount);
+                _p->tileLayer = options.layer;
                 _p->running = true;
                 _p->thread = std::thread(
                     [this]
@@ -99,7 +128,12 @@ namespace djv
                     {
                         info = _readInfo(fileName);
                         info.fileName = _fileInfo.getFileName();
+                        {
+                            std::lock_guard<std::mutex> lock(_mutex);
+                            p.info = info;
+                        }
                         p.infoPromise.set_value(info);
+                        _wake();
                     }
                     catch (const std::exception&)
                     {
@@ -112,6 +146,7 @@ namespace djv
                             }
                             p.running = false;
                             p.infoPromise.set_exception(std::current_exception());
+                            _wake();
                         }
                         catch (const std::exception& e)
                         {
@@ -129,24 +164,76 @@ namespace djv
                         bool playback = false;
                         bool loop = false;
                         InOutPoints inOutPoints;
+                        bool tiles = false;
                         bool cacheEnabled = false;
                         size_t cacheMaxByteCount = 0;
+                        float cachePriority = 1.F;
+                        size_t layer = _options.layer;
+                        std::set<size_t> cacheLayers;
                         {
                             std::lock_guard<std::mutex> lock(_mutex);
+                            if (canChangeLayer())
+                            {
+                                layer = _layer;
+                                cacheLayers = _cacheLayers;
+                            }
                             threadCount = _threadCount;
                             playback = _playback;
                             loop = _loop;
                             inOutPoints = _inOutPoints;
+                            tiles = _tilesEnabled && !_playback && canReadTiles();
                             cacheEnabled = _cacheEnabled;
                             cacheMaxByteCount = _cacheMaxByteCount;
+                            cachePriority = _cachePriority;
                         }
+                        _cache.setPriority(cachePriority);
                         if (!cacheEnabled)
                         {
                             _cache.clear();
                         }
-                        if (info.video.size() && _options.layer < info.video.size())
+
+                        // Update the layers. When the current layer changes
+                        // the queued frames are read again.
+                        p.layers.clear();
+                        p.layers.push_back(layer);
+                        for (const auto i : cacheLayers)
                         {
-                            const size_t dataByteCount = info.video[_options.layer].getDataByteCount();
+                            if (i != layer && i < info.video.size())
+                            {
+                                p.layers.push_back(i);
+                            }
+                        }
+                        if (layer != p.layer)
+                        {
+                            p.layer = layer;
+                            _cache.setLayer(layer);
+                            std::lock_guard<std::mutex> lock(_mutex);
+                            if (Math::Frame::invalid == p.seek && _videoQueue.getCount())
+                            {
+                                p.seek = _videoQueue.getFrame().frame;
+                            }
+                        }
+
+                        // When tiles are enabled or disabled the queued
+                        // frames are read again, either as placeholders or
+                        // as full resolution images.
+                        if (tiles != p.tiles)
+                        {
+                            p.tiles = tiles;
+                            std::lock_guard<std::mutex> lock(_mutex);
+                            if (Math::Frame::invalid == p.seek && _videoQueue.getCount())
+                            {
+                                p.seek = _videoQueue.getFrame().frame;
+                            }
+                        }
+
+                        if (info.video.size() && layer < info.video.size())
+                        {
+                            size_t dataByteCount = 0;
+                            for (const auto i : p.layers)
+                            {
+                                dataByteCount += info.video[i].getDataByteCount();
+                            }
                             _cache.setMax(dataByteCount ? (cacheMaxByteCount / dataByteCount) : 0);
                             _cache.setSequenceSize(info.videoSequence.getFrameCount());
                             _cache.setInOutPoints(inOutPoints);
@@ -199,13 +286,15 @@ namespace djv
                         size_t read = 0;
                         if (queueCount > 0)
                         {
-                            read = _readQueue(queueCount, loop, cacheEnabled);
+                            read = _readQueue(queueCount, loop, cacheEnabled, tiles);
                         }
 
-                        // Fill the cache.
-                        if (cacheEnabled)
+                        // Fill the cache. The cache is not filled while
+                        // tiles are enabled, so that full resolution images
+                        // are not read when only a part of them is viewed.
+                        if (cacheEnabled && !tiles)
                         {
-                            _readCache(playback ? (threadCount / 2) : threadCount, inOutPoints);
+                            _readCache(playback ? (threadCount / 2) : threadCount);
                         }
 
                         // Update information.
@@ -226,6 +315,31 @@ namespace djv
                         }
                     }
 
+                    // Cancel any jobs that have not started and wait for the rest.
+                    std::vector<std::future<void> > tileFutures;
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        p.tileFinished = true;
+                        tileFutures = std::move(p.tileFutures);
+                    }
+                    p.threadPool->cancelJobs(p.uid);
+                    for (auto& i : p.cacheFutures)
+                    {
+                        if (i.valid())
+                        {
+                            i.wait();
+                        }
+                    }
+                    for (auto& i : tileFutures)
+                    {
+                        if (i.valid())
+                        {
+                            i.wait();
+                        }
+                    }
+                    p.cacheFutures.clear();
+                    p.cachePending.clear();
+
                     p.running = false;
                 });
             }
@@ -263,6 +377,109 @@ namespace djv
                 return _sequence.getFrameCount() > 1;
             }
 
+            std::future<std::shared_ptr<Image::Data> > ISequenceRead::readTile(const Tile& tile)
+            {
+                DJV_PRIVATE_PTR();
+                auto promise = std::make_shared<std::promise<std::shared_ptr<Image::Data> > >();
+                auto out = promise->get_future();
+                std::shared_ptr<Image::Data> image;
+                std::string fileName;
+                size_t layer = _options.layer;
+                Image::Size size;
+                Math::BBox2i window;
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (canChangeLayer())
+                {
+                    layer = _layer;
+                }
+                if (layer != p.tileLayer)
+                {
+                    p.tileLayer = layer;
+                    p.tileCache->clear();
+                }
+                if (canReadTiles() &&
+                    !p.tileFinished &&
+                    layer < p.info.video.size() &&
+                    !p.tileCache->get(tile, image))
+                {
+                    size = p.info.video[layer].size;
+                    window = getTileWindow(tile, getLevelSize(size, tile.level));
+                    if (window.w() > 0 && window.h() > 0)
+                    {
+                        if (System::File::Type::Sequence == _fileInfo.getType())
+                        {
+                            const auto& sequence = _fileInfo.getSequence();
+                            if (tile.frame >= 0 && tile.frame < static_cast<Math::Frame::Index>(sequence.getFrameCount()))
+                            {
+                                fileName = _fileInfo.getFileName(sequence.getFrame(tile.frame));
+                            }
+                        }
+                        else
+                        {
+                            fileName = _fileInfo.getFileName();
+                        }
+                    }
+                }
+                if (fileName.empty())
+                {
+                    promise->set_value(image);
+                    return out;
+                }
+
+                // Remove the finished jobs.
+                auto i = p.tileFutures.begin();
+                while (i != p.tileFutures.end())
+                {
+                    if (i->valid() &&
+                        i->wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+                    {
+                        i = p.tileFutures.erase(i);
+                    }
+                    else
+                    {
+                        ++i;
+                    }
+                }
+
+                auto finished = std::make_shared<std::promise<void> >();
+                p.tileFutures.push_back(finished->get_future());
+                p.threadPool->addJob(
+                    p.uid,
+                    JobPriority::High,
+                    [this, promise, finished, tile, fileName, layer, size, window]
+                    {
+                        DJV_PRIVATE_PTR();
+                        std::shared_ptr<Image::Data> image;
+                        try
+                        {
+                            image = _readRegion(fileName, layer, window, tile.level);
+                            if (!image && tile.level > 0)
+                            {
+                                image = _readReducedRegion(fileName, layer, size, window, tile.level);
+                            }
+                            if (image)
+                            {
+                                std::lock_guard<std::mutex> lock(_mutex);
+                                if (layer == p.tileLayer)
+                                {
+                                    p.tileCache->add(tile, image);
+                                }
+                            }
+                        }
+                        catch (const std::exception& e)
+                        {
+                            _logSystem->log(
+                                "djv::AV::ISequenceRead",
+                                String::Format("{0}: {1}").arg(fileName).arg(e.what()),
+                                System::LogLevel::Error);
+                        }
+                        promise->set_value(image);
+                        finished->set_value();
+                        _wake();
+                    });
+                return out;
+            }
+
             void ISequenceRead::_finish()
             {
                 DJV_PRIVATE_PTR();
@@ -279,7 +496,8 @@ namespace djv
                 const bool queue = (_videoQueue.getCount() < _videoQueue.getMax()) && !_videoQueue.isFinished();
                 const bool seek = _p->seek != Math::Frame::invalid;
                 const bool direction = _p->direction != _direction;
-                return queue || seek || direction;
+                const bool layer = canChangeLayer() && _p->layer != _layer;
+                return queue || seek || direction || layer;
             }
 
             size_t ISequenceRead::_getQueueCount(size_t threadCount) const
@@ -288,17 +506,59 @@ namespace djv
                 return std::min(queueMax, threadCount);
             }
 
-            std::future<ISequenceRead::Future> ISequenceRead::_getFuture(Math::Frame::Number i, std::string fileName)
+            std::vector<std::shared_ptr<Image::Data> > ISequenceRead::_readImages(
+                const std::string& fileName,
+                const std::vector<size_t>&)
+            {
+                return { _readImage(fileName) };
+            }
+
+            std::shared_ptr<Image::Data> ISequenceRead::_readRegion(
+                const std::string&,
+                size_t,
+                const Math::BBox2i&,
+                uint8_t)
+            {
+                return nullptr;
+            }
+
+            std::future<ISequenceRead::Future> ISequenceRead::_getFuture(
+                Math::Frame::Number i,
+                std::string fileName,
+                const std::vector<size_t>& layers,
+                JobPriority priority,
+                bool cache)
             {
-                return std::async(
-                    std::launch::async,
-                    [this, i, fileName]
+                DJV_PRIVATE_PTR();
+                auto promise = std::make_shared<std::promise<Future> >();
+                auto out = promise->get_future();
+                p.threadPool->addJob(
+                    p.uid,
+                    priority,
+                    [this, promise, i, fileName, layers, cache]
                     {
                         Future out;
                         out.frame = i;
                         try
                         {
-                            out.image = _readImage(fileName);
+                            out.images = _readImages(fileName, layers);
+                            out.layers = layers;
+                            out.layers.resize(out.images.size());
+#if defined(DJV_MMAP)
+                            // Memory-mapped images are only copied when they
+                            // are cached, so that the cache does not keep the
+                            // files open.
+                            if (cache)
+                            {
+                                for (const auto& image : out.images)
+                                {
+                                    if (image)
+                                    {
+                                        image->detach(_options.dataPool);
+                                    }
+                                }
+                            }
+#endif // DJV_MMAP
                         }
                         catch (const std::exception& e)
                         {
@@ -307,18 +567,45 @@ namespace djv
                                 String::Format("{0}: {1}").arg(fileName).arg(e.what()),
                                 System::LogLevel::Error);
                         }
-                        return out;
+                        promise->set_value(out);
                     });
+                return out;
             }
 
-            size_t ISequenceRead::_readQueue(size_t count, bool loop, bool cacheEnabled)
+            void ISequenceRead::_cacheAdd(const Future& value)
+            {
+                for (size_t i = 0; i < value.images.size(); ++i)
+                {
+                    if (value.images[i])
+                    {
+                        _cache.add(value.frame, value.images[i], value.layers[i]);
+                    }
+                }
+            }
+
+            size_t ISequenceRead::_readQueue(size_t count, bool loop, bool cacheEnabled, bool tiles)
             {
                 DJV_PRIVATE_PTR();
 
+                // When tiles are enabled the last mip level is read as a
+                // placeholder instead of the full resolution image.
+                uint8_t tileLevel = 0;
+                if (tiles && p.layer < p.info.video.size())
+                {
+                    tileLevel = getLevelCount(p.info.video[p.layer].size) - 1;
+                }
+
                 // Get frames to be added to the queue.
                 const size_t sequenceFrameCount = _sequence.getFrameCount();
                 std::vector<std::pair<Math::Frame::Number, std::shared_ptr<Image::Data> > > images;
                 std::vector<std::future<Future> > futures;
+                struct TileFuture
+                {
+                    Math::Frame::Number frame;
+                    std::string fileName;
+                    std::future<std::shared_ptr<Image::Data> > future;
+                };
+                std::vector<TileFuture> tileFutures;
                 for (size_t i = 0; i < count; ++i)
                 {
                     std::shared_ptr<Image::Data> cachedImage;
@@ -328,19 +615,29 @@ namespace djv
                     }
                     else
                     {
+                        std::string fileName;
                         if (sequenceFrameCount)
                         {
                             if (p.frame >= 0 && p.frame < sequenceFrameCount)
                             {
                                 const Math::Frame::Number frameNumber = _sequence.getFrame(p.frame);
-                                const std::string fileName = _fileInfo.getFileName(frameNumber);
-                                futures.push_back(_getFuture(p.frame, fileName));
+                                fileName = _fileInfo.getFileName(frameNumber);
                             }
                         }
                         else
                         {
-                            const std::string fileName = _fileInfo.getFileName();
-                            futures.push_back(_getFuture(p.frame, fileName));
+                            fileName = _fileInfo.getFileName();
+                        }
+                        if (!fileName.empty())
+                        {
+                            if (tiles)
+                            {
+                                tileFutures.push_back({ p.frame, fileName, readTile(Tile(p.frame, tileLevel, 0, 0)) });
+                            }
+                            else
+                            {
+                                futures.push_back(_getFuture(p.frame, fileName, p.layers, JobPriority::High, cacheEnabled));
+                            }
                         }
                     }
 
@@ -367,17 +664,28 @@ namespace djv
                     }
                 }
 
+                // Get the placeholders. If a placeholder cannot be read the
+                // full resolution image is read instead.
+                for (auto& tileFuture : tileFutures)
+                {
+                    if (auto image = tileFuture.future.get())
+                    {
+                        images.push_back(std::make_pair(tileFuture.frame, image));
+                    }
+                    else
+                    {
+                        futures.push_back(_getFuture(tileFuture.frame, tileFuture.fileName, p.layers, JobPriority::High, cacheEnabled));
+                    }
+                }
+
                 // Get the results.
                 for (auto& future : futures)
                 {
                     const auto result = future.get();
-                    images.push_back(std::make_pair(result.frame, result.image));
+                    images.push_back(std::make_pair(result.frame, result.images.size() ? result.images[0] : nullptr));
                     if (cacheEnabled)
                     {
-#if defined(DJV_MMAP)
-                        result.image->detach();
-#endif // DJV_MMAP
-                        _cache.add(result.frame, result.image);
+                        _cacheAdd(result);
                     }
                 }
 
@@ -400,10 +708,15 @@ namespace djv
                     _videoQueue.setFinished(true);
                 }
 
-                return futures.size();
+                if (images.size())
+                {
+                    _wake();
+                }
+
+                return futures.size() + tileFutures.size();
             }
 
-            void ISequenceRead::_readCache(size_t count, const AV::IO::InOutPoints& inOutPoints)
+            void ISequenceRead::_readCache(size_t count)
             {
                 DJV_PRIVATE_PTR();
 
@@ -418,66 +731,16 @@ namespace djv
                 }
                 if (count > 0 && frame != Math::Frame::invalid)
                 {
-                    const size_t sequenceFrameCount = _sequence.getFrameCount();
-                    const auto range = inOutPoints.getRange(sequenceFrameCount);
                     _cache.setDirection(p.direction);
                     _cache.setCurrentFrame(frame);
-                    const size_t readBehind = _cache.getReadBehind();
-                    switch (p.direction)
-                    {
-                    case Direction::Forward:
+                    if (p.cacheFutures.size() < count)
                     {
-                        for (size_t i = 0; i < readBehind; ++i)
+                        for (const auto i : _cache.getUncachedFrames(count - p.cacheFutures.size(), p.cachePending))
                         {
-                            --frame;
-                            if (frame < range.getMin())
-                            {
-                                frame = range.getMax();
-                            }
+                            const std::string fileName = _fileInfo.getFileName(_sequence.getFrame(i));
+                            p.cacheFutures.push_back(_getFuture(i, fileName, p.layers, JobPriority::Low, true));
+                            p.cachePending.insert(i);
                         }
-                        const size_t max = std::min(_cache.getMax(), sequenceFrameCount);
-                        for (size_t i = 0; i < max && p.cacheFutures.size() < count; ++i)
-                        {
-                            if (!_cache.contains(frame))
-                            {
-                                const std::string fileName = _fileInfo.getFileName(_sequence.getFrame(frame));
-                                p.cacheFutures.push_back(_getFuture(frame, fileName));
-                            }
-                            ++frame;
-                            if (frame > range.getMax())
-                            {
-                                frame = range.getMin();
-                            }
-                        }
-                        break;
-                    }
-                    case Direction::Reverse:
-                    {
-                        for (size_t i = 0; i < readBehind; ++i)
-                        {
-                            ++frame;
-                            if (frame > range.getMax())
-                            {
-                                frame = range.getMin();
-                            }
-                        }
-                        const size_t max = std::min(_cache.getMax(), sequenceFrameCount);
-                        for (Math::Frame::Number i = 0; i < max && p.cacheFutures.size() < count; ++i)
-                        {
-                            if (!_cache.contains(frame))
-                            {
-                                const std::string fileName = _fileInfo.getFileName(_sequence.getFrame(frame));
-                                p.cacheFutures.push_back(_getFuture(frame, fileName));
-                            }
-                            --frame;
-                            if (frame < range.getMin())
-                            {
-                                frame = range.getMax();
-                            }
-                        }
-                        break;
-                    }
-                    default: break;
                     }
                 }
 
@@ -489,10 +752,8 @@ namespace djv
                         i->wait_for(std::chrono::seconds(0)) == std::future_status::ready)
                     {
                         const auto result = i->get();
-#if defined(DJV_MMAP)
-                        result.image->detach();
-#endif // DJV_MMAP
-                        _cache.add(result.frame, result.image);
+                        _cacheAdd(result);
+                        p.cachePending.erase(result.frame);
                         i = p.cacheFutures.erase(i);
                     }
                     else
@@ -502,12 +763,71 @@ namespace djv
                 }
             }
 
+            std::shared_ptr<Image::Data> ISequenceRead::_readReducedRegion(
+                const std::string& fileName,
+                size_t layer,
+                const Image::Size& size,
+                const Math::BBox2i& window,
+                uint8_t level)
+            {
+                // The region is read from the full resolution image in bands
+                // of scanlines, and each band is reduced by half for each
+                // mip level.
+                std::shared_ptr<Image::Data> out;
+                const int scale = 1 << level;
+                const int x0 = window.min.x * scale;
+                const int x1 = std::min((window.max.x + 1) * scale, static_cast<int>(size.w)) - 1;
+                const int bandHeight = std::max(static_cast<int>(tileSize) >> level, 1);
+                auto convert = Image::Convert::create(1);
+                for (int y = window.min.y; y <= window.max.y; y += bandHeight)
+                {
+                    const int y1 = std::min(y + bandHeight - 1, window.max.y);
+                    const Math::BBox2i band(
+                        glm::ivec2(x0, y * scale),
+                        glm::ivec2(x1, std::min((y1 + 1) * scale, static_cast<int>(size.h)) - 1));
+                    auto image = _readRegion(fileName, layer, band, 0);
+                    if (!image)
+                    {
+                        return nullptr;
+                    }
+                    for (uint8_t i = 0; i < level; ++i)
+                    {
+                        auto info = image->getInfo();
+                        info.size.w = std::max((info.size.w + 1) / 2, 1U);
+                        info.size.h = std::max((info.size.h + 1) / 2, 1U);
+                        info.layout = Image::Layout();
+                        auto tmp = Image::Data::create(info);
+                        convert->process(*image, info, *tmp);
+                        tmp->setPluginName(image->getPluginName());
+                        image = tmp;
+                    }
+                    if (!out)
+                    {
+                        auto info = image->getInfo();
+                        info.size = Image::Size(window.w(), window.h());
+                        out = Image::Data::create(info);
+                        out->setPluginName(image->getPluginName());
+
+                        // Reduced bands may be narrower than the window.
+                        out->zero();
+                    }
+                    const size_t scanlineByteCount = std::min(out->getScanlineByteCount(), image->getScanlineByteCount());
+                    for (int j = 0; j < y1 - y + 1 && j < static_cast<int>(image->getHeight()); ++j)
+                    {
+                        memcpy(out->getData(y - window.min.y + j), image->getData(j), scanlineByteCount);
+                    }
+                }
+                return out;
+            }
+
             struct ISequenceWrite::Private
             {
                 System::File::Info fileInfo;
                 Math::Frame::Number frameNumber = Math::Frame::invalid;
                 GLFWwindow * glfwWindow = nullptr;
                 std::shared_ptr<GL::ImageConvert> convert;
+                std::shared_ptr<Image::Convert> cpuConvert;
+                std::shared_ptr<OCIO::ImageConvert> ocioConvert;
                 std::thread thread;
                 std::atomic<bool> running;
             };
@@ -559,7 +879,11 @@ namespace djv
                 p.glfwWindow = glfwCreateWindow(100, 100, "djv::IO::ISequenceWrite", NULL, NULL);
                 if (!p.glfwWindow)
                 {
-                    throw System::File::Error(_textSystem->getText(DJV_TEXT("error_glfw_window_creation")));
+                    // Convert the images with the CPU instead of OpenGL.
+                    _logSystem->log(
+                        "djv::AV::ISequenceWrite",
+                        _textSystem->getText(DJV_TEXT("error_glfw_window_creation")),
+                        System::LogLevel::Warning);
                 }
 
                 p.running = true;
@@ -569,17 +893,27 @@ namespace djv
                     DJV_PRIVATE_PTR();
                     try
                     {
-                        glfwMakeContextCurrent(p.glfwWindow);
+                        if (p.glfwWindow)
+                        {
+                            glfwMakeContextCurrent(p.glfwWindow);
 #if defined(DJV_GL_ES2)
-                        if (!gladLoadGLES2Loader((GLADloadproc)glfwGetProcAddress))
+                            if (!gladLoadGLES2Loader((GLADloadproc)glfwGetProcAddress))
 #else // DJV_GL_ES2
-                        if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+                            if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
 #endif // DJV_GL_ES2
+                            {
+                                throw System::File::Error(_textSystem->getText(DJV_TEXT("error_glad_init")));
+                            }
+                            p.convert = GL::ImageConvert::create(_textSystem, _resourceSystem);
+                        }
+                        else
                         {
-                            throw System::File::Error(_textSystem->getText(DJV_TEXT("error_glad_init")));
+                            p.cpuConvert = Image::Convert::create();
+                        }
+                        if (_options.colorSpaceConvert.isValid())
+                        {
+                            p.ocioConvert = OCIO::ImageConvert::create();
                         }
-
-                        p.convert = GL::ImageConvert::create(_textSystem, _resourceSystem);
 
                         const auto timeout = System::getTimerValue(System::TimerValue::VeryFast);
                         while (p.running)
@@ -602,6 +936,9 @@ namespace djv
                             }
                             if (images.size())
                             {
+                                // There is now room in the queue.
+                                _wake();
+
                                 struct Future
                                 {
                                     std::string fileName;
@@ -622,6 +959,26 @@ namespace djv
                                         ++p.frameNumber;
                                     }
                                     auto image = images[i];
+                                    if (p.ocioConvert)
+                                    {
+                                        // Convert the color space of a copy of the image
+                                        // since the image data may be shared.
+                                        const Image::Info ocioInfo(
+                                            image->getSize(),
+                                            OCIO::ImageConvert::getProcessType(image->getType()));
+                                        auto tmp = Image::Data::create(ocioInfo);
+                                        tmp->setTags(image->getTags());
+                                        if (p.convert)
+                                        {
+                                            p.convert->process(*image, ocioInfo, *tmp);
+                                        }
+                                        else
+                                        {
+                                            p.cpuConvert->process(*image, ocioInfo, *tmp);
+                                        }
+                                        p.ocioConvert->process(*tmp, _options.colorSpaceConvert);
+                                        image = tmp;
+                                    }
                                     const Image::Type imageType = _getImageType(image->getType());
                                     if (Image::Type::None == imageType)
                                     {
@@ -635,7 +992,14 @@ namespace djv
                                         const Image::Info imageInfo(image->getSize(), imageType, imageLayout);
                                         auto tmp = Image::Data::create(imageInfo);
                                         tmp->setTags(image->getTags());
-                                        p.convert->process(*image, imageInfo, *tmp);
+                                        if (p.convert)
+                                        {
+                                            p.convert->process(*image, imageInfo, *tmp);
+                                        }
+                                        else
+                                        {
+                                            p.cpuConvert->process(*image, imageInfo, *tmp);
+                                        }
                                         image = tmp;
                                     }
                                     futures.push_back(std::async(
@@ -676,6 +1040,8 @@ namespace djv
                         }
 
                         p.convert.reset();
+                        p.cpuConvert.reset();
+                        p.ocioConvert.reset();
                     }
                     catch (const std::exception& e)
                     {
@@ -683,6 +1049,7 @@ namespace djv
                     }
 
                     p.running = false;
+                    _wake();
                 });
             }
 
@@ -33,10 +33,32 @@ namespace djv
                 std::future<Info> getInfo() override;
                 void seek(int64_t, Direction) override;
                 bool hasCache() const override;
+                std::future<std::shared_ptr<Image::Data> > readTile(const Tile&) override;
 
             protected:
                 virtual Info _readInfo(const std::string& fileName) = 0;
                 virtual std::shared_ptr<Image::Data> _readImage(const std::string& fileName) = 0;
+
+                //! Read the given layers of an image. The first layer is the
+                //! current layer. The default implementation only reads the
+                //! layer from the read options.
+                virtual std::vector<std::shared_ptr<Image::Data> > _readImages(
+                    const std::string& fileName,
+                    const std::vector<size_t>& layers);
+
+                //! Read a region of an image for a tile. The window is in the
+                //! pixel coordinates of the given mip level. The image should
+                //! not be mirrored and should have the native endian. Return
+                //! null if the mip level is not stored in the file, it is then
+                //! reduced from the full resolution image. The default
+                //! implementation returns null. This function is called from
+                //! the thread pool.
+                virtual std::shared_ptr<Image::Data> _readRegion(
+                    const std::string& fileName,
+                    size_t layer,
+                    const Math::BBox2i& window,
+                    uint8_t level);
+
                 void _finish();
 
                 Math::IntRational _speed;
@@ -46,9 +68,21 @@ namespace djv
                 bool _hasWork() const;
                 size_t _getQueueCount(size_t threadCount) const;
                 struct Future;
-                std::future<Future> _getFuture(Math::Frame::Number, std::string fileName);
-                size_t _readQueue(size_t count, bool loop, bool cacheEnabled);
-                void _readCache(size_t count, const AV::IO::InOutPoints&);
+                std::future<Future> _getFuture(
+                    Math::Frame::Number,
+                    std::string fileName,
+                    const std::vector<size_t>& layers,
+                    JobPriority,
+                    bool cache);
+                void _cacheAdd(const Future&);
+                size_t _readQueue(size_t count, bool loop, bool cacheEnabled, bool tiles);
+                void _readCache(size_t count);
+                std::shared_ptr<Image::Data> _readReducedRegion(
+                    const std::string& fileName,
+                    size_t layer,
+                    const Image::Size&,
+                    const Math::BBox2i& window,
+                    uint8_t level);
 
                 DJV_PRIVATE();
             };
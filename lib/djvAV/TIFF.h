@@ -68,13 +68,22 @@ namespace djv
                     const std::shared_ptr<System::ResourceSystem>&,
                     const std::shared_ptr<System::LogSystem>&);
 
+                bool canReadTiles() const override;
+
             protected:
                 IO::Info _readInfo(const std::string& fileName) override;
                 std::shared_ptr<Image::Data> _readImage(const std::string& fileName) override;
+                std::shared_ptr<Image::Data> _readRegion(
+                    const std::string& fileName,
+                    size_t layer,
+                    const Math::BBox2i&,
+                    uint8_t level) override;
 
             private:
                 struct File;
                 IO::Info _open(const std::string&, File&);
+                IO::Info _readDirectory(const std::string&, File&);
+                void _setReducedDirectory(const std::string&, File&, IO::Info&);
             };
                 
             //! TIFF writer.
@@ -10,6 +10,8 @@
 
 #include <djvCore/StringFormat.h>
 
+#include <algorithm>
+
 using namespace djv::Core;
 
 namespace djv
@@ -55,6 +57,11 @@ namespace djv
                 return out;
             }
 
+            bool Read::canReadTiles() const
+            {
+                return true;
+            }
+
             IO::Info Read::_readInfo(const std::string& fileName)
             {
                 File f;
@@ -65,10 +72,14 @@ namespace djv
             {
                 std::shared_ptr<Image::Data> out;
                 File f;
-                const auto info = _open(fileName, f);
-                out = Image::Data::create(info.video[0]);
+                auto info = _open(fileName, f);
+                if (_options.preferredSize.isValid())
+                {
+                    _setReducedDirectory(fileName, f, info);
+                }
+                out = Image::Data::create(info.video[0], _options.dataPool);
                 out->setPluginName(pluginName);
-                for (uint16_t y = 0; y < info.video[0].size.h; ++y)
+                for (uint32_t y = 0; y < info.video[0].size.h; ++y)
                 {
                     if (TIFFReadScanline(f.f, (tdata_t *)out->getData(y), y) == -1)
                     {
@@ -88,6 +99,127 @@ namespace djv
                 return out;
             }
 
+            std::shared_ptr<Image::Data> Read::_readRegion(
+                const std::string& fileName,
+                size_t,
+                const Math::BBox2i& window,
+                uint8_t level)
+            {
+                std::shared_ptr<Image::Data> out;
+                File f;
+                auto info = _open(fileName, f);
+                if (level > 0)
+                {
+                    // Find the reduced resolution image with the size of the
+                    // mip level.
+                    const Image::Size levelSize = IO::getLevelSize(info.video[0].size, level);
+                    tdir_t directory = 0;
+                    for (tdir_t i = 1; !directory && TIFFReadDirectory(f.f); ++i)
+                    {
+                        uint32 subfileType = 0;
+                        uint32 width = 0;
+                        uint32 height = 0;
+                        TIFFGetFieldDefaulted(f.f, TIFFTAG_SUBFILETYPE, &subfileType);
+                        TIFFGetFieldDefaulted(f.f, TIFFTAG_IMAGEWIDTH, &width);
+                        TIFFGetFieldDefaulted(f.f, TIFFTAG_IMAGELENGTH, &height);
+                        if ((subfileType & FILETYPE_REDUCEDIMAGE) &&
+                            width == levelSize.w &&
+                            height == levelSize.h)
+                        {
+                            directory = i;
+                        }
+                    }
+                    if (!directory)
+                    {
+                        return out;
+                    }
+                    TIFFSetDirectory(f.f, directory);
+                    info = _readDirectory(fileName, f);
+                }
+                const auto& imageInfo = info.video[0];
+                uint16 planarConfig = 0;
+                TIFFGetFieldDefaulted(f.f, TIFFTAG_PLANARCONFIG, &planarConfig);
+                if (imageInfo.layout.mirror.x || imageInfo.layout.mirror.y || PLANARCONFIG_SEPARATE == planarConfig)
+                {
+                    return out;
+                }
+
+                out = Image::Data::create(Image::Info(window.w(), window.h(), imageInfo.type));
+                out->setPluginName(pluginName);
+                const size_t pixelByteCount = f.palette ? 1 : imageInfo.getPixelByteCount();
+                if (TIFFIsTiled(f.f))
+                {
+                    // Copy the parts of the TIFF tiles that overlap the window.
+                    uint32 tileWidth = 0;
+                    uint32 tileHeight = 0;
+                    TIFFGetFieldDefaulted(f.f, TIFFTAG_TILEWIDTH, &tileWidth);
+                    TIFFGetFieldDefaulted(f.f, TIFFTAG_TILELENGTH, &tileHeight);
+                    const tmsize_t tileRowSize = TIFFTileRowSize(f.f);
+                    const tmsize_t tileByteCount = TIFFTileSize(f.f);
+                    if (!tileWidth || !tileHeight || tileRowSize <= 0 || tileByteCount <= 0)
+                    {
+                        throw System::File::Error(String::Format("{0}: {1}").
+                            arg(fileName).
+                            arg(_textSystem->getText(DJV_TEXT("error_read_scanline"))));
+                    }
+                    std::vector<uint8_t> buf(tileByteCount);
+                    const uint32 tx0 = window.min.x / tileWidth * tileWidth;
+                    const uint32 ty0 = window.min.y / tileHeight * tileHeight;
+                    for (uint32 ty = ty0; ty <= static_cast<uint32>(window.max.y); ty += tileHeight)
+                    {
+                        for (uint32 tx = tx0; tx <= static_cast<uint32>(window.max.x); tx += tileWidth)
+                        {
+                            if (TIFFReadTile(f.f, buf.data(), tx, ty, 0, 0) == -1)
+                            {
+                                throw System::File::Error(String::Format("{0}: {1}").
+                                    arg(fileName).
+                                    arg(_textSystem->getText(DJV_TEXT("error_read_scanline"))));
+                            }
+                            const uint32 x0 = std::max(tx, static_cast<uint32>(window.min.x));
+                            const uint32 x1 = std::min(tx + tileWidth - 1, static_cast<uint32>(window.max.x));
+                            const uint32 y0 = std::max(ty, static_cast<uint32>(window.min.y));
+                            const uint32 y1 = std::min(ty + tileHeight - 1, static_cast<uint32>(window.max.y));
+                            for (uint32 y = y0; y <= y1; ++y)
+                            {
+                                memcpy(
+                                    out->getData(x0 - window.min.x, y - window.min.y),
+                                    buf.data() + (y - ty) * tileRowSize + (x0 - tx) * pixelByteCount,
+                                    (x1 - x0 + 1) * pixelByteCount);
+                            }
+                        }
+                    }
+                }
+                else
+                {
+                    std::vector<uint8_t> buf(TIFFScanlineSize(f.f));
+                    for (int y = window.min.y; y <= window.max.y; ++y)
+                    {
+                        if (TIFFReadScanline(f.f, (tdata_t *)buf.data(), y) == -1)
+                        {
+                            throw System::File::Error(String::Format("{0}: {1}").
+                                arg(fileName).
+                                arg(_textSystem->getText(DJV_TEXT("error_read_scanline"))));
+                        }
+                        memcpy(
+                            out->getData(y - window.min.y),
+                            buf.data() + window.min.x * pixelByteCount,
+                            window.w() * pixelByteCount);
+                    }
+                }
+                if (f.palette)
+                {
+                    for (uint32_t y = 0; y < out->getHeight(); ++y)
+                    {
+                        readPalette(
+                            out->getData(y),
+                            out->getWidth(),
+                            static_cast<int>(Image::getChannelCount(imageInfo.type)),
+                            f.colormap[0], f.colormap[1], f.colormap[2]);
+                    }
+                }
+                return out;
+            }
+
             IO::Info Read::_open(const std::string& fileName, File& f)
             {
 #if defined(DJV_PLATFORM_WINDOWS)
@@ -101,7 +233,43 @@ namespace djv
                         arg(fileName).
                         arg(_textSystem->getText(DJV_TEXT("error_file_open"))));
                 }
+                return _readDirectory(fileName, f);
+            }
 
+            void Read::_setReducedDirectory(const std::string& fileName, File& f, IO::Info& info)
+            {
+                // Find the smallest reduced resolution image that is still
+                // at least the preferred size.
+                tdir_t directory = 0;
+                uint32 directoryWidth = info.video[0].size.w;
+                for (tdir_t i = 1; TIFFReadDirectory(f.f); ++i)
+                {
+                    uint32 subfileType = 0;
+                    uint32 width = 0;
+                    uint32 height = 0;
+                    TIFFGetFieldDefaulted(f.f, TIFFTAG_SUBFILETYPE, &subfileType);
+                    TIFFGetFieldDefaulted(f.f, TIFFTAG_IMAGEWIDTH, &width);
+                    TIFFGetFieldDefaulted(f.f, TIFFTAG_IMAGELENGTH, &height);
+                    if ((subfileType & FILETYPE_REDUCEDIMAGE) &&
+                        width >= _options.preferredSize.w &&
+                        height >= _options.preferredSize.h &&
+                        width < directoryWidth)
+                    {
+                        directory = i;
+                        directoryWidth = width;
+                    }
+                }
+                TIFFSetDirectory(f.f, directory);
+                if (directory > 0)
+                {
+                    const Image::Tags tags = info.tags;
+                    info = _readDirectory(fileName, f);
+                    info.tags = tags;
+                }
+            }
+
+            IO::Info Read::_readDirectory(const std::string& fileName, File& f)
+            {
                 uint32   width            = 0;
                 uint32   height           = 0;
                 uint16   photometric      = 0;
@@ -89,6 +89,15 @@ namespace djv
                 case Image::Type::RGB_U10:  out = Image::Type::RGB_U16;  break;
                 case Image::Type::RGB_F16:  out = Image::Type::RGB_F32;  break;
                 case Image::Type::RGBA_F16: out = Image::Type::RGBA_F32; break;
+                case Image::Type::YUV_420P_U8:
+                case Image::Type::YUV_422P_U8:
+                case Image::Type::YUV_444P_U8: out = Image::Type::RGB_U8; break;
+                case Image::Type::YUV_420P_U10:
+                case Image::Type::YUV_422P_U10:
+                case Image::Type::YUV_444P_U10:
+                case Image::Type::YUV_420P_U16:
+                case Image::Type::YUV_422P_U16:
+                case Image::Type::YUV_444P_U16: out = Image::Type::RGB_U16; break;
                 default: break;
                 }
                 return out;
@@ -211,7 +220,7 @@ namespace djv
                     TIFFSetField(f.f, TIFFTAG_IMAGEDESCRIPTION, tag.data());
                 }
 
-                for (uint16_t y = 0; y < info.size.h; ++y)
+                for (uint32_t y = 0; y < info.size.h; ++y)
                 {
                     if (TIFFWriteScanline(f.f, (tdata_t *)image->getData(y), y) == -1)
                     {
@@ -139,7 +139,7 @@ namespace djv
                 std::shared_ptr<Image::Data> out;
                 auto io = System::File::IO::create();
                 const auto info = _open(fileName, io);
-                out = Image::Data::create(info.video[0]);
+                out = Image::Data::create(info.video[0], _options.dataPool);
                 out->setPluginName(pluginName);
 
                 const Image::Info& imageInfo = info.video[0];
@@ -155,7 +155,7 @@ namespace djv
                     io->read(tmp.data(), tmpSize);
                     const uint8_t* p = tmp.data();
                     const uint8_t* const end = p + tmpSize;
-                    for (uint16_t y = 0; y < imageInfo.size.h; ++y)
+                    for (uint32_t y = 0; y < imageInfo.size.h; ++y)
                     {
                         p = readRle(
                             p,
@@ -174,10 +174,10 @@ namespace djv
 
                 if (_bgr)
                 {
-                    for (uint16_t y = 0; y < imageInfo.size.h; ++y)
+                    for (uint32_t y = 0; y < imageInfo.size.h; ++y)
                     {
                         uint8_t* p = out->getData(0, y);
-                        for (uint16_t x = 0; x < imageInfo.size.w; ++x, p += channels)
+                        for (uint32_t x = 0; x < imageInfo.size.w; ++x, p += channels)
                         {
                             const uint8_t tmp = p[0];
                             p[0] = p[2];
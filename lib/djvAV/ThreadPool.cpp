@@ -0,0 +1,225 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAV/ThreadPool.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace IO
+        {
+            namespace
+            {
+                struct Job
+                {
+                    Core::UID owner = 0;
+                    std::function<void(void)> function;
+                };
+
+            } // namespace
+
+            struct ThreadPool::Private
+            {
+                size_t threadCount = 0;
+                std::vector<std::thread> threads;
+                std::array<std::deque<Job>, 2> jobs;
+                mutable std::mutex mutex;
+                std::condition_variable cv;
+                std::atomic<bool> running;
+            };
+
+            void ThreadPool::_init(size_t threadCount)
+            {
+                DJV_PRIVATE_PTR();
+                p.running = true;
+                setThreadCount(threadCount);
+            }
+
+            ThreadPool::ThreadPool() :
+                _p(new Private)
+            {}
+
+            ThreadPool::~ThreadPool()
+            {
+                DJV_PRIVATE_PTR();
+                {
+                    std::lock_guard<std::mutex> lock(p.mutex);
+                    p.running = false;
+                    for (auto& i : p.jobs)
+                    {
+                        i.clear();
+                    }
+                }
+                p.cv.notify_all();
+                for (auto& i : p.threads)
+                {
+                    if (i.joinable())
+                    {
+                        i.join();
+                    }
+                }
+            }
+
+            std::shared_ptr<ThreadPool> ThreadPool::create(size_t threadCount)
+            {
+                auto out = std::shared_ptr<ThreadPool>(new ThreadPool);
+                out->_init(threadCount);
+                return out;
+            }
+
+            size_t ThreadPool::getThreadCount() const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                return p.threadCount;
+            }
+
+            void ThreadPool::setThreadCount(size_t value)
+            {
+                DJV_PRIVATE_PTR();
+                const size_t threadCount = std::max(value, static_cast<size_t>(1));
+                std::vector<std::thread> finished;
+                {
+                    std::lock_guard<std::mutex> lock(p.mutex);
+                    if (threadCount == p.threadCount)
+                        return;
+                    p.threadCount = threadCount;
+                    while (p.threads.size() > threadCount)
+                    {
+                        finished.push_back(std::move(p.threads.back()));
+                        p.threads.pop_back();
+                    }
+                    while (p.threads.size() < threadCount)
+                    {
+                        const size_t index = p.threads.size();
+                        p.threads.push_back(std::thread(
+                            [this, index]
+                            {
+                                _run(index);
+                            }));
+                    }
+                }
+                p.cv.notify_all();
+                for (auto& i : finished)
+                {
+                    if (i.joinable())
+                    {
+                        i.join();
+                    }
+                }
+            }
+
+            size_t ThreadPool::getJobCount() const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                size_t out = 0;
+                for (const auto& i : p.jobs)
+                {
+                    out += i.size();
+                }
+                return out;
+            }
+
+            void ThreadPool::addJob(Core::UID owner, JobPriority priority, const std::function<void(void)>& value)
+            {
+                DJV_PRIVATE_PTR();
+                {
+                    std::lock_guard<std::mutex> lock(p.mutex);
+                    Job job;
+                    job.owner = owner;
+                    job.function = value;
+                    p.jobs[static_cast<size_t>(priority)].push_back(std::move(job));
+                }
+                p.cv.notify_one();
+            }
+
+            void ThreadPool::cancelJobs(Core::UID owner)
+            {
+                DJV_PRIVATE_PTR();
+                // Move the cancelled jobs out of the lock so that any
+                // resources they hold are released without blocking the
+                // worker threads.
+                std::vector<Job> cancelled;
+                {
+                    std::lock_guard<std::mutex> lock(p.mutex);
+                    for (auto& jobs : p.jobs)
+                    {
+                        auto i = jobs.begin();
+                        while (i != jobs.end())
+                        {
+                            if (owner == i->owner)
+                            {
+                                cancelled.push_back(std::move(*i));
+                                i = jobs.erase(i);
+                            }
+                            else
+                            {
+                                ++i;
+                            }
+                        }
+                    }
+                }
+            }
+
+            void ThreadPool::_run(size_t index)
+            {
+                DJV_PRIVATE_PTR();
+                while (true)
+                {
+                    Job job;
+                    {
+                        std::unique_lock<std::mutex> lock(p.mutex);
+                        p.cv.wait(
+                            lock,
+                            [this, index]
+                            {
+                                DJV_PRIVATE_PTR();
+                                if (!p.running || index >= p.threadCount)
+                                {
+                                    return true;
+                                }
+                                for (const auto& i : p.jobs)
+                                {
+                                    if (!i.empty())
+                                    {
+                                        return true;
+                                    }
+                                }
+                                return false;
+                            });
+                        if (!p.running || index >= p.threadCount)
+                        {
+                            break;
+                        }
+                        for (auto& i : p.jobs)
+                        {
+                            if (!i.empty())
+                            {
+                                job = std::move(i.front());
+                                i.pop_front();
+                                break;
+                            }
+                        }
+                    }
+                    if (job.function)
+                    {
+                        job.function();
+                    }
+                }
+            }
+
+        } // namespace IO
+    } // namespace AV
+} // namespace djv
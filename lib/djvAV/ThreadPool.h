@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvCore/UID.h>
+
+#include <functional>
+#include <memory>
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace IO
+        {
+            //! I/O job priority.
+            enum class JobPriority
+            {
+                High,   //!< Jobs needed for playback.
+                Low     //!< Jobs for filling the cache.
+            };
+
+            //! Pool of worker threads shared by the I/O readers.
+            //!
+            //! Jobs are run in priority order, and in the order they were
+            //! added for jobs with the same priority.
+            class ThreadPool : public std::enable_shared_from_this<ThreadPool>
+            {
+                DJV_NON_COPYABLE(ThreadPool);
+
+            protected:
+                void _init(size_t threadCount);
+                ThreadPool();
+
+            public:
+                ~ThreadPool();
+
+                static std::shared_ptr<ThreadPool> create(size_t threadCount);
+
+                //! \name Threads
+                ///@{
+
+                size_t getThreadCount() const;
+
+                //! Set the number of worker threads. When the number of
+                //! threads is reduced this function blocks until the extra
+                //! threads have finished their current job.
+                void setThreadCount(size_t);
+
+                ///@}
+
+                //! \name Jobs
+                ///@{
+
+                size_t getJobCount() const;
+
+                //! Add a job. The owner ID can be used to cancel jobs that
+                //! have not been started yet.
+                void addJob(Core::UID owner, JobPriority, const std::function<void(void)>&);
+
+                //! Remove the jobs for the given owner that have not been
+                //! started yet.
+                void cancelJobs(Core::UID owner);
+
+                ///@}
+
+            private:
+                void _run(size_t index);
+
+                DJV_PRIVATE();
+            };
+
+        } // namespace IO
+    } // namespace AV
+} // namespace djv
@@ -0,0 +1,1099 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAV/ThumbnailCache.h>
+
+#include <djvAV/IO.h>
+
+#include <djvAudio/Info.h>
+
+#include <djvImage/Data.h>
+
+#include <djvSystem/File.h>
+#include <djvSystem/FileIO.h>
+#include <djvSystem/FileInfo.h>
+#include <djvSystem/FileLock.h>
+#include <djvSystem/TextSystem.h>
+
+#include <djvCore/Memory.h>
+#include <djvCore/StringFormat.h>
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <thread>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace
+        {
+            //! \todo Should this be configurable?
+            const float trimPercentage   = .75F;
+            const int   compressionLevel = Z_BEST_SPEED;
+
+            const char     packMagic[]   = "DJVT";
+            const char     indexMagic[]  = "DJVI";
+            const char     recordMagic[] = "DJVR";
+            const uint32_t version       = 1;
+            const size_t   magicByteCount      = 4;
+            const size_t   packHeaderByteCount = magicByteCount + sizeof(uint32_t);
+
+            enum class Kind : uint8_t
+            {
+                Info,
+                Image,
+
+                Count
+            };
+
+            uint64_t getKey(const System::File::Info& fileInfo, size_t options, Kind kind)
+            {
+                size_t out = 0;
+                Memory::hashCombine(out, fileInfo.getFileName());
+                Memory::hashCombine(out, static_cast<int64_t>(fileInfo.getTime()));
+                Memory::hashCombine(out, fileInfo.getSize());
+                Memory::hashCombine(out, options);
+                Memory::hashCombine(out, static_cast<uint8_t>(kind));
+                return out;
+            }
+
+            class Writer
+            {
+            public:
+                template<typename T>
+                void pod(T value)
+                {
+                    const uint8_t* p = reinterpret_cast<const uint8_t*>(&value);
+                    data.insert(data.end(), p, p + sizeof(T));
+                }
+
+                void string(const std::string& value)
+                {
+                    pod(static_cast<uint32_t>(value.size()));
+                    data.insert(data.end(), value.begin(), value.end());
+                }
+
+                template<typename T>
+                void enumeration(T value)
+                {
+                    pod(static_cast<uint8_t>(value));
+                }
+
+                std::vector<uint8_t> data;
+            };
+
+            class Reader
+            {
+            public:
+                Reader(const uint8_t* p, const uint8_t* end) :
+                    _p(p),
+                    _end(end)
+                {}
+
+                template<typename T>
+                T pod()
+                {
+                    T out;
+                    memcpy(&out, bytes(sizeof(T)), sizeof(T));
+                    return out;
+                }
+
+                std::string string()
+                {
+                    const size_t size = pod<uint32_t>();
+                    const uint8_t* p = bytes(size);
+                    return std::string(reinterpret_cast<const char*>(p), size);
+                }
+
+                template<typename T>
+                T enumeration()
+                {
+                    const uint8_t value = pod<uint8_t>();
+                    if (value >= static_cast<uint8_t>(T::Count))
+                    {
+                        throw std::runtime_error("Invalid enumeration.");
+                    }
+                    return static_cast<T>(value);
+                }
+
+                const uint8_t* bytes(size_t size)
+                {
+                    if (static_cast<size_t>(_end - _p) < size)
+                    {
+                        throw std::runtime_error("Unexpected end of data.");
+                    }
+                    const uint8_t* out = _p;
+                    _p += size;
+                    return out;
+                }
+
+                const uint8_t* getP() const
+                {
+                    return _p;
+                }
+
+            private:
+                const uint8_t* _p   = nullptr;
+                const uint8_t* _end = nullptr;
+            };
+
+            void write(Writer& writer, const Math::Frame::Sequence& value)
+            {
+                const auto& ranges = value.getRanges();
+                writer.pod(static_cast<uint32_t>(ranges.size()));
+                for (const auto& i : ranges)
+                {
+                    writer.pod(static_cast<int64_t>(i.getMin()));
+                    writer.pod(static_cast<int64_t>(i.getMax()));
+                }
+                writer.pod(static_cast<uint32_t>(value.getPad()));
+            }
+
+            void read(Reader& reader, Math::Frame::Sequence& out)
+            {
+                std::vector<Math::Frame::Range> ranges;
+                const size_t size = reader.pod<uint32_t>();
+                for (size_t i = 0; i < size; ++i)
+                {
+                    const Math::Frame::Number min = reader.pod<int64_t>();
+                    const Math::Frame::Number max = reader.pod<int64_t>();
+                    ranges.push_back(Math::Frame::Range(min, max));
+                }
+                const size_t pad = reader.pod<uint32_t>();
+                out = Math::Frame::Sequence(ranges, pad);
+            }
+
+            void write(Writer& writer, const Image::Tags& value)
+            {
+                const auto& tags = value.get();
+                writer.pod(static_cast<uint32_t>(tags.size()));
+                for (const auto& i : tags)
+                {
+                    writer.string(i.first);
+                    writer.string(i.second);
+                }
+            }
+
+            void read(Reader& reader, Image::Tags& out)
+            {
+                std::map<std::string, std::string> tags;
+                const size_t size = reader.pod<uint32_t>();
+                for (size_t i = 0; i < size; ++i)
+                {
+                    const std::string key = reader.string();
+                    tags[key] = reader.string();
+                }
+                out.set(tags);
+            }
+
+            void write(Writer& writer, const Image::Info& value)
+            {
+                writer.string(value.name);
+                writer.pod(static_cast<uint32_t>(value.size.w));
+                writer.pod(static_cast<uint32_t>(value.size.h));
+                writer.pod(value.pixelAspectRatio);
+                writer.enumeration(value.type);
+                writer.pod(static_cast<uint8_t>(value.layout.mirror.x));
+                writer.pod(static_cast<uint8_t>(value.layout.mirror.y));
+                writer.pod(static_cast<int32_t>(value.layout.alignment));
+                writer.enumeration(value.layout.endian);
+                writer.string(value.codec);
+                writer.enumeration(value.yuvCoefficients);
+                writer.enumeration(value.yuvRange);
+            }
+
+            void read(Reader& reader, Image::Info& out)
+            {
+                out.name                 = reader.string();
+                out.size.w               = static_cast<decltype(out.size.w)>(reader.pod<uint32_t>());
+                out.size.h               = static_cast<decltype(out.size.h)>(reader.pod<uint32_t>());
+                out.pixelAspectRatio     = reader.pod<float>();
+                out.type                 = reader.enumeration<Image::Type>();
+                out.layout.mirror.x      = reader.pod<uint8_t>() != 0;
+                out.layout.mirror.y      = reader.pod<uint8_t>() != 0;
+                out.layout.alignment     = reader.pod<int32_t>();
+                out.layout.endian        = reader.enumeration<Memory::Endian>();
+                out.codec                = reader.string();
+                out.yuvCoefficients      = reader.enumeration<Image::YUVCoefficients>();
+                out.yuvRange             = reader.enumeration<Image::YUVRange>();
+            }
+
+            void write(Writer& writer, const Audio::Info& value)
+            {
+                writer.string(value.name);
+                writer.pod(value.channelCount);
+                writer.enumeration(value.type);
+                writer.pod(static_cast<uint64_t>(value.sampleRate));
+                writer.string(value.codec);
+            }
+
+            void read(Reader& reader, Audio::Info& out)
+            {
+                out.name         = reader.string();
+                out.channelCount = reader.pod<uint8_t>();
+                out.type         = reader.enumeration<Audio::Type>();
+                out.sampleRate   = static_cast<size_t>(reader.pod<uint64_t>());
+                out.codec        = reader.string();
+            }
+
+            void write(Writer& writer, const IO::Info& value)
+            {
+                writer.string(value.fileName);
+                writer.pod(static_cast<int32_t>(value.videoSpeed.getNum()));
+                writer.pod(static_cast<int32_t>(value.videoSpeed.getDen()));
+                write(writer, value.videoSequence);
+                writer.pod(static_cast<uint32_t>(value.video.size()));
+                for (const auto& i : value.video)
+                {
+                    write(writer, i);
+                }
+                write(writer, value.audio);
+                writer.pod(static_cast<uint64_t>(value.audioSampleCount));
+                write(writer, value.tags);
+            }
+
+            void read(Reader& reader, IO::Info& out)
+            {
+                out.fileName = reader.string();
+                const int num = reader.pod<int32_t>();
+                const int den = reader.pod<int32_t>();
+                out.videoSpeed = Math::IntRational(num, den);
+                read(reader, out.videoSequence);
+                const size_t size = reader.pod<uint32_t>();
+                out.video.clear();
+                for (size_t i = 0; i < size; ++i)
+                {
+                    Image::Info info;
+                    read(reader, info);
+                    out.video.push_back(info);
+                }
+                read(reader, out.audio);
+                out.audioSampleCount = static_cast<size_t>(reader.pod<uint64_t>());
+                read(reader, out.tags);
+            }
+
+            //! The records in the pack file start with a header that identifies
+            //! the file the record was created from, followed by the
+            //! uncompressed meta data and the compressed image data.
+            struct Record
+            {
+                Kind               kind     = Kind::Info;
+                uint64_t           key      = 0;
+                System::File::Info fileInfo;
+                int64_t            time     = 0;
+                uint64_t           size     = 0;
+                uint64_t           options  = 0;
+                std::string        meta;
+                uint64_t           dataByteCount           = 0;
+                const uint8_t*     compressedData          = nullptr;
+                uint64_t           compressedDataByteCount = 0;
+            };
+
+            void writeRecord(
+                Writer&                   writer,
+                Kind                      kind,
+                uint64_t                  key,
+                const System::File::Info& fileInfo,
+                size_t                    options,
+                const std::string&        meta,
+                const uint8_t*            data,
+                size_t                    dataByteCount)
+            {
+                writer.data.insert(writer.data.end(), recordMagic, recordMagic + magicByteCount);
+                writer.enumeration(kind);
+                writer.pod(key);
+                writer.string(fileInfo.getPath().get());
+                writer.enumeration(fileInfo.getType());
+                write(writer, fileInfo.getSequence());
+                writer.pod(static_cast<int64_t>(fileInfo.getTime()));
+                writer.pod(static_cast<uint64_t>(fileInfo.getSize()));
+                writer.pod(static_cast<uint64_t>(options));
+                writer.string(meta);
+                writer.pod(static_cast<uint64_t>(dataByteCount));
+                if (dataByteCount > 0)
+                {
+                    uLongf compressedByteCount = compressBound(static_cast<uLong>(dataByteCount));
+                    const size_t pos = writer.data.size();
+                    writer.data.resize(pos + sizeof(uint64_t) + compressedByteCount);
+                    if (compress2(
+                        writer.data.data() + pos + sizeof(uint64_t),
+                        &compressedByteCount,
+                        data,
+                        static_cast<uLong>(dataByteCount),
+                        compressionLevel) != Z_OK)
+                    {
+                        throw std::runtime_error("Cannot compress data.");
+                    }
+                    const uint64_t tmp = compressedByteCount;
+                    memcpy(writer.data.data() + pos, &tmp, sizeof(uint64_t));
+                    writer.data.resize(pos + sizeof(uint64_t) + compressedByteCount);
+                }
+                else
+                {
+                    writer.pod(static_cast<uint64_t>(0));
+                }
+            }
+
+            void readRecord(Reader& reader, Record& out)
+            {
+                if (memcmp(reader.bytes(magicByteCount), recordMagic, magicByteCount) != 0)
+                {
+                    throw std::runtime_error("Invalid record.");
+                }
+                out.kind = reader.enumeration<Kind>();
+                out.key = reader.pod<uint64_t>();
+                const std::string path = reader.string();
+                const auto type = reader.enumeration<System::File::Type>();
+                Math::Frame::Sequence sequence;
+                read(reader, sequence);
+                out.fileInfo = System::File::Info(System::File::Path(path), type, sequence, false);
+                out.time = reader.pod<int64_t>();
+                out.size = reader.pod<uint64_t>();
+                out.options = reader.pod<uint64_t>();
+                out.meta = reader.string();
+                out.dataByteCount = reader.pod<uint64_t>();
+                out.compressedDataByteCount = reader.pod<uint64_t>();
+                out.compressedData = reader.bytes(out.compressedDataByteCount);
+            }
+
+            struct Entry
+            {
+                uint64_t offset    = 0;
+                uint64_t byteCount = 0;
+                uint64_t access    = 0;
+            };
+
+        } // namespace
+
+        struct ThumbnailCache::Private
+        {
+            std::shared_ptr<System::TextSystem> textSystem;
+            std::string fileName;
+            std::string indexFileName;
+            std::shared_ptr<System::File::Lock> lock;
+            bool readOnly = false;
+            size_t maxByteCount = 0;
+            std::shared_ptr<System::File::IO> read;
+            std::shared_ptr<System::File::IO> write;
+            size_t packByteCount = 0;
+            size_t byteCount = 0;
+            std::map<uint64_t, Entry> entries;
+            uint64_t access = 0;
+            std::vector<uint8_t> buffer;
+            mutable std::mutex mutex;
+            std::thread thread;
+            std::atomic<bool> running;
+
+            void create();
+            void open();
+            void close();
+            const uint8_t* map(size_t offset, size_t byteCount);
+            bool readHeader();
+            bool readIndex();
+            void writeIndex();
+            bool scan();
+            bool get(const System::File::Info&, size_t options, Kind, Record&);
+            void add(uint64_t key, const std::vector<uint8_t>&);
+            void remove(std::map<uint64_t, Entry>::iterator);
+            void trim();
+            void compact();
+        };
+
+        void ThumbnailCache::_init(
+            const std::shared_ptr<System::TextSystem>& textSystem,
+            const std::string& fileName,
+            size_t             maxByteCount,
+            bool               validate)
+        {
+            DJV_PRIVATE_PTR();
+            p.running = false;
+            p.textSystem = textSystem;
+            p.fileName = fileName;
+            p.indexFileName = fileName + ".index";
+            p.maxByteCount = maxByteCount;
+
+            // The lock is held until the cache is destroyed so that appending,
+            // compacting, and writing the index are not interleaved with
+            // another process.
+            p.lock = System::File::Lock::create(fileName + ".lock");
+            p.readOnly = !p.lock->tryLock();
+
+            bool valid = false;
+            if (System::File::Info(fileName).doesExist())
+            {
+                try
+                {
+                    p.open();
+                    valid = p.readHeader();
+                }
+                catch (const std::exception&)
+                {}
+            }
+            if (valid)
+            {
+                // Use the index if it matches the pack file, otherwise scan the
+                // pack file for the entries. The index is removed so that it
+                // can't be used again if the pack file is modified without
+                // writing a new one.
+                if (!p.readIndex() && !p.scan() && !p.readOnly)
+                {
+                    p.compact();
+                }
+            }
+            else
+            {
+                p.close();
+                if (!p.readOnly)
+                {
+                    p.create();
+                    p.open();
+                }
+            }
+            if (!p.readOnly)
+            {
+                std::remove(p.indexFileName.c_str());
+                if (p.packByteCount > p.maxByteCount)
+                {
+                    p.trim();
+                }
+            }
+
+            p.running = true;
+            if (validate)
+            {
+                p.thread = std::thread(
+                    [this]
+                    {
+                        this->validate();
+                    });
+            }
+        }
+
+        ThumbnailCache::ThumbnailCache() :
+            _p(new Private)
+        {}
+
+        ThumbnailCache::~ThumbnailCache()
+        {
+            DJV_PRIVATE_PTR();
+            p.running = false;
+            if (p.thread.joinable())
+            {
+                p.thread.join();
+            }
+            if (p.read && p.write)
+            {
+                try
+                {
+                    // Rewrite the pack file if it is too large or if more than
+                    // half of it is removed entries.
+                    if (p.packByteCount > p.maxByteCount ||
+                        p.packByteCount - packHeaderByteCount - p.byteCount > p.byteCount)
+                    {
+                        p.trim();
+                    }
+                    p.close();
+                    p.writeIndex();
+                }
+                catch (const std::exception&)
+                {}
+            }
+        }
+
+        std::shared_ptr<ThumbnailCache> ThumbnailCache::create(
+            const std::shared_ptr<System::TextSystem>& textSystem,
+            const std::string& fileName,
+            size_t             maxByteCount,
+            bool               validate)
+        {
+            auto out = std::shared_ptr<ThumbnailCache>(new ThumbnailCache);
+            out->_init(textSystem, fileName, maxByteCount, validate);
+            return out;
+        }
+
+        const std::string& ThumbnailCache::getFileName() const
+        {
+            return _p->fileName;
+        }
+
+        bool ThumbnailCache::isReadOnly() const
+        {
+            return _p->readOnly;
+        }
+
+        size_t ThumbnailCache::getEntryCount() const
+        {
+            DJV_PRIVATE_PTR();
+            std::lock_guard<std::mutex> lock(p.mutex);
+            return p.entries.size();
+        }
+
+        size_t ThumbnailCache::getByteCount() const
+        {
+            DJV_PRIVATE_PTR();
+            std::lock_guard<std::mutex> lock(p.mutex);
+            return p.byteCount;
+        }
+
+        size_t ThumbnailCache::getPackByteCount() const
+        {
+            DJV_PRIVATE_PTR();
+            std::lock_guard<std::mutex> lock(p.mutex);
+            return p.packByteCount;
+        }
+
+        size_t ThumbnailCache::getMaxByteCount() const
+        {
+            DJV_PRIVATE_PTR();
+            std::lock_guard<std::mutex> lock(p.mutex);
+            return p.maxByteCount;
+        }
+
+        float ThumbnailCache::getPercentageUsed() const
+        {
+            DJV_PRIVATE_PTR();
+            std::lock_guard<std::mutex> lock(p.mutex);
+            return p.maxByteCount > 0 ? (p.byteCount / static_cast<float>(p.maxByteCount) * 100.F) : 0.F;
+        }
+
+        void ThumbnailCache::setMaxByteCount(size_t value)
+        {
+            DJV_PRIVATE_PTR();
+            std::lock_guard<std::mutex> lock(p.mutex);
+            p.maxByteCount = value;
+            if (p.packByteCount > p.maxByteCount)
+            {
+                p.trim();
+            }
+        }
+
+        bool ThumbnailCache::getInfo(const System::File::Info& fileInfo, size_t options, IO::Info& out)
+        {
+            DJV_PRIVATE_PTR();
+            std::lock_guard<std::mutex> lock(p.mutex);
+            Record record;
+            bool found = p.get(fileInfo, options, Kind::Info, record);
+            if (found)
+            {
+                try
+                {
+                    Reader reader(
+                        reinterpret_cast<const uint8_t*>(record.meta.data()),
+                        reinterpret_cast<const uint8_t*>(record.meta.data()) + record.meta.size());
+                    read(reader, out);
+                }
+                catch (const std::exception&)
+                {
+                    p.remove(p.entries.find(record.key));
+                    found = false;
+                }
+            }
+            return found;
+        }
+
+        void ThumbnailCache::addInfo(const System::File::Info& fileInfo, size_t options, const IO::Info& value)
+        {
+            DJV_PRIVATE_PTR();
+            Writer meta;
+            write(meta, value);
+            Writer writer;
+            const uint64_t key = getKey(fileInfo, options, Kind::Info);
+            writeRecord(
+                writer,
+                Kind::Info,
+                key,
+                fileInfo,
+                options,
+                std::string(meta.data.begin(), meta.data.end()),
+                nullptr,
+                0);
+            std::lock_guard<std::mutex> lock(p.mutex);
+            p.add(key, writer.data);
+        }
+
+        std::shared_ptr<Image::Data> ThumbnailCache::getImage(const System::File::Info& fileInfo, size_t options)
+        {
+            DJV_PRIVATE_PTR();
+            std::shared_ptr<Image::Data> out;
+            std::lock_guard<std::mutex> lock(p.mutex);
+            Record record;
+            if (p.get(fileInfo, options, Kind::Image, record))
+            {
+                try
+                {
+                    Reader reader(
+                        reinterpret_cast<const uint8_t*>(record.meta.data()),
+                        reinterpret_cast<const uint8_t*>(record.meta.data()) + record.meta.size());
+                    Image::Info info;
+                    read(reader, info);
+                    const std::string pluginName = reader.string();
+                    Image::Tags tags;
+                    read(reader, tags);
+                    auto image = Image::Data::create(info);
+                    if (image->getDataByteCount() != record.dataByteCount)
+                    {
+                        throw std::runtime_error("Invalid image data.");
+                    }
+
+                    // Decompress directly from the memory map into the image.
+                    uLongf byteCount = static_cast<uLongf>(record.dataByteCount);
+                    if (uncompress(
+                        image->getData(),
+                        &byteCount,
+                        record.compressedData,
+                        static_cast<uLong>(record.compressedDataByteCount)) != Z_OK ||
+                        byteCount != record.dataByteCount)
+                    {
+                        throw std::runtime_error("Cannot uncompress data.");
+                    }
+                    image->setPluginName(pluginName);
+                    image->setTags(tags);
+                    out = image;
+                }
+                catch (const std::exception&)
+                {
+                    p.remove(p.entries.find(record.key));
+                }
+            }
+            return out;
+        }
+
+        void ThumbnailCache::addImage(
+            const System::File::Info&           fileInfo,
+            size_t                              options,
+            const std::shared_ptr<Image::Data>& value)
+        {
+            DJV_PRIVATE_PTR();
+            if (!value)
+            {
+                return;
+            }
+            Writer meta;
+            write(meta, value->getInfo());
+            meta.string(value->getPluginName());
+            write(meta, value->getTags());
+            Writer writer;
+            const uint64_t key = getKey(fileInfo, options, Kind::Image);
+            writeRecord(
+                writer,
+                Kind::Image,
+                key,
+                fileInfo,
+                options,
+                std::string(meta.data.begin(), meta.data.end()),
+                value->getData(),
+                value->getDataByteCount());
+            std::lock_guard<std::mutex> lock(p.mutex);
+            p.add(key, writer.data);
+        }
+
+        void ThumbnailCache::validate()
+        {
+            DJV_PRIVATE_PTR();
+
+            // Copy the entries so the lock is not held while the files are
+            // checked.
+            std::vector<std::pair<uint64_t, uint64_t> > entries;
+            {
+                std::lock_guard<std::mutex> lock(p.mutex);
+                for (const auto& i : p.entries)
+                {
+                    entries.push_back(std::make_pair(i.first, i.second.offset));
+                }
+            }
+
+            // Multiple entries can refer to the same file so the results are
+            // cached.
+            std::map<std::string, bool> results;
+            for (const auto& i : entries)
+            {
+                if (!p.running)
+                {
+                    break;
+                }
+                Record record;
+                {
+                    std::lock_guard<std::mutex> lock(p.mutex);
+                    const auto j = p.entries.find(i.first);
+                    if (j == p.entries.end() || j->second.offset != i.second)
+                    {
+                        continue;
+                    }
+                    try
+                    {
+                        const uint8_t* data = p.map(j->second.offset, j->second.byteCount);
+                        Reader reader(data, data + j->second.byteCount);
+                        readRecord(reader, record);
+                    }
+                    catch (const std::exception&)
+                    {
+                        p.remove(j);
+                        continue;
+                    }
+                }
+                const std::string fileName = record.fileInfo.getFileName();
+                auto k = results.find(fileName);
+                if (k == results.end())
+                {
+                    System::File::Info fileInfo = record.fileInfo;
+                    const bool valid =
+                        fileInfo.stat() &&
+                        fileInfo.doesExist() &&
+                        static_cast<int64_t>(fileInfo.getTime()) == record.time &&
+                        fileInfo.getSize() == record.size;
+                    k = results.insert(std::make_pair(fileName, valid)).first;
+                }
+                if (!k->second)
+                {
+                    std::lock_guard<std::mutex> lock(p.mutex);
+                    const auto j = p.entries.find(i.first);
+                    if (j != p.entries.end() && j->second.offset == i.second)
+                    {
+                        p.remove(j);
+                    }
+                }
+            }
+        }
+
+        void ThumbnailCache::trim()
+        {
+            DJV_PRIVATE_PTR();
+            std::lock_guard<std::mutex> lock(p.mutex);
+            p.trim();
+        }
+
+        void ThumbnailCache::clear()
+        {
+            DJV_PRIVATE_PTR();
+            std::lock_guard<std::mutex> lock(p.mutex);
+            if (p.readOnly)
+            {
+                p.entries.clear();
+                p.byteCount = 0;
+            }
+            else
+            {
+                p.close();
+                p.create();
+                p.open();
+            }
+        }
+
+        void ThumbnailCache::Private::create()
+        {
+            auto io = System::File::IO::create();
+            io->open(fileName, System::File::Mode::Write);
+            io->write(packMagic, magicByteCount);
+            io->writeU32(version);
+            io->close();
+            entries.clear();
+            byteCount = 0;
+        }
+
+        void ThumbnailCache::Private::open()
+        {
+            read = System::File::IO::create();
+            read->open(fileName, System::File::Mode::Read);
+            packByteCount = read->getSize();
+            if (!readOnly)
+            {
+                write = System::File::IO::create();
+                write->open(fileName, System::File::Mode::Append);
+            }
+        }
+
+        void ThumbnailCache::Private::close()
+        {
+            read.reset();
+            write.reset();
+        }
+
+        const uint8_t* ThumbnailCache::Private::map(size_t offset, size_t size)
+        {
+            // Re-open the file if the data was appended after it was mapped.
+            if (offset + size > read->getSize())
+            {
+                read->open(fileName, System::File::Mode::Read);
+                if (offset + size > read->getSize())
+                {
+                    throw System::File::Error(String::Format("{0}: {1}").
+                        arg(fileName).
+                        arg(textSystem->getText(DJV_TEXT("error_incomplete_file"))));
+                }
+            }
+            read->setPos(offset);
+#if defined(DJV_MMAP)
+            const uint8_t* out = read->mmapP();
+#else // DJV_MMAP
+            const uint8_t* out = nullptr;
+#endif // DJV_MMAP
+            if (!out)
+            {
+                buffer.resize(size);
+                read->read(buffer.data(), size);
+                out = buffer.data();
+            }
+            return out;
+        }
+
+        bool ThumbnailCache::Private::readHeader()
+        {
+            bool out = false;
+            if (packByteCount >= packHeaderByteCount)
+            {
+                const uint8_t* data = map(0, packHeaderByteCount);
+                Reader reader(data, data + packHeaderByteCount);
+                out =
+                    0 == memcmp(reader.bytes(magicByteCount), packMagic, magicByteCount) &&
+                    version == reader.pod<uint32_t>();
+            }
+            return out;
+        }
+
+        bool ThumbnailCache::Private::readIndex()
+        {
+            bool out = false;
+            try
+            {
+                if (System::File::Info(indexFileName).doesExist())
+                {
+                    auto io = System::File::IO::create();
+                    io->open(indexFileName, System::File::Mode::Read);
+                    const std::string contents = System::File::readContents(io);
+                    Reader reader(
+                        reinterpret_cast<const uint8_t*>(contents.data()),
+                        reinterpret_cast<const uint8_t*>(contents.data()) + contents.size());
+                    if (0 == memcmp(reader.bytes(magicByteCount), indexMagic, magicByteCount) &&
+                        version == reader.pod<uint32_t>() &&
+                        packByteCount == reader.pod<uint64_t>())
+                    {
+                        std::map<uint64_t, Entry> tmp;
+                        size_t tmpByteCount = 0;
+                        const uint64_t tmpAccess = reader.pod<uint64_t>();
+                        const size_t size = reader.pod<uint32_t>();
+                        for (size_t i = 0; i < size; ++i)
+                        {
+                            const uint64_t key = reader.pod<uint64_t>();
+                            Entry entry;
+                            entry.offset    = reader.pod<uint64_t>();
+                            entry.byteCount = reader.pod<uint64_t>();
+                            entry.access    = reader.pod<uint64_t>();
+                            if (entry.offset < packHeaderByteCount ||
+                                entry.offset + entry.byteCount > packByteCount)
+                            {
+                                throw std::runtime_error("Invalid index entry.");
+                            }
+                            tmp[key] = entry;
+                            tmpByteCount += entry.byteCount;
+                        }
+                        entries = std::move(tmp);
+                        byteCount = tmpByteCount;
+                        access = tmpAccess;
+                        out = true;
+                    }
+                }
+            }
+            catch (const std::exception&)
+            {}
+            return out;
+        }
+
+        void ThumbnailCache::Private::writeIndex()
+        {
+            Writer writer;
+            writer.data.insert(writer.data.end(), indexMagic, indexMagic + magicByteCount);
+            writer.pod(version);
+            writer.pod(static_cast<uint64_t>(packByteCount));
+            writer.pod(access);
+            writer.pod(static_cast<uint32_t>(entries.size()));
+            for (const auto& i : entries)
+            {
+                writer.pod(i.first);
+                writer.pod(i.second.offset);
+                writer.pod(i.second.byteCount);
+                writer.pod(i.second.access);
+            }
+            auto io = System::File::IO::create();
+            io->open(indexFileName, System::File::Mode::Write);
+            io->write(writer.data.data(), writer.data.size());
+        }
+
+        bool ThumbnailCache::Private::scan()
+        {
+            bool out = true;
+            entries.clear();
+            byteCount = 0;
+            if (packByteCount > packHeaderByteCount)
+            {
+                const uint8_t* data = map(packHeaderByteCount, packByteCount - packHeaderByteCount);
+                const uint8_t* end = data + packByteCount - packHeaderByteCount;
+                const uint8_t* p = data;
+                while (p < end)
+                {
+                    try
+                    {
+                        // The records are in the order they were added so the
+                        // file position is used for the initial access order.
+                        Reader reader(p, end);
+                        Record record;
+                        readRecord(reader, record);
+                        Entry entry;
+                        entry.offset    = packHeaderByteCount + (p - data);
+                        entry.byteCount = reader.getP() - p;
+                        entry.access    = ++access;
+                        const auto i = entries.find(record.key);
+                        if (i != entries.end())
+                        {
+                            byteCount -= i->second.byteCount;
+                        }
+                        entries[record.key] = entry;
+                        byteCount += entry.byteCount;
+                        p = reader.getP();
+                    }
+                    catch (const std::exception&)
+                    {
+                        // Skip to the next record. The data may be corrupt or
+                        // the end of the file may be incomplete if the
+                        // application did not exit cleanly.
+                        out = false;
+                        p = std::search(p + 1, end, recordMagic, recordMagic + magicByteCount);
+                    }
+                }
+            }
+            return out;
+        }
+
+        bool ThumbnailCache::Private::get(
+            const System::File::Info& fileInfo,
+            size_t                    options,
+            Kind                      kind,
+            Record&                   out)
+        {
+            bool found = false;
+            const uint64_t key = getKey(fileInfo, options, kind);
+            const auto i = entries.find(key);
+            if (i != entries.end())
+            {
+                try
+                {
+                    const uint8_t* data = map(i->second.offset, i->second.byteCount);
+                    Reader reader(data, data + i->second.byteCount);
+                    readRecord(reader, out);
+                    if (out.key == key &&
+                        out.kind == kind &&
+                        out.fileInfo.getFileName() == fileInfo.getFileName() &&
+                        out.time == static_cast<int64_t>(fileInfo.getTime()) &&
+                        out.size == fileInfo.getSize() &&
+                        out.options == options)
+                    {
+                        i->second.access = ++access;
+                        found = true;
+                    }
+                }
+                catch (const std::exception&)
+                {}
+                if (!found)
+                {
+                    remove(i);
+                }
+            }
+            return found;
+        }
+
+        void ThumbnailCache::Private::add(uint64_t key, const std::vector<uint8_t>& data)
+        {
+            if (readOnly)
+            {
+                return;
+            }
+            write->write(data.data(), data.size());
+            Entry entry;
+            entry.offset    = packByteCount;
+            entry.byteCount = data.size();
+            entry.access    = ++access;
+            remove(entries.find(key));
+            entries[key] = entry;
+            packByteCount += entry.byteCount;
+            byteCount += entry.byteCount;
+            if (packByteCount > maxByteCount)
+            {
+                trim();
+            }
+        }
+
+        void ThumbnailCache::Private::remove(std::map<uint64_t, Entry>::iterator i)
+        {
+            if (i != entries.end())
+            {
+                byteCount -= i->second.byteCount;
+                entries.erase(i);
+            }
+        }
+
+        void ThumbnailCache::Private::trim()
+        {
+            if (readOnly)
+            {
+                return;
+            }
+            std::vector<std::pair<uint64_t, uint64_t> > accessOrder;
+            for (const auto& i : entries)
+            {
+                accessOrder.push_back(std::make_pair(i.second.access, i.first));
+            }
+            std::sort(accessOrder.begin(), accessOrder.end());
+            const size_t trimByteCount = static_cast<size_t>(maxByteCount * trimPercentage);
+            for (auto i = accessOrder.begin(); i != accessOrder.end() && byteCount > trimByteCount; ++i)
+            {
+                remove(entries.find(i->second));
+            }
+            compact();
+        }
+
+        void ThumbnailCache::Private::compact()
+        {
+            // Copy the entries to a new pack file in their current order.
+            std::vector<std::pair<uint64_t, uint64_t> > offsetOrder;
+            for (const auto& i : entries)
+            {
+                offsetOrder.push_back(std::make_pair(i.second.offset, i.first));
+            }
+            std::sort(offsetOrder.begin(), offsetOrder.end());
+            const std::string tmpFileName = fileName + ".tmp";
+            {
+                auto io = System::File::IO::create();
+                io->open(tmpFileName, System::File::Mode::Write);
+                io->write(packMagic, magicByteCount);
+                io->writeU32(version);
+                uint64_t offset = packHeaderByteCount;
+                for (const auto& i : offsetOrder)
+                {
+                    auto& entry = entries[i.second];
+                    io->write(map(entry.offset, entry.byteCount), entry.byteCount);
+                    entry.offset = offset;
+                    offset += entry.byteCount;
+                }
+            }
+            close();
+            std::remove(fileName.c_str());
+            if (std::rename(tmpFileName.c_str(), fileName.c_str()) != 0)
+            {
+                entries.clear();
+                byteCount = 0;
+                create();
+            }
+            open();
+        }
+
+    } // namespace AV
+} // namespace djv
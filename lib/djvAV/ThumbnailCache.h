@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvCore/Core.h>
+
+#include <memory>
+#include <string>
+
+namespace djv
+{
+    namespace System
+    {
+        class TextSystem;
+
+        namespace File
+        {
+            class Info;
+
+        } // namespace File
+    } // namespace System
+
+    namespace Image
+    {
+        class Data;
+
+    } // namespace Image
+
+    namespace AV
+    {
+        namespace IO
+        {
+            class Info;
+
+        } // namespace IO
+
+        //! Persistent thumbnail cache.
+        //!
+        //! The entries are stored compressed in a pack file that is memory
+        //! mapped for reading and appended to for writing. A small index file
+        //! is written next to the pack file when the cache is destroyed so that
+        //! the pack file does not need to be scanned the next time it is
+        //! opened.
+        //!
+        //! Entries are keyed by the file path, modification time, size, and a
+        //! hash of the options that were used to create them. The file
+        //! information should be from a call to System::File::Info::stat().
+        //!
+        //! When the pack file grows larger than the maximum byte count the least
+        //! recently used entries are removed. A background thread removes the
+        //! entries for files that have changed or no longer exist.
+        //!
+        //! Only one process at a time can write to the cache. An advisory lock
+        //! on a lock file next to the pack file is held while the cache is
+        //! open, and if another process holds the lock the cache is opened
+        //! read-only. Read-only caches do not add entries or modify the pack
+        //! and index files.
+        class ThumbnailCache
+        {
+            DJV_NON_COPYABLE(ThumbnailCache);
+
+        protected:
+            void _init(
+                const std::shared_ptr<System::TextSystem>&,
+                const std::string& fileName,
+                size_t             maxByteCount,
+                bool               validate);
+            ThumbnailCache();
+
+        public:
+            ~ThumbnailCache();
+
+            //! Create a new thumbnail cache. If the pack file is missing or
+            //! cannot be read a new one is created.
+            //! Throws:
+            //! - System::File::Error
+            static std::shared_ptr<ThumbnailCache> create(
+                const std::shared_ptr<System::TextSystem>&,
+                const std::string& fileName,
+                size_t             maxByteCount,
+                bool               validate = true);
+
+            //! \name Information
+            ///@{
+
+            const std::string& getFileName() const;
+
+            //! Get whether the cache is read-only because another process is
+            //! writing to it.
+            bool isReadOnly() const;
+
+            size_t getEntryCount() const;
+
+            //! Get the number of bytes used by the entries.
+            size_t getByteCount() const;
+
+            //! Get the size of the pack file including the removed entries that
+            //! have not been trimmed yet.
+            size_t getPackByteCount() const;
+
+            size_t getMaxByteCount() const;
+            float getPercentageUsed() const;
+
+            void setMaxByteCount(size_t);
+
+            ///@}
+
+            //! \name Entries
+            ///@{
+
+            bool getInfo(const System::File::Info&, size_t options, IO::Info&);
+
+            //! Throws:
+            //! - System::File::Error
+            void addInfo(const System::File::Info&, size_t options, const IO::Info&);
+
+            std::shared_ptr<Image::Data> getImage(const System::File::Info&, size_t options);
+
+            //! Throws:
+            //! - System::File::Error
+            void addImage(const System::File::Info&, size_t options, const std::shared_ptr<Image::Data>&);
+
+            ///@}
+
+            //! \name Maintenance
+            ///@{
+
+            //! Remove the entries for files that have changed or no longer
+            //! exist. This is called from a background thread when the cache is
+            //! created.
+            void validate();
+
+            //! Remove the least recently used entries until the cache is below
+            //! the maximum byte count and rewrite the pack file.
+            //! Throws:
+            //! - System::File::Error
+            void trim();
+
+            //! Remove all of the entries. Read-only caches only forget the
+            //! entries and leave the pack file unchanged.
+            //! Throws:
+            //! - System::File::Error
+            void clear();
+
+            ///@}
+
+        private:
+            DJV_PRIVATE();
+        };
+
+    } // namespace AV
+} // namespace djv
@@ -5,9 +5,15 @@
 #include <djvAV/ThumbnailSystem.h>
 
 #include <djvAV/IOSystem.h>
+#include <djvAV/Speed.h>
+#include <djvAV/ThumbnailCache.h>
 
+#include <djvOCIO/ImageConvert.h>
+
+#include <djvGL/GLFWSystem.h>
 #include <djvGL/ImageConvert.h>
 
+#include <djvImage/Convert.h>
 #include <djvImage/Data.h>
 
 #include <djvSystem/Context.h>
@@ -17,12 +23,17 @@
 #include <djvSystem/Timer.h>
 
 #include <djvCore/Cache.h>
+#include <djvCore/Memory.h>
 #include <djvCore/OS.h>
+#include <djvCore/StringFormat.h>
 #include <djvCore/UID.h>
 
 #define GLFW_INCLUDE_NONE
 #include <GLFW/glfw3.h>
 
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
 #include <atomic>
 #include <mutex>
 #include <thread>
@@ -40,6 +51,8 @@ namespace djv
             const size_t imageProcessMax = 4;
             const size_t infoCacheMax    = 1000;
             const size_t imageCacheMax   = 1000;
+            const size_t imageCacheMaxByteCount = 256 * Memory::megabyte;
+            const size_t persistentCacheMaxByteCount = 256 * Memory::megabyte;
 
             struct InfoRequest
             {
@@ -89,6 +102,8 @@ namespace djv
                     fileInfo(other.fileInfo),
                     size(std::move(other.size)),
                     type(std::move(other.type)),
+                    colorSpace(std::move(other.colorSpace)),
+                    configID(std::move(other.configID)),
                     read(std::move(other.read)),
                     promise(std::move(other.promise))
                 {}
@@ -104,6 +119,8 @@ namespace djv
                         fileInfo = other.fileInfo;
                         size = std::move(other.size);
                         type = std::move(other.type);
+                        colorSpace = std::move(other.colorSpace);
+                        configID = std::move(other.configID);
                         read = std::move(other.read);
                         promise = std::move(other.promise);
                     }
@@ -114,6 +131,8 @@ namespace djv
                 System::File::Info fileInfo;
                 Image::Size size;
                 Image::Type type = Image::Type::None;
+                OCIO::Convert colorSpace;
+                std::string configID;
                 std::shared_ptr<IO::IRead> read;
                 std::promise<std::shared_ptr<Image::Data> > promise;
             };
@@ -125,13 +144,56 @@ namespace djv
                 return out;
             }
 
-            size_t getImageCacheKey(const System::File::Info& fileInfo, const Image::Size& size, Image::Type type)
+            void hashColorSpace(size_t& out, const ImageRequest& request)
+            {
+                if (request.colorSpace.isValid())
+                {
+                    Memory::hashCombine(out, request.colorSpace.input);
+                    Memory::hashCombine(out, request.colorSpace.output);
+                    Memory::hashCombine(out, request.configID);
+                }
+            }
+
+            size_t getImageCacheKey(const ImageRequest& request)
             {
                 size_t out = 0;
-                Memory::hashCombine(out, fileInfo.getFileName());
-                Memory::hashCombine(out, size.w);
-                Memory::hashCombine(out, size.h);
-                Memory::hashCombine(out, type);
+                Memory::hashCombine(out, request.fileInfo.getFileName());
+                Memory::hashCombine(out, request.size.w);
+                Memory::hashCombine(out, request.size.h);
+                Memory::hashCombine(out, request.type);
+                hashColorSpace(out, request);
+                return out;
+            }
+
+            //! Get a hash of the I/O options and the default speed. This is
+            //! used so that entries in the persistent cache are not used after
+            //! the options have changed.
+            size_t getOptionsHash(const std::shared_ptr<IO::IOSystem>& io)
+            {
+                size_t out = 0;
+                for (const auto& i : io->getPluginNames())
+                {
+                    rapidjson::Document document;
+                    const auto options = io->getOptions(i, document.GetAllocator());
+                    rapidjson::StringBuffer buffer;
+                    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+                    options.Accept(writer);
+                    Memory::hashCombine(out, i);
+                    Memory::hashCombine(out, std::string(buffer.GetString(), buffer.GetSize()));
+                }
+                const auto speed = fromSpeed(getDefaultSpeed());
+                Memory::hashCombine(out, speed.getNum());
+                Memory::hashCombine(out, speed.getDen());
+                return out;
+            }
+
+            size_t getImageOptionsHash(size_t optionsHash, const ImageRequest& request)
+            {
+                size_t out = optionsHash;
+                Memory::hashCombine(out, request.size.w);
+                Memory::hashCombine(out, request.size.h);
+                Memory::hashCombine(out, request.type);
+                hashColorSpace(out, request);
                 return out;
             }
 
@@ -174,9 +236,15 @@ namespace djv
             Memory::Cache<size_t, std::shared_ptr<Image::Data> > imageCache;
             std::atomic<float> imageCachePercentage;
             std::atomic<bool> clearCache;
+            std::string persistentCacheFileName;
+            bool persistentCacheInit = false;
+            std::shared_ptr<ThumbnailCache> persistentCache;
+            std::mutex persistentCacheMutex;
+            std::atomic<size_t> optionsHash;
             std::shared_ptr<Observer::Value<bool> > ioOptionsObserver;
 
             GLFWwindow * glfwWindow = nullptr;
+            std::shared_ptr<OCIO::ImageConvert> ocioConvert;
             std::shared_ptr<System::Timer> statsTimer;
             std::thread thread;
             std::atomic<bool> running;
@@ -195,29 +263,44 @@ namespace djv
             p.infoCache.setMax(infoCacheMax);
             p.infoCachePercentage = 0.F;
             p.imageCache.setMax(imageCacheMax);
+            p.imageCache.setMaxCost(imageCacheMaxByteCount);
+            p.imageCache.setCostFunction(
+                [](const std::shared_ptr<Image::Data>& value)
+                {
+                    return value ? value->getDataByteCount() : 0;
+                });
             p.imageCachePercentage = 0.F;
             p.clearCache = false;
 
+            auto resourceSystem = context->getSystemT<System::ResourceSystem>();
+            p.persistentCacheFileName = resourceSystem->getPath(System::File::ResourcePath::ThumbnailCacheFile).get();
+            p.optionsHash = getOptionsHash(p.io);
+
+            auto glfwSystem = context->getSystemT<GL::GLFW::GLFWSystem>();
+            if (glfwSystem && glfwSystem->getWindow())
+            {
 #if defined(DJV_GL_ES2)
-            glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_ES_API);
-            glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 2);
-            glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
+                glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_ES_API);
+                glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 2);
+                glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
 #else // DJV_GL_ES2
-            glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
-            glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 1);
-            glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
-            glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+                glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+                glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 1);
+                glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+                glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 #endif // DJV_GL_ES2
-            glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
-            int env = 0;
-            if (OS::getIntEnv("DJV_GL_DEBUG", env) && env != 0)
-            {
-                glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);
+                glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+                int env = 0;
+                if (OS::getIntEnv("DJV_GL_DEBUG", env) && env != 0)
+                {
+                    glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);
+                }
+                p.glfwWindow = glfwCreateWindow(100, 100, context->getName().c_str(), NULL, NULL);
             }
-            p.glfwWindow = glfwCreateWindow(100, 100, context->getName().c_str(), NULL, NULL);
             if (!p.glfwWindow)
             {
-                throw ThumbnailError(p.textSystem->getText(DJV_TEXT("error_glfw_window_creation")));
+                // Convert the thumbnails with the CPU instead of OpenGL.
+                _log(p.textSystem->getText(DJV_TEXT("error_glfw_window_creation")), System::LogLevel::Warning);
             }
 
             p.statsTimer = System::Timer::create(context);
@@ -227,16 +310,25 @@ namespace djv
                 [this](const std::chrono::steady_clock::time_point&, const Time::Duration&)
             {
                 DJV_PRIVATE_PTR();
+                std::shared_ptr<ThumbnailCache> persistentCache;
+                {
+                    std::lock_guard<std::mutex> lock(p.persistentCacheMutex);
+                    persistentCache = p.persistentCache;
+                }
                 std::stringstream ss;
                 {
                     ss << "Info cache: " << p.infoCachePercentage << "%\n";
-                    ss << "Image cache: " << p.imageCachePercentage << '%';
+                    ss << "Image cache: " << p.imageCachePercentage << "%";
+                    if (persistentCache)
+                    {
+                        ss << "\n";
+                        ss << "Persistent cache: " << persistentCache->getPercentageUsed() << "%";
+                    }
                 }
                 _log(ss.str());
             });
 
             auto logSystem = context->getSystemT<System::LogSystem>();
-            auto resourceSystem = context->getSystemT<System::ResourceSystem>();
             p.running = true;
             p.thread = std::thread(
                 [this, resourceSystem, logSystem]
@@ -244,18 +336,22 @@ namespace djv
                 DJV_PRIVATE_PTR();
                 try
                 {
-                    glfwMakeContextCurrent(p.glfwWindow);
+                    std::shared_ptr<GL::ImageConvert> convert;
+                    auto cpuConvert = Image::Convert::create();
+                    if (p.glfwWindow)
+                    {
+                        glfwMakeContextCurrent(p.glfwWindow);
 #if defined(DJV_GL_ES2)
-                    if (!gladLoadGLES2Loader((GLADloadproc)glfwGetProcAddress))
+                        if (!gladLoadGLES2Loader((GLADloadproc)glfwGetProcAddress))
 #else // DJV_GL_ES2
-                    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+                        if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
 #endif // DJV_GL_ES2
-                    {
-                        throw ThumbnailError(p.textSystem->getText(DJV_TEXT("error_glad_init")));
+                        {
+                            throw ThumbnailError(p.textSystem->getText(DJV_TEXT("error_glad_init")));
+                        }
+                        convert = GL::ImageConvert::create(p.textSystem, resourceSystem);
                     }
 
-                    auto convert = GL::ImageConvert::create(p.textSystem, resourceSystem);
-
                     const auto timeout = System::getTimerValue(System::TimerValue::Medium);
                     while (p.running)
                     {
@@ -291,7 +387,7 @@ namespace djv
                         }
                         if (imageRequests)
                         {
-                            _handleImageRequests(convert);
+                            _handleImageRequests(convert, cpuConvert);
                         }
                     }
                 }
@@ -299,6 +395,7 @@ namespace djv
                 {
                     logSystem->log("djv::AV::ThumbnailSystem", e.what(), System::LogLevel::Error);
                 }
+                p.ocioConvert.reset();
             });
 
             auto weak = std::weak_ptr<ThumbnailSystem>(std::dynamic_pointer_cast<ThumbnailSystem>(shared_from_this()));
@@ -383,13 +480,19 @@ namespace djv
         ThumbnailSystem::ImageFuture ThumbnailSystem::getImage(
             const System::File::Info& fileInfo,
             const Image::Size&        size,
-            Image::Type               type)
+            Image::Type               type,
+            const OCIO::Convert&      colorSpace)
         {
             DJV_PRIVATE_PTR();
             ImageRequest request;
             request.fileInfo = fileInfo;
             request.size = size;
             request.type = type;
+            if (colorSpace.isValid())
+            {
+                request.colorSpace = colorSpace;
+                request.configID = OCIO::getCurrentConfigID();
+            }
             auto future = request.promise.get_future();
             {
                 std::unique_lock<std::mutex> lock(p.requestMutex);
@@ -430,7 +533,9 @@ namespace djv
 
         void ThumbnailSystem::clearCache()
         {
-            _p->clearCache = true;
+            DJV_PRIVATE_PTR();
+            p.optionsHash = getOptionsHash(p.io);
+            p.clearCache = true;
         }
 
         void ThumbnailSystem::_handleInfoRequests()
@@ -455,7 +560,20 @@ namespace djv
                 }
                 const auto key = getInfoCacheKey(i.fileInfo);
                 IO::Info info;
-                const bool cached = p.infoCache.get(key, info);
+                bool cached = p.infoCache.get(key, info);
+                if (!cached && _getPersistentCache())
+                {
+                    if (!i.fileInfo.doesExist())
+                    {
+                        i.fileInfo.stat();
+                    }
+                    cached = p.persistentCache->getInfo(i.fileInfo, p.optionsHash, info);
+                    if (cached)
+                    {
+                        p.infoCache.add(key, info);
+                        p.infoCachePercentage = p.infoCache.getPercentageUsed();
+                    }
+                }
                 if (cached)
                 {
                     i.promise.set_value(info);
@@ -491,10 +609,11 @@ namespace djv
                 {
                     try
                     {
-                    const auto info = i->infoFuture.get();
-                    p.infoCache.add(getInfoCacheKey(i->fileInfo), info);
-                    p.infoCachePercentage = p.infoCache.getPercentageUsed();
-                    i->promise.set_value(info);
+                        const auto info = i->infoFuture.get();
+                        p.infoCache.add(getInfoCacheKey(i->fileInfo), info);
+                        p.infoCachePercentage = p.infoCache.getPercentageUsed();
+                        _addPersistent(i->fileInfo, info);
+                        i->promise.set_value(info);
                     }
                     catch (const std::exception&)
                     {
@@ -516,7 +635,9 @@ namespace djv
             }
         }
 
-        void ThumbnailSystem::_handleImageRequests(const std::shared_ptr<GL::ImageConvert>& convert)
+        void ThumbnailSystem::_handleImageRequests(
+            const std::shared_ptr<GL::ImageConvert>& convert,
+            const std::shared_ptr<Image::Convert>& cpuConvert)
         {
             DJV_PRIVATE_PTR();
 
@@ -536,9 +657,24 @@ namespace djv
                         break;
                     }
                 }
-                const auto key = getImageCacheKey(i.fileInfo, i.size, i.type);
+                const auto key = getImageCacheKey(i);
                 std::shared_ptr<Image::Data> image;
                 p.imageCache.get(key, image);
+                if (!image && _getPersistentCache())
+                {
+                    if (!i.fileInfo.doesExist())
+                    {
+                        i.fileInfo.stat();
+                    }
+                    image = p.persistentCache->getImage(
+                        i.fileInfo,
+                        getImageOptionsHash(p.optionsHash, i));
+                    if (image)
+                    {
+                        p.imageCache.add(key, image);
+                        p.imageCachePercentage = p.imageCache.getPercentageUsed();
+                    }
+                }
                 if (image)
                 {
                     i.promise.set_value(image);
@@ -547,7 +683,9 @@ namespace djv
                 {
                     try
                     {
-                        i.read = p.io->read(i.fileInfo);
+                        IO::ReadOptions options;
+                        options.preferredSize = i.size;
+                        i.read = p.io->read(i.fileInfo, options);
                         const auto info = i.read->getInfo().get();
                         if (info.video.size() > 0)
                         {
@@ -596,20 +734,21 @@ namespace djv
                     {
                         Image::Size imageSize = image->getSize();
                         imageSize.w *= image->getInfo().pixelAspectRatio;
-                        if (i->size != imageSize || i->type != Image::Type::None)
+                        const bool colorSpace = i->colorSpace.isValid();
+                        if (i->size != imageSize || i->type != Image::Type::None || colorSpace)
                         {
                             Image::Size size = i->size;
                             const float aspect = size.h != 0 ? (size.w / static_cast<float>(size.h)) : 1.F;
                             const float imageAspect = imageSize.h != 0 ? (imageSize.w / static_cast<float>(imageSize.h)) : 1.F;
                             if (imageAspect < aspect)
                             {
-                                size.w = static_cast<uint16_t>(size.h * imageAspect);
+                                size.w = static_cast<uint32_t>(size.h * imageAspect);
                             }
                             else
                             {
-                                size.h = static_cast<int>(size.w / imageAspect);
+                                size.h = static_cast<uint32_t>(size.w / imageAspect);
                             }
-                            const auto type = i->type != Image::Type::None ? i->type : image->getType();
+                            const auto type = i->type != Image::Type::None ? i->type : Image::getRGBType(image->getType());
                             auto info = Image::Info(size, type);
 #if defined(DJV_GL_ES2)
                             info.type = Image::Type::RGBA_U8;
@@ -617,11 +756,43 @@ namespace djv
                             auto tmp = Image::Data::create(info);
                             tmp->setPluginName(image->getPluginName());
                             tmp->setTags(image->getTags());
-                            convert->process(*image, info, *tmp);
+                            if (colorSpace)
+                            {
+                                // Resize the image with floating point data, convert
+                                // the color space, and then convert to the output type.
+                                const uint8_t channelCount = Image::getChannelCount(info.type);
+                                const Image::Info ocioInfo(
+                                    size,
+                                    2 == channelCount || 4 == channelCount ? Image::Type::RGBA_F32 : Image::Type::RGB_F32);
+                                auto ocioData = Image::Data::create(ocioInfo);
+                                if (convert)
+                                {
+                                    convert->process(*image, ocioInfo, *ocioData);
+                                }
+                                else
+                                {
+                                    cpuConvert->process(*image, ocioInfo, *ocioData);
+                                }
+                                if (!p.ocioConvert)
+                                {
+                                    p.ocioConvert = OCIO::ImageConvert::create();
+                                }
+                                p.ocioConvert->process(*ocioData, i->colorSpace);
+                                cpuConvert->process(*ocioData, info, *tmp);
+                            }
+                            else if (convert)
+                            {
+                                convert->process(*image, info, *tmp);
+                            }
+                            else
+                            {
+                                cpuConvert->process(*image, info, *tmp);
+                            }
                             image = tmp;
                         }
-                        p.imageCache.add(getImageCacheKey(i->fileInfo, i->size, i->type), image);
+                        p.imageCache.add(getImageCacheKey(*i), image);
                         p.imageCachePercentage = p.imageCache.getPercentageUsed();
+                        _addPersistent(i->fileInfo, getImageOptionsHash(p.optionsHash, *i), image);
                         i->promise.set_value(image);
                     }
                     catch (const std::exception&)
@@ -651,5 +822,71 @@ namespace djv
             }
         }
 
+        std::shared_ptr<ThumbnailCache> ThumbnailSystem::_getPersistentCache()
+        {
+            DJV_PRIVATE_PTR();
+            // The persistent cache is created when thumbnails are first
+            // requested so that processes which don't use thumbnails don't
+            // open it.
+            if (!p.persistentCacheInit)
+            {
+                p.persistentCacheInit = true;
+                try
+                {
+                    auto persistentCache = ThumbnailCache::create(
+                        p.textSystem,
+                        p.persistentCacheFileName,
+                        persistentCacheMaxByteCount);
+                    if (persistentCache->isReadOnly())
+                    {
+                        _log(String::Format("{0}: Another process is writing to the persistent cache, opening it read-only.").
+                            arg(p.persistentCacheFileName));
+                    }
+                    std::lock_guard<std::mutex> lock(p.persistentCacheMutex);
+                    p.persistentCache = persistentCache;
+                }
+                catch (const std::exception& e)
+                {
+                    _log(e.what(), System::LogLevel::Error);
+                }
+            }
+            return p.persistentCache;
+        }
+
+        void ThumbnailSystem::_addPersistent(const System::File::Info& fileInfo, const IO::Info& info)
+        {
+            DJV_PRIVATE_PTR();
+            if (p.persistentCache && fileInfo.doesExist())
+            {
+                try
+                {
+                    p.persistentCache->addInfo(fileInfo, p.optionsHash, info);
+                }
+                catch (const std::exception& e)
+                {
+                    _log(e.what(), System::LogLevel::Error);
+                }
+            }
+        }
+
+        void ThumbnailSystem::_addPersistent(
+            const System::File::Info&           fileInfo,
+            size_t                              optionsHash,
+            const std::shared_ptr<Image::Data>& image)
+        {
+            DJV_PRIVATE_PTR();
+            if (p.persistentCache && fileInfo.doesExist())
+            {
+                try
+                {
+                    p.persistentCache->addImage(fileInfo, optionsHash, image);
+                }
+                catch (const std::exception& e)
+                {
+                    _log(e.what(), System::LogLevel::Error);
+                }
+            }
+        }
+
     } // namespace AV
 } // namespace djv
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <djvOCIO/OCIO.h>
+
 #include <djvImage/Type.h>
 
 #include <djvSystem/ISystem.h>
@@ -25,6 +27,7 @@ namespace djv
 
     namespace Image
     {
+        class Convert;
         class Data;
         class Info;
         class Size;
@@ -44,6 +47,8 @@ namespace djv
             class Info;
 
         } // namespace IO
+
+        class ThumbnailCache;
             
         //! Thumbnail error.
         class ThumbnailError : public std::runtime_error
@@ -93,11 +98,14 @@ namespace djv
                 Core::UID uid = 0;
             };
 
-            //! Get a thumbnail image.
+            //! Get a thumbnail image. If a color space conversion is given
+            //! it is applied to the thumbnail with the current OpenColorIO
+            //! configuration, without using OpenGL.
             ImageFuture getImage(
                 const System::File::Info& path,
                 const Image::Size&        size,
-                Image::Type               type = Image::Type::None);
+                Image::Type               type       = Image::Type::None,
+                const OCIO::Convert&      colorSpace = OCIO::Convert());
 
             //! Cancel a thumbnail image.
             void cancelImage(Core::UID);
@@ -108,12 +116,21 @@ namespace djv
             //! Get the image cache percentage used.
             float getImageCachePercentage() const;
 
-            //! Clear the cache.
+            //! Clear the cache. The persistent cache is not cleared since the
+            //! entries are keyed by the I/O options.
             void clearCache();
 
         private:
             void _handleInfoRequests();
-            void _handleImageRequests(const std::shared_ptr<GL::ImageConvert>&);
+            void _handleImageRequests(
+                const std::shared_ptr<GL::ImageConvert>&,
+                const std::shared_ptr<Image::Convert>&);
+            std::shared_ptr<ThumbnailCache> _getPersistentCache();
+            void _addPersistent(const System::File::Info&, const IO::Info&);
+            void _addPersistent(
+                const System::File::Info&,
+                size_t optionsHash,
+                const std::shared_ptr<Image::Data>&);
 
             DJV_PRIVATE();
         };
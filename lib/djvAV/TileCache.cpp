@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAV/TileCache.h>
+
+#include <djvCore/Cache.h>
+
+#include <algorithm>
+#include <limits>
+#include <mutex>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace IO
+        {
+            Image::Size getLevelSize(const Image::Size& size, uint8_t level)
+            {
+                Image::Size out = size;
+                for (uint8_t i = 0; i < level; ++i)
+                {
+                    out.w = std::max((out.w + 1) / 2, 1U);
+                    out.h = std::max((out.h + 1) / 2, 1U);
+                }
+                return out;
+            }
+
+            uint8_t getLevelCount(const Image::Size& size, uint32_t tileSize)
+            {
+                uint8_t out = 1;
+                Image::Size levelSize = size;
+                while ((levelSize.w > tileSize || levelSize.h > tileSize) && out < 32)
+                {
+                    levelSize.w = (levelSize.w + 1) / 2;
+                    levelSize.h = (levelSize.h + 1) / 2;
+                    ++out;
+                }
+                return out;
+            }
+
+            void getTileCount(const Image::Size& levelSize, uint32_t& x, uint32_t& y, uint32_t tileSize)
+            {
+                x = tileSize > 0 ? ((levelSize.w + tileSize - 1) / tileSize) : 0;
+                y = tileSize > 0 ? ((levelSize.h + tileSize - 1) / tileSize) : 0;
+            }
+
+            Math::BBox2i getTileWindow(const Tile& tile, const Image::Size& levelSize, uint32_t tileSize)
+            {
+                const uint32_t x0 = tile.x * tileSize;
+                const uint32_t y0 = tile.y * tileSize;
+                const uint32_t x1 = std::min(x0 + tileSize, levelSize.w);
+                const uint32_t y1 = std::min(y0 + tileSize, levelSize.h);
+                return Math::BBox2i(
+                    static_cast<int>(x0),
+                    static_cast<int>(y0),
+                    x1 > x0 ? static_cast<int>(x1 - x0) : 0,
+                    y1 > y0 ? static_cast<int>(y1 - y0) : 0);
+            }
+
+            struct TileCache::Private
+            {
+                mutable std::mutex mutex;
+                Memory::Cache<Tile, std::shared_ptr<Image::Data> > cache;
+            };
+
+            TileCache::TileCache() :
+                _p(new Private)
+            {
+                DJV_PRIVATE_PTR();
+                p.cache.setMax(std::numeric_limits<size_t>::max());
+                p.cache.setCostFunction(
+                    [](const std::shared_ptr<Image::Data>& value)
+                    {
+                        return value ? value->getDataByteCount() : 0;
+                    });
+            }
+
+            TileCache::~TileCache()
+            {}
+
+            std::shared_ptr<TileCache> TileCache::create()
+            {
+                return std::shared_ptr<TileCache>(new TileCache);
+            }
+
+            size_t TileCache::getMaxByteCount() const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                return p.cache.getMaxCost();
+            }
+
+            size_t TileCache::getByteCount() const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                return p.cache.getCost();
+            }
+
+            size_t TileCache::getCount() const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                return p.cache.getSize();
+            }
+
+            void TileCache::setMaxByteCount(size_t value)
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                p.cache.setMaxCost(value);
+            }
+
+            bool TileCache::contains(const Tile& tile) const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                return p.cache.contains(tile);
+            }
+
+            bool TileCache::get(const Tile& tile, std::shared_ptr<Image::Data>& value) const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                return p.cache.get(tile, value);
+            }
+
+            void TileCache::add(const Tile& tile, const std::shared_ptr<Image::Data>& value)
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                p.cache.add(tile, value);
+            }
+
+            void TileCache::clear()
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                p.cache.clear();
+            }
+
+        } // namespace IO
+    } // namespace AV
+} // namespace djv
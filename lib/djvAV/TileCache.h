@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvImage/Data.h>
+
+#include <djvMath/BBox.h>
+#include <djvMath/FrameNumber.h>
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace IO
+        {
+            //! The size of the image tiles.
+            const uint32_t tileSize = 512;
+
+            //! Image tile.
+            //!
+            //! Tiles are identified by the frame, the mip level, and the
+            //! position of the tile in the level. Level zero is the full
+            //! resolution image, and each level is half the size of the
+            //! previous level (rounding up).
+            class Tile
+            {
+            public:
+                Tile() noexcept;
+                Tile(Math::Frame::Index frame, uint8_t level, uint32_t x, uint32_t y) noexcept;
+
+                Math::Frame::Index frame = Math::Frame::invalidIndex;
+                uint8_t level = 0;
+                uint32_t x = 0;
+                uint32_t y = 0;
+
+                bool operator == (const Tile&) const noexcept;
+                bool operator != (const Tile&) const noexcept;
+                bool operator < (const Tile&) const noexcept;
+            };
+
+            //! \name Tile Utility
+            ///@{
+
+            //! Get the size of a mip level.
+            Image::Size getLevelSize(const Image::Size&, uint8_t level);
+
+            //! Get the number of mip levels, the last level is the first
+            //! one that fits within a single tile.
+            uint8_t getLevelCount(const Image::Size&, uint32_t tileSize = IO::tileSize);
+
+            //! Get the number of tiles in a mip level.
+            void getTileCount(const Image::Size& levelSize, uint32_t& x, uint32_t& y, uint32_t tileSize = IO::tileSize);
+
+            //! Get the pixel window of a tile, clamped to the size of the
+            //! mip level.
+            Math::BBox2i getTileWindow(const Tile&, const Image::Size& levelSize, uint32_t tileSize = IO::tileSize);
+
+            ///@}
+
+            //! Tile cache.
+            //!
+            //! The least recently used tiles are removed when the memory
+            //! budget is exceeded. This class is thread safe.
+            class TileCache
+            {
+                DJV_NON_COPYABLE(TileCache);
+
+            protected:
+                TileCache();
+
+            public:
+                ~TileCache();
+
+                static std::shared_ptr<TileCache> create();
+
+                //! \name Size
+                ///@{
+
+                //! Get the maximum number of bytes. A value of zero means the
+                //! size is not limited.
+                size_t getMaxByteCount() const;
+                size_t getByteCount() const;
+                size_t getCount() const;
+
+                void setMaxByteCount(size_t);
+
+                ///@}
+
+                //! \name Tiles
+                ///@{
+
+                bool contains(const Tile&) const;
+                bool get(const Tile&, std::shared_ptr<Image::Data>&) const;
+
+                void add(const Tile&, const std::shared_ptr<Image::Data>&);
+                void clear();
+
+                ///@}
+
+            private:
+                DJV_PRIVATE();
+            };
+
+        } // namespace IO
+    } // namespace AV
+} // namespace djv
+
+namespace std
+{
+    template<>
+    struct hash<djv::AV::IO::Tile>
+    {
+        std::size_t operator() (const djv::AV::IO::Tile&) const noexcept;
+    };
+
+} // namespace std
+
+#include <djvAV/TileCacheInline.h>
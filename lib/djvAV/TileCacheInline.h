@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvCore/Memory.h>
+
+#include <tuple>
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace IO
+        {
+            inline Tile::Tile() noexcept
+            {}
+
+            inline Tile::Tile(Math::Frame::Index frame, uint8_t level, uint32_t x, uint32_t y) noexcept :
+                frame(frame),
+                level(level),
+                x(x),
+                y(y)
+            {}
+
+            inline bool Tile::operator == (const Tile& other) const noexcept
+            {
+                return
+                    frame == other.frame &&
+                    level == other.level &&
+                    x == other.x &&
+                    y == other.y;
+            }
+
+            inline bool Tile::operator != (const Tile& other) const noexcept
+            {
+                return !(*this == other);
+            }
+
+            inline bool Tile::operator < (const Tile& other) const noexcept
+            {
+                return std::tie(frame, level, y, x) < std::tie(other.frame, other.level, other.y, other.x);
+            }
+
+        } // namespace IO
+    } // namespace AV
+} // namespace djv
+
+namespace std
+{
+    inline std::size_t hash<djv::AV::IO::Tile>::operator() (const djv::AV::IO::Tile& value) const noexcept
+    {
+        std::size_t hash = 0;
+        djv::Core::Memory::hashCombine(hash, value.frame);
+        djv::Core::Memory::hashCombine(hash, value.level);
+        djv::Core::Memory::hashCombine(hash, value.x);
+        djv::Core::Memory::hashCombine(hash, value.y);
+        return hash;
+    }
+
+} // namespace std
@@ -17,8 +17,11 @@
 #include <djvCore/StringFormat.h>
 #include <djvCore/String.h>
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <sstream>
+#include <thread>
 
 using namespace djv::Core;
 
@@ -28,15 +31,19 @@ namespace djv
     {
         namespace
         {
+            const size_t tickRateDefault = 60;
+
             //! \todo Should this be configurable?
-            const size_t frameRate = 60;
+            const std::chrono::milliseconds idleTimeout(1000);
 
         } // namespace
 
         struct Application::Private
         {
-            bool running = false;
+            std::atomic<bool> running;
             int exit = 0;
+            size_t tickRate = tickRateDefault;
+            bool batchMode = false;
         };
 
         void Application::_init(std::list<std::string>& args)
@@ -83,7 +90,9 @@ namespace djv
 
         Application::Application() :
             _p(new Private)
-        {}
+        {
+            _p->running = false;
+        }
 
         Application::~Application()
         {}
@@ -98,21 +107,31 @@ namespace djv
         void Application::run()
         {
             DJV_PRIVATE_PTR();
-            auto time = std::chrono::steady_clock::now();
-            Time::Duration delta = Time::Duration::zero();
             p.running = true;
             while (p.running)
             {
+                const auto time = std::chrono::steady_clock::now();
                 tick();
+                if (p.batchMode || !p.running)
+                {
+                    continue;
+                }
 
-                auto end = std::chrono::steady_clock::now();
-                delta = std::chrono::duration_cast<Time::Duration>(end - time);
-                while (delta < std::chrono::microseconds(1000000 / frameRate))
+                // Don't tick faster than the tick rate.
+                if (p.tickRate > 0)
                 {
-                    end = std::chrono::steady_clock::now();
-                    delta = std::chrono::duration_cast<Time::Duration>(end - time);
+                    std::this_thread::sleep_until(time + std::chrono::duration_cast<Time::Duration>(
+                        std::chrono::duration<double>(1.0 / p.tickRate)));
+                }
+
+                // Sleep until a system needs to be ticked or until we are
+                // woken up from another thread.
+                const auto now = std::chrono::steady_clock::now();
+                const auto nextTick = std::min(getNextTick(), now + idleTimeout);
+                if (nextTick > now)
+                {
+                    wait(nextTick);
                 }
-                time = end;
             }
         }
 
@@ -124,8 +143,29 @@ namespace djv
         void Application::exit(int value)
         {
             DJV_PRIVATE_PTR();
-            p.running = false;
             p.exit = value;
+            p.running = false;
+            wake();
+        }
+
+        size_t Application::getTickRate() const
+        {
+            return _p->tickRate;
+        }
+
+        bool Application::isBatchMode() const
+        {
+            return _p->batchMode;
+        }
+
+        void Application::setTickRate(size_t value)
+        {
+            _p->tickRate = value;
+        }
+
+        void Application::setBatchMode(bool value)
+        {
+            _p->batchMode = value;
         }
 
         std::list<std::string> Application::args(int argc, char** argv)
@@ -171,6 +211,32 @@ namespace djv
                     auto avSystem = getSystemT<AV::AVSystem>();
                     avSystem->setTimeUnits(value);
                 }
+                else if ("-tick_rate" == *arg)
+                {
+                    arg = args.erase(arg);
+                    if (args.end() == arg)
+                    {
+                        throw std::runtime_error(String::Format("{0}: {1}").
+                            arg("-tick_rate").
+                            arg(textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+                    }
+                    int value = 0;
+                    std::stringstream ss(*arg);
+                    ss >> value;
+                    if (ss.fail() || value < 0)
+                    {
+                        throw std::runtime_error(String::Format("{0}: {1}").
+                            arg("-tick_rate").
+                            arg(textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+                    }
+                    arg = args.erase(arg);
+                    setTickRate(static_cast<size_t>(value));
+                }
+                else if ("-batch" == *arg)
+                {
+                    arg = args.erase(arg);
+                    setBatchMode(true);
+                }
                 else if ("-h" == *arg || "-help" == *arg || "--help" == *arg)
                 {
                     arg = args.erase(arg);
@@ -212,6 +278,16 @@ namespace djv
                 std::cout << "   " << s << std::endl;
             }
             std::cout << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("cli_option_tick_rate")) << std::endl;
+            {
+                const std::string s = String::Format(textSystem->getText(DJV_TEXT("cli_option_tick_rate_description"))).
+                    arg(_p->tickRate);
+                std::cout << "   " << s << std::endl;
+            }
+            std::cout << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("cli_option_batch")) << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("cli_option_batch_description")) << std::endl;
+            std::cout << std::endl;
             std::cout << "   " << textSystem->getText(DJV_TEXT("cli_option_log_console")) << std::endl;
             std::cout << "   " << textSystem->getText(DJV_TEXT("cli_option_log_console_description")) << std::endl;
             std::cout << std::endl;
@@ -22,6 +22,11 @@ namespace djv
     namespace CmdLine
     {
         //! Command-line application.
+        //!
+        //! The event loop ticks the context at the tick rate. Between ticks
+        //! the application sleeps until the next timer is due or until the
+        //! context is woken up from another thread. In batch mode the
+        //! context is ticked as fast as possible without sleeping.
         class Application : public System::Context
         {
             DJV_NON_COPYABLE(Application);
@@ -40,6 +45,19 @@ namespace djv
             int getExitCode() const;
             void exit(int);
 
+            //! \name Event Loop
+            ///@{
+
+            //! Get the maximum number of ticks per second. A value of zero
+            //! means the tick rate is not limited.
+            size_t getTickRate() const;
+            bool isBatchMode() const;
+
+            void setTickRate(size_t);
+            void setBatchMode(bool);
+
+            ///@}
+
             static std::list<std::string> args(int, char**);
             static std::list<std::string> args(int, wchar_t**);
 
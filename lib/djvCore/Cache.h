@@ -6,9 +6,13 @@
 
 #include <djvCore/Core.h>
 
-#include <map>
+#include <functional>
+#include <list>
+#include <unordered_map>
 #include <vector>
 
+#include <cstddef>
+
 namespace djv
 {
     namespace Core
@@ -17,8 +21,13 @@ namespace djv
         {
             //! Memory cache.
             //!
+            //! The cache discards the least recently used entries when either
+            //! the maximum number of entries or the maximum cost is exceeded.
+            //! The cost of an entry is given by an optional cost function
+            //! (e.g., the number of bytes used by the value).
+            //!
             //! \todo Return an iterator from get() instead of a value?
-            template<typename T, typename U>
+            template<typename T, typename U, typename H = std::hash<T> >
             class Cache
             {
             public:
@@ -33,28 +42,74 @@ namespace djv
 
                 ///@}
 
+                //! \name Cost
+                ///@{
+
+                //! Get the maximum cost. A value of zero means the cost is
+                //! not limited.
+                size_t getMaxCost() const;
+                size_t getCost() const;
+
+                void setMaxCost(size_t);
+                void setCostFunction(const std::function<size_t(const U&)>&);
+
+                ///@}
+
+                //! \name Statistics
+                ///@{
+
+                size_t getHitCount() const;
+                size_t getMissCount() const;
+                size_t getEvictionCount() const;
+
+                void resetStatistics();
+
+                ///@}
+
                 //! \name Contents
                 ///@{
 
                 bool contains(const T& key) const;
                 bool get(const T& key, U& value) const;
-                
+
                 void add(const T& key, const U& value);
                 void remove(const T& key);
                 void clear();
 
+                //! Get the keys ordered from the most recently used to the
+                //! least recently used. Callers that need sorted keys should
+                //! sort them.
                 std::vector<T> getKeys() const;
+
+                //! Get the values in the same order as the keys.
                 std::vector<U> getValues() const;
 
                 ///@}
 
             private:
+                struct Entry
+                {
+                    T key;
+                    U value;
+                    size_t cost;
+                };
+                typedef std::list<Entry> List;
+
                 void _maxUpdate();
 
                 size_t _max = 10000;
-                std::map<T, U> _map;
-                mutable std::map<T, int64_t> _counts;
-                mutable int64_t _counter = 0;
+                size_t _maxCost = 0;
+                size_t _cost = 0;
+                std::function<size_t(const U&)> _costFunction;
+
+                // The list is ordered from the most recently used entry to
+                // the least recently used entry.
+                mutable List _list;
+                std::unordered_map<T, typename List::iterator, H> _map;
+
+                mutable size_t _hitCount = 0;
+                mutable size_t _missCount = 0;
+                size_t _evictionCount = 0;
             };
 
         } // namespace Memory
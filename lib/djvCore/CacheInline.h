@@ -10,133 +10,191 @@ namespace djv
     {
         namespace Memory
         {
-            template<typename T, typename U>
-            inline size_t Cache<T, U>::getMax() const
+            template<typename T, typename U, typename H>
+            inline size_t Cache<T, U, H>::getMax() const
             {
                 return _max;
             }
 
-            template<typename T, typename U>
-            inline size_t Cache<T, U>::getSize() const
+            template<typename T, typename U, typename H>
+            inline size_t Cache<T, U, H>::getSize() const
             {
                 return _map.size();
             }
 
-            template<typename T, typename U>
-            inline float Cache<T, U>::getPercentageUsed() const
+            template<typename T, typename U, typename H>
+            inline float Cache<T, U, H>::getPercentageUsed() const
             {
-                return _map.size() / static_cast<float>(_max) * 100.F;
+                float out = _max > 0 ? (_map.size() / static_cast<float>(_max) * 100.F) : 0.F;
+                if (_maxCost > 0)
+                {
+                    out = std::max(out, _cost / static_cast<float>(_maxCost) * 100.F);
+                }
+                return out;
             }
 
-            template<typename T, typename U>
-            inline void Cache<T, U>::setMax(size_t value)
+            template<typename T, typename U, typename H>
+            inline void Cache<T, U, H>::setMax(size_t value)
             {
                 _max = value;
                 _maxUpdate();
             }
 
-            template<typename T, typename U>
-            inline bool Cache<T, U>::contains(const T& key) const
+            template<typename T, typename U, typename H>
+            inline size_t Cache<T, U, H>::getMaxCost() const
+            {
+                return _maxCost;
+            }
+
+            template<typename T, typename U, typename H>
+            inline size_t Cache<T, U, H>::getCost() const
+            {
+                return _cost;
+            }
+
+            template<typename T, typename U, typename H>
+            inline void Cache<T, U, H>::setMaxCost(size_t value)
+            {
+                _maxCost = value;
+                _maxUpdate();
+            }
+
+            template<typename T, typename U, typename H>
+            inline void Cache<T, U, H>::setCostFunction(const std::function<size_t(const U&)>& value)
+            {
+                _costFunction = value;
+                _cost = 0;
+                for (auto& i : _list)
+                {
+                    i.cost = _costFunction ? _costFunction(i.value) : 0;
+                    _cost += i.cost;
+                }
+                _maxUpdate();
+            }
+
+            template<typename T, typename U, typename H>
+            inline size_t Cache<T, U, H>::getHitCount() const
+            {
+                return _hitCount;
+            }
+
+            template<typename T, typename U, typename H>
+            inline size_t Cache<T, U, H>::getMissCount() const
+            {
+                return _missCount;
+            }
+
+            template<typename T, typename U, typename H>
+            inline size_t Cache<T, U, H>::getEvictionCount() const
+            {
+                return _evictionCount;
+            }
+
+            template<typename T, typename U, typename H>
+            inline void Cache<T, U, H>::resetStatistics()
+            {
+                _hitCount = 0;
+                _missCount = 0;
+                _evictionCount = 0;
+            }
+
+            template<typename T, typename U, typename H>
+            inline bool Cache<T, U, H>::contains(const T& key) const
             {
                 return _map.find(key) != _map.end();
             }
 
-            template<typename T, typename U>
-            inline bool Cache<T, U>::get(const T& key, U& value) const
+            template<typename T, typename U, typename H>
+            inline bool Cache<T, U, H>::get(const T& key, U& value) const
             {
-                auto i = _map.find(key);
+                const auto i = _map.find(key);
                 if (i != _map.end())
                 {
-                    value = i->second;
-                    auto j = _counts.find(key);
-                    if (j != _counts.end())
-                    {
-                        ++_counter;
-                        j->second = _counter;
-                    }
+                    value = i->second->value;
+                    _list.splice(_list.begin(), _list, i->second);
+                    ++_hitCount;
                     return true;
                 }
-                return i != _map.end();
+                ++_missCount;
+                return false;
             }
 
-            template<typename T, typename U>
-            inline void Cache<T, U>::add(const T& key, const U& value)
+            template<typename T, typename U, typename H>
+            inline void Cache<T, U, H>::add(const T& key, const U& value)
             {
-                _map[key] = value;
-                ++_counter;
-                _counts[key] = _counter;
+                const size_t cost = _costFunction ? _costFunction(value) : 0;
+                const auto i = _map.find(key);
+                if (i != _map.end())
+                {
+                    _cost -= i->second->cost;
+                    i->second->value = value;
+                    i->second->cost = cost;
+                    _list.splice(_list.begin(), _list, i->second);
+                }
+                else
+                {
+                    _list.push_front(Entry{ key, value, cost });
+                    _map[key] = _list.begin();
+                }
+                _cost += cost;
                 _maxUpdate();
             }
 
-            template<typename T, typename U>
-            inline void Cache<T, U>::remove(const T& key)
+            template<typename T, typename U, typename H>
+            inline void Cache<T, U, H>::remove(const T& key)
             {
                 const auto i = _map.find(key);
                 if (i != _map.end())
                 {
+                    _cost -= i->second->cost;
+                    _list.erase(i->second);
                     _map.erase(i);
                 }
-                const auto j = _counts.find(key);
-                if (j != _counts.end())
-                {
-                    _counts.erase(j);
-                }
-                _maxUpdate();
             }
-            
-            template<typename T, typename U>
-            inline void Cache<T, U>::clear()
+
+            template<typename T, typename U, typename H>
+            inline void Cache<T, U, H>::clear()
             {
                 _map.clear();
+                _list.clear();
+                _cost = 0;
             }
 
-            template<typename T, typename U>
-            inline std::vector<T> Cache<T, U>::getKeys() const
+            template<typename T, typename U, typename H>
+            inline std::vector<T> Cache<T, U, H>::getKeys() const
             {
                 std::vector<T> out;
-                for (const auto& i : _map)
+                out.reserve(_list.size());
+                for (const auto& i : _list)
                 {
-                    out.push_back(i.first);
+                    out.push_back(i.key);
                 }
                 return out;
             }
 
-            template<typename T, typename U>
-            inline std::vector<U> Cache<T, U>::getValues() const
+            template<typename T, typename U, typename H>
+            inline std::vector<U> Cache<T, U, H>::getValues() const
             {
                 std::vector<U> out;
-                for (const auto& i : _map)
+                out.reserve(_list.size());
+                for (const auto& i : _list)
                 {
-                    out.push_back(i.second);
+                    out.push_back(i.value);
                 }
                 return out;
             }
 
-            template<typename T, typename U>
-            inline void Cache<T, U>::_maxUpdate()
+            template<typename T, typename U, typename H>
+            inline void Cache<T, U, H>::_maxUpdate()
             {
-                if (_map.size() > _max)
+                while (!_list.empty() &&
+                    (_list.size() > _max || (_maxCost > 0 && _cost > _maxCost)))
                 {
-                    std::map<int64_t, T> sorted;
-                    for (const auto& i : _counts)
-                    {
-                        sorted[i.second] = i.first;
-                    }
-                    while (_map.size() > _max)
-                    {
-                        auto begin = sorted.begin();
-                        auto i = _map.find(begin->second);
-                        if (i != _map.end())
-                        {
-                            _map.erase(i);
-                        }
-                        auto j = _counts.find(begin->second);
-                        if (j != _counts.end())
-                        {
-                            _counts.erase(j);
-                        }
-                        sorted.erase(begin);
-                    }
+                    const auto& entry = _list.back();
+                    _cost -= entry.cost;
+                    _map.erase(entry.key);
+                    _list.pop_back();
+                    ++_evictionCount;
                 }
             }
 
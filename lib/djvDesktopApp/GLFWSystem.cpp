@@ -61,6 +61,10 @@ namespace djv
             p.monitorInfo = Observer::ListSubject<MonitorInfo>::create();
 
             auto avGLFWSystem = context->getSystemT<GL::GLFW::GLFWSystem>();
+            if (!avGLFWSystem || !avGLFWSystem->getWindow())
+            {
+                throw GL::GLFW::Error(_getText(DJV_TEXT("error_glfw_window_creation")));
+            }
             addDependency(avGLFWSystem);
 
             // Poll for monitor information.
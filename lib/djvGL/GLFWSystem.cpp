@@ -120,96 +120,120 @@ namespace djv
                     ss << "GLFW version: " << glfwMajor << "." << glfwMinor << "." << glfwRevision;
                     _log(ss.str());
                 }
-                if (!glfwInit())
+
+                // OpenGL is optional so that the command line tools can run
+                // without a display; the system is then created without a
+                // window and the images are converted with the CPU.
+                int disable = 0;
+                if (OS::getIntEnv("DJV_GL_DISABLE", disable) && disable != 0)
                 {
-                    throw Error(getErrorMessage(ErrorString::Init, p.textSystem));
+                    _log("OpenGL disabled by DJV_GL_DISABLE", System::LogLevel::Warning);
                 }
+                else
+                {
+                    try
+                    {
+                        if (!glfwInit())
+                        {
+                            throw Error(getErrorMessage(ErrorString::Init, p.textSystem));
+                        }
 
-                // Create a window.
+                        // Create a window.
 #if defined(DJV_GL_ES2)
-                glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_ES_API);
-                glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 2);
-                glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
+                        glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_ES_API);
+                        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 2);
+                        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
 #else // DJV_GL_ES2
-                glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
-                glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 1);
-                glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GLFW_TRUE);
-                glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+                        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+                        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 1);
+                        glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GLFW_TRUE);
+                        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 #endif // DJV_GL_ES2
-                glfwWindowHint(GLFW_SAMPLES, 1);
-                glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
-                glfwWindowHint(GLFW_DOUBLEBUFFER, GLFW_TRUE);
-                int env = 0;
-                if (OS::getIntEnv("DJV_GL_DEBUG", env) && env != 0)
-                {
-                    glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GLFW_TRUE);
-                }
-                p.window = glfwCreateWindow(
-                    windowSize.x,
-                    windowSize.y,
-                    context->getName().c_str(),
-                    NULL,
-                    NULL);
-                if (!p.window)
-                {
-                    throw Error(getErrorMessage(ErrorString::Window, p.textSystem));
-                }
-                {
-                    const int glMajor = glfwGetWindowAttrib(_p->window, GLFW_CONTEXT_VERSION_MAJOR);
-                    const int glMinor = glfwGetWindowAttrib(_p->window, GLFW_CONTEXT_VERSION_MINOR);
-                    const int glRevision = glfwGetWindowAttrib(_p->window, GLFW_CONTEXT_REVISION);
-                    std::stringstream ss;
-                    ss << "GLFW OpenGL version: " << glMajor << "." << glMinor << "." << glRevision;
-                    _log(ss.str());
-                }
-                glfwSetWindowUserPointer(p.window, context.get());
-                glfwMakeContextCurrent(p.window);
+                        glfwWindowHint(GLFW_SAMPLES, 1);
+                        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+                        glfwWindowHint(GLFW_DOUBLEBUFFER, GLFW_TRUE);
+                        int env = 0;
+                        if (OS::getIntEnv("DJV_GL_DEBUG", env) && env != 0)
+                        {
+                            glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GLFW_TRUE);
+                        }
+                        p.window = glfwCreateWindow(
+                            windowSize.x,
+                            windowSize.y,
+                            context->getName().c_str(),
+                            NULL,
+                            NULL);
+                        if (!p.window)
+                        {
+                            throw Error(getErrorMessage(ErrorString::Window, p.textSystem));
+                        }
+                        {
+                            const int glMajor = glfwGetWindowAttrib(_p->window, GLFW_CONTEXT_VERSION_MAJOR);
+                            const int glMinor = glfwGetWindowAttrib(_p->window, GLFW_CONTEXT_VERSION_MINOR);
+                            const int glRevision = glfwGetWindowAttrib(_p->window, GLFW_CONTEXT_REVISION);
+                            std::stringstream ss;
+                            ss << "GLFW OpenGL version: " << glMajor << "." << glMinor << "." << glRevision;
+                            _log(ss.str());
+                        }
+                        glfwSetWindowUserPointer(p.window, context.get());
+                        glfwMakeContextCurrent(p.window);
 #if defined(DJV_GL_ES2)
-                if (!gladLoadGLES2Loader((GLADloadproc)glfwGetProcAddress))
+                        if (!gladLoadGLES2Loader((GLADloadproc)glfwGetProcAddress))
 #else
-                if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+                        if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
 #endif
-                {
-                    throw Error(getErrorMessage(ErrorString::GLAD, p.textSystem));
-                }
+                        {
+                            throw Error(getErrorMessage(ErrorString::GLAD, p.textSystem));
+                        }
 #if defined(DJV_GL_ES2)
 #else // DJV_GL_ES2
-                GLint flags = 0;
-                glGetIntegerv(GL_CONTEXT_FLAGS, &flags);
-                if (flags & static_cast<GLint>(GL_CONTEXT_FLAG_DEBUG_BIT))
-                {
-                    glEnable(GL_DEBUG_OUTPUT);
-                    glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
-                    glDebugMessageCallback(glDebugOutput, context.get());
-                    glDebugMessageControl(
-                        static_cast<GLenum>(GL_DONT_CARE),
-                        static_cast<GLenum>(GL_DONT_CARE),
-                        static_cast<GLenum>(GL_DONT_CARE),
-                        0,
-                        nullptr,
-                        GLFW_TRUE);
-                }
+                        GLint flags = 0;
+                        glGetIntegerv(GL_CONTEXT_FLAGS, &flags);
+                        if (flags & static_cast<GLint>(GL_CONTEXT_FLAG_DEBUG_BIT))
+                        {
+                            glEnable(GL_DEBUG_OUTPUT);
+                            glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+                            glDebugMessageCallback(glDebugOutput, context.get());
+                            glDebugMessageControl(
+                                static_cast<GLenum>(GL_DONT_CARE),
+                                static_cast<GLenum>(GL_DONT_CARE),
+                                static_cast<GLenum>(GL_DONT_CARE),
+                                0,
+                                nullptr,
+                                GLFW_TRUE);
+                        }
 #endif // DJV_GL_ES2
 
-                {
-                    std::stringstream ss;
-                    ss << "OpenGL vendor: " << glGetString(GL_VENDOR);
-                    _log(ss.str());
-                }
-                {
-                    std::stringstream ss;
-                    ss << "OpenGL renderer: " << glGetString(GL_RENDERER);
-                    _log(ss.str());
-                }
-                {
-                    std::stringstream ss;
-                    ss << "OpenGL version: " << glGetString(GL_VERSION);
-                    _log(ss.str());
-                }
-                {
-                    std::stringstream ss;
-                    ss << "OpenGL shading language version: " << glGetString(GL_SHADING_LANGUAGE_VERSION);
-                    _log(ss.str());
+                        {
+                            std::stringstream ss;
+                            ss << "OpenGL vendor: " << glGetString(GL_VENDOR);
+                            _log(ss.str());
+                        }
+                        {
+                            std::stringstream ss;
+                            ss << "OpenGL renderer: " << glGetString(GL_RENDERER);
+                            _log(ss.str());
+                        }
+                        {
+                            std::stringstream ss;
+                            ss << "OpenGL version: " << glGetString(GL_VERSION);
+                            _log(ss.str());
+                        }
+                        {
+                            std::stringstream ss;
+                            ss << "OpenGL shading language version: " << glGetString(GL_SHADING_LANGUAGE_VERSION);
+                            _log(ss.str());
+                        }
+                    }
+                    catch (const std::exception& e)
+                    {
+                        if (p.window)
+                        {
+                            glfwDestroyWindow(p.window);
+                            p.window = nullptr;
+                        }
+                        _log(e.what(), System::LogLevel::Error);
+                    }
                 }
 
                 p.swapInterval = Observer::ValueSubject<SwapInterval>::create(SwapInterval::Default);
@@ -48,14 +48,15 @@ namespace djv
             public:
                 ~GLFWSystem() override;
 
-                //! Create a new GLFW system.
-                //! Throws:
-                //! - Error
+                //! Create a new GLFW system. If OpenGL is not available, or the
+                //! DJV_GL_DISABLE environment variable is set, the system is
+                //! created without a window.
                 static std::shared_ptr<GLFWSystem> create(const std::shared_ptr<System::Context>&);
 
                 //! \name Window
                 ///@{
 
+                //! Get the window, or nullptr if OpenGL is not available.
                 GLFWwindow* getWindow() const;
 
                 ///@}
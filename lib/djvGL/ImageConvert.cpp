@@ -87,6 +87,13 @@ namespace djv
 
             p.shader->bind();
             p.shader->setUniform("textureSampler", 0);
+            const bool yuv = Image::isYUVType(data.getType());
+            if (yuv)
+            {
+                p.shader->setUniform("yuvPlanes", getYUVPlanes(data.getInfo()));
+                p.shader->setUniform("yuvMatrix", getYUVMatrix(data.getInfo()));
+            }
+            p.shader->setUniform("yuv", yuv);
             
             if (info.size != p.size)
             {
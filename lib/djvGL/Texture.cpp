@@ -4,7 +4,11 @@
 
 #include <djvGL/Texture.h>
 
+#include <glm/mat3x3.hpp>
+#include <glm/vec3.hpp>
+
 #include <array>
+#include <cstring>
 
 //#pragma optimize("", off)
 
@@ -43,6 +47,16 @@ namespace djv
                 GL_NONE,
                 GL_NONE,
                 GL_NONE,
+                GL_NONE,
+
+                GL_LUMINANCE,
+                GL_LUMINANCE,
+                GL_LUMINANCE,
+                GL_NONE,
+                GL_NONE,
+                GL_NONE,
+                GL_NONE,
+                GL_NONE,
                 GL_NONE
 #else // DJV_GL_ES2
                 GL_R8,
@@ -68,12 +82,102 @@ namespace djv
                 GL_RGBA16,
                 GL_RGBA32I,
                 GL_RGBA16F,
-                GL_RGBA32F
+                GL_RGBA32F,
+
+                GL_R8,
+                GL_R8,
+                GL_R8,
+                GL_R16,
+                GL_R16,
+                GL_R16,
+                GL_R16,
+                GL_R16,
+                GL_R16
 #endif // DJV_GL_ES2
             };
             return data[static_cast<size_t>(type)];
         }
 
+        Image::Size getTextureSize(const Image::Info& info)
+        {
+            Image::Size out = info.size;
+            const uint8_t planeCount = info.getPlaneCount();
+            for (uint8_t i = 1; i < planeCount; ++i)
+            {
+                out.h += info.getPlaneSize(i).h;
+            }
+            return out;
+        }
+
+        glm::vec4 getYUVPlanes(const Image::Info& info)
+        {
+            const Image::Size chromaSize = info.getPlaneSize(1);
+            return glm::vec4(info.size.w, info.size.h, chromaSize.w, chromaSize.h);
+        }
+
+        glm::mat4x4 getYUVMatrix(const Image::Info& info)
+        {
+            glm::mat4x4 out(1.F);
+            if (Image::isYUVType(info.type))
+            {
+                // Convert from Y'CbCr to R'G'B'.
+                float kr = 0.F;
+                float kb = 0.F;
+                switch (info.yuvCoefficients)
+                {
+                case Image::YUVCoefficients::Rec601:  kr = .299F;  kb = .114F;  break;
+                case Image::YUVCoefficients::Rec709:  kr = .2126F; kb = .0722F; break;
+                case Image::YUVCoefficients::Rec2020: kr = .2627F; kb = .0593F; break;
+                default: break;
+                }
+                const float kg = 1.F - kr - kb;
+                const glm::mat3x3 rgb(
+                    1.F, 1.F, 1.F,
+                    0.F, -2.F * kb * (1.F - kb) / kg, 2.F * (1.F - kb),
+                    2.F * (1.F - kr), -2.F * kr * (1.F - kr) / kg, 0.F);
+
+                // Scale the texture samples to Y' in the range [0, 1] and
+                // Cb and Cr in the range [-0.5, 0.5]. Note that the 10-bit
+                // samples are stored in 16-bit textures.
+                const uint8_t bitDepth = Image::getBitDepth(info.type);
+                const float textureMax = Image::DataType::U8 == Image::getDataType(info.type) ?
+                    static_cast<float>(Image::U8Range.getMax()) :
+                    static_cast<float>(Image::U16Range.getMax());
+                float yScale  = 1.F;
+                float yOffset = 0.F;
+                float cScale  = 1.F;
+                float cOffset = 0.F;
+                switch (info.yuvRange)
+                {
+                case Image::YUVRange::Video:
+                {
+                    const float m = static_cast<float>(1 << (bitDepth - 8));
+                    yScale  = textureMax / (219.F * m);
+                    yOffset = -16.F / 219.F;
+                    cScale  = textureMax / (224.F * m);
+                    cOffset = -128.F / 224.F;
+                    break;
+                }
+                case Image::YUVRange::Full:
+                {
+                    const float m = static_cast<float>((1 << bitDepth) - 1);
+                    yScale  = textureMax / m;
+                    cScale  = textureMax / m;
+                    cOffset = -static_cast<float>(1 << (bitDepth - 1)) / m;
+                    break;
+                }
+                default: break;
+                }
+
+                out = glm::mat4x4(rgb * glm::mat3x3(
+                    yScale, 0.F, 0.F,
+                    0.F, cScale, 0.F,
+                    0.F, 0.F, cScale));
+                out[3] = glm::vec4(rgb * glm::vec3(yOffset, cOffset, cOffset), 1.F);
+            }
+            return out;
+        }
+
         /*GLenum getInternalFormat1D(Image::Type type)
         {
             //return Image::getGLFormat(type);
@@ -103,12 +207,13 @@ namespace djv
                 glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
                 glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, _filterMin);
                 glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, _filterMag);
+                const Image::Size textureSize = getTextureSize(_info);
                 glTexImage2D(
                     GL_TEXTURE_2D,
                     0,
                     getInternalFormat2D(_info.type),
-                    _info.size.w,
-                    _info.size.h,
+                    textureSize.w,
+                    textureSize.h,
                     0,
                     _info.getGLFormat(),
                     _info.getGLType(),
@@ -173,12 +278,13 @@ namespace djv
                 glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
                 glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, _filterMin);
                 glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, _filterMag);
+                const Image::Size textureSize = getTextureSize(_info);
                 glTexImage2D(
                     GL_TEXTURE_2D,
                     0,
                     getInternalFormat2D(_info.type),
-                    _info.size.w,
-                    _info.size.h,
+                    textureSize.w,
+                    textureSize.h,
                     0,
                     _info.getGLFormat(),
                     _info.getGLType(),
@@ -189,6 +295,11 @@ namespace djv
         void Texture2D::copy(const Image::Data & data)
         {
             const auto & info = data.getInfo();
+            if (Image::isYUVType(info.type))
+            {
+                _copyYUV(data, 0, 0);
+                return;
+            }
 #if defined(DJV_GL_ES2)
             glBindTexture(GL_TEXTURE_2D, _id);
             glPixelStorei(GL_UNPACK_ALIGNMENT, info.layout.alignment);
@@ -237,9 +348,14 @@ namespace djv
 #endif // DJV_GL_ES2
         }
 
-        void Texture2D::copy(const Image::Data & data, uint16_t x, uint16_t y)
+        void Texture2D::copy(const Image::Data & data, uint32_t x, uint32_t y)
         {
             const auto & info = data.getInfo();
+            if (Image::isYUVType(info.type))
+            {
+                _copyYUV(data, x, y);
+                return;
+            }
 
 #if defined(DJV_GL_ES2)
             glBindTexture(GL_TEXTURE_2D, _id);
@@ -289,11 +405,130 @@ namespace djv
 #endif // DJV_GL_ES2
         }
 
+        void Texture2D::copyRegion(const Image::Data& data, uint32_t x, uint32_t y)
+        {
+            const auto& info = data.getInfo();
+
+#if defined(DJV_GL_ES2)
+            // Unpacking a region requires GL_UNPACK_ROW_LENGTH which is not
+            // available, so the scanlines are copied individually.
+            glBindTexture(GL_TEXTURE_2D, _id);
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+            for (uint32_t i = 0; i < _info.size.h; ++i)
+            {
+                glTexSubImage2D(
+                    GL_TEXTURE_2D,
+                    0,
+                    0,
+                    i,
+                    _info.size.w,
+                    1,
+                    info.getGLFormat(),
+                    info.getGLType(),
+                    data.getData(x, y + i));
+            }
+#else // DJV_GL_ES2
+
+#if defined(DJV_GL_PBO)
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, _pbo);
+            if (uint8_t* p = reinterpret_cast<uint8_t*>(glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY)))
+            {
+                const size_t scanlineByteCount = _info.getScanlineByteCount();
+                const size_t byteCount = static_cast<size_t>(_info.size.w) * info.getPixelByteCount();
+                for (uint32_t i = 0; i < _info.size.h; ++i, p += scanlineByteCount)
+                {
+                    memcpy(p, data.getData(x, y + i), byteCount);
+                }
+                glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+            }
+#endif // DJV_GL_PBO
+
+            glBindTexture(GL_TEXTURE_2D, _id);
+            glPixelStorei(GL_UNPACK_SWAP_BYTES, info.layout.endian != Memory::getEndian());
+#if defined(DJV_GL_PBO)
+            glPixelStorei(GL_UNPACK_ALIGNMENT, _info.layout.alignment);
+            glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+            glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+            glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+#else // DJV_GL_PBO
+            glPixelStorei(GL_UNPACK_ALIGNMENT, info.layout.alignment);
+            glPixelStorei(GL_UNPACK_ROW_LENGTH, info.size.w);
+            glPixelStorei(GL_UNPACK_SKIP_ROWS, y);
+            glPixelStorei(GL_UNPACK_SKIP_PIXELS, x);
+#endif // DJV_GL_PBO
+            glTexSubImage2D(
+                GL_TEXTURE_2D,
+                0,
+                0,
+                0,
+                _info.size.w,
+                _info.size.h,
+                info.getGLFormat(),
+                info.getGLType(),
+#if defined(DJV_GL_PBO)
+                0
+#else // DJV_GL_PBO
+                data.getData()
+#endif // DJV_GL_PBO
+                );
+            glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+            glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+            glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+#endif // DJV_GL_ES2
+        }
+
         void Texture2D::bind()
         {
             glBindTexture(GL_TEXTURE_2D, _id);
         }
 
+        void Texture2D::_copyYUV(const Image::Data& data, uint32_t x, uint32_t y)
+        {
+            const auto& info = data.getInfo();
+
+#if defined(DJV_GL_PBO) && !defined(DJV_GL_ES2)
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, _pbo);
+            glBufferSubData(
+                GL_PIXEL_UNPACK_BUFFER,
+                0,
+                info.getDataByteCount(),
+                data.getData());
+#endif // DJV_GL_PBO
+
+            glBindTexture(GL_TEXTURE_2D, _id);
+            glPixelStorei(GL_UNPACK_ALIGNMENT, info.layout.alignment);
+#if !defined(DJV_GL_ES2)
+            glPixelStorei(GL_UNPACK_SWAP_BYTES, info.layout.endian != Memory::getEndian());
+            glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+            glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+#endif // DJV_GL_ES2
+            const uint8_t planeCount = info.getPlaneCount();
+            for (uint8_t i = 0; i < planeCount; ++i)
+            {
+                const Image::Size planeSize = info.getPlaneSize(i);
+                glTexSubImage2D(
+                    GL_TEXTURE_2D,
+                    0,
+                    x,
+                    y,
+                    planeSize.w,
+                    planeSize.h,
+                    info.getGLFormat(),
+                    info.getGLType(),
+#if defined(DJV_GL_PBO) && !defined(DJV_GL_ES2)
+                    reinterpret_cast<const GLvoid*>(info.getPlaneOffset(i))
+#else // DJV_GL_PBO
+                    data.getPlaneData(i)
+#endif // DJV_GL_PBO
+                    );
+                y += planeSize.h;
+            }
+#if !defined(DJV_GL_ES2)
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+#endif // DJV_GL_ES2
+        }
+
         /*void Texture1D::_init(const Image::Info& info, GLenum filter)
         {
             _info = info;
@@ -400,7 +635,7 @@ namespace djv
 #endif // DJV_GL_ES2
         }
 
-        void Texture1D::copy(const Image::Data& data, uint16_t x)
+        void Texture1D::copy(const Image::Data& data, uint32_t x)
         {
             const auto& info = data.getInfo();
 
@@ -8,6 +8,9 @@
 
 #include <djvImage/Data.h>
 
+#include <glm/mat4x4.hpp>
+#include <glm/vec4.hpp>
+
 namespace djv
 {
     namespace GL
@@ -15,6 +18,18 @@ namespace djv
         //! Get the OpenGL internal format.
         GLenum getInternalFormat2D(Image::Type);
 
+        //! Get the OpenGL texture size. Planar YUV images are stored in a
+        //! single channel texture with the planes stacked vertically, and
+        //! the chroma planes aligned to the left edge.
+        Image::Size getTextureSize(const Image::Info&);
+
+        //! Get the size of the planar YUV texture planes as the luma width
+        //! and height followed by the chroma width and height.
+        glm::vec4 getYUVPlanes(const Image::Info&);
+
+        //! Get the matrix that converts planar YUV texture samples to RGB.
+        glm::mat4x4 getYUVMatrix(const Image::Info&);
+
         //! Get the OpenGL internal format.
         //GLenum getInternalFormat1D(Image::Type);
         
@@ -50,13 +65,21 @@ namespace djv
 
             void set(const Image::Info&);
             void copy(const Image::Data&);
-            void copy(const Image::Data&, uint16_t x, uint16_t y);
+            void copy(const Image::Data&, uint32_t x, uint32_t y);
+
+            //! Copy the region of the image data that starts at the given
+            //! position and has the size of the texture. This is used to
+            //! split images that are larger than the maximum texture size
+            //! into tiles. Planar YUV images are not supported.
+            void copyRegion(const Image::Data&, uint32_t x, uint32_t y);
 
             void bind();
 
             ///@}
 
         private:
+            void _copyYUV(const Image::Data&, uint32_t x, uint32_t y);
+
             Image::Info _info;
             GLenum _filterMin = GL_LINEAR;
             GLenum _filterMag = GL_LINEAR;
@@ -95,7 +118,7 @@ namespace djv
             GLuint getID() const;
 
             void copy(const Image::Data&);
-            void copy(const Image::Data&, uint16_t);
+            void copy(const Image::Data&, uint32_t);
 
             void bind();
 
@@ -0,0 +1,922 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvImage/Convert.h>
+
+#include <djvImage/Data.h>
+
+#include <djvMath/Math.h>
+
+#include <djvSystem/Parallel.h>
+
+#include <djvCore/Memory.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define DJV_IMAGE_CONVERT_SSE2
+#include <emmintrin.h>
+#endif // __SSE2__
+#if defined(__AVX2__)
+#define DJV_IMAGE_CONVERT_AVX2
+#include <immintrin.h>
+#endif // __AVX2__
+#if defined(__F16C__)
+#define DJV_IMAGE_CONVERT_F16C
+#include <immintrin.h>
+#endif // __F16C__
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#define DJV_IMAGE_CONVERT_NEON
+#include <arm_neon.h>
+#endif // __ARM_NEON
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace Image
+    {
+        namespace
+        {
+            //! The number of pixels that are converted at a time.
+            //! \todo Should this be configurable?
+            const size_t chunkSize = 256;
+
+            //! The number of scanlines for each thread job.
+            //! \todo Should this be configurable?
+            const size_t threadRowCount = 16;
+
+            //! The minimum number of pixels to use multiple threads.
+            //! \todo Should this be configurable?
+            const size_t threadPixelCount = 65536;
+
+            const float u8Scale  = 1.F / static_cast<float>(U8Range.getMax());
+            const float u10Scale = 1.F / static_cast<float>(U10Range.getMax());
+            const float u16Scale = 1.F / static_cast<float>(U16Range.getMax());
+
+            inline float clamp01(float value)
+            {
+                // This also converts NaN to zero.
+                return value > 0.F ? (value < 1.F ? value : 1.F) : 0.F;
+            }
+
+            //! \name Data Type Kernels
+            //! Convert between the data types and normalized floating point
+            //! values. The size is the number of values.
+            ///@{
+
+            void decodeU8(const U8_T* in, float* out, size_t size)
+            {
+                size_t i = 0;
+#if defined(DJV_IMAGE_CONVERT_AVX2)
+                const __m256 scale = _mm256_set1_ps(u8Scale);
+                for (; i + 8 <= size; i += 8)
+                {
+                    const __m256i v = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + i)));
+                    _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_cvtepi32_ps(v), scale));
+                }
+#elif defined(DJV_IMAGE_CONVERT_SSE2)
+                const __m128 scale = _mm_set1_ps(u8Scale);
+                const __m128i zero = _mm_setzero_si128();
+                for (; i + 16 <= size; i += 16)
+                {
+                    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                    const __m128i lo = _mm_unpacklo_epi8(v, zero);
+                    const __m128i hi = _mm_unpackhi_epi8(v, zero);
+                    _mm_storeu_ps(out + i,      _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), scale));
+                    _mm_storeu_ps(out + i + 4,  _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), scale));
+                    _mm_storeu_ps(out + i + 8,  _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), scale));
+                    _mm_storeu_ps(out + i + 12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), scale));
+                }
+#elif defined(DJV_IMAGE_CONVERT_NEON)
+                const float32x4_t scale = vdupq_n_f32(u8Scale);
+                for (; i + 16 <= size; i += 16)
+                {
+                    const uint8x16_t v = vld1q_u8(in + i);
+                    const uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+                    const uint16x8_t hi = vmovl_u8(vget_high_u8(v));
+                    vst1q_f32(out + i,      vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo))), scale));
+                    vst1q_f32(out + i + 4,  vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo))), scale));
+                    vst1q_f32(out + i + 8,  vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi))), scale));
+                    vst1q_f32(out + i + 12, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi))), scale));
+                }
+#endif
+                for (; i < size; ++i)
+                {
+                    out[i] = in[i] * u8Scale;
+                }
+            }
+
+            void decodeU16(const U16_T* in, float* out, size_t size)
+            {
+                size_t i = 0;
+#if defined(DJV_IMAGE_CONVERT_AVX2)
+                const __m256 scale = _mm256_set1_ps(u16Scale);
+                for (; i + 8 <= size; i += 8)
+                {
+                    const __m256i v = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i)));
+                    _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_cvtepi32_ps(v), scale));
+                }
+#elif defined(DJV_IMAGE_CONVERT_SSE2)
+                const __m128 scale = _mm_set1_ps(u16Scale);
+                const __m128i zero = _mm_setzero_si128();
+                for (; i + 8 <= size; i += 8)
+                {
+                    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                    _mm_storeu_ps(out + i,     _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(v, zero)), scale));
+                    _mm_storeu_ps(out + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(v, zero)), scale));
+                }
+#elif defined(DJV_IMAGE_CONVERT_NEON)
+                const float32x4_t scale = vdupq_n_f32(u16Scale);
+                for (; i + 8 <= size; i += 8)
+                {
+                    const uint16x8_t v = vld1q_u16(in + i);
+                    vst1q_f32(out + i,     vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(v))), scale));
+                    vst1q_f32(out + i + 4, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(v))), scale));
+                }
+#endif
+                for (; i < size; ++i)
+                {
+                    out[i] = in[i] * u16Scale;
+                }
+            }
+
+            void decodeU32(const U32_T* in, float* out, size_t size)
+            {
+                for (size_t i = 0; i < size; ++i)
+                {
+                    out[i] = static_cast<float>(in[i] / static_cast<double>(U32Range.getMax()));
+                }
+            }
+
+            void decodeF16(const F16_T* in, float* out, size_t size)
+            {
+                size_t i = 0;
+#if defined(DJV_IMAGE_CONVERT_F16C)
+                for (; i + 4 <= size; i += 4)
+                {
+                    _mm_storeu_ps(out + i, _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + i))));
+                }
+#elif defined(DJV_IMAGE_CONVERT_NEON)
+                for (; i + 4 <= size; i += 4)
+                {
+                    vst1q_f32(out + i, vcvt_f32_f16(vld1_f16(reinterpret_cast<const float16_t*>(in + i))));
+                }
+#endif
+                for (; i < size; ++i)
+                {
+                    out[i] = in[i];
+                }
+            }
+
+            //! The size is the number of pixels.
+            void decodeU10(const uint32_t* in, float* out, size_t size)
+            {
+                for (size_t i = 0; i < size; ++i, out += 3)
+                {
+                    const uint32_t v = in[i];
+                    out[0] = ((v >> 22) & 1023) * u10Scale;
+                    out[1] = ((v >> 12) & 1023) * u10Scale;
+                    out[2] = ((v >>  2) & 1023) * u10Scale;
+                }
+            }
+
+            void encodeU8(const float* in, U8_T* out, size_t size)
+            {
+                size_t i = 0;
+#if defined(DJV_IMAGE_CONVERT_AVX2)
+                const __m256 zero = _mm256_setzero_ps();
+                const __m256 one = _mm256_set1_ps(1.F);
+                const __m256 scale = _mm256_set1_ps(static_cast<float>(U8Range.getMax()));
+                const __m256i permute = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+                for (; i + 32 <= size; i += 32)
+                {
+                    __m256i v[4];
+                    for (size_t j = 0; j < 4; ++j)
+                    {
+                        const __m256 f = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(in + i + j * 8), zero), one);
+                        v[j] = _mm256_cvtps_epi32(_mm256_mul_ps(f, scale));
+                    }
+                    const __m256i r = _mm256_packus_epi16(_mm256_packs_epi32(v[0], v[1]), _mm256_packs_epi32(v[2], v[3]));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_permutevar8x32_epi32(r, permute));
+                }
+#elif defined(DJV_IMAGE_CONVERT_SSE2)
+                const __m128 zero = _mm_setzero_ps();
+                const __m128 one = _mm_set1_ps(1.F);
+                const __m128 scale = _mm_set1_ps(static_cast<float>(U8Range.getMax()));
+                for (; i + 16 <= size; i += 16)
+                {
+                    __m128i v[4];
+                    for (size_t j = 0; j < 4; ++j)
+                    {
+                        const __m128 f = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(in + i + j * 4), zero), one);
+                        v[j] = _mm_cvtps_epi32(_mm_mul_ps(f, scale));
+                    }
+                    const __m128i r = _mm_packus_epi16(_mm_packs_epi32(v[0], v[1]), _mm_packs_epi32(v[2], v[3]));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), r);
+                }
+#elif defined(DJV_IMAGE_CONVERT_NEON)
+                const float32x4_t zero = vdupq_n_f32(0.F);
+                const float32x4_t one = vdupq_n_f32(1.F);
+                const float32x4_t scale = vdupq_n_f32(static_cast<float>(U8Range.getMax()));
+                for (; i + 16 <= size; i += 16)
+                {
+                    uint16x4_t v[4];
+                    for (size_t j = 0; j < 4; ++j)
+                    {
+                        const float32x4_t f = vminq_f32(vmaxq_f32(vld1q_f32(in + i + j * 4), zero), one);
+                        v[j] = vqmovn_u32(vcvtnq_u32_f32(vmulq_f32(f, scale)));
+                    }
+                    vst1q_u8(out + i, vcombine_u8(
+                        vqmovn_u16(vcombine_u16(v[0], v[1])),
+                        vqmovn_u16(vcombine_u16(v[2], v[3]))));
+                }
+#endif
+                for (; i < size; ++i)
+                {
+                    out[i] = static_cast<U8_T>(std::lrint(clamp01(in[i]) * U8Range.getMax()));
+                }
+            }
+
+            void encodeU16(const float* in, U16_T* out, size_t size)
+            {
+                size_t i = 0;
+#if defined(DJV_IMAGE_CONVERT_AVX2)
+                const __m256 zero = _mm256_setzero_ps();
+                const __m256 one = _mm256_set1_ps(1.F);
+                const __m256 scale = _mm256_set1_ps(static_cast<float>(U16Range.getMax()));
+                for (; i + 16 <= size; i += 16)
+                {
+                    const __m256 f0 = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(in + i), zero), one);
+                    const __m256 f1 = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(in + i + 8), zero), one);
+                    const __m256i r = _mm256_packus_epi32(
+                        _mm256_cvtps_epi32(_mm256_mul_ps(f0, scale)),
+                        _mm256_cvtps_epi32(_mm256_mul_ps(f1, scale)));
+                    _mm256_storeu_si256(
+                        reinterpret_cast<__m256i*>(out + i),
+                        _mm256_permute4x64_epi64(r, _MM_SHUFFLE(3, 1, 2, 0)));
+                }
+#elif defined(DJV_IMAGE_CONVERT_SSE2)
+                // SSE2 does not have an unsigned 32-bit pack, so the values
+                // are offset into the signed range and back.
+                const __m128 zero = _mm_setzero_ps();
+                const __m128 one = _mm_set1_ps(1.F);
+                const __m128 scale = _mm_set1_ps(static_cast<float>(U16Range.getMax()));
+                const __m128i offset32 = _mm_set1_epi32(32768);
+                const __m128i offset16 = _mm_set1_epi16(-32768);
+                for (; i + 8 <= size; i += 8)
+                {
+                    const __m128 f0 = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(in + i), zero), one);
+                    const __m128 f1 = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(in + i + 4), zero), one);
+                    const __m128i v0 = _mm_sub_epi32(_mm_cvtps_epi32(_mm_mul_ps(f0, scale)), offset32);
+                    const __m128i v1 = _mm_sub_epi32(_mm_cvtps_epi32(_mm_mul_ps(f1, scale)), offset32);
+                    _mm_storeu_si128(
+                        reinterpret_cast<__m128i*>(out + i),
+                        _mm_add_epi16(_mm_packs_epi32(v0, v1), offset16));
+                }
+#elif defined(DJV_IMAGE_CONVERT_NEON)
+                const float32x4_t zero = vdupq_n_f32(0.F);
+                const float32x4_t one = vdupq_n_f32(1.F);
+                const float32x4_t scale = vdupq_n_f32(static_cast<float>(U16Range.getMax()));
+                for (; i + 8 <= size; i += 8)
+                {
+                    const float32x4_t f0 = vminq_f32(vmaxq_f32(vld1q_f32(in + i), zero), one);
+                    const float32x4_t f1 = vminq_f32(vmaxq_f32(vld1q_f32(in + i + 4), zero), one);
+                    vst1q_u16(out + i, vcombine_u16(
+                        vqmovn_u32(vcvtnq_u32_f32(vmulq_f32(f0, scale))),
+                        vqmovn_u32(vcvtnq_u32_f32(vmulq_f32(f1, scale)))));
+                }
+#endif
+                for (; i < size; ++i)
+                {
+                    out[i] = static_cast<U16_T>(std::lrint(clamp01(in[i]) * U16Range.getMax()));
+                }
+            }
+
+            void encodeU32(const float* in, U32_T* out, size_t size)
+            {
+                for (size_t i = 0; i < size; ++i)
+                {
+                    out[i] = static_cast<U32_T>(clamp01(in[i]) * static_cast<double>(U32Range.getMax()) + .5);
+                }
+            }
+
+            void encodeF16(const float* in, F16_T* out, size_t size)
+            {
+                size_t i = 0;
+#if defined(DJV_IMAGE_CONVERT_F16C)
+                for (; i + 4 <= size; i += 4)
+                {
+                    _mm_storel_epi64(
+                        reinterpret_cast<__m128i*>(out + i),
+                        _mm_cvtps_ph(_mm_loadu_ps(in + i), 0));
+                }
+#elif defined(DJV_IMAGE_CONVERT_NEON)
+                for (; i + 4 <= size; i += 4)
+                {
+                    vst1_f16(reinterpret_cast<float16_t*>(out + i), vcvt_f16_f32(vld1q_f32(in + i)));
+                }
+#endif
+                for (; i < size; ++i)
+                {
+                    out[i] = in[i];
+                }
+            }
+
+            //! The size is the number of pixels.
+            void encodeU10(const float* in, uint32_t* out, size_t size)
+            {
+                const float scale = static_cast<float>(U10Range.getMax());
+                for (size_t i = 0; i < size; ++i, in += 3)
+                {
+                    out[i] =
+                        static_cast<uint32_t>(std::lrint(clamp01(in[0]) * scale)) << 22 |
+                        static_cast<uint32_t>(std::lrint(clamp01(in[1]) * scale)) << 12 |
+                        static_cast<uint32_t>(std::lrint(clamp01(in[2]) * scale)) << 2;
+                }
+            }
+
+            //! The size is the number of pixels.
+            void decode(const uint8_t* in, Type type, float* out, size_t size)
+            {
+                const size_t valueCount = size * getChannelCount(type);
+                switch (getDataType(type))
+                {
+                case DataType::U8:  decodeU8(in, out, valueCount); break;
+                case DataType::U10: decodeU10(reinterpret_cast<const uint32_t*>(in), out, size); break;
+                case DataType::U16: decodeU16(reinterpret_cast<const U16_T*>(in), out, valueCount); break;
+                case DataType::U32: decodeU32(reinterpret_cast<const U32_T*>(in), out, valueCount); break;
+                case DataType::F16: decodeF16(reinterpret_cast<const F16_T*>(in), out, valueCount); break;
+                case DataType::F32: memcpy(out, in, valueCount * sizeof(float)); break;
+                default: break;
+                }
+            }
+
+            //! The size is the number of pixels.
+            void encode(const float* in, Type type, uint8_t* out, size_t size)
+            {
+                const size_t valueCount = size * getChannelCount(type);
+                switch (getDataType(type))
+                {
+                case DataType::U8:  encodeU8(in, out, valueCount); break;
+                case DataType::U10: encodeU10(in, reinterpret_cast<uint32_t*>(out), size); break;
+                case DataType::U16: encodeU16(in, reinterpret_cast<U16_T*>(out), valueCount); break;
+                case DataType::U32: encodeU32(in, reinterpret_cast<U32_T*>(out), valueCount); break;
+                case DataType::F16: encodeF16(in, reinterpret_cast<F16_T*>(out), valueCount); break;
+                case DataType::F32: memcpy(out, in, valueCount * sizeof(float)); break;
+                default: break;
+                }
+            }
+
+            ///@}
+
+            //! \name Channel Kernels
+            ///@{
+
+            template<typename T>
+            inline T average(T a, T b, T c, std::true_type)
+            {
+                return static_cast<T>((static_cast<uint64_t>(a) + b + c) / 3);
+            }
+
+            template<typename T>
+            inline T average(T a, T b, T c, std::false_type)
+            {
+                return static_cast<T>((static_cast<float>(a) + static_cast<float>(b) + static_cast<float>(c)) / 3.F);
+            }
+
+            template<typename T, size_t inChannels, size_t outChannels>
+            void remap(const T* in, T* out, size_t size, T max)
+            {
+                for (size_t i = 0; i < size; ++i, in += inChannels, out += outChannels)
+                {
+                    if (outChannels < 3)
+                    {
+                        out[0] = inChannels < 3 ?
+                            in[0] :
+                            average(in[0], in[1], in[2], typename std::is_integral<T>::type());
+                    }
+                    else
+                    {
+                        out[0] = in[0];
+                        out[1] = inChannels < 3 ? in[0] : in[1];
+                        out[2] = inChannels < 3 ? in[0] : in[2];
+                    }
+                    if (2 == outChannels || 4 == outChannels)
+                    {
+                        out[outChannels - 1] = (2 == inChannels || 4 == inChannels) ? in[inChannels - 1] : max;
+                    }
+                }
+            }
+
+            template<typename T>
+            void remap(const T* in, size_t inChannels, T* out, size_t outChannels, size_t size, T max)
+            {
+                typedef void (*Function)(const T*, T*, size_t, T);
+                static const Function functions[4][4] =
+                {
+                    { remap<T, 1, 1>, remap<T, 1, 2>, remap<T, 1, 3>, remap<T, 1, 4> },
+                    { remap<T, 2, 1>, remap<T, 2, 2>, remap<T, 2, 3>, remap<T, 2, 4> },
+                    { remap<T, 3, 1>, remap<T, 3, 2>, remap<T, 3, 3>, remap<T, 3, 4> },
+                    { remap<T, 4, 1>, remap<T, 4, 2>, remap<T, 4, 3>, remap<T, 4, 4> }
+                };
+                functions[inChannels - 1][outChannels - 1](in, out, size, max);
+            }
+
+            //! Convert the channels without changing the data type. The size
+            //! is the number of pixels.
+            void remap(const uint8_t* in, Type inType, uint8_t* out, Type outType, size_t size)
+            {
+                const size_t inChannels = getChannelCount(inType);
+                const size_t outChannels = getChannelCount(outType);
+                switch (getDataType(inType))
+                {
+                case DataType::U8:
+                    remap<U8_T>(in, inChannels, out, outChannels, size, U8Range.getMax());
+                    break;
+                case DataType::U16:
+                    remap<U16_T>(
+                        reinterpret_cast<const U16_T*>(in), inChannels,
+                        reinterpret_cast<U16_T*>(out), outChannels,
+                        size, U16Range.getMax());
+                    break;
+                case DataType::U32:
+                    remap<U32_T>(
+                        reinterpret_cast<const U32_T*>(in), inChannels,
+                        reinterpret_cast<U32_T*>(out), outChannels,
+                        size, U32Range.getMax());
+                    break;
+                case DataType::F16:
+                    remap<F16_T>(
+                        reinterpret_cast<const F16_T*>(in), inChannels,
+                        reinterpret_cast<F16_T*>(out), outChannels,
+                        size, F16Range.getMax());
+                    break;
+                case DataType::F32:
+                    remap<F32_T>(
+                        reinterpret_cast<const F32_T*>(in), inChannels,
+                        reinterpret_cast<F32_T*>(out), outChannels,
+                        size, F32Range.getMax());
+                    break;
+                default: break;
+                }
+            }
+
+            void reverse(uint8_t* data, size_t size, size_t pixelByteCount)
+            {
+                uint8_t tmp[16];
+                uint8_t* a = data;
+                uint8_t* b = data + (size - 1) * pixelByteCount;
+                for (; a < b; a += pixelByteCount, b -= pixelByteCount)
+                {
+                    memcpy(tmp, a, pixelByteCount);
+                    memcpy(a, b, pixelByteCount);
+                    memcpy(b, tmp, pixelByteCount);
+                }
+            }
+
+            ///@}
+
+            //! Y'CbCr to R'G'B' conversion, see also GL::getYUVMatrix().
+            struct YUV
+            {
+                YUV()
+                {}
+
+                explicit YUV(const Info& info)
+                {
+                    float kr = 0.F;
+                    float kb = 0.F;
+                    switch (info.yuvCoefficients)
+                    {
+                    case YUVCoefficients::Rec601:  kr = .299F;  kb = .114F;  break;
+                    case YUVCoefficients::Rec709:  kr = .2126F; kb = .0722F; break;
+                    case YUVCoefficients::Rec2020: kr = .2627F; kb = .0593F; break;
+                    default: break;
+                    }
+                    const float kg = 1.F - kr - kb;
+                    rv = 2.F * (1.F - kr);
+                    gu = -2.F * kb * (1.F - kb) / kg;
+                    gv = -2.F * kr * (1.F - kr) / kg;
+                    bu = 2.F * (1.F - kb);
+
+                    const uint8_t bitDepth = getBitDepth(info.type);
+                    switch (info.yuvRange)
+                    {
+                    case YUVRange::Video:
+                    {
+                        const float m = static_cast<float>(1 << (bitDepth - 8));
+                        yScale  = 1.F / (219.F * m);
+                        yOffset = -16.F / 219.F;
+                        cScale  = 1.F / (224.F * m);
+                        cOffset = -128.F / 224.F;
+                        break;
+                    }
+                    case YUVRange::Full:
+                    {
+                        const float m = static_cast<float>((1 << bitDepth) - 1);
+                        yScale  = 1.F / m;
+                        cScale  = 1.F / m;
+                        cOffset = -static_cast<float>(1 << (bitDepth - 1)) / m;
+                        break;
+                    }
+                    default: break;
+                    }
+                }
+
+                float rv = 0.F;
+                float gu = 0.F;
+                float gv = 0.F;
+                float bu = 0.F;
+                float yScale  = 1.F;
+                float yOffset = 0.F;
+                float cScale  = 1.F;
+                float cOffset = 0.F;
+            };
+
+            template<typename T>
+            inline float getSample(const T* p, bool swap)
+            {
+                T v = *p;
+                if (swap)
+                {
+                    Memory::endian(&v, 1, sizeof(T));
+                }
+                return static_cast<float>(v);
+            }
+
+            //! Convert planar YUV samples to RGB. The size is the number of
+            //! pixels.
+            template<typename T>
+            void yuvToRGB(
+                const T* yP,
+                const T* uP,
+                const T* vP,
+                size_t chromaShift,
+                uint32_t x,
+                size_t size,
+                bool swap,
+                const YUV& yuv,
+                float* out)
+            {
+                for (size_t i = 0; i < size; ++i, out += 3)
+                {
+                    const size_t c = (x + i) >> chromaShift;
+                    const float y = getSample(yP + x + i, swap) * yuv.yScale + yuv.yOffset;
+                    const float u = getSample(uP + c, swap) * yuv.cScale + yuv.cOffset;
+                    const float v = getSample(vP + c, swap) * yuv.cScale + yuv.cOffset;
+                    out[0] = y + yuv.rv * v;
+                    out[1] = y + yuv.gu * u + yuv.gv * v;
+                    out[2] = y + yuv.bu * u;
+                }
+            }
+
+            //! Conversion state shared by the threads.
+            struct Job
+            {
+                const Data* in = nullptr;
+                Info        inInfo;
+                Info        outInfo;
+                uint8_t*    outData = nullptr;
+                size_t      outScanlineByteCount = 0;
+                bool        inSwap = false;
+                bool        outSwap = false;
+                bool        mirrorX = false;
+                bool        mirrorY = false;
+                bool        yuv = false;
+                YUV         yuvCoefficients;
+
+                //! Horizontal bilinear filter coordinates used when resizing.
+                std::vector<uint32_t> x0;
+                std::vector<uint32_t> x1;
+                std::vector<float>    xt;
+            };
+
+            //! Per-thread buffers.
+            struct Buffers
+            {
+                std::vector<uint8_t> swap;
+                std::vector<float>   f0;
+                std::vector<float>   f1;
+
+                //! Source scanlines converted to floating point for resizing.
+                std::vector<float>   rows[2];
+                int64_t              rowY[2] = { -1, -1 };
+                size_t               rowLast = 0;
+            };
+
+            //! Convert source pixels to floating point with the output
+            //! channels. The size is the number of pixels, up to the chunk
+            //! size.
+            const float* convertToFloat(const Job& job, uint32_t x, uint32_t y, size_t size, Buffers& buffers)
+            {
+                const Type inType = job.yuv ? getRGBType(job.inInfo.type) : job.inInfo.type;
+                const size_t inChannels = getChannelCount(inType);
+                const size_t outChannels = getChannelCount(job.outInfo.type);
+                if (job.yuv)
+                {
+                    const Size chromaSize = job.inInfo.getPlaneSize(1);
+                    const size_t chromaShift = chromaSize.w != job.inInfo.size.w ? 1 : 0;
+                    const uint32_t chromaY = static_cast<uint32_t>(
+                        y * static_cast<size_t>(chromaSize.h) / job.inInfo.size.h);
+                    const uint8_t* yP = job.in->getPlaneData(0) + y * job.inInfo.getPlaneScanlineByteCount(0);
+                    const uint8_t* uP = job.in->getPlaneData(1) + chromaY * job.inInfo.getPlaneScanlineByteCount(1);
+                    const uint8_t* vP = job.in->getPlaneData(2) + chromaY * job.inInfo.getPlaneScanlineByteCount(2);
+                    if (DataType::U8 == getDataType(job.inInfo.type))
+                    {
+                        yuvToRGB(yP, uP, vP, chromaShift, x, size, false, job.yuvCoefficients, buffers.f0.data());
+                    }
+                    else
+                    {
+                        yuvToRGB(
+                            reinterpret_cast<const uint16_t*>(yP),
+                            reinterpret_cast<const uint16_t*>(uP),
+                            reinterpret_cast<const uint16_t*>(vP),
+                            chromaShift, x, size, job.inSwap, job.yuvCoefficients, buffers.f0.data());
+                    }
+                }
+                else
+                {
+                    const uint8_t* inP = job.in->getData(x, y);
+                    if (job.inSwap)
+                    {
+                        const size_t wordSize = DataType::U10 == getDataType(inType) ?
+                            4 :
+                            getByteCount(getDataType(inType));
+                        const size_t pixelByteCount = job.inInfo.getPixelByteCount();
+                        Memory::endian(inP, buffers.swap.data(), size * pixelByteCount / wordSize, wordSize);
+                        inP = buffers.swap.data();
+                    }
+                    decode(inP, inType, buffers.f0.data(), size);
+                }
+                const float* out = buffers.f0.data();
+                if (inChannels != outChannels)
+                {
+                    remap<float>(out, inChannels, buffers.f1.data(), outChannels, size, 1.F);
+                    out = buffers.f1.data();
+                }
+                return out;
+            }
+
+            //! Convert source pixels to the output pixels. The size is the
+            //! number of pixels, up to the chunk size.
+            void convertPixels(const Job& job, uint32_t x, uint32_t y, size_t size, uint8_t* out, Buffers& buffers)
+            {
+                const Type inType = job.inInfo.type;
+                const Type outType = job.outInfo.type;
+                const DataType inDataType = getDataType(inType);
+                if (!job.yuv && !job.inSwap && inType == outType)
+                {
+                    memcpy(out, job.in->getData(x, y), size * job.inInfo.getPixelByteCount());
+                }
+                else if (!job.yuv && !job.inSwap && inDataType == getDataType(outType) && inDataType != DataType::U10)
+                {
+                    remap(job.in->getData(x, y), inType, out, outType, size);
+                }
+                else
+                {
+                    encode(convertToFloat(job, x, y, size, buffers), outType, out, size);
+                }
+            }
+
+            void swapRow(const Job& job, uint8_t* data)
+            {
+                const DataType dataType = getDataType(job.outInfo.type);
+                const size_t wordSize = DataType::U10 == dataType ? 4 : getByteCount(dataType);
+                const size_t byteCount = static_cast<size_t>(job.outInfo.size.w) * job.outInfo.getPixelByteCount();
+                Memory::endian(data, byteCount / wordSize, wordSize);
+            }
+
+            void convertRow(const Job& job, uint32_t y, Buffers& buffers)
+            {
+                const uint32_t w = job.outInfo.size.w;
+                const size_t outPixelByteCount = job.outInfo.getPixelByteCount();
+                uint8_t* outRow = job.outData + y * job.outScanlineByteCount;
+                const uint32_t inY = job.mirrorY ? (job.inInfo.size.h - 1 - y) : y;
+                for (uint32_t x = 0; x < w; x += chunkSize)
+                {
+                    const size_t size = std::min(chunkSize, static_cast<size_t>(w - x));
+                    const uint32_t inX = job.mirrorX ? static_cast<uint32_t>(w - x - size) : x;
+                    uint8_t* outP = outRow + x * outPixelByteCount;
+                    convertPixels(job, inX, inY, size, outP, buffers);
+                    if (job.mirrorX)
+                    {
+                        reverse(outP, size, outPixelByteCount);
+                    }
+                }
+                if (job.outSwap)
+                {
+                    swapRow(job, outRow);
+                }
+            }
+
+            //! Get a source scanline converted to floating point with the
+            //! output channels.
+            const float* getResizeRow(const Job& job, uint32_t y, Buffers& buffers)
+            {
+                const uint32_t inY = job.mirrorY ? (job.inInfo.size.h - 1 - y) : y;
+                for (size_t i = 0; i < 2; ++i)
+                {
+                    if (buffers.rowY[i] == static_cast<int64_t>(inY))
+                    {
+                        buffers.rowLast = i;
+                        return buffers.rows[i].data();
+                    }
+                }
+                const size_t i = 1 - buffers.rowLast;
+                buffers.rowY[i] = inY;
+                buffers.rowLast = i;
+                const uint32_t w = job.inInfo.size.w;
+                const size_t outChannels = getChannelCount(job.outInfo.type);
+                float* row = buffers.rows[i].data();
+                for (uint32_t x = 0; x < w; x += chunkSize)
+                {
+                    const size_t size = std::min(chunkSize, static_cast<size_t>(w - x));
+                    const uint32_t inX = job.mirrorX ? static_cast<uint32_t>(w - x - size) : x;
+                    const float* p = convertToFloat(job, inX, inY, size, buffers);
+                    float* rowP = row + x * outChannels;
+                    if (job.mirrorX)
+                    {
+                        for (size_t j = 0; j < size; ++j)
+                        {
+                            memcpy(
+                                rowP + j * outChannels,
+                                p + (size - 1 - j) * outChannels,
+                                outChannels * sizeof(float));
+                        }
+                    }
+                    else
+                    {
+                        memcpy(rowP, p, size * outChannels * sizeof(float));
+                    }
+                }
+                return row;
+            }
+
+            void resizeRow(const Job& job, uint32_t y, Buffers& buffers)
+            {
+                const uint32_t w = job.outInfo.size.w;
+                const uint32_t inH = job.inInfo.size.h;
+                const size_t channels = getChannelCount(job.outInfo.type);
+
+                const float fy = Math::clamp(
+                    (y + .5F) * inH / static_cast<float>(job.outInfo.size.h) - .5F,
+                    0.F,
+                    static_cast<float>(inH - 1));
+                const uint32_t y0 = static_cast<uint32_t>(fy);
+                const uint32_t y1 = std::min(static_cast<uint32_t>(y0 + 1), static_cast<uint32_t>(inH - 1));
+                const float yt = fy - y0;
+                const float* row0 = getResizeRow(job, y0, buffers);
+                const float* row1 = getResizeRow(job, y1, buffers);
+
+                uint8_t* outRow = job.outData + y * job.outScanlineByteCount;
+                const size_t outPixelByteCount = job.outInfo.getPixelByteCount();
+                for (uint32_t x = 0; x < w; x += chunkSize)
+                {
+                    const size_t size = std::min(chunkSize, static_cast<size_t>(w - x));
+                    float* f = buffers.f0.data();
+                    for (size_t i = 0; i < size; ++i)
+                    {
+                        const size_t x0 = job.x0[x + i] * channels;
+                        const size_t x1 = job.x1[x + i] * channels;
+                        const float xt = job.xt[x + i];
+                        for (size_t c = 0; c < channels; ++c, ++f)
+                        {
+                            const float a = row0[x0 + c] + (row0[x1 + c] - row0[x0 + c]) * xt;
+                            const float b = row1[x0 + c] + (row1[x1 + c] - row1[x0 + c]) * xt;
+                            *f = a + (b - a) * yt;
+                        }
+                    }
+                    encode(buffers.f0.data(), job.outInfo.type, outRow + x * outPixelByteCount, size);
+                }
+                if (job.outSwap)
+                {
+                    swapRow(job, outRow);
+                }
+            }
+
+        } // namespace
+
+        struct Convert::Private
+        {
+            size_t threadCount = 1;
+        };
+
+        void Convert::_init(size_t threadCount)
+        {
+            DJV_PRIVATE_PTR();
+            p.threadCount = threadCount > 0 ?
+                threadCount :
+                System::getHardwareThreadCount();
+        }
+
+        Convert::Convert() :
+            _p(new Private)
+        {}
+
+        Convert::~Convert()
+        {}
+
+        std::shared_ptr<Convert> Convert::create(size_t threadCount)
+        {
+            auto out = std::shared_ptr<Convert>(new Convert);
+            out->_init(threadCount);
+            return out;
+        }
+
+        size_t Convert::getThreadCount() const
+        {
+            return _p->threadCount;
+        }
+
+        void Convert::process(const Data& data, const Info& info, Data& out)
+        {
+            DJV_PRIVATE_PTR();
+            if (!data.isValid() || !info.isValid() || isYUVType(info.type))
+            {
+                return;
+            }
+
+            Job job;
+            job.in = &data;
+            job.inInfo = data.getInfo();
+            job.outInfo = info;
+            job.outData = out.getData();
+            job.outScanlineByteCount = info.getScanlineByteCount();
+            const Memory::Endian endian = Memory::getEndian();
+            job.inSwap = job.inInfo.layout.endian != endian && getByteCount(getDataType(job.inInfo.type)) > 1;
+            job.outSwap = info.layout.endian != endian && getByteCount(getDataType(info.type)) > 1;
+            job.mirrorX = job.inInfo.layout.mirror.x != info.layout.mirror.x;
+            job.mirrorY = job.inInfo.layout.mirror.y != info.layout.mirror.y;
+            job.yuv = isYUVType(job.inInfo.type);
+            if (job.yuv)
+            {
+                job.yuvCoefficients = YUV(job.inInfo);
+            }
+            const bool resize = job.inInfo.size != info.size;
+            if (resize)
+            {
+                const uint32_t inW = job.inInfo.size.w;
+                job.x0.resize(info.size.w);
+                job.x1.resize(info.size.w);
+                job.xt.resize(info.size.w);
+                for (uint32_t x = 0; x < info.size.w; ++x)
+                {
+                    const float fx = Math::clamp(
+                        (x + .5F) * inW / static_cast<float>(info.size.w) - .5F,
+                        0.F,
+                        static_cast<float>(inW - 1));
+                    job.x0[x] = static_cast<uint32_t>(fx);
+                    job.x1[x] = std::min(static_cast<uint32_t>(job.x0[x] + 1), static_cast<uint32_t>(inW - 1));
+                    job.xt[x] = fx - job.x0[x];
+                }
+            }
+
+            const uint32_t h = info.size.h;
+            size_t threadCount = p.threadCount;
+            if (static_cast<size_t>(info.size.w) * h < threadPixelCount)
+            {
+                threadCount = 1;
+            }
+            std::vector<Buffers> threadBuffers(threadCount);
+            System::parallelFor(
+                h,
+                threadRowCount,
+                threadCount,
+                [&job, &threadBuffers, resize](size_t thread, size_t begin, size_t end)
+                {
+                    Buffers& buffers = threadBuffers[thread];
+                    if (buffers.f0.empty())
+                    {
+                        const size_t maxChannels = 4;
+                        buffers.swap.resize(chunkSize * maxChannels * sizeof(float));
+                        buffers.f0.resize(chunkSize * maxChannels);
+                        buffers.f1.resize(chunkSize * maxChannels);
+                        if (resize)
+                        {
+                            const size_t rowSize = job.inInfo.size.w * getChannelCount(job.outInfo.type);
+                            buffers.rows[0].resize(rowSize);
+                            buffers.rows[1].resize(rowSize);
+                        }
+                    }
+                    for (size_t y = begin; y < end; ++y)
+                    {
+                        if (resize)
+                        {
+                            resizeRow(job, static_cast<uint32_t>(y), buffers);
+                        }
+                        else
+                        {
+                            convertRow(job, static_cast<uint32_t>(y), buffers);
+                        }
+                    }
+                });
+        }
+
+    } // namespace Image
+} // namespace djv
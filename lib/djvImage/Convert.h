@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvCore/Core.h>
+
+#include <memory>
+
+namespace djv
+{
+    namespace Image
+    {
+        class Data;
+        class Info;
+
+        //! CPU image data conversion.
+        //!
+        //! This converts between all of the image types, layouts, and sizes
+        //! without an OpenGL context, so that it can be used where
+        //! GL::ImageConvert is not available. Planar YUV types can be used as
+        //! the input but not the output.
+        //!
+        //! The scanlines are converted in parallel with the shared worker
+        //! threads of System::parallelFor(), and vectorized kernels (SSE2,
+        //! AVX2, F16C, or NEON depending on the compiler flags) are used for
+        //! the 8-bit, 16-bit, and floating point data types.
+        //!
+        //! The channels are converted the same way as Image::convert(); the
+        //! luminance is copied to each of the color channels, and the color
+        //! channels are averaged for luminance. Images that are resized are
+        //! filtered with bilinear interpolation.
+        class Convert
+        {
+            DJV_NON_COPYABLE(Convert);
+
+        protected:
+            void _init(size_t threadCount);
+            Convert();
+
+        public:
+            ~Convert();
+
+            //! Create a new converter. If the thread count is zero the number
+            //! of hardware threads is used.
+            static std::shared_ptr<Convert> create(size_t threadCount = 0);
+
+            size_t getThreadCount() const;
+
+            //! Convert the image data. The output data should be created
+            //! with the given information.
+            void process(const Data&, const Info&, Data&);
+
+        private:
+            DJV_PRIVATE();
+        };
+
+    } // namespace Image
+} // namespace djv
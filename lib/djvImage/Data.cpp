@@ -5,6 +5,15 @@
 #include <djvImage/Data.h>
 
 #include <djvImage/Color.h>
+#include <djvImage/Convert.h>
+#include <djvImage/DataPool.h>
+
+#if defined(DJV_MMAP)
+#include <djvSystem/File.h>
+#include <djvSystem/FileIO.h>
+
+#include <djvCore/StringFormat.h>
+#endif // DJV_MMAP
 
 #include <djvCore/UID.h>
 
@@ -12,7 +21,7 @@ namespace djv
 {
     namespace Image
     {
-        void Data::_init(const Info& info)
+        void Data::_init(const Info& info, const std::shared_ptr<DataPool>& pool)
         {
             _uid = Core::createUID();
             _info = info;
@@ -21,26 +30,99 @@ namespace djv
             _dataByteCount = info.getDataByteCount();
             if (_dataByteCount)
             {
-                _data = new uint8_t[_dataByteCount];
+                if (pool)
+                {
+                    _data = pool->allocate(_dataByteCount);
+                    _pool = pool;
+                }
+                else
+                {
+                    _data = new uint8_t[_dataByteCount];
+                }
                 _p = _data;
             }
         }
 
+#if defined(DJV_MMAP)
+        void Data::_init(const Info& info, const std::shared_ptr<System::File::IO>& io)
+        {
+            _uid = Core::createUID();
+            _info = info;
+            _pixelByteCount = info.getPixelByteCount();
+            _scanlineByteCount = info.getScanlineByteCount();
+            _dataByteCount = info.getDataByteCount();
+            if (_dataByteCount)
+            {
+                const uint8_t* p = io->mmapP();
+                if (!p || _dataByteCount > static_cast<size_t>(io->mmapEnd() - p))
+                {
+                    throw System::File::Error(Core::String::Format("{0}: Cannot read memory map.").
+                        arg(io->getFileName()));
+                }
+                _p = p;
+                _io = io;
+                io->seek(_dataByteCount);
+            }
+        }
+#endif // DJV_MMAP
+
         Data::Data()
         {}
 
         Data::~Data()
         {
-            delete[] _data;
+            if (_pool)
+            {
+                _pool->release(_data, _dataByteCount);
+            }
+            else
+            {
+                delete[] _data;
+            }
         }
 
         std::shared_ptr<Data> Data::create(const Info& info)
         {
             auto out = std::shared_ptr<Data>(new Data);
-            out->_init(info);
+            out->_init(info, std::shared_ptr<DataPool>());
             return out;
         }
 
+        std::shared_ptr<Data> Data::create(const Info& info, const std::shared_ptr<DataPool>& pool)
+        {
+            auto out = std::shared_ptr<Data>(new Data);
+            out->_init(info, pool);
+            return out;
+        }
+
+#if defined(DJV_MMAP)
+        std::shared_ptr<Data> Data::create(const Info& info, const std::shared_ptr<System::File::IO>& io)
+        {
+            auto out = std::shared_ptr<Data>(new Data);
+            out->_init(info, io);
+            return out;
+        }
+
+        void Data::detach(const std::shared_ptr<DataPool>& pool)
+        {
+            if (_io)
+            {
+                if (pool)
+                {
+                    _data = pool->allocate(_dataByteCount);
+                    _pool = pool;
+                }
+                else
+                {
+                    _data = new uint8_t[_dataByteCount];
+                }
+                memcpy(_data, _p, _dataByteCount);
+                _p = _data;
+                _io.reset();
+            }
+        }
+#endif // DJV_MMAP
+
         void Data::newUID()
         {
             _uid = Core::createUID();
@@ -58,7 +140,7 @@ namespace djv
 
         void Data::zero()
         {
-            memset(_data, 0, _dataByteCount);
+            memset(getData(), 0, _dataByteCount);
         }
 
         bool Data::operator == (const Data& other) const
@@ -70,11 +152,11 @@ namespace djv
 #else
                 if (GL_UNSIGNED_INT_10_10_10_2 == _info.getGLType())
                 {
-                    for (uint16_t y = 0; y < _info.size.h; ++y)
+                    for (uint32_t y = 0; y < _info.size.h; ++y)
                     {
                         const U10_S * p = reinterpret_cast<const U10_S*>(getData(y));
                         const U10_S * otherP = reinterpret_cast<const U10_S*>(other.getData(y));
-                        for (uint16_t x = 0; x < _info.size.w; ++x, ++p, ++otherP)
+                        for (uint32_t x = 0; x < _info.size.w; ++x, ++p, ++otherP)
                         {
                             if (*p != *otherP)
                             {
@@ -101,13 +183,13 @@ namespace djv
         namespace
         {
             template<typename T, typename T2>
-            void getAverageColor(const uint8_t* data, uint16_t width, uint16_t height, uint8_t channels, uint8_t* out)
+            void getAverageColor(const uint8_t* data, uint32_t width, uint32_t height, uint8_t channels, uint8_t* out)
             {
                 std::vector<T2> average(channels, T2(0));
                 const T* p = reinterpret_cast<const T*>(data);
-                for (uint16_t y = 0; y < height; ++y)
+                for (uint32_t y = 0; y < height; ++y)
                 {
-                    for (uint16_t x = 0; x < width; ++x)
+                    for (uint32_t x = 0; x < width; ++x)
                     {
                         for (uint8_t c = 0; c < channels; ++c)
                         {
@@ -118,17 +200,17 @@ namespace djv
                 T* outP = reinterpret_cast<T*>(out);
                 for (uint8_t c = 0; c < channels; ++c)
                 {
-                    outP[c] = average[c] / static_cast<float>(width * height);
+                    outP[c] = average[c] / (static_cast<float>(width) * height);
                 }
             }
 
-            void getAverageColorU10(const uint8_t* data, uint16_t width, uint16_t height, uint8_t* out)
+            void getAverageColorU10(const uint8_t* data, uint32_t width, uint32_t height, uint8_t* out)
             {
                 uint64_t average[3] = { 0, 0, 0 };
                 const U10_S_LSB* p = reinterpret_cast<const U10_S_LSB*>(data);
-                for (uint16_t y = 0; y < height; ++y)
+                for (uint32_t y = 0; y < height; ++y)
                 {
-                    for (uint16_t x = 0; x < width; ++x)
+                    for (uint32_t x = 0; x < width; ++x)
                     {
                         average[0] += p->r;
                         average[1] += p->g;
@@ -137,20 +219,30 @@ namespace djv
                     }
                 }
                 U10_S_LSB* outP = reinterpret_cast<U10_S_LSB*>(out);
-                outP->r = static_cast<uint32_t>(static_cast<float>(average[0]) / static_cast<float>(width * height));
-                outP->g = static_cast<uint32_t>(static_cast<float>(average[1]) / static_cast<float>(width * height));
-                outP->b = static_cast<uint32_t>(static_cast<float>(average[2]) / static_cast<float>(width * height));
+                outP->r = static_cast<uint32_t>(static_cast<float>(average[0]) / (static_cast<float>(width) * height));
+                outP->g = static_cast<uint32_t>(static_cast<float>(average[1]) / (static_cast<float>(width) * height));
+                outP->b = static_cast<uint32_t>(static_cast<float>(average[2]) / (static_cast<float>(width) * height));
             }
 
         } // namespace
 
-        Color getAverageColor(const std::shared_ptr<Data>& data)
+        Color getAverageColor(const std::shared_ptr<Data>& value)
         {
             Color out;
+            auto data = value;
+            if (data && data->isValid() && isYUVType(data->getType()))
+            {
+                // Planar YUV images are converted to RGB first, the average
+                // is taken of the RGB values.
+                const Info info(data->getSize(), getRGBType(data->getType()));
+                auto rgb = Data::create(info);
+                Convert::create(1)->process(*data, info, *rgb);
+                data = rgb;
+            }
             if (data && data->isValid())
             {
-                const uint16_t w = data->getWidth();
-                const uint16_t h = data->getHeight();
+                const uint32_t w = data->getWidth();
+                const uint32_t h = data->getHeight();
                 const Image::Type type = data->getType();
                 const uint8_t c = getChannelCount(type);
                 const uint8_t* p = data->getData();
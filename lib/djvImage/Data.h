@@ -14,15 +14,31 @@
 
 namespace djv
 {
+#if defined(DJV_MMAP)
+    namespace System
+    {
+        namespace File
+        {
+            class IO;
+
+        } // namespace File
+    } // namespace System
+#endif // DJV_MMAP
+
     namespace Image
     {
+        class DataPool;
+
         //! Image data.
         class Data
         {
             DJV_NON_COPYABLE(Data);
 
         protected:
-            void _init(const Info&);
+            void _init(const Info&, const std::shared_ptr<DataPool>&);
+#if defined(DJV_MMAP)
+            void _init(const Info&, const std::shared_ptr<System::File::IO>&);
+#endif // DJV_MMAP
             Data();
 
         public:
@@ -30,6 +46,21 @@ namespace djv
 
             static std::shared_ptr<Data> create(const Info&);
 
+            //! Create new image data using memory from the given pool. The
+            //! memory is released back to the pool when the image data is
+            //! destroyed.
+            static std::shared_ptr<Data> create(const Info&, const std::shared_ptr<DataPool>&);
+
+#if defined(DJV_MMAP)
+            //! Create image data that references the memory-mapped file at
+            //! the current position without copying it. The file is kept
+            //! open until the image data is destroyed or detached, and the
+            //! file position is moved past the image data.
+            //! Throws:
+            //! - System::File::Error
+            static std::shared_ptr<Data> create(const Info&, const std::shared_ptr<System::File::IO>&);
+#endif // DJV_MMAP
+
             //! \name Information
             ///@{
 
@@ -39,8 +70,8 @@ namespace djv
 
             const Info& getInfo() const;
             const Size& getSize() const;
-            uint16_t getWidth() const;
-            uint16_t getHeight() const;
+            uint32_t getWidth() const;
+            uint32_t getHeight() const;
             float getAspectRatio() const;
 
             Type getType() const;
@@ -62,14 +93,40 @@ namespace djv
             //! \name Data
             ///@{
 
+            //! \note The data for memory-mapped images references read-only
+            //! file pages. Call detach() before writing through the
+            //! non-const accessors.
+
             const uint8_t* getData() const;
-            const uint8_t* getData(uint16_t y) const;
-            const uint8_t* getData(uint16_t x, uint16_t y) const;
+            const uint8_t* getData(uint32_t y) const;
+            const uint8_t* getData(uint32_t x, uint32_t y) const;
             uint8_t* getData();
-            uint8_t* getData(uint16_t y);
-            uint8_t* getData(uint16_t x, uint16_t y);
+            uint8_t* getData(uint32_t y);
+            uint8_t* getData(uint32_t x, uint32_t y);
+
+            //! Get the data for a plane. Planar YUV images have three
+            //! planes, and other images have one.
+            const uint8_t* getPlaneData(uint8_t) const;
+            uint8_t* getPlaneData(uint8_t);
+
+            ///@}
+
+#if defined(DJV_MMAP)
+            //! \name Memory Mapping
+            ///@{
+
+            //! Get whether the image data references a memory-mapped file.
+            bool isMemoryMapped() const;
+
+            //! Copy memory-mapped image data so the file can be closed and the
+            //! data can be written. This does nothing if the image data is not
+            //! memory-mapped. Pointers returned by the data accessors before
+            //! detaching are no longer valid, so this must not be called while
+            //! other threads are using the image data.
+            void detach(const std::shared_ptr<DataPool>& = nullptr);
 
             ///@}
+#endif // DJV_MMAP
 
             //! \name Tags
             ///@{
@@ -99,12 +156,18 @@ namespace djv
             std::string _pluginName;
             uint8_t* _data = nullptr;
             const uint8_t* _p = nullptr;
+            std::shared_ptr<DataPool> _pool;
+#if defined(DJV_MMAP)
+            std::shared_ptr<System::File::IO> _io;
+#endif // DJV_MMAP
             Tags _tags;
         };
 
         //! \name Utility
         ///@{
 
+        //! Get the average color of the image data. Planar YUV images are
+        //! converted to RGB with the same bit depth.
         Color getAverageColor(const std::shared_ptr<Data>&);
 
         ///@}
@@ -28,12 +28,12 @@ namespace djv
             return _info.size;
         }
 
-        inline uint16_t Data::getWidth() const
+        inline uint32_t Data::getWidth() const
         {
             return _info.size.w;
         }
 
-        inline uint16_t Data::getHeight() const
+        inline uint32_t Data::getHeight() const
         {
             return _info.size.h;
         }
@@ -88,31 +88,48 @@ namespace djv
             return _p;
         }
 
-        inline const uint8_t* Data::getData(uint16_t y) const
+        inline const uint8_t* Data::getData(uint32_t y) const
         {
             return _p + y * _scanlineByteCount;
         }
 
-        inline const uint8_t* Data::getData(uint16_t x, uint16_t y) const
+        inline const uint8_t* Data::getData(uint32_t x, uint32_t y) const
         {
             return _p + y * _scanlineByteCount + x * static_cast<size_t>(_pixelByteCount);
         }
 
         inline uint8_t* Data::getData()
         {
-            return _data;
+            return const_cast<uint8_t*>(_p);
         }
 
-        inline uint8_t* Data::getData(uint16_t y)
+        inline uint8_t* Data::getData(uint32_t y)
         {
-            return _data + y * _scanlineByteCount;
+            return const_cast<uint8_t*>(_p) + y * _scanlineByteCount;
         }
 
-        inline uint8_t* Data::getData(uint16_t x, uint16_t y)
+        inline uint8_t* Data::getData(uint32_t x, uint32_t y)
         {
-            return _data + y * _scanlineByteCount + x * static_cast<size_t>(_pixelByteCount);
+            return const_cast<uint8_t*>(_p) + y * _scanlineByteCount + x * static_cast<size_t>(_pixelByteCount);
         }
 
+        inline const uint8_t* Data::getPlaneData(uint8_t plane) const
+        {
+            return _p + _info.getPlaneOffset(plane);
+        }
+
+        inline uint8_t* Data::getPlaneData(uint8_t plane)
+        {
+            return const_cast<uint8_t*>(_p) + _info.getPlaneOffset(plane);
+        }
+
+#if defined(DJV_MMAP)
+        inline bool Data::isMemoryMapped() const
+        {
+            return _io.get() != nullptr;
+        }
+#endif // DJV_MMAP
+
         inline const Tags& Data::getTags() const
         {
             return _tags;
@@ -0,0 +1,294 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvImage/DataPool.h>
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <cstdlib>
+
+#if defined(DJV_PLATFORM_WINDOWS)
+#include <malloc.h>
+#else // DJV_PLATFORM_WINDOWS
+#include <stdlib.h>
+#endif // DJV_PLATFORM_WINDOWS
+#if defined(DJV_PLATFORM_LINUX)
+#include <sys/mman.h>
+#endif // DJV_PLATFORM_LINUX
+
+namespace djv
+{
+    namespace Image
+    {
+        namespace
+        {
+            const size_t alignment         = 64;
+            const size_t hugePageSize      = 2 * 1024 * 1024;
+            const size_t minSizeClass      = 256;
+            const size_t sizeClassFraction = 16;
+
+            uint8_t* alignedAlloc(size_t byteCount, size_t align)
+            {
+                void* out = nullptr;
+#if defined(DJV_PLATFORM_WINDOWS)
+                out = _aligned_malloc(byteCount, align);
+#else // DJV_PLATFORM_WINDOWS
+                if (posix_memalign(&out, align, byteCount) != 0)
+                {
+                    out = nullptr;
+                }
+#endif // DJV_PLATFORM_WINDOWS
+                if (!out)
+                {
+                    throw std::bad_alloc();
+                }
+                return reinterpret_cast<uint8_t*>(out);
+            }
+
+            void alignedFree(uint8_t* value)
+            {
+#if defined(DJV_PLATFORM_WINDOWS)
+                _aligned_free(value);
+#else // DJV_PLATFORM_WINDOWS
+                free(value);
+#endif // DJV_PLATFORM_WINDOWS
+            }
+
+        } // namespace
+
+        struct DataPool::Private
+        {
+            //! \todo Should this be configurable?
+            size_t maxByteCount = 512 * 1024 * 1024;
+            bool hugePages = false;
+
+            mutable std::mutex mutex;
+            std::map<size_t, std::vector<uint8_t*> > freeLists;
+            size_t usedByteCount = 0;
+            size_t freeByteCount = 0;
+            size_t allocationCount = 0;
+            size_t reuseCount = 0;
+
+            uint8_t* alloc(size_t sizeClass);
+            void trim(size_t byteCount, size_t keepSizeClass);
+        };
+
+        DataPool::DataPool() :
+            _p(new Private)
+        {}
+
+        DataPool::~DataPool()
+        {
+            clear();
+        }
+
+        std::shared_ptr<DataPool> DataPool::create()
+        {
+            return std::shared_ptr<DataPool>(new DataPool);
+        }
+
+        size_t DataPool::getMaxByteCount() const
+        {
+            std::lock_guard<std::mutex> lock(_p->mutex);
+            return _p->maxByteCount;
+        }
+
+        bool DataPool::hasHugePages() const
+        {
+            std::lock_guard<std::mutex> lock(_p->mutex);
+            return _p->hugePages;
+        }
+
+        void DataPool::setMaxByteCount(size_t value)
+        {
+            DJV_PRIVATE_PTR();
+            std::lock_guard<std::mutex> lock(p.mutex);
+            p.maxByteCount = value;
+            p.trim(p.maxByteCount, 0);
+        }
+
+        void DataPool::setHugePages(bool value)
+        {
+            std::lock_guard<std::mutex> lock(_p->mutex);
+            _p->hugePages = value;
+        }
+
+        uint8_t* DataPool::allocate(size_t byteCount)
+        {
+            DJV_PRIVATE_PTR();
+            const size_t sizeClass = getSizeClass(byteCount);
+            {
+                std::lock_guard<std::mutex> lock(p.mutex);
+                ++p.allocationCount;
+                p.usedByteCount += sizeClass;
+                const auto i = p.freeLists.find(sizeClass);
+                if (i != p.freeLists.end() && !i->second.empty())
+                {
+                    uint8_t* out = i->second.back();
+                    i->second.pop_back();
+                    p.freeByteCount -= sizeClass;
+                    ++p.reuseCount;
+                    return out;
+                }
+            }
+            try
+            {
+                return p.alloc(sizeClass);
+            }
+            catch (const std::exception&)
+            {
+                std::lock_guard<std::mutex> lock(p.mutex);
+                p.usedByteCount -= sizeClass;
+                throw;
+            }
+        }
+
+        void DataPool::release(uint8_t* value, size_t byteCount)
+        {
+            DJV_PRIVATE_PTR();
+            if (!value)
+            {
+                return;
+            }
+            const size_t sizeClass = getSizeClass(byteCount);
+            bool keep = false;
+            {
+                std::lock_guard<std::mutex> lock(p.mutex);
+                p.usedByteCount -= sizeClass;
+                if (sizeClass <= p.maxByteCount)
+                {
+                    // Make room by freeing memory from the other size
+                    // classes first, since they are less likely to be used
+                    // again.
+                    p.trim(p.maxByteCount - sizeClass, sizeClass);
+                    if (p.freeByteCount + sizeClass <= p.maxByteCount)
+                    {
+                        p.freeLists[sizeClass].push_back(value);
+                        p.freeByteCount += sizeClass;
+                        keep = true;
+                    }
+                }
+            }
+            if (!keep)
+            {
+                alignedFree(value);
+            }
+        }
+
+        void DataPool::clear()
+        {
+            DJV_PRIVATE_PTR();
+            std::lock_guard<std::mutex> lock(p.mutex);
+            for (const auto& i : p.freeLists)
+            {
+                for (auto j : i.second)
+                {
+                    alignedFree(j);
+                }
+            }
+            p.freeLists.clear();
+            p.freeByteCount = 0;
+        }
+
+        size_t DataPool::getUsedByteCount() const
+        {
+            std::lock_guard<std::mutex> lock(_p->mutex);
+            return _p->usedByteCount;
+        }
+
+        size_t DataPool::getFreeByteCount() const
+        {
+            std::lock_guard<std::mutex> lock(_p->mutex);
+            return _p->freeByteCount;
+        }
+
+        float DataPool::getFreePercentage() const
+        {
+            std::lock_guard<std::mutex> lock(_p->mutex);
+            return _p->maxByteCount > 0 ?
+                (_p->freeByteCount / static_cast<float>(_p->maxByteCount) * 100.F) :
+                0.F;
+        }
+
+        size_t DataPool::getAllocationCount() const
+        {
+            std::lock_guard<std::mutex> lock(_p->mutex);
+            return _p->allocationCount;
+        }
+
+        size_t DataPool::getReuseCount() const
+        {
+            std::lock_guard<std::mutex> lock(_p->mutex);
+            return _p->reuseCount;
+        }
+
+        size_t DataPool::getSizeClass(size_t value)
+        {
+            if (value <= minSizeClass)
+            {
+                return minSizeClass;
+            }
+            size_t power = minSizeClass;
+            while (power < value)
+            {
+                power <<= 1;
+            }
+            const size_t step = power / sizeClassFraction;
+            return (value + step - 1) / step * step;
+        }
+
+        uint8_t* DataPool::Private::alloc(size_t sizeClass)
+        {
+            bool huge = false;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                huge = hugePages && sizeClass >= hugePageSize;
+            }
+            uint8_t* out = alignedAlloc(sizeClass, huge ? hugePageSize : alignment);
+#if defined(DJV_PLATFORM_LINUX) && defined(MADV_HUGEPAGE)
+            if (huge)
+            {
+                madvise(out, sizeClass, MADV_HUGEPAGE);
+            }
+#endif // DJV_PLATFORM_LINUX
+            return out;
+        }
+
+        void DataPool::Private::trim(size_t byteCount, size_t keepSizeClass)
+        {
+            // Free the largest buffers first.
+            auto i = freeLists.rbegin();
+            while (freeByteCount > byteCount && i != freeLists.rend())
+            {
+                if (i->first != keepSizeClass)
+                {
+                    while (freeByteCount > byteCount && !i->second.empty())
+                    {
+                        alignedFree(i->second.back());
+                        i->second.pop_back();
+                        freeByteCount -= i->first;
+                    }
+                }
+                ++i;
+            }
+            if (0 == keepSizeClass)
+            {
+                return;
+            }
+            const auto j = freeLists.find(keepSizeClass);
+            if (j != freeLists.end())
+            {
+                while (freeByteCount > byteCount && !j->second.empty())
+                {
+                    alignedFree(j->second.back());
+                    j->second.pop_back();
+                    freeByteCount -= j->first;
+                }
+            }
+        }
+
+    } // namespace Image
+} // namespace djv
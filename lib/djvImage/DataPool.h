@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvCore/Core.h>
+
+#include <memory>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace djv
+{
+    namespace Image
+    {
+        //! Image data memory pool.
+        //!
+        //! Memory that is released to the pool is kept in free lists and
+        //! re-used for the next allocation of the same size class, so
+        //! decoding a stream of frames does not allocate new memory for each
+        //! frame. Size classes are spaced at one sixteenth of a power of two.
+        //!
+        //! Memory is aligned for SIMD access, and large allocations may
+        //! optionally use huge pages.
+        //!
+        //! This class is thread safe.
+        class DataPool : public std::enable_shared_from_this<DataPool>
+        {
+            DJV_NON_COPYABLE(DataPool);
+
+        protected:
+            DataPool();
+
+        public:
+            ~DataPool();
+
+            static std::shared_ptr<DataPool> create();
+
+            //! \name Options
+            ///@{
+
+            //! Get the maximum number of bytes kept in the free lists.
+            size_t getMaxByteCount() const;
+
+            //! Get whether huge pages are used for large allocations. This
+            //! is currently only supported on Linux.
+            bool hasHugePages() const;
+
+            void setMaxByteCount(size_t);
+            void setHugePages(bool);
+
+            ///@}
+
+            //! \name Allocation
+            ///@{
+
+            //! Allocate memory.
+            uint8_t* allocate(size_t byteCount);
+
+            //! Release memory back to the pool. The byte count must match the
+            //! value passed to allocate().
+            void release(uint8_t*, size_t byteCount);
+
+            //! Free the memory in the free lists.
+            void clear();
+
+            ///@}
+
+            //! \name Statistics
+            ///@{
+
+            //! Get the number of bytes currently allocated from the pool.
+            size_t getUsedByteCount() const;
+
+            //! Get the number of bytes in the free lists.
+            size_t getFreeByteCount() const;
+
+            //! Get the number of bytes in the free lists as a percentage of
+            //! the maximum number of bytes.
+            float getFreePercentage() const;
+
+            //! Get the number of allocations.
+            size_t getAllocationCount() const;
+
+            //! Get the number of allocations that re-used memory from the
+            //! free lists.
+            size_t getReuseCount() const;
+
+            ///@}
+
+            //! Get the size class for the given number of bytes.
+            static size_t getSizeClass(size_t);
+
+        private:
+            DJV_PRIVATE();
+        };
+
+    } // namespace Image
+} // namespace djv
@@ -4,6 +4,8 @@
 
 #include <djvImage/Info.h>
 
+#include <array>
+
 namespace djv
 {
     namespace Image
@@ -11,7 +13,7 @@ namespace djv
         Layout::Layout() noexcept
         {}
 
-        Size::Size(uint16_t w, uint16_t h) noexcept :
+        Size::Size(uint32_t w, uint32_t h) noexcept :
             w(w),
             h(h)
         {}
@@ -25,14 +27,30 @@ namespace djv
             layout(layout)
         {}
 
-        Info::Info(uint16_t width, uint16_t height, Type type, const Layout & layout) :
+        Info::Info(uint32_t width, uint32_t height, Type type, const Layout & layout) :
             size(width, height),
             type(type),
             layout(layout)
         {}
         
+        DJV_ENUM_HELPERS_IMPLEMENTATION(YUVCoefficients);
+        DJV_ENUM_HELPERS_IMPLEMENTATION(YUVRange);
+
     } // namespace Image
 
+    DJV_ENUM_SERIALIZE_HELPERS_IMPLEMENTATION(
+        Image,
+        YUVCoefficients,
+        DJV_TEXT("image_yuv_coefficients_rec601"),
+        DJV_TEXT("image_yuv_coefficients_rec709"),
+        DJV_TEXT("image_yuv_coefficients_rec2020"));
+
+    DJV_ENUM_SERIALIZE_HELPERS_IMPLEMENTATION(
+        Image,
+        YUVRange,
+        DJV_TEXT("image_yuv_range_video"),
+        DJV_TEXT("image_yuv_range_full"));
+
     std::ostream& operator << (std::ostream& s, const Image::Size& value)
     {
         s << value.w << " ";
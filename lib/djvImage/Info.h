@@ -51,10 +51,10 @@ namespace djv
         class Size
         {
         public:
-            Size(uint16_t w = 0, uint16_t h = 0) noexcept;
+            Size(uint32_t w = 0, uint32_t h = 0) noexcept;
 
-            uint16_t w = 0;
-            uint16_t h = 0;
+            uint32_t w = 0;
+            uint32_t h = 0;
 
             bool isValid() const noexcept;
             float getAspectRatio() const noexcept;
@@ -63,6 +63,29 @@ namespace djv
             bool operator != (const Size&) const noexcept;
         };
 
+        //! YUV color coefficients.
+        enum class YUVCoefficients
+        {
+            Rec601,
+            Rec709,
+            Rec2020,
+
+            Count,
+            First = Rec601
+        };
+        DJV_ENUM_HELPERS(YUVCoefficients);
+
+        //! YUV value range.
+        enum class YUVRange
+        {
+            Video,
+            Full,
+
+            Count,
+            First = Video
+        };
+        DJV_ENUM_HELPERS(YUVRange);
+
         //! The default name.
         const std::string defaultName = "Video";
         
@@ -72,7 +95,7 @@ namespace djv
         public:
             Info();
             Info(const Size&, Type, const Layout& = Layout());
-            Info(uint16_t width, uint16_t height, Type, const Layout& = Layout());
+            Info(uint32_t width, uint32_t height, Type, const Layout& = Layout());
 
             std::string name                = defaultName;
             Size        size;
@@ -81,6 +104,11 @@ namespace djv
             Layout      layout;
             std::string codec;
 
+            //! The YUV coefficients and range are only used for planar YUV
+            //! types.
+            YUVCoefficients yuvCoefficients = YUVCoefficients::Rec709;
+            YUVRange        yuvRange        = YUVRange::Video;
+
             float getAspectRatio() const noexcept;
             GLenum getGLFormat() const noexcept;
             GLenum getGLType() const noexcept;
@@ -89,12 +117,28 @@ namespace djv
             size_t getScanlineByteCount() const noexcept;
             size_t getDataByteCount() const noexcept;
 
+            //! \name Planes
+            //! Planar YUV images have three planes, and other images have
+            //! one. The planes are stored one after another.
+            ///@{
+
+            uint8_t getPlaneCount() const noexcept;
+            Size getPlaneSize(uint8_t) const noexcept;
+            size_t getPlaneScanlineByteCount(uint8_t) const noexcept;
+            size_t getPlaneByteCount(uint8_t) const noexcept;
+            size_t getPlaneOffset(uint8_t) const noexcept;
+
+            ///@}
+
             bool operator == (const Info&) const;
             bool operator != (const Info&) const;
         };
 
     } // namespace Image
 
+    DJV_ENUM_SERIALIZE_HELPERS(Image::YUVCoefficients);
+    DJV_ENUM_SERIALIZE_HELPERS(Image::YUVRange);
+
     std::ostream& operator << (std::ostream&, const Image::Size&);
 
     //! Throws:
@@ -84,20 +84,77 @@ namespace djv
 
         inline size_t Info::getPixelByteCount() const noexcept
         {
-            return djv::Image::getByteCount(type);
+            return isYUVType(type) ?
+                djv::Image::getByteCount(getDataType(type)) :
+                djv::Image::getByteCount(type);
         }
 
         inline size_t Info::getScanlineByteCount() const noexcept
         {
-            const size_t byteCount = static_cast<size_t>(size.w) * djv::Image::getByteCount(type);
+            return getPlaneScanlineByteCount(0);
+        }
+
+        inline size_t Info::getDataByteCount() const noexcept
+        {
+            size_t out = 0;
+            const uint8_t planeCount = getPlaneCount();
+            for (uint8_t i = 0; i < planeCount; ++i)
+            {
+                out += getPlaneByteCount(i);
+            }
+            return out;
+        }
+
+        inline uint8_t Info::getPlaneCount() const noexcept
+        {
+            return isYUVType(type) ? 3 : 1;
+        }
+
+        inline Size Info::getPlaneSize(uint8_t plane) const noexcept
+        {
+            Size out = size;
+            if (plane > 0)
+            {
+                switch (type)
+                {
+                case Type::YUV_420P_U8:
+                case Type::YUV_420P_U10:
+                case Type::YUV_420P_U16:
+                    out.w = (size.w + 1) / 2;
+                    out.h = (size.h + 1) / 2;
+                    break;
+                case Type::YUV_422P_U8:
+                case Type::YUV_422P_U10:
+                case Type::YUV_422P_U16:
+                    out.w = (size.w + 1) / 2;
+                    break;
+                default: break;
+                }
+            }
+            return out;
+        }
+
+        inline size_t Info::getPlaneScanlineByteCount(uint8_t plane) const noexcept
+        {
+            const size_t byteCount = static_cast<size_t>(getPlaneSize(plane).w) * getPixelByteCount();
             const size_t q = byteCount / layout.alignment * layout.alignment;
             const size_t r = byteCount - q;
             return q + (r ? layout.alignment : 0);
         }
 
-        inline size_t Info::getDataByteCount() const noexcept
+        inline size_t Info::getPlaneByteCount(uint8_t plane) const noexcept
+        {
+            return getPlaneSize(plane).h * getPlaneScanlineByteCount(plane);
+        }
+
+        inline size_t Info::getPlaneOffset(uint8_t plane) const noexcept
         {
-            return size.h * getScanlineByteCount();
+            size_t out = 0;
+            for (uint8_t i = 0; i < plane; ++i)
+            {
+                out += getPlaneByteCount(i);
+            }
+            return out;
         }
 
         inline bool Info::operator == (const Info& other) const
@@ -109,7 +166,9 @@ namespace djv
                 pixelAspectRatio == other.pixelAspectRatio &&
                 type == other.type &&
                 layout == other.layout &&
-                codec == other.codec;
+                codec == other.codec &&
+                yuvCoefficients == other.yuvCoefficients &&
+                yuvRange == other.yuvRange;
         }
 
         inline bool Info::operator != (const Info& other) const
@@ -0,0 +1,552 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvImage/Stats.h>
+
+#include <djvImage/Convert.h>
+#include <djvImage/Data.h>
+
+#include <djvSystem/Parallel.h>
+
+#include <djvCore/Memory.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define DJV_IMAGE_STATS_SSE2
+#include <emmintrin.h>
+#endif // __SSE2__
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace Image
+    {
+        namespace
+        {
+            //! The number of scanlines for each thread job.
+            //! \todo Should this be configurable?
+            const size_t threadRowCount = 16;
+
+            //! The minimum number of pixels to use multiple threads.
+            //! \todo Should this be configurable?
+            const size_t threadPixelCount = 65536;
+
+            const size_t maxChannels = 4;
+
+            inline size_t getBin(float value, size_t binCount)
+            {
+                // This also puts NaN in the first bin.
+                const float v = value * binCount;
+                return v > 0.F ? (v < binCount - 1 ? static_cast<size_t>(v) : binCount - 1) : 0;
+            }
+
+            //! \name Value Tables
+            //! The 8-bit, 10-bit, 16-bit, and half float types are counted
+            //! with a table of every possible value, and the statistics are
+            //! computed from the tables afterwards. The values are counted
+            //! into multiple tables to avoid stalls when consecutive values
+            //! are the same; table k holds the values for channel
+            //! k % channelCount.
+            ///@{
+
+            inline size_t getTableCount(uint8_t channelCount)
+            {
+                return 3 == channelCount ? 3 : 4;
+            }
+
+            template<typename T, size_t K>
+            void countValues(const T* in, size_t size, uint64_t* tables, size_t valueCount)
+            {
+                size_t i = 0;
+                for (; i + K <= size; i += K)
+                {
+                    for (size_t k = 0; k < K; ++k)
+                    {
+                        ++tables[k * valueCount + in[i + k]];
+                    }
+                }
+                for (size_t k = 0; i < size; ++i, ++k)
+                {
+                    ++tables[k * valueCount + in[i]];
+                }
+            }
+
+            //! The size is the number of pixels.
+            void countValuesU10(const uint32_t* in, size_t size, uint64_t* tables)
+            {
+                const size_t valueCount = 1024;
+                for (size_t i = 0; i < size; ++i)
+                {
+                    const uint32_t v = in[i];
+                    ++tables[                 ((v >> 22) & 1023)];
+                    ++tables[valueCount +     ((v >> 12) & 1023)];
+                    ++tables[valueCount * 2 + ((v >>  2) & 1023)];
+                }
+            }
+
+            ///@}
+
+            //! \name Floating Point Accumulation
+            //! The 32-bit integer and floating point types are accumulated
+            //! directly.
+            ///@{
+
+            struct Accumulator
+            {
+                explicit Accumulator(size_t binCount) :
+                    bins(maxChannels * binCount, 0)
+                {
+                    for (size_t c = 0; c < maxChannels; ++c)
+                    {
+                        min[c] = std::numeric_limits<float>::max();
+                        max[c] = -std::numeric_limits<float>::max();
+                    }
+                }
+
+                float                 min[maxChannels];
+                float                 max[maxChannels];
+                double                sum[maxChannels]   = { 0.0, 0.0, 0.0, 0.0 };
+                double                sumSq[maxChannels] = { 0.0, 0.0, 0.0, 0.0 };
+                uint64_t              count[maxChannels] = { 0, 0, 0, 0 };
+                std::vector<uint64_t> bins;
+
+                void add(float value, size_t c, size_t binCount)
+                {
+                    ++bins[c * binCount + getBin(value, binCount)];
+                    if (std::isfinite(value))
+                    {
+                        min[c] = std::min(min[c], value);
+                        max[c] = std::max(max[c], value);
+                        sum[c] += value;
+                        sumSq[c] += static_cast<double>(value) * value;
+                        ++count[c];
+                    }
+                }
+
+                void add(const Accumulator& other)
+                {
+                    for (size_t c = 0; c < maxChannels; ++c)
+                    {
+                        min[c] = std::min(min[c], other.min[c]);
+                        max[c] = std::max(max[c], other.max[c]);
+                        sum[c] += other.sum[c];
+                        sumSq[c] += other.sumSq[c];
+                        count[c] += other.count[c];
+                    }
+                    for (size_t i = 0; i < bins.size(); ++i)
+                    {
+                        bins[i] += other.bins[i];
+                    }
+                }
+            };
+
+            void accumulateU32(const U32_T* in, size_t size, uint8_t channelCount, size_t binCount, Accumulator& out)
+            {
+                const double scale = 1.0 / static_cast<double>(U32Range.getMax());
+                for (size_t i = 0; i < size; ++i)
+                {
+                    out.add(static_cast<float>(in[i] * scale), i % channelCount, binCount);
+                }
+            }
+
+            void accumulateF32(const F32_T* in, size_t size, uint8_t channelCount, size_t binCount, Accumulator& out)
+            {
+                size_t i = 0;
+#if defined(DJV_IMAGE_STATS_SSE2)
+                // Each lane holds the values for channel (lane % channelCount).
+                if (0 == maxChannels % channelCount)
+                {
+                    const __m128 zero = _mm_setzero_ps();
+                    const __m128 inf = _mm_set1_ps(std::numeric_limits<float>::infinity());
+                    const __m128 negInf = _mm_set1_ps(-std::numeric_limits<float>::infinity());
+                    const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+                    const __m128 binScale = _mm_set1_ps(static_cast<float>(binCount));
+                    const __m128 binMax = _mm_set1_ps(static_cast<float>(binCount - 1));
+                    __m128 min = inf;
+                    __m128 max = negInf;
+                    __m128d sum0 = _mm_setzero_pd();
+                    __m128d sum1 = _mm_setzero_pd();
+                    __m128d sumSq0 = _mm_setzero_pd();
+                    __m128d sumSq1 = _mm_setzero_pd();
+                    __m128i count = _mm_setzero_si128();
+                    alignas(16) int32_t bins[4];
+                    uint64_t* binsP[4];
+                    for (size_t k = 0; k < 4; ++k)
+                    {
+                        binsP[k] = out.bins.data() + (k % channelCount) * binCount;
+                    }
+                    for (; i + 4 <= size; i += 4)
+                    {
+                        const __m128 v = _mm_loadu_ps(in + i);
+
+                        // Out of range and NaN values go in the first and last bins.
+                        const __m128 b = _mm_min_ps(_mm_max_ps(_mm_mul_ps(v, binScale), zero), binMax);
+                        _mm_store_si128(reinterpret_cast<__m128i*>(bins), _mm_cvttps_epi32(b));
+                        ++binsP[0][bins[0]];
+                        ++binsP[1][bins[1]];
+                        ++binsP[2][bins[2]];
+                        ++binsP[3][bins[3]];
+
+                        // Mask out the values that are not finite.
+                        const __m128 finite = _mm_cmplt_ps(_mm_and_ps(v, absMask), inf);
+                        const __m128 f = _mm_and_ps(finite, v);
+                        min = _mm_min_ps(min, _mm_or_ps(f, _mm_andnot_ps(finite, inf)));
+                        max = _mm_max_ps(max, _mm_or_ps(f, _mm_andnot_ps(finite, negInf)));
+                        const __m128d d0 = _mm_cvtps_pd(f);
+                        const __m128d d1 = _mm_cvtps_pd(_mm_movehl_ps(f, f));
+                        sum0 = _mm_add_pd(sum0, d0);
+                        sum1 = _mm_add_pd(sum1, d1);
+                        sumSq0 = _mm_add_pd(sumSq0, _mm_mul_pd(d0, d0));
+                        sumSq1 = _mm_add_pd(sumSq1, _mm_mul_pd(d1, d1));
+                        count = _mm_sub_epi32(count, _mm_castps_si128(finite));
+                    }
+                    alignas(16) float minLanes[4];
+                    alignas(16) float maxLanes[4];
+                    alignas(16) double sumLanes[4];
+                    alignas(16) double sumSqLanes[4];
+                    alignas(16) int32_t countLanes[4];
+                    _mm_store_ps(minLanes, min);
+                    _mm_store_ps(maxLanes, max);
+                    _mm_store_pd(sumLanes, sum0);
+                    _mm_store_pd(sumLanes + 2, sum1);
+                    _mm_store_pd(sumSqLanes, sumSq0);
+                    _mm_store_pd(sumSqLanes + 2, sumSq1);
+                    _mm_store_si128(reinterpret_cast<__m128i*>(countLanes), count);
+                    for (size_t k = 0; k < 4; ++k)
+                    {
+                        const size_t c = k % channelCount;
+                        if (countLanes[k] > 0)
+                        {
+                            out.min[c] = std::min(out.min[c], minLanes[k]);
+                            out.max[c] = std::max(out.max[c], maxLanes[k]);
+                        }
+                        out.sum[c] += sumLanes[k];
+                        out.sumSq[c] += sumSqLanes[k];
+                        out.count[c] += countLanes[k];
+                    }
+                }
+#endif // DJV_IMAGE_STATS_SSE2
+                for (; i < size; ++i)
+                {
+                    out.add(in[i], i % channelCount, binCount);
+                }
+            }
+
+            ///@}
+
+            //! Run the function for each scanline in parallel. The function
+            //! is given the thread index and the scanline.
+            template<typename F>
+            void forEachRow(size_t h, size_t threadCount, const F& f)
+            {
+                System::parallelFor(
+                    h,
+                    threadRowCount,
+                    threadCount,
+                    [&f](size_t thread, size_t begin, size_t end)
+                    {
+                        for (size_t y = begin; y < end; ++y)
+                        {
+                            f(thread, y);
+                        }
+                    });
+            }
+
+            size_t getThreadCount(size_t w, size_t h, size_t value)
+            {
+                size_t out = value ? value : System::getHardwareThreadCount();
+                out = std::min(out, (h + threadRowCount - 1) / threadRowCount);
+                if (w * h < threadPixelCount)
+                {
+                    out = 1;
+                }
+                return out;
+            }
+
+            void getTableStats(const Data& data, size_t threadCount, Stats& out)
+            {
+                const size_t w = data.getWidth();
+                const size_t h = data.getHeight();
+                const DataType dataType = getDataType(data.getType());
+                const size_t tableCount = getTableCount(out.channelCount);
+                size_t valueCount = 0;
+                switch (dataType)
+                {
+                case DataType::U8:  valueCount = 256;   break;
+                case DataType::U10: valueCount = 1024;  break;
+                case DataType::U16:
+                case DataType::F16: valueCount = 65536; break;
+                default: break;
+                }
+
+                std::vector<std::vector<uint64_t> > tables(threadCount);
+                for (auto& i : tables)
+                {
+                    i.resize(tableCount * valueCount, 0);
+                }
+                const size_t size = w * out.channelCount;
+                forEachRow(
+                    h,
+                    threadCount,
+                    [&data, &tables, dataType, tableCount, valueCount, w, size](size_t thread, size_t y)
+                    {
+                        const uint8_t* p = data.getData(static_cast<uint32_t>(y));
+                        uint64_t* t = tables[thread].data();
+                        switch (dataType)
+                        {
+                        case DataType::U8:
+                            if (3 == tableCount)
+                            {
+                                countValues<U8_T, 3>(p, size, t, valueCount);
+                            }
+                            else
+                            {
+                                countValues<U8_T, 4>(p, size, t, valueCount);
+                            }
+                            break;
+                        case DataType::U16:
+                        case DataType::F16:
+                            if (3 == tableCount)
+                            {
+                                countValues<uint16_t, 3>(reinterpret_cast<const uint16_t*>(p), size, t, valueCount);
+                            }
+                            else
+                            {
+                                countValues<uint16_t, 4>(reinterpret_cast<const uint16_t*>(p), size, t, valueCount);
+                            }
+                            break;
+                        case DataType::U10:
+                            countValuesU10(reinterpret_cast<const uint32_t*>(p), w, t);
+                            break;
+                        default: break;
+                        }
+                    });
+
+                // Combine the tables for each channel.
+                std::vector<uint64_t> counts(out.channelCount * valueCount, 0);
+                for (const auto& i : tables)
+                {
+                    for (size_t k = 0; k < tableCount; ++k)
+                    {
+                        const uint64_t* in = i.data() + k * valueCount;
+                        uint64_t* c = counts.data() + (k % out.channelCount) * valueCount;
+                        for (size_t v = 0; v < valueCount; ++v)
+                        {
+                            c[v] += in[v];
+                        }
+                    }
+                }
+
+                // Compute the normalized value and histogram bin of each table entry.
+                std::vector<float> values(valueCount);
+                switch (dataType)
+                {
+                case DataType::U8:
+                case DataType::U10:
+                case DataType::U16:
+                {
+                    const float scale = 1.F / static_cast<float>(valueCount - 1);
+                    for (size_t v = 0; v < valueCount; ++v)
+                    {
+                        values[v] = v * scale;
+                    }
+                    break;
+                }
+                case DataType::F16:
+                    for (size_t v = 0; v < valueCount; ++v)
+                    {
+                        F16_T f;
+                        f.setBits(static_cast<unsigned short>(v));
+                        values[v] = f;
+                    }
+                    break;
+                default: break;
+                }
+                std::vector<size_t> bins(valueCount);
+                for (size_t v = 0; v < valueCount; ++v)
+                {
+                    bins[v] = getBin(values[v], out.binCount);
+                }
+
+                for (uint8_t c = 0; c < out.channelCount; ++c)
+                {
+                    const uint64_t* in = counts.data() + c * valueCount;
+                    float min = std::numeric_limits<float>::max();
+                    float max = -std::numeric_limits<float>::max();
+                    double sum = 0.0;
+                    uint64_t count = 0;
+                    for (size_t v = 0; v < valueCount; ++v)
+                    {
+                        if (in[v])
+                        {
+                            out.histogram[c][bins[v]] += in[v];
+                            const float f = values[v];
+                            if (std::isfinite(f))
+                            {
+                                min = std::min(min, f);
+                                max = std::max(max, f);
+                                sum += static_cast<double>(f) * in[v];
+                                count += in[v];
+                            }
+                        }
+                    }
+                    if (count)
+                    {
+                        const double mean = sum / count;
+                        double variance = 0.0;
+                        for (size_t v = 0; v < valueCount; ++v)
+                        {
+                            if (in[v] && std::isfinite(values[v]))
+                            {
+                                const double d = values[v] - mean;
+                                variance += d * d * in[v];
+                            }
+                        }
+                        out.min[c] = min;
+                        out.max[c] = max;
+                        out.mean[c] = static_cast<float>(mean);
+                        out.stdDev[c] = static_cast<float>(std::sqrt(variance / count));
+                    }
+                }
+            }
+
+            void getAccumulatorStats(const Data& data, size_t threadCount, Stats& out)
+            {
+                const size_t w = data.getWidth();
+                const size_t h = data.getHeight();
+                const DataType dataType = getDataType(data.getType());
+                const uint8_t channelCount = out.channelCount;
+                const size_t binCount = out.binCount;
+                std::vector<Accumulator> accumulators(threadCount, Accumulator(binCount));
+                forEachRow(
+                    h,
+                    threadCount,
+                    [&data, &accumulators, dataType, channelCount, binCount, w](size_t thread, size_t y)
+                    {
+                        const uint8_t* p = data.getData(static_cast<uint32_t>(y));
+                        switch (dataType)
+                        {
+                        case DataType::U32:
+                            accumulateU32(reinterpret_cast<const U32_T*>(p), w * channelCount, channelCount, binCount, accumulators[thread]);
+                            break;
+                        case DataType::F32:
+                            accumulateF32(reinterpret_cast<const F32_T*>(p), w * channelCount, channelCount, binCount, accumulators[thread]);
+                            break;
+                        default: break;
+                        }
+                    });
+
+                Accumulator a(binCount);
+                for (const auto& i : accumulators)
+                {
+                    a.add(i);
+                }
+                for (uint8_t c = 0; c < channelCount; ++c)
+                {
+                    for (size_t b = 0; b < binCount; ++b)
+                    {
+                        out.histogram[c][b] = a.bins[c * binCount + b];
+                    }
+                    if (a.count[c])
+                    {
+                        const double mean = a.sum[c] / a.count[c];
+                        out.min[c] = a.min[c];
+                        out.max[c] = a.max[c];
+                        out.mean[c] = static_cast<float>(mean);
+                        out.stdDev[c] = static_cast<float>(std::sqrt(std::max(a.sumSq[c] / a.count[c] - mean * mean, 0.0)));
+                    }
+                }
+            }
+
+        } // namespace
+
+        Stats::Stats()
+        {}
+
+        size_t Stats::getHistogramMax() const
+        {
+            size_t out = 0;
+            for (const auto& i : histogram)
+            {
+                for (const auto j : i)
+                {
+                    out = std::max(out, j);
+                }
+            }
+            return out;
+        }
+
+        bool Stats::isValid() const
+        {
+            return channelCount > 0 && binCount > 0;
+        }
+
+        bool Stats::operator == (const Stats& other) const
+        {
+            return
+                channelCount == other.channelCount &&
+                binCount == other.binCount &&
+                histogram == other.histogram &&
+                min == other.min &&
+                max == other.max &&
+                mean == other.mean &&
+                stdDev == other.stdDev;
+        }
+
+        Stats getStats(const Data& data, size_t binCount, size_t threadCount)
+        {
+            Stats out;
+            if (!data.isValid() || 0 == binCount)
+            {
+                return out;
+            }
+
+            const Info& info = data.getInfo();
+            const size_t w = info.size.w;
+            const size_t h = info.size.h;
+            threadCount = getThreadCount(w, h, threadCount);
+
+            // Convert planar YUV and non-native endian data first.
+            std::shared_ptr<Data> tmp;
+            const Data* in = &data;
+            const bool yuv = isYUVType(info.type);
+            if (yuv || (info.layout.endian != Memory::getEndian() && getByteCount(getDataType(info.type)) > 1))
+            {
+                const Info tmpInfo(info.size, getRGBType(info.type));
+                tmp = Data::create(tmpInfo);
+                auto convert = Convert::create(threadCount);
+                convert->process(data, tmpInfo, *tmp);
+                in = tmp.get();
+            }
+
+            out.channelCount = getChannelCount(in->getType());
+            out.binCount = binCount;
+            out.histogram.resize(out.channelCount, std::vector<size_t>(binCount, 0));
+            out.min.resize(out.channelCount, 0.F);
+            out.max.resize(out.channelCount, 0.F);
+            out.mean.resize(out.channelCount, 0.F);
+            out.stdDev.resize(out.channelCount, 0.F);
+            switch (getDataType(in->getType()))
+            {
+            case DataType::U8:
+            case DataType::U10:
+            case DataType::U16:
+            case DataType::F16:
+                getTableStats(*in, threadCount, out);
+                break;
+            case DataType::U32:
+            case DataType::F32:
+                getAccumulatorStats(*in, threadCount, out);
+                break;
+            default: break;
+            }
+            return out;
+        }
+
+    } // namespace Image
+} // namespace djv
@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvCore/Core.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace djv
+{
+    namespace Image
+    {
+        class Data;
+
+        //! Image statistics.
+        //!
+        //! The values are normalized to the range 0.0 - 1.0 for the integer
+        //! types. The histogram bins divide the range 0.0 - 1.0 evenly, and
+        //! values outside of that range are counted in the first and last
+        //! bins. Floating point values that are not finite are only counted
+        //! in the histogram.
+        class Stats
+        {
+        public:
+            Stats();
+
+            uint8_t                           channelCount = 0;
+            size_t                            binCount     = 0;
+            std::vector<std::vector<size_t> > histogram;
+            std::vector<float>                min;
+            std::vector<float>                max;
+            std::vector<float>                mean;
+            std::vector<float>                stdDev;
+
+            //! Get the largest histogram bin value for all of the channels.
+            size_t getHistogramMax() const;
+
+            bool isValid() const;
+
+            bool operator == (const Stats&) const;
+        };
+
+        //! \name Utility
+        ///@{
+
+        //! Compute the image statistics. The scanlines are processed in
+        //! parallel with System::parallelFor(); if the thread count is zero
+        //! the number of hardware threads is used. Planar YUV images are
+        //! converted to RGB first.
+        Stats getStats(const Data&, size_t binCount = 256, size_t threadCount = 0);
+
+        ///@}
+
+    } // namespace Image
+} // namespace djv
@@ -497,7 +497,17 @@ namespace djv
                 Channels::RGBA,
                 Channels::RGBA,
                 Channels::RGBA,
-                Channels::RGBA
+                Channels::RGBA,
+
+                Channels::RGB,
+                Channels::RGB,
+                Channels::RGB,
+                Channels::RGB,
+                Channels::RGB,
+                Channels::RGB,
+                Channels::RGB,
+                Channels::RGB,
+                Channels::RGB
             };
             return data[static_cast<size_t>(value)];
         }
@@ -510,7 +520,8 @@ namespace djv
                 1, 1, 1, 1, 1,
                 2, 2, 2, 2, 2,
                 3, 3, 3, 3, 3, 3,
-                4, 4, 4, 4, 4
+                4, 4, 4, 4, 4,
+                3, 3, 3, 3, 3, 3, 3, 3, 3
             };
             return data[static_cast<size_t>(value)];
         }
@@ -544,7 +555,17 @@ namespace djv
                 DataType::U16,
                 DataType::U32,
                 DataType::F16,
-                DataType::F32
+                DataType::F32,
+
+                DataType::U8,
+                DataType::U8,
+                DataType::U8,
+                DataType::U10,
+                DataType::U10,
+                DataType::U10,
+                DataType::U16,
+                DataType::U16,
+                DataType::U16
             };
             return data[static_cast<size_t>(value)];
         }
@@ -557,7 +578,8 @@ namespace djv
                 8, 16, 32, 16, 32,
                 8, 16, 32, 16, 32,
                 8, 10, 16, 32, 16, 32,
-                8, 16, 32, 16, 32
+                8, 16, 32, 16, 32,
+                8, 8, 8, 10, 10, 10, 16, 16, 16
             };
             return data[static_cast<size_t>(value)];
         }
@@ -585,7 +607,8 @@ namespace djv
                 1, 2, 4, 2, 4,
                 2, 4, 8, 4, 8,
                 3, 4, 6, 12, 6, 12,
-                4, 8, 16, 8, 16
+                4, 8, 16, 8, 16,
+                3, 3, 3, 6, 6, 6, 6, 6, 6
             };
             return data[static_cast<size_t>(value)];
         }
@@ -614,6 +637,7 @@ namespace djv
                 true, true, true, false, false,
                 true, true, true, true, false, false,
                 true, true, true, false, false,
+                true, true, true, true, true, true, true, true, true
             };
             return data[static_cast<size_t>(value)];
         }
@@ -626,7 +650,8 @@ namespace djv
                 false, false, false, true, true,
                 false, false, false, true, true,
                 false, false, false, false, true, true,
-                false, false, false, true, true
+                false, false, false, true, true,
+                false, false, false, false, false, false, false, false, false
             };
             return data[static_cast<size_t>(value)];
         }
@@ -661,6 +686,16 @@ namespace djv
                 Math::IntRange(U32Range.getMin(), U32Range.getMax()),
                 Math::IntRange(0, 0),
                 Math::IntRange(0, 0),
+
+                Math::IntRange(U8Range.getMin(), U8Range.getMax()),
+                Math::IntRange(U8Range.getMin(), U8Range.getMax()),
+                Math::IntRange(U8Range.getMin(), U8Range.getMax()),
+                Math::IntRange(U10Range.getMin(), U10Range.getMax()),
+                Math::IntRange(U10Range.getMin(), U10Range.getMax()),
+                Math::IntRange(U10Range.getMin(), U10Range.getMax()),
+                Math::IntRange(U16Range.getMin(), U16Range.getMax()),
+                Math::IntRange(U16Range.getMin(), U16Range.getMax()),
+                Math::IntRange(U16Range.getMin(), U16Range.getMax())
             };
             return data[static_cast<size_t>(value)];
         }
@@ -695,6 +730,16 @@ namespace djv
                 Math::FloatRange(0.F, 0.F),
                 Math::FloatRange(F16Range.getMin(), F16Range.getMax()),
                 Math::FloatRange(F32Range.getMin(), F32Range.getMax()),
+
+                Math::FloatRange(0.F, 0.F),
+                Math::FloatRange(0.F, 0.F),
+                Math::FloatRange(0.F, 0.F),
+                Math::FloatRange(0.F, 0.F),
+                Math::FloatRange(0.F, 0.F),
+                Math::FloatRange(0.F, 0.F),
+                Math::FloatRange(0.F, 0.F),
+                Math::FloatRange(0.F, 0.F),
+                Math::FloatRange(0.F, 0.F)
             };
             return data[static_cast<size_t>(value)];
         }
@@ -786,6 +831,44 @@ namespace djv
             return Type::None;
         }
 
+        bool isYUVType(Type value) noexcept
+        {
+            bool out = false;
+            switch (value)
+            {
+            case Type::YUV_420P_U8:
+            case Type::YUV_422P_U8:
+            case Type::YUV_444P_U8:
+            case Type::YUV_420P_U10:
+            case Type::YUV_422P_U10:
+            case Type::YUV_444P_U10:
+            case Type::YUV_420P_U16:
+            case Type::YUV_422P_U16:
+            case Type::YUV_444P_U16: out = true; break;
+            default: break;
+            }
+            return out;
+        }
+
+        Type getRGBType(Type value) noexcept
+        {
+            Type out = value;
+            switch (value)
+            {
+            case Type::YUV_420P_U8:
+            case Type::YUV_422P_U8:
+            case Type::YUV_444P_U8:  out = Type::RGB_U8; break;
+            case Type::YUV_420P_U10:
+            case Type::YUV_422P_U10:
+            case Type::YUV_444P_U10: out = Type::RGB_U10; break;
+            case Type::YUV_420P_U16:
+            case Type::YUV_422P_U16:
+            case Type::YUV_444P_U16: out = Type::RGB_U16; break;
+            default: break;
+            }
+            return out;
+        }
+
         GLenum getGLFormat(Type value) noexcept
         {
             const std::array<GLenum, static_cast<size_t>(Type::Count)> data =
@@ -816,6 +899,16 @@ namespace djv
                 GL_NONE,
                 GL_NONE,
                 GL_NONE,
+                GL_NONE,
+
+                GL_LUMINANCE,
+                GL_LUMINANCE,
+                GL_LUMINANCE,
+                GL_NONE,
+                GL_NONE,
+                GL_NONE,
+                GL_NONE,
+                GL_NONE,
                 GL_NONE
 #else // DJV_GL_ES2
                 GL_RED,
@@ -841,7 +934,17 @@ namespace djv
                 GL_RGBA,
                 GL_RGBA,
                 GL_RGBA,
-                GL_RGBA
+                GL_RGBA,
+
+                GL_RED,
+                GL_RED,
+                GL_RED,
+                GL_RED,
+                GL_RED,
+                GL_RED,
+                GL_RED,
+                GL_RED,
+                GL_RED
 #endif // DJV_GL_ES2
             };
             return data[static_cast<size_t>(value)];
@@ -878,6 +981,16 @@ namespace djv
                 GL_NONE,
                 GL_NONE,
                 GL_NONE,
+
+                GL_UNSIGNED_BYTE,
+                GL_UNSIGNED_BYTE,
+                GL_UNSIGNED_BYTE,
+                GL_NONE,
+                GL_NONE,
+                GL_NONE,
+                GL_NONE,
+                GL_NONE,
+                GL_NONE
 #else // DJV_GL_ES2
                 GL_UNSIGNED_BYTE,
                 GL_UNSIGNED_SHORT,
@@ -902,7 +1015,17 @@ namespace djv
                 GL_UNSIGNED_SHORT,
                 GL_UNSIGNED_INT,
                 GL_HALF_FLOAT,
-                GL_FLOAT
+                GL_FLOAT,
+
+                GL_UNSIGNED_BYTE,
+                GL_UNSIGNED_BYTE,
+                GL_UNSIGNED_BYTE,
+                GL_UNSIGNED_SHORT,
+                GL_UNSIGNED_SHORT,
+                GL_UNSIGNED_SHORT,
+                GL_UNSIGNED_SHORT,
+                GL_UNSIGNED_SHORT,
+                GL_UNSIGNED_SHORT
 #endif // DJV_GL_ES2
             };
             return data[static_cast<size_t>(value)];
@@ -1008,7 +1131,16 @@ namespace djv
         DJV_TEXT("image_type_rgba_u16"),
         DJV_TEXT("image_type_rgba_u32"),
         DJV_TEXT("image_type_rgba_f16"),
-        DJV_TEXT("image_type_rgba_f32"));
+        DJV_TEXT("image_type_rgba_f32"),
+        DJV_TEXT("image_type_yuv_420p_u8"),
+        DJV_TEXT("image_type_yuv_422p_u8"),
+        DJV_TEXT("image_type_yuv_444p_u8"),
+        DJV_TEXT("image_type_yuv_420p_u10"),
+        DJV_TEXT("image_type_yuv_422p_u10"),
+        DJV_TEXT("image_type_yuv_444p_u10"),
+        DJV_TEXT("image_type_yuv_420p_u16"),
+        DJV_TEXT("image_type_yuv_422p_u16"),
+        DJV_TEXT("image_type_yuv_444p_u16"));
 
     DJV_ENUM_SERIALIZE_HELPERS_IMPLEMENTATION(
         Image,
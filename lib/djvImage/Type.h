@@ -59,6 +59,16 @@ namespace djv
             RGBA_F16,
             RGBA_F32,
 
+            YUV_420P_U8,
+            YUV_422P_U8,
+            YUV_444P_U8,
+            YUV_420P_U10,
+            YUV_422P_U10,
+            YUV_444P_U10,
+            YUV_420P_U16,
+            YUV_422P_U16,
+            YUV_444P_U16,
+
             Count,
             First = None
         };
@@ -166,6 +176,9 @@ namespace djv
         DataType getDataType(Type) noexcept;
         uint8_t getBitDepth(Type) noexcept;
         uint8_t getBitDepth(DataType) noexcept;
+
+        //! Get the number of bytes per pixel. For planar YUV types this is
+        //! the size of one Y, U, and V sample.
         size_t getByteCount(Type) noexcept;
         size_t getByteCount(DataType) noexcept;
 
@@ -176,6 +189,16 @@ namespace djv
         Type getIntType(uint8_t channelCount, uint8_t bitDepth) noexcept;
         Type getFloatType(uint8_t channelCount, uint8_t bitDepth) noexcept;
 
+        //! Get whether the type is planar YUV. Planar YUV images store the
+        //! Y, U, and V planes one after another, with the U and V planes
+        //! sub-sampled as given by the type. The 10-bit types store one
+        //! sample per 16-bit value.
+        bool isYUVType(Type) noexcept;
+
+        //! Get the RGB type with the same bit depth as a planar YUV type.
+        //! Other types are returned unchanged.
+        Type getRGBType(Type) noexcept;
+
         GLenum getGLFormat(Type) noexcept;
         GLenum getGLType(Type) noexcept;
 
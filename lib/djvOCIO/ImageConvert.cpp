@@ -0,0 +1,529 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvOCIO/ImageConvert.h>
+
+#include <djvOCIO/OCIO.h>
+
+#include <djvImage/Data.h>
+
+#include <djvSystem/Parallel.h>
+
+#include <djvCore/Cache.h>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define DJV_OCIO_IMAGE_CONVERT_SSE2
+#include <emmintrin.h>
+#endif // __SSE2__
+
+using namespace djv::Core;
+
+namespace _OCIO = OCIO_NAMESPACE;
+
+namespace djv
+{
+    namespace OCIO
+    {
+        namespace
+        {
+            //! \todo Should this be configurable?
+            const size_t lutEdgeLen = 33;
+            const size_t lutCacheMax = 16;
+
+            //! The number of pixels that are processed at a time.
+            //! \todo Should this be configurable?
+            const size_t chunkSize = 256;
+
+            //! The number of scanlines for each thread job.
+            //! \todo Should this be configurable?
+            const size_t threadRowCount = 16;
+
+            //! The minimum number of pixels to use multiple threads.
+            //! \todo Should this be configurable?
+            const size_t threadPixelCount = 65536;
+
+            //! Approximate base 2 logarithm of a positive value, accurate to
+            //! about 2e-5 which is well below the resolution of the LUT.
+            inline float fastLog2(float value)
+            {
+                uint32_t i = 0;
+                memcpy(&i, &value, sizeof(float));
+                const float e = static_cast<float>(static_cast<int>((i >> 23) & 0xff) - 127);
+                i = (i & 0x007fffff) | 0x3f800000;
+                float m = 0.F;
+                memcpy(&m, &i, sizeof(float));
+                const float x = m - 1.F;
+                return e + x * (1.441879896F + x * (-.708865218F + x * (.415245561F + x * (-.193516525F + x * .045268293F))));
+            }
+
+#if defined(DJV_OCIO_IMAGE_CONVERT_SSE2)
+            inline __m128 fastLog2(__m128 value)
+            {
+                const __m128i i = _mm_castps_si128(value);
+                const __m128 e = _mm_cvtepi32_ps(_mm_sub_epi32(
+                    _mm_and_si128(_mm_srli_epi32(i, 23), _mm_set1_epi32(0xff)),
+                    _mm_set1_epi32(127)));
+                const __m128 x = _mm_sub_ps(
+                    _mm_castsi128_ps(_mm_or_si128(
+                        _mm_and_si128(i, _mm_set1_epi32(0x007fffff)),
+                        _mm_set1_epi32(0x3f800000))),
+                    _mm_set1_ps(1.F));
+                __m128 p = _mm_set1_ps(.045268293F);
+                p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(-.193516525F));
+                p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(.415245561F));
+                p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(-.708865218F));
+                p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(1.441879896F));
+                return _mm_add_ps(e, _mm_mul_ps(p, x));
+            }
+#endif // DJV_OCIO_IMAGE_CONVERT_SSE2
+
+            //! Maps values from the input color space to the domain of the
+            //! LUT, using the allocation of the color space.
+            struct Shaper
+            {
+                bool  log2   = false;
+                float min    = 0.F;
+                float max    = 1.F;
+                float offset = 0.F;
+
+                float toLUT(float value) const
+                {
+                    if (log2)
+                    {
+                        const float v = value + offset;
+                        value = v > 0.F ? fastLog2(v) : min;
+                    }
+                    return (value - min) / (max - min);
+                }
+
+                float fromLUT(float value) const
+                {
+                    value = min + value * (max - min);
+                    return log2 ? (std::pow(2.F, value) - offset) : value;
+                }
+            };
+
+            //! Baked 3D LUT. Each entry is padded to four floats so that it
+            //! can be loaded with a single vector instruction.
+            struct LUT
+            {
+                Shaper             shaper;
+                size_t             edgeLen = 0;
+                std::vector<float> data;
+
+                //! Scale from the shaped values to the lattice coordinates.
+                float              scale   = 0.F;
+
+                inline void lookup(const float* in, float* out) const;
+            };
+
+            Shaper getShaper(const _OCIO::ConstColorSpaceRcPtr& colorSpace)
+            {
+                Shaper out;
+                if (colorSpace)
+                {
+                    const int varCount = colorSpace->getAllocationNumVars();
+                    std::vector<float> vars(std::max(varCount, 0));
+                    if (varCount > 0)
+                    {
+                        colorSpace->getAllocationVars(vars.data());
+                    }
+                    switch (colorSpace->getAllocation())
+                    {
+                    case _OCIO::ALLOCATION_LG2:
+                        out.log2 = true;
+                        out.min = varCount >= 2 ? vars[0] : -10.F;
+                        out.max = varCount >= 2 ? vars[1] : 6.F;
+                        out.offset = varCount >= 3 ? vars[2] : 0.F;
+                        break;
+                    default:
+                        if (varCount >= 2)
+                        {
+                            out.min = vars[0];
+                            out.max = vars[1];
+                        }
+                        break;
+                    }
+                    if (out.max <= out.min)
+                    {
+                        out.min = out.log2 ? -10.F : 0.F;
+                        out.max = out.log2 ? 6.F : 1.F;
+                    }
+                }
+                return out;
+            }
+
+            std::shared_ptr<LUT> bakeLUT(
+                const _OCIO::ConstConfigRcPtr& config,
+                const Convert& convert)
+            {
+                auto out = std::shared_ptr<LUT>(new LUT);
+                out->shaper = getShaper(config->getColorSpace(convert.input.c_str()));
+                out->edgeLen = lutEdgeLen;
+                out->scale = (out->edgeLen - 1) / (out->shaper.max - out->shaper.min);
+
+                // Evaluate the processor on the lattice of the LUT.
+                const size_t n = out->edgeLen;
+                const size_t count = n * n * n;
+                std::vector<float> lattice(count * 3);
+                std::vector<float> values(n);
+                for (size_t i = 0; i < n; ++i)
+                {
+                    values[i] = out->shaper.fromLUT(i / static_cast<float>(n - 1));
+                }
+                float* p = lattice.data();
+                for (size_t b = 0; b < n; ++b)
+                {
+                    for (size_t g = 0; g < n; ++g)
+                    {
+                        for (size_t r = 0; r < n; ++r, p += 3)
+                        {
+                            p[0] = values[r];
+                            p[1] = values[g];
+                            p[2] = values[b];
+                        }
+                    }
+                }
+                auto processor = config->getProcessor(convert.input.c_str(), convert.output.c_str());
+                _OCIO::PackedImageDesc imageDesc(lattice.data(), static_cast<long>(count), 1, 3);
+                processor->apply(imageDesc);
+
+                out->data.resize(count * 4);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    out->data[i * 4 + 0] = lattice[i * 3 + 0];
+                    out->data[i * 4 + 1] = lattice[i * 3 + 1];
+                    out->data[i * 4 + 2] = lattice[i * 3 + 2];
+                    out->data[i * 4 + 3] = 0.F;
+                }
+                return out;
+            }
+
+            inline void LUT::lookup(const float* in, float* out) const
+            {
+                // Find the lattice cell and the position inside of it. Values
+                // outside of the domain (including NaN) are clamped.
+                const float s = static_cast<float>(edgeLen - 1);
+#if defined(DJV_OCIO_IMAGE_CONVERT_SSE2)
+                __m128 v = _mm_setr_ps(in[0], in[1], in[2], 0.F);
+                if (shaper.log2)
+                {
+                    const __m128 min = _mm_set1_ps(shaper.min);
+                    v = _mm_add_ps(v, _mm_set1_ps(shaper.offset));
+                    const __m128 positive = _mm_cmpgt_ps(v, _mm_setzero_ps());
+                    v = _mm_or_ps(
+                        _mm_and_ps(positive, fastLog2(v)),
+                        _mm_andnot_ps(positive, min));
+                }
+                v = _mm_mul_ps(_mm_sub_ps(v, _mm_set1_ps(shaper.min)), _mm_set1_ps(scale));
+                v = _mm_min_ps(_mm_max_ps(v, _mm_setzero_ps()), _mm_set1_ps(s));
+                const __m128i vi = _mm_cvttps_epi32(_mm_min_ps(v, _mm_set1_ps(s - 1.F)));
+                int32_t i[4];
+                float d[4];
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(i), vi);
+                _mm_storeu_ps(d, _mm_sub_ps(v, _mm_cvtepi32_ps(vi)));
+#else // DJV_OCIO_IMAGE_CONVERT_SSE2
+                size_t i[3];
+                float d[3];
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    float v = in[c];
+                    if (shaper.log2)
+                    {
+                        v += shaper.offset;
+                        v = v > 0.F ? fastLog2(v) : shaper.min;
+                    }
+                    v = (v - shaper.min) * scale;
+                    if (!(v > 0.F))
+                    {
+                        v = 0.F;
+                    }
+                    else if (v > s)
+                    {
+                        v = s;
+                    }
+                    i[c] = std::min(static_cast<size_t>(v), edgeLen - 2);
+                    d[c] = v - i[c];
+                }
+#endif // DJV_OCIO_IMAGE_CONVERT_SSE2
+
+                // Tetrahedral interpolation between the four corners of the
+                // tetrahedron that contains the value.
+                const size_t rStride = 4;
+                const size_t gStride = edgeLen * 4;
+                const size_t bStride = edgeLen * edgeLen * 4;
+                const float* c0 = data.data() + i[2] * bStride + i[1] * gStride + i[0] * rStride;
+                const float dr = d[0];
+                const float dg = d[1];
+                const float db = d[2];
+                size_t o1 = 0;
+                size_t o2 = 0;
+                float w0 = 0.F;
+                float w1 = 0.F;
+                float w2 = 0.F;
+                float w3 = 0.F;
+                if (dr > dg)
+                {
+                    if (dg > db)
+                    {
+                        o1 = rStride; o2 = rStride + gStride;
+                        w0 = 1.F - dr; w1 = dr - dg; w2 = dg - db; w3 = db;
+                    }
+                    else if (dr > db)
+                    {
+                        o1 = rStride; o2 = rStride + bStride;
+                        w0 = 1.F - dr; w1 = dr - db; w2 = db - dg; w3 = dg;
+                    }
+                    else
+                    {
+                        o1 = bStride; o2 = rStride + bStride;
+                        w0 = 1.F - db; w1 = db - dr; w2 = dr - dg; w3 = dg;
+                    }
+                }
+                else
+                {
+                    if (db > dg)
+                    {
+                        o1 = bStride; o2 = gStride + bStride;
+                        w0 = 1.F - db; w1 = db - dg; w2 = dg - dr; w3 = dr;
+                    }
+                    else if (db > dr)
+                    {
+                        o1 = gStride; o2 = gStride + bStride;
+                        w0 = 1.F - dg; w1 = dg - db; w2 = db - dr; w3 = dr;
+                    }
+                    else
+                    {
+                        o1 = gStride; o2 = rStride + gStride;
+                        w0 = 1.F - dg; w1 = dg - dr; w2 = dr - db; w3 = db;
+                    }
+                }
+                const size_t o3 = rStride + gStride + bStride;
+#if defined(DJV_OCIO_IMAGE_CONVERT_SSE2)
+                __m128 o = _mm_mul_ps(_mm_loadu_ps(c0), _mm_set1_ps(w0));
+                o = _mm_add_ps(o, _mm_mul_ps(_mm_loadu_ps(c0 + o1), _mm_set1_ps(w1)));
+                o = _mm_add_ps(o, _mm_mul_ps(_mm_loadu_ps(c0 + o2), _mm_set1_ps(w2)));
+                o = _mm_add_ps(o, _mm_mul_ps(_mm_loadu_ps(c0 + o3), _mm_set1_ps(w3)));
+                float tmp[4];
+                _mm_storeu_ps(tmp, o);
+                out[0] = tmp[0];
+                out[1] = tmp[1];
+                out[2] = tmp[2];
+#else // DJV_OCIO_IMAGE_CONVERT_SSE2
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    out[c] = c0[c] * w0 + c0[o1 + c] * w1 + c0[o2 + c] * w2 + c0[o3 + c] * w3;
+                }
+#endif // DJV_OCIO_IMAGE_CONVERT_SSE2
+            }
+
+            template<typename T>
+            inline float toFloat(T value, float scale)
+            {
+                return value * scale;
+            }
+
+            template<typename T>
+            inline T fromFloat(float value, float scale)
+            {
+                return static_cast<T>(std::min(std::max(value, 0.F), 1.F) * scale + .5F);
+            }
+
+            template<>
+            inline float toFloat<Image::F16_T>(Image::F16_T value, float)
+            {
+                return value;
+            }
+
+            template<>
+            inline Image::F16_T fromFloat<Image::F16_T>(float value, float)
+            {
+                return value;
+            }
+
+            //! Process a scanline of integer or half float data through a
+            //! floating point buffer.
+            template<typename T>
+            void processRow(const LUT& lut, T* p, size_t w, size_t channels, float scale, std::vector<float>& buffer)
+            {
+                const float inScale = 1.F / scale;
+                for (size_t x = 0; x < w; x += chunkSize)
+                {
+                    const size_t size = std::min(chunkSize, w - x);
+                    T* q = p + x * channels;
+                    float* f = buffer.data();
+                    for (size_t i = 0; i < size; ++i, q += channels, f += 3)
+                    {
+                        f[0] = toFloat(q[0], inScale);
+                        f[1] = toFloat(q[1], inScale);
+                        f[2] = toFloat(q[2], inScale);
+                    }
+                    f = buffer.data();
+                    for (size_t i = 0; i < size; ++i, f += 3)
+                    {
+                        lut.lookup(f, f);
+                    }
+                    q = p + x * channels;
+                    f = buffer.data();
+                    for (size_t i = 0; i < size; ++i, q += channels, f += 3)
+                    {
+                        q[0] = fromFloat<T>(f[0], scale);
+                        q[1] = fromFloat<T>(f[1], scale);
+                        q[2] = fromFloat<T>(f[2], scale);
+                    }
+                }
+            }
+
+        } // namespace
+
+        struct ImageConvert::Private
+        {
+            size_t threadCount = 1;
+            Memory::Cache<std::string, std::shared_ptr<LUT> > lutCache;
+        };
+
+        void ImageConvert::_init(size_t threadCount)
+        {
+            DJV_PRIVATE_PTR();
+            p.threadCount = threadCount > 0 ?
+                threadCount :
+                System::getHardwareThreadCount();
+            p.lutCache.setMax(lutCacheMax);
+        }
+
+        ImageConvert::ImageConvert() :
+            _p(new Private)
+        {}
+
+        ImageConvert::~ImageConvert()
+        {}
+
+        std::shared_ptr<ImageConvert> ImageConvert::create(size_t threadCount)
+        {
+            auto out = std::shared_ptr<ImageConvert>(new ImageConvert);
+            out->_init(threadCount);
+            return out;
+        }
+
+        size_t ImageConvert::getThreadCount() const
+        {
+            return _p->threadCount;
+        }
+
+        Image::Type ImageConvert::getProcessType(Image::Type value)
+        {
+            Image::Type out = Image::isYUVType(value) ? Image::getRGBType(value) : value;
+            switch (out)
+            {
+            case Image::Type::RGB_U8:
+            case Image::Type::RGB_U16:
+            case Image::Type::RGB_F16:
+            case Image::Type::RGB_F32:
+            case Image::Type::RGBA_U8:
+            case Image::Type::RGBA_U16:
+            case Image::Type::RGBA_F16:
+            case Image::Type::RGBA_F32:
+                break;
+            case Image::Type::None:
+                break;
+            default:
+                switch (Image::getChannelCount(out))
+                {
+                case 2:
+                case 4:
+                    out = Image::Type::RGBA_F32;
+                    break;
+                default:
+                    out = Image::Type::RGB_F32;
+                    break;
+                }
+                break;
+            }
+            return out;
+        }
+
+        void ImageConvert::process(Image::Data& data, const Convert& convert)
+        {
+            DJV_PRIVATE_PTR();
+            const Image::Type type = data.getType();
+            if (!data.isValid() ||
+                !convert.isValid() ||
+                convert.input == convert.output ||
+                getProcessType(type) != type ||
+                data.getLayout().endian != Memory::getEndian())
+            {
+                return;
+            }
+
+            // Get the LUT from the cache, or bake a new one.
+            auto config = _OCIO::GetCurrentConfig();
+            const std::string key = std::string(config->getCacheID()) + '\n' + convert.input + '\n' + convert.output;
+            std::shared_ptr<LUT> lut;
+            if (!p.lutCache.get(key, lut))
+            {
+                lut = bakeLUT(config, convert);
+                p.lutCache.add(key, lut);
+            }
+
+            const Image::DataType dataType = Image::getDataType(type);
+            const size_t w = data.getWidth();
+            const size_t h = data.getHeight();
+            const size_t channels = Image::getChannelCount(type);
+            size_t threadCount = p.threadCount;
+            if (w * h < threadPixelCount)
+            {
+                threadCount = 1;
+            }
+            std::vector<std::vector<float> > buffers(threadCount);
+            System::parallelFor(
+                h,
+                threadRowCount,
+                threadCount,
+                [&data, &lut, &buffers, dataType, w, channels](size_t thread, size_t begin, size_t end)
+                {
+                    std::vector<float>& buffer = buffers[thread];
+                    buffer.resize(chunkSize * 3);
+                    for (size_t y = begin; y < end; ++y)
+                    {
+                        uint8_t* p = data.getData(static_cast<uint32_t>(y));
+                        switch (dataType)
+                        {
+                        case Image::DataType::U8:
+                            processRow(*lut, reinterpret_cast<Image::U8_T*>(p), w, channels, Image::U8Range.getMax(), buffer);
+                            break;
+                        case Image::DataType::U16:
+                            processRow(*lut, reinterpret_cast<Image::U16_T*>(p), w, channels, Image::U16Range.getMax(), buffer);
+                            break;
+                        case Image::DataType::F16:
+                            processRow(*lut, reinterpret_cast<Image::F16_T*>(p), w, channels, 1.F, buffer);
+                            break;
+                        case Image::DataType::F32:
+                        {
+                            float* f = reinterpret_cast<float*>(p);
+                            for (size_t x = 0; x < w; ++x, f += channels)
+                            {
+                                lut->lookup(f, f);
+                            }
+                            break;
+                        }
+                        default: break;
+                        }
+                    }
+                });
+        }
+
+        std::string getCurrentConfigID()
+        {
+            return _OCIO::GetCurrentConfig()->getCacheID();
+        }
+
+    } // namespace OCIO
+} // namespace djv
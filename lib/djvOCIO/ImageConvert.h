@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvImage/Type.h>
+
+#include <djvCore/Core.h>
+
+#include <memory>
+#include <string>
+
+namespace djv
+{
+    namespace Image
+    {
+        class Data;
+
+    } // namespace Image
+
+    namespace OCIO
+    {
+        class Convert;
+
+        //! CPU color space conversion.
+        //!
+        //! This applies color space conversions to image data without an
+        //! OpenGL context. The OpenColorIO processor for each conversion is
+        //! baked into a 3D LUT, which is cached by the configuration and the
+        //! input and output color spaces. The domain of the LUT is shaped by
+        //! the allocation of the input color space, the same as the LUTs
+        //! used by Render2D::Render.
+        //!
+        //! The scanlines are processed in parallel with tetrahedral
+        //! interpolation (using SSE2 when available).
+        class ImageConvert
+        {
+            DJV_NON_COPYABLE(ImageConvert);
+
+        protected:
+            void _init(size_t threadCount);
+            ImageConvert();
+
+        public:
+            ~ImageConvert();
+
+            //! Create a new converter. If the thread count is zero the number
+            //! of hardware threads is used.
+            static std::shared_ptr<ImageConvert> create(size_t threadCount = 0);
+
+            size_t getThreadCount() const;
+
+            //! Get the image type that is used to process the given type.
+            //! RGB and RGBA images with 8-bit, 16-bit, and floating point
+            //! data are processed directly, other types should be converted
+            //! first (for example with Image::Convert).
+            static Image::Type getProcessType(Image::Type);
+
+            //! Apply a color space conversion with the current configuration
+            //! to the image data in place. The image type must be a type
+            //! returned by getProcessType() with the native endian. The alpha
+            //! channel is not modified.
+            //! Throws:
+            //! - std::exception
+            void process(Image::Data&, const Convert&);
+
+        private:
+            DJV_PRIVATE();
+        };
+
+        //! \name Utility
+        ///@{
+
+        //! Get an identifier for the current configuration. This can be used
+        //! for keys of caches that contain color space converted images.
+        std::string getCurrentConfigID();
+
+        ///@}
+
+    } // namespace OCIO
+} // namespace djv
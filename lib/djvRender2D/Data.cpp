@@ -55,7 +55,8 @@ namespace djv
         Render2D,
         ImageCache,
         DJV_TEXT("render2d_image_cache_atlas"),
-        DJV_TEXT("render2d_image_cache_dynamic"));
+        DJV_TEXT("render2d_image_cache_dynamic"),
+        DJV_TEXT("render2d_image_cache_tile"));
 
     DJV_ENUM_SERIALIZE_HELPERS_IMPLEMENTATION(
         Render2D,
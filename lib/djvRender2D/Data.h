@@ -34,11 +34,14 @@ namespace djv
         };
         DJV_ENUM_HELPERS(ImageChannelsDisplay);
 
-        //! Image caching options.
+        //! Image caching options. Tile images use dynamic textures that are
+        //! kept in a separate cache, so that drawing many tiles does not
+        //! remove the other dynamic textures.
         enum class ImageCache
         {
             Atlas,
             Dynamic,
+            Tile,
 
             Count,
             First = Atlas
@@ -228,4 +228,20 @@ namespace djv
     } // namespace Render2D
 } // namespace djv
 
+namespace std
+{
+    template<>
+    struct hash<djv::Render2D::Font::FontInfo>
+    {
+        std::size_t operator() (const djv::Render2D::Font::FontInfo&) const noexcept;
+    };
+
+    template<>
+    struct hash<djv::Render2D::Font::GlyphInfo>
+    {
+        std::size_t operator() (const djv::Render2D::Font::GlyphInfo&) const noexcept;
+    };
+
+} // namespace std
+
 #include <djvRender2D/FontSystemInline.h>
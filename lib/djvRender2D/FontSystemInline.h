@@ -55,3 +55,25 @@ namespace djv
         } // namespace Font
     } // namespace Render2D
 } // namespace djv
+
+namespace std
+{
+    inline std::size_t hash<djv::Render2D::Font::FontInfo>::operator() (const djv::Render2D::Font::FontInfo& value) const noexcept
+    {
+        std::size_t hash = 0;
+        djv::Core::Memory::hashCombine(hash, value.getFamily());
+        djv::Core::Memory::hashCombine(hash, value.getFace());
+        djv::Core::Memory::hashCombine(hash, value.getSize());
+        djv::Core::Memory::hashCombine(hash, value.getDPI());
+        return hash;
+    }
+
+    inline std::size_t hash<djv::Render2D::Font::GlyphInfo>::operator() (const djv::Render2D::Font::GlyphInfo& value) const noexcept
+    {
+        std::size_t hash = 0;
+        djv::Core::Memory::hashCombine(hash, value.code);
+        djv::Core::Memory::hashCombine(hash, value.fontInfo);
+        return hash;
+    }
+
+} // namespace std
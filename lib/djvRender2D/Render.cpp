@@ -58,6 +58,9 @@ namespace djv
             std::map<UID, uint64_t>                        glyphTextureIDs;
             std::vector<std::shared_ptr<GL::Texture2D> >   dynamicTextures;
             std::map<UID, std::shared_ptr<GL::Texture2D> > dynamicTextureCache;
+            Memory::Cache<UID, std::shared_ptr<GL::Texture2D> > tileTextureCache;
+            GLint                                          maxTextureSize      = 0;
+            Memory::Cache<UID, std::vector<std::shared_ptr<GL::Texture2D> > > tiledTextureCache;
 #if !defined(DJV_GL_ES2)
             std::map<OCIO::Convert, ColorSpaceData>        colorSpaceCache;
             size_t                                         colorSpaceID        = 1;
@@ -85,6 +88,13 @@ namespace djv
                 const glm::mat3x3& currentTransform,
                 const Math::BBox2f& currentClipRect,
                 const float finalColor[4]);
+            void drawImageTiles(
+                const std::shared_ptr<Image::Data>&,
+                const std::shared_ptr<ImagePrimitive>&,
+                const glm::vec2& pos,
+                const ImageOptions&,
+                const glm::mat3x3& currentTransform,
+                const Math::BBox2f& currentClipRect);
 
             std::string getFragmentSource() const;
         };
@@ -95,21 +105,25 @@ namespace djv
             DJV_PRIVATE_PTR();
             p.system = this;
 
-            addDependency(GL::GLFW::GLFWSystem::create(context));
+            auto glfwSystem = GL::GLFW::GLFWSystem::create(context);
+            if (!glfwSystem->getWindow())
+            {
+                throw GL::GLFW::Error(_getText(DJV_TEXT("error_glfw_window_creation")));
+            }
+            addDependency(glfwSystem);
 
             GLint maxTextureUnits = 0;
-            GLint maxTextureSize = 0;
             glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &maxTextureUnits);
-            glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize);
+            glGetIntegerv(GL_MAX_TEXTURE_SIZE, &p.maxTextureSize);
             {
                 auto logSystem = context->getSystemT<System::LogSystem>();
                 std::stringstream ss;
                 ss << "Maximum OpenGL texture units: " << maxTextureUnits << "\n";
-                ss << "Maximum OpenGL texture size: " << maxTextureSize;
+                ss << "Maximum OpenGL texture size: " << p.maxTextureSize;
                 logSystem->log("djv::Render2D::Render", ss.str());
             }
             const uint8_t _textureAtlasCount = std::min(maxTextureUnits, static_cast<GLint>(textureAtlasCount));
-            const uint16_t _textureAtlasSize = std::min(maxTextureSize, static_cast<GLint>(textureAtlasSize));
+            const uint16_t _textureAtlasSize = std::min(p.maxTextureSize, static_cast<GLint>(textureAtlasSize));
             {
                 auto logSystem = context->getSystemT<System::LogSystem>();
                 std::stringstream ss;
@@ -124,6 +138,8 @@ namespace djv
                 GL_NEAREST,
                 0));
             p.primitiveData.textureAtlasCount = _textureAtlasCount;
+            p.tileTextureCache.setMax(tileTextureCacheMax);
+            p.tiledTextureCache.setMax(tiledTextureCacheMax);
 
             _imageFilterUpdate();
 
@@ -159,6 +175,8 @@ namespace djv
                     ss << "Glyph texture IDs: " << p.glyphTextureIDs.size() << "\n";
                     ss << "Dynamic textures: " << p.dynamicTextures.size() << "\n";
                     ss << "Dynamic texture cache: " << p.dynamicTextureCache.size() << "\n";
+                    ss << "Tile texture cache: " << p.tileTextureCache.getSize() << "\n";
+                    ss << "Tiled texture cache: " << p.tiledTextureCache.getSize() << "\n";
 #if !defined(DJV_GL_ES2)
                     ss << "Color space cache: " << p.colorSpaceCache.size() << "\n";
 #endif // DJV_GL_ES2
@@ -205,6 +223,9 @@ namespace djv
                 const auto program = p.shader->getProgram();
                 p.mvpLoc = glGetUniformLocation(program, "transform.mvp");
                 p.primitiveData.imageChannelsLoc = glGetUniformLocation(program, "imageChannels");
+                p.primitiveData.yuvLoc = glGetUniformLocation(program, "yuv");
+                p.primitiveData.yuvPlanesLoc = glGetUniformLocation(program, "yuvPlanes");
+                p.primitiveData.yuvMatrixLoc = glGetUniformLocation(program, "yuvMatrix");
                 p.primitiveData.colorModeLoc = glGetUniformLocation(program, "colorMode");
                 p.primitiveData.colorLoc = glGetUniformLocation(program, "color");
 #if !defined(DJV_GL_ES2)
@@ -1051,6 +1072,11 @@ namespace djv
             return _p->dynamicTextureCache.size();
         }
 
+        size_t Render::getTileTextureCount() const
+        {
+            return _p->tileTextureCache.getSize();
+        }
+
         size_t Render::getVBOSize() const
         {
             return _p->vbo ? _p->vbo->getSize() : 0;
@@ -1061,6 +1087,8 @@ namespace djv
             DJV_PRIVATE_PTR();
             p.dynamicTextures.clear();
             p.dynamicTextureCache.clear();
+            p.tileTextureCache.clear();
+            p.tiledTextureCache.clear();
             for (size_t i = 0; i < dynamicTextureCount; ++i)
             {
                 p.dynamicTextures.emplace_back(
@@ -1126,6 +1154,12 @@ namespace djv
                 auto primitive = std::make_shared<ImagePrimitive>();
                 primitive->clipRect = currentClipRect;
                 primitive->imageChannels = Image::getChannels(info.type);
+                primitive->yuv = Image::isYUVType(info.type);
+                if (primitive->yuv)
+                {
+                    primitive->yuvPlanes = GL::getYUVPlanes(info);
+                    primitive->yuvMatrix = GL::getYUVMatrix(info);
+                }
                 primitive->colorMode = colorMode;
                 primitive->color[0] = finalColor[0];
                 primitive->color[1] = finalColor[1];
@@ -1157,11 +1191,19 @@ namespace djv
                         powf(2.F, 3.5F) - primitive->exposureK);
                 }
                 primitive->softClip = options.softClipEnabled ? options.softClip : 0.F;
-                primitive->imageCache = options.cache;
+                // Planar YUV images cannot be stored in the texture atlas.
+                // Images that are larger than the maximum texture size are
+                // split into tiles.
+                const bool tiled = !primitive->yuv &&
+                    maxTextureSize > 0 &&
+                    (info.size.w > static_cast<uint32_t>(maxTextureSize) ||
+                     info.size.h > static_cast<uint32_t>(maxTextureSize));
+                const ImageCache imageCache = primitive->yuv || tiled ? ImageCache::Dynamic : options.cache;
+                primitive->imageCache = imageCache;
                 float textureU[2] = { 0.F, 0.F };
                 float textureV[2] = { 0.F, 0.F };
                 const UID uid = image->getUID();
-                switch (options.cache)
+                switch (imageCache)
                 {
                 case ImageCache::Atlas:
                 {
@@ -1201,6 +1243,11 @@ namespace djv
                 }
                 case ImageCache::Dynamic:
                 {
+                    if (tiled)
+                    {
+                        // The tile textures are handled by drawImageTiles().
+                        break;
+                    }
                     const auto i = dynamicTextureCache.find(uid);
                     if (i != dynamicTextureCache.end())
                     {
@@ -1245,6 +1292,26 @@ namespace djv
                     }
                     break;
                 }
+                case ImageCache::Tile:
+                {
+                    std::shared_ptr<GL::Texture2D> texture;
+                    if (!tileTextureCache.get(uid, texture))
+                    {
+                        texture = GL::Texture2D::create(
+                            image->getInfo(),
+                            toGL(imageFilterOptions.min),
+                            toGL(imageFilterOptions.mag));
+                        texture->copy(*image);
+                        tileTextureCache.add(uid, texture);
+                    }
+                    primitive->textureID = texture->getID();
+                    primitive->texture = texture;
+                    textureU[0] = info.layout.mirror.x ? 1.F : 0.F;
+                    textureU[1] = info.layout.mirror.x ? 0.F : 1.F;
+                    textureV[0] = info.layout.mirror.y ? 1.F : 0.F;
+                    textureV[1] = info.layout.mirror.y ? 0.F : 1.F;
+                    break;
+                }
                 default: break;
                 }
                 if (options.mirror.x)
@@ -1301,6 +1368,11 @@ namespace djv
                     primitive->colorSpaceTextureID = colorSpaceData.lut3D ? colorSpaceData.lut3D->getID() : 0;
                 }
 #endif // DJV_GL_ES2
+                if (tiled)
+                {
+                    drawImageTiles(image, primitive, pos, options, currentTransform, currentClipRect);
+                    return;
+                }
                 primitive->type = GL_TRIANGLE_STRIP;
                 primitive->vaoOffset = vboDataSize / GL::getVertexByteCount(GL::VBOType::Pos2_F32_UV_U16);
                 primitive->vaoSize = 4;
@@ -1329,6 +1401,129 @@ namespace djv
             }
         }
 
+        void Render::Private::drawImageTiles(
+            const std::shared_ptr<Image::Data>& image,
+            const std::shared_ptr<ImagePrimitive>& primitive,
+            const glm::vec2& pos,
+            const ImageOptions& options,
+            const glm::mat3x3& currentTransform,
+            const Math::BBox2f& currentClipRect)
+        {
+            const auto& info = image->getInfo();
+            const bool mirrorX = info.layout.mirror.x != options.mirror.x;
+            const bool mirrorY = info.layout.mirror.y != options.mirror.y;
+
+            // Neighboring tiles overlap by a border so there are no seams
+            // when the textures are filtered.
+            const uint32_t tileSize = static_cast<uint32_t>(maxTextureSize) - textureTileBorder * 2;
+            const uint32_t tilesX = (info.size.w + tileSize - 1) / tileSize;
+            const uint32_t tilesY = (info.size.h + tileSize - 1) / tileSize;
+            // The least recently drawn images are evicted from the cache, the
+            // primitives keep their textures until they are drawn.
+            std::vector<std::shared_ptr<GL::Texture2D> > textures;
+            tiledTextureCache.get(image->getUID(), textures);
+            textures.resize(static_cast<size_t>(tilesX) * tilesY);
+            for (uint32_t ty = 0; ty < tilesY; ++ty)
+            {
+                for (uint32_t tx = 0; tx < tilesX; ++tx)
+                {
+                    const uint32_t x0 = tx * tileSize;
+                    const uint32_t x1 = std::min(x0 + tileSize, info.size.w);
+                    const uint32_t y0 = ty * tileSize;
+                    const uint32_t y1 = std::min(y0 + tileSize, info.size.h);
+
+                    glm::vec3 pts[4];
+                    pts[0].x = pos.x + (mirrorX ? (info.size.w - x1) : x0);
+                    pts[0].y = pos.y + (mirrorY ? (info.size.h - y1) : y0);
+                    pts[0].z = 1.F;
+                    pts[1].x = pos.x + (mirrorX ? (info.size.w - x0) : x1);
+                    pts[1].y = pts[0].y;
+                    pts[1].z = 1.F;
+                    pts[2].x = pts[1].x;
+                    pts[2].y = pos.y + (mirrorY ? (info.size.h - y0) : y1);
+                    pts[2].z = 1.F;
+                    pts[3].x = pts[0].x;
+                    pts[3].y = pts[2].y;
+                    pts[3].z = 1.F;
+                    for (auto& i : pts)
+                    {
+                        i = currentTransform * i;
+                    }
+                    Math::BBox2f bbox;
+                    bbox.min = pts[0];
+                    bbox.max = pts[0];
+                    for (size_t i = 1; i < 4; ++i)
+                    {
+                        bbox.min.x = std::min(bbox.min.x, pts[i].x);
+                        bbox.max.x = std::max(bbox.max.x, pts[i].x);
+                        bbox.min.y = std::min(bbox.min.y, pts[i].y);
+                        bbox.max.y = std::max(bbox.max.y, pts[i].y);
+                    }
+                    if (!bbox.intersects(currentClipRect))
+                    {
+                        continue;
+                    }
+
+                    // Only the visible tiles are uploaded.
+                    const uint32_t rx0 = x0 > textureTileBorder ? (x0 - textureTileBorder) : 0;
+                    const uint32_t rx1 = std::min(x1 + textureTileBorder, info.size.w);
+                    const uint32_t ry0 = y0 > textureTileBorder ? (y0 - textureTileBorder) : 0;
+                    const uint32_t ry1 = std::min(y1 + textureTileBorder, info.size.h);
+                    auto& texture = textures[static_cast<size_t>(ty) * tilesX + tx];
+                    if (!texture)
+                    {
+                        const Image::Info tileInfo(
+                            rx1 - rx0,
+                            ry1 - ry0,
+                            info.type,
+                            Image::Layout(Image::Mirror(), info.layout.alignment, info.layout.endian));
+                        texture = GL::Texture2D::create(
+                            tileInfo,
+                            toGL(imageFilterOptions.min),
+                            toGL(imageFilterOptions.mag));
+                        texture->copyRegion(*image, rx0, ry0);
+                    }
+
+                    const float u0 = (x0 - rx0) / static_cast<float>(rx1 - rx0);
+                    const float u1 = (x1 - rx0) / static_cast<float>(rx1 - rx0);
+                    const float v0 = (y0 - ry0) / static_cast<float>(ry1 - ry0);
+                    const float v1 = (y1 - ry0) / static_cast<float>(ry1 - ry0);
+                    const float textureU[2] = { mirrorX ? u1 : u0, mirrorX ? u0 : u1 };
+                    const float textureV[2] = { mirrorY ? v1 : v0, mirrorY ? v0 : v1 };
+
+                    auto tilePrimitive = std::make_shared<ImagePrimitive>(*primitive);
+                    tilePrimitive->textureID = texture->getID();
+                    tilePrimitive->texture = texture;
+                    tilePrimitive->type = GL_TRIANGLE_STRIP;
+                    tilePrimitive->vaoOffset = vboDataSize / GL::getVertexByteCount(GL::VBOType::Pos2_F32_UV_U16);
+                    tilePrimitive->vaoSize = 4;
+
+                    const size_t vboDataOffset = vboDataSize;
+                    vboDataSizeUpdate(4);
+                    VBOVertex* pData = reinterpret_cast<VBOVertex*>(&vboData[vboDataOffset]);
+                    pData[0].vx = pts[0].x;
+                    pData[0].vy = pts[0].y;
+                    pData[0].tx = static_cast<uint16_t>(textureU[0] * 65535.F);
+                    pData[0].ty = static_cast<uint16_t>(textureV[0] * 65535.F);
+                    pData[1].vx = pts[1].x;
+                    pData[1].vy = pts[1].y;
+                    pData[1].tx = static_cast<uint16_t>(textureU[1] * 65535.F);
+                    pData[1].ty = static_cast<uint16_t>(textureV[0] * 65535.F);
+                    pData[2].vx = pts[3].x;
+                    pData[2].vy = pts[3].y;
+                    pData[2].tx = static_cast<uint16_t>(textureU[0] * 65535.F);
+                    pData[2].ty = static_cast<uint16_t>(textureV[1] * 65535.F);
+                    pData[3].vx = pts[2].x;
+                    pData[3].vy = pts[2].y;
+                    pData[3].tx = static_cast<uint16_t>(textureU[1] * 65535.F);
+                    pData[3].ty = static_cast<uint16_t>(textureV[1] * 65535.F);
+
+                    primitives.push_back(tilePrimitive);
+                }
+            }
+            tiledTextureCache.add(image->getUID(), textures);
+        }
+
         std::string Render::Private::getFragmentSource() const
         {
             std::string out = fragmentSource;
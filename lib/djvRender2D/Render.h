@@ -146,6 +146,7 @@ namespace djv
             size_t getPrimitivesCount() const;
             float getTextureAtlasPercentage() const;
             size_t getDynamicTextureCount() const;
+            size_t getTileTextureCount() const;
             size_t getVBOSize() const;
 
             ///@}
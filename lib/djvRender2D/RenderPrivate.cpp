@@ -34,6 +34,12 @@ namespace djv
             shader->setUniform(data.colorModeLoc, static_cast<int>(colorMode));
             shader->setUniform(data.colorLoc, reinterpret_cast<const GLfloat*>(color));
             shader->setUniform(data.imageChannelsLoc, static_cast<int>(imageChannels));
+            if (yuv)
+            {
+                shader->setUniform(data.yuvPlanesLoc, yuvPlanes);
+                shader->setUniform(data.yuvMatrixLoc, yuvMatrix);
+            }
+            shader->setUniform(data.yuvLoc, yuv);
             if (colorMatrixEnabled)
             {
                 shader->setUniform(data.colorMatrixLoc, colorMatrix);
@@ -74,6 +80,7 @@ namespace djv
                 shader->setUniform(data.textureSamplerLoc, static_cast<int>(atlasIndex));
                 break;
             case ImageCache::Dynamic:
+            case ImageCache::Tile:
                 glActiveTexture(static_cast<GLenum>(GL_TEXTURE0 + data.textureAtlasCount));
                 glBindTexture(GL_TEXTURE_2D, textureID);
                 shader->setUniform(data.textureSamplerLoc, static_cast<int>(data.textureAtlasCount));
@@ -22,6 +22,9 @@ namespace djv
         const uint16_t textureAtlasSize       = 8192;
         const size_t   dynamicTextureCount    = 16;
         const size_t   dynamicTextureCacheMax = 16;
+        const size_t   tileTextureCacheMax    = 64;
+        const size_t   tiledTextureCacheMax   = 2;
+        const uint8_t  textureTileBorder      = 1;
 #if !defined(DJV_GL_ES2)
         const size_t   lut3DSize              = 32;
         const size_t   colorSpaceCacheMax     = 32;
@@ -49,6 +52,9 @@ namespace djv
 
             // Shader uniform variable locations.
             GLint imageChannelsLoc          = 0;
+            GLint yuvLoc                    = 0;
+            GLint yuvPlanesLoc              = 0;
+            GLint yuvMatrixLoc              = 0;
             GLint colorModeLoc              = 0;
             GLint colorLoc                  = 0;
 #if !defined(DJV_GL_ES2)
@@ -106,6 +112,9 @@ namespace djv
         public:
             ColorMode            colorMode            = ColorMode::ColorAndTexture;
             Image::Channels      imageChannels        = Image::Channels::RGBA;
+            bool                 yuv                  = false;
+            glm::vec4            yuvPlanes;
+            glm::mat4x4          yuvMatrix;
 #if !defined(DJV_GL_ES2)
             uint8_t              colorSpace           = 0;
             GLuint               colorSpaceTextureID  = 0;
@@ -126,6 +135,10 @@ namespace djv
             uint8_t              atlasIndex           = 0;
             GLuint               textureID            = 0;
 
+            //! Keep the texture until the primitive is drawn, in case it is
+            //! removed from the cache in the same frame.
+            std::shared_ptr<GL::Texture2D> texture;
+
             void bind(const PrimitiveData&, const std::shared_ptr<GL::Shader>&) override;
         };
 
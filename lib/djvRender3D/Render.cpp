@@ -75,7 +75,12 @@ namespace djv
             ISystem::_init("djv::Render3D::Render", context);
             DJV_PRIVATE_PTR();
 
-            addDependency(GL::GLFW::GLFWSystem::create(context));
+            auto glfwSystem = GL::GLFW::GLFWSystem::create(context);
+            if (!glfwSystem->getWindow())
+            {
+                throw GL::GLFW::Error(_getText(DJV_TEXT("error_glfw_window_creation")));
+            }
+            addDependency(glfwSystem);
 
             GLint maxTextureUnits = 0;
             GLint maxTextureSize = 0;
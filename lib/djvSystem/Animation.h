@@ -122,6 +122,7 @@ namespace djv
                 static std::shared_ptr<AnimationSystem> create(const std::shared_ptr<Context>&);
 
                 void tick() override;
+                Core::Time::TimePoint getNextTick() const override;
 
             private:
                 void _addAnimation(const std::weak_ptr<Animation>&);
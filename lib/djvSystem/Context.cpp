@@ -16,6 +16,7 @@
 #include <djvCore/OS.h>
 #include <djvCore/Time.h>
 
+#include <algorithm>
 #include <iostream>
 #include <thread>
 
@@ -198,6 +199,45 @@ namespace djv
             ++_tickCount;
         }
 
+        Time::TimePoint Context::getNextTick() const
+        {
+            Time::TimePoint out = Time::TimePoint::max();
+            for (const auto& system : _systems)
+            {
+                out = std::min(out, system->getNextTick());
+            }
+            return out;
+        }
+
+        void Context::wake()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_wakeMutex);
+                _wake = true;
+            }
+            _wakeCV.notify_one();
+        }
+
+        bool Context::wait(const Time::TimePoint& value)
+        {
+            std::unique_lock<std::mutex> lock(_wakeMutex);
+            const auto predicate = [this]
+            {
+                return _wake;
+            };
+            bool out = true;
+            if (Time::TimePoint::max() == value)
+            {
+                _wakeCV.wait(lock, predicate);
+            }
+            else
+            {
+                out = _wakeCV.wait_until(lock, value, predicate);
+            }
+            _wake = false;
+            return out;
+        }
+
         void Context::_addSystem(const std::shared_ptr<ISystemBase>& system)
         {
             _systems.push_back(system);
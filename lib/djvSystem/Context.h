@@ -6,8 +6,10 @@
 
 #include <djvCore/Time.h>
 
+#include <condition_variable>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -78,6 +80,23 @@ namespace djv
             //! Get the system tick times.
             const std::vector<std::pair<std::string, Core::Time::Duration> >& getSystemTickTimes() const;
 
+            //! Get the time when the systems next need to be ticked.
+            Core::Time::TimePoint getNextTick() const;
+
+            ///@}
+
+            //! \name Wake Up
+            ///@{
+
+            //! Wake up the application event loop. This function is thread
+            //! safe and may be called when work from another thread is ready,
+            //! for example when a file has been opened.
+            void wake();
+
+            //! Wait until the given time or until the context is woken up.
+            //! Returns true if the context was woken up.
+            bool wait(const Core::Time::TimePoint&);
+
             ///@}
 
         protected:
@@ -102,6 +121,9 @@ namespace djv
             std::list<float> _fpsSamples;
             float _fpsAverage = 0.F;
             std::shared_ptr<Timer> _fpsTimer;
+            std::mutex _wakeMutex;
+            std::condition_variable _wakeCV;
+            bool _wake = false;
             int _debugEnv = 0;
 
             friend class ISystemBase;
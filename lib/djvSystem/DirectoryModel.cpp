@@ -5,6 +5,7 @@
 #include <djvSystem/DirectoryModel.h>
 
 #include <djvSystem/DirectoryWatcher.h>
+#include <djvSystem/FileInfoPrivate.h>
 #include <djvSystem/Timer.h>
 
 #include <djvCore/OS.h>
@@ -19,6 +20,13 @@ namespace djv
     {
         namespace File
         {
+            namespace
+            {
+                //! \todo Should this be configurable?
+                const size_t changesTimeout = 500;
+
+            } // namespace
+
             struct DirectoryModel::Private
             {
                 std::shared_ptr<Observer::ValueSubject<Path> > path;
@@ -34,6 +42,9 @@ namespace djv
                 std::future<std::pair<std::vector<Info>, std::vector<std::string> > > future;
                 std::shared_ptr<Timer> futureTimer;
                 std::shared_ptr<DirectoryWatcher> directoryWatcher;
+                std::set<std::string> changes;
+                bool changesReload = false;
+                std::shared_ptr<Timer> changesTimer;
             };
 
             void DirectoryModel::_init(const std::shared_ptr<Context>& context)
@@ -52,15 +63,35 @@ namespace djv
                 p.futureTimer = Timer::create(context);
                 p.futureTimer->setRepeating(true);
 
+                p.changesTimer = Timer::create(context);
+
                 p.directoryWatcher = DirectoryWatcher::create(context);
 
+                // Collect the changes from the directory watcher over a short
+                // time and then apply them to the directory listing, so that
+                // the directory is not listed again for every change.
                 auto weak = std::weak_ptr<DirectoryModel>(shared_from_this());
-                p.directoryWatcher->setCallback(
-                    [weak]
+                p.directoryWatcher->setEventsCallback(
+                    [weak](const std::vector<DirectoryWatcherEvent>& value)
                 {
                     if (auto model = weak.lock())
                     {
-                        model->reload();
+                        auto& p = *model->_p;
+                        for (const auto& i : value)
+                        {
+                            if (i.fileName.empty())
+                            {
+                                p.changesReload = true;
+                            }
+                            else
+                            {
+                                p.changes.insert(i.fileName);
+                            }
+                        }
+                        if (!p.changesTimer->isActive())
+                        {
+                            model->_changesTimerStart(std::chrono::milliseconds(changesTimeout));
+                        }
                     }
                 });
             }
@@ -237,6 +268,8 @@ namespace djv
                 DJV_PRIVATE_PTR();
                 const Path path = p.path->get();
                 const auto options = p.options->get();
+                p.changes.clear();
+                p.changesReload = false;
                 p.future = std::async(
                     std::launch::async,
                     [path, options]
@@ -245,11 +278,55 @@ namespace djv
                     out.first = directoryList(path, options);
                     for (const auto& info : out.first)
                     {
-                        out.second.push_back(info.getFileName(-1, false));
+                        out.second.push_back(info.getFileName(Math::Frame::invalid, false));
                     }
                     return out;
                 });
+                _futureUpdate();
+
+                p.directoryWatcher->setPath(p.path->get());
+            }
+
+            void DirectoryModel::_changesUpdate()
+            {
+                DJV_PRIVATE_PTR();
+                if (p.future.valid())
+                {
+                    // Wait for the current listing to finish, the changes are
+                    // applied afterwards.
+                    return;
+                }
+                if (p.changesReload)
+                {
+                    _pathUpdate();
+                }
+                else if (p.changes.size())
+                {
+                    const Path path = p.path->get();
+                    const auto options = p.options->get();
+                    auto info = p.info->get();
+                    std::set<std::string> changes;
+                    std::swap(changes, p.changes);
+                    p.future = std::async(
+                        std::launch::async,
+                        [path, options, info, changes]() mutable
+                    {
+                        std::pair<std::vector<Info>, std::vector<std::string> > out;
+                        update(path, changes, options, info);
+                        out.first = std::move(info);
+                        for (const auto& i : out.first)
+                        {
+                            out.second.push_back(i.getFileName(Math::Frame::invalid, false));
+                        }
+                        return out;
+                    });
+                    _futureUpdate();
+                }
+            }
 
+            void DirectoryModel::_futureUpdate()
+            {
+                DJV_PRIVATE_PTR();
                 p.futureTimer->start(
                     getTimerDuration(TimerValue::Medium),
                     [this](const std::chrono::steady_clock::time_point&, const Time::Duration&)
@@ -263,10 +340,28 @@ namespace djv
                         const auto& out = p.future.get();
                         p.info->setIfChanged(out.first);
                         p.fileNames->setIfChanged(out.second);
+
+                        // Apply the changes that happened while listing.
+                        if ((p.changes.size() || p.changesReload) && !p.changesTimer->isActive())
+                        {
+                            _changesTimerStart(Time::Duration::zero());
+                        }
                     }
                 });
+            }
 
-                p.directoryWatcher->setPath(p.path->get());
+            void DirectoryModel::_changesTimerStart(const Time::Duration& value)
+            {
+                auto weak = std::weak_ptr<DirectoryModel>(shared_from_this());
+                _p->changesTimer->start(
+                    value,
+                    [weak](const std::chrono::steady_clock::time_point&, const Time::Duration&)
+                {
+                    if (auto model = weak.lock())
+                    {
+                        model->_changesUpdate();
+                    }
+                });
             }
 
         } // namespace File
@@ -7,6 +7,7 @@
 #include <djvSystem/FileInfo.h>
 
 #include <djvCore/ListObserver.h>
+#include <djvCore/Time.h>
 #include <djvCore/ValueObserver.h>
 
 namespace djv
@@ -85,6 +86,9 @@ namespace djv
 
             private:
                 void _pathUpdate();
+                void _changesUpdate();
+                void _changesTimerStart(const Core::Time::Duration&);
+                void _futureUpdate();
 
                 DJV_PRIVATE();
             };
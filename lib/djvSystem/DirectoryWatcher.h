@@ -8,6 +8,8 @@
 
 #include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace djv
 {
@@ -19,6 +21,31 @@ namespace djv
         {
             class Path;
 
+            //! Directory watcher event types.
+            enum class DirectoryWatcherEventType
+            {
+                Added,
+                Removed,
+                Modified
+            };
+
+            //! Directory watcher event.
+            struct DirectoryWatcherEvent
+            {
+                DirectoryWatcherEvent();
+                DirectoryWatcherEvent(DirectoryWatcherEventType, const std::string& fileName);
+
+                DirectoryWatcherEventType type = DirectoryWatcherEventType::Modified;
+
+                //! The name of the file that changed. An empty file name means
+                //! that it is not known what changed (for example on platforms
+                //! that only report that the directory has changed), and the
+                //! directory should be listed again.
+                std::string fileName;
+
+                bool operator == (const DirectoryWatcherEvent&) const;
+            };
+
             //! Directory watcher.
             //!
             //! \bug What do we do about changes to the directory path (like deletion or moving)?
@@ -47,6 +74,10 @@ namespace djv
 
                 void setCallback(const std::function<void(void)>&);
 
+                //! Set the callback that receives the events that have
+                //! occurred since it was last called.
+                void setEventsCallback(const std::function<void(const std::vector<DirectoryWatcherEvent>&)>&);
+
                 ///!@}
 
             private:
@@ -57,3 +88,5 @@ namespace djv
     } // namespace System
 } // namespace djv
 
+
+#include <djvSystem/DirectoryWatcherInline.h>
@@ -0,0 +1,26 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+namespace djv
+{
+    namespace System
+    {
+        namespace File
+        {
+            inline DirectoryWatcherEvent::DirectoryWatcherEvent()
+            {}
+
+            inline DirectoryWatcherEvent::DirectoryWatcherEvent(DirectoryWatcherEventType type, const std::string& fileName) :
+                type(type),
+                fileName(fileName)
+            {}
+
+            inline bool DirectoryWatcherEvent::operator == (const DirectoryWatcherEvent& other) const
+            {
+                return type == other.type && fileName == other.fileName;
+            }
+
+        } // namespace File
+    } // namespace System
+} // namespace djv
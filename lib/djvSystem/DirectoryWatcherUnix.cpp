@@ -66,7 +66,7 @@ namespace djv
                         }
                     }
                                         
-                    ::time_t poll()
+                    ::time_t poll(std::vector<DirectoryWatcherEvent>& events)
                     {
                         struct kevent eventData[1];
                         timespec _timeout;
@@ -75,7 +75,9 @@ namespace djv
                         int eventCount = ::kevent(_kq, _eventsToMonitor, 1, eventData, 1, &_timeout);
                         if (eventCount)
                         {
+                            // The file names are not available.
                             _lastModified = time(nullptr);
+                            events.push_back(DirectoryWatcherEvent());
                         }
                         return _lastModified;
                     }
@@ -99,7 +101,10 @@ namespace djv
                         _fd = ::inotify_init1(IN_NONBLOCK);
                         if (_fd)
                         {
-                            _wd = ::inotify_add_watch(_fd, _path.get().c_str(), IN_CREATE | IN_DELETE | IN_MODIFY | IN_ATTRIB);
+                            _wd = ::inotify_add_watch(
+                                _fd,
+                                _path.get().c_str(),
+                                IN_CREATE | IN_DELETE | IN_MODIFY | IN_ATTRIB | IN_MOVED_FROM | IN_MOVED_TO);
                         }
                     }
 
@@ -136,28 +141,50 @@ namespace djv
                         return *this;
                     }
                                         
-                    ::time_t poll()
+                    ::time_t poll(std::vector<DirectoryWatcherEvent>& events)
                     {
                         if (_fd && _wd)
                         {
+                            // Read all of the pending events.
                             static const size_t bufferSize = 1024 * (sizeof(::inotify_event) + 16);
                             char buffer[bufferSize];
-                            const int length = ::read(_fd, buffer, bufferSize);
-                            int i = 0;
-                            while (i < length)
+                            int length = 0;
+                            while ((length = ::read(_fd, buffer, bufferSize)) > 0)
                             {
-                                ::inotify_event* event = (::inotify_event*)&buffer[i];
-                                if (event->len)
+                                int i = 0;
+                                while (i < length)
                                 {
-                                    if (event->mask & IN_CREATE ||
-                                        event->mask & IN_DELETE ||
-                                        event->mask & IN_MODIFY)
+                                    const ::inotify_event* event = (const ::inotify_event*)&buffer[i];
+                                    if (event->mask & IN_Q_OVERFLOW)
                                     {
+                                        // Events have been lost.
                                         _lastModified = time(nullptr);
-                                        break;
+                                        events.push_back(DirectoryWatcherEvent());
                                     }
+                                    else if (event->len)
+                                    {
+                                        bool valid = true;
+                                        DirectoryWatcherEventType type = DirectoryWatcherEventType::Modified;
+                                        if (event->mask & (IN_CREATE | IN_MOVED_TO))
+                                        {
+                                            type = DirectoryWatcherEventType::Added;
+                                        }
+                                        else if (event->mask & (IN_DELETE | IN_MOVED_FROM))
+                                        {
+                                            type = DirectoryWatcherEventType::Removed;
+                                        }
+                                        else if (!(event->mask & (IN_MODIFY | IN_ATTRIB)))
+                                        {
+                                            valid = false;
+                                        }
+                                        if (valid)
+                                        {
+                                            _lastModified = time(nullptr);
+                                            events.push_back(DirectoryWatcherEvent(type, event->name));
+                                        }
+                                    }
+                                    i += sizeof(::inotify_event) + event->len;
                                 }
-                                i += sizeof(::inotify_event) + event->len;
                             }
                         }
                         return _lastModified;
@@ -181,8 +208,10 @@ namespace djv
                 std::timed_mutex mutex;
                 ::time_t lastModified = 0;
                 ::time_t threadModified = 0;
+                std::vector<DirectoryWatcherEvent> threadEvents;
                 std::shared_ptr<Timer> timer;
                 std::function<void(void)> callback;
+                std::function<void(const std::vector<DirectoryWatcherEvent>&)> eventsCallback;
             };
 
             void DirectoryWatcher::_init(const std::shared_ptr<Context>& context)
@@ -197,7 +226,8 @@ namespace djv
                     Path path;
                     bool pathInit = false;
                     std::unique_ptr<Notify> notify;
-                    ::time_t lastModified = 0;                    
+                    ::time_t lastModified = 0;
+                    std::vector<DirectoryWatcherEvent> events;
                     bool running = true;
                     while (running)
                     {
@@ -212,8 +242,11 @@ namespace djv
                                 {
                                     path = p.path;
                                     pathInit = true;
+                                    events.clear();
                                 }
-                                p.threadModified = lastModified;                                                        
+                                p.threadModified = lastModified;
+                                p.threadEvents.insert(p.threadEvents.end(), events.begin(), events.end());
+                                events.clear();
                                 p.mutex.unlock();
                             }
                         }
@@ -233,7 +266,7 @@ namespace djv
                         if (notify)
                         {
                             // Poll for events.
-                            lastModified = notify->poll();
+                            lastModified = notify->poll(events);
                         }
                         
                         std::this_thread::sleep_for(timeout);
@@ -249,19 +282,30 @@ namespace djv
                     if (auto watcher = weak.lock())
                     {
                         auto & p = *watcher->_p;
+                        bool changed = false;
+                        std::vector<DirectoryWatcherEvent> events;
                         if (p.mutex.try_lock_for(timeout))
                         {
-                            if (p.threadModified != p.lastModified)
-                            {                            
+                            if (p.threadModified != p.lastModified || !p.threadEvents.empty())
+                            {
                                 p.lastModified = p.threadModified;
-                                
-                                if (p.callback)
-                                {
-                                    p.callback();
-                                }
+                                changed = true;
+                                events = std::move(p.threadEvents);
+                                p.threadEvents.clear();
                             }
                             p.mutex.unlock();
                         }
+
+                        // The callbacks are called without the mutex locked
+                        // so they can set the path.
+                        if (changed && p.callback)
+                        {
+                            p.callback();
+                        }
+                        if (!events.empty() && p.eventsCallback)
+                        {
+                            p.eventsCallback(events);
+                        }
                     }
                 });
             }
@@ -293,7 +337,13 @@ namespace djv
 
             void DirectoryWatcher::setPath(const Path& value)
             {
-                _p->path = value;
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::timed_mutex> lock(p.mutex);
+                if (value != p.path)
+                {
+                    p.path = value;
+                    p.threadEvents.clear();
+                }
             }
 
             void DirectoryWatcher::setCallback(const std::function<void(void)>& value)
@@ -301,6 +351,11 @@ namespace djv
                 _p->callback = value;
             }
 
+            void DirectoryWatcher::setEventsCallback(const std::function<void(const std::vector<DirectoryWatcherEvent>&)>& value)
+            {
+                _p->eventsCallback = value;
+            }
+
         } // namespace File
     } // namespace System
 } // namespace djv
@@ -43,6 +43,7 @@ namespace djv
                 std::thread thread;
                 std::atomic<bool> running = true;
                 std::function<void(void)> callback;
+                std::function<void(const std::vector<DirectoryWatcherEvent>&)> eventsCallback;
                 std::shared_ptr<Timer> timer;
             };
 
@@ -164,6 +165,12 @@ namespace djv
                     {
                         p.callback();
                     }
+                    if (changed && p.eventsCallback)
+                    {
+                        // The file names are not available from the change
+                        // notification.
+                        p.eventsCallback({ DirectoryWatcherEvent() });
+                    }
                 });
             }
 
@@ -214,6 +221,11 @@ namespace djv
                 _p->callback = value;
             }
 
+            void DirectoryWatcher::setEventsCallback(const std::function<void(const std::vector<DirectoryWatcherEvent>&)>& value)
+            {
+                _p->eventsCallback = value;
+            }
+
         } // namespace File
     } // namespace System
 } // namespace djv
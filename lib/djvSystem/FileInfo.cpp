@@ -4,10 +4,17 @@
 
 #include <djvSystem/FileInfoPrivate.h>
 
+#include <djvSystem/Parallel.h>
+
 #include <djvMath/FrameNumber.h>
 
+#include <djvCore/String.h>
+
 #include <algorithm>
 #include <array>
+#include <map>
+#include <sstream>
+#include <unordered_map>
 
 //#pragma optimize("", off)
 
@@ -107,6 +114,32 @@ namespace djv
                 return ss.str();
             }
 
+            bool Info::stat(std::string* error)
+            {
+                return stat(SequenceStat::All, error);
+            }
+
+            bool Info::stat(SequenceStat sequenceStat, std::string* error)
+            {
+                std::vector<std::string> fileNames;
+                _getStatFileNames(sequenceStat, fileNames);
+                std::vector<StatInfo> statInfo;
+                statFiles(fileNames, statInfo);
+                const bool out = _setStat(statInfo.data(), statInfo.size(), sequenceStat);
+                if (!out && error)
+                {
+                    for (const auto& i : statInfo)
+                    {
+                        if (!i.exists)
+                        {
+                            *error = i.error;
+                            break;
+                        }
+                    }
+                }
+                return out;
+            }
+
             void Info::setSequence(const Math::Frame::Sequence& in)
             {
                 _sequence = in;
@@ -163,6 +196,140 @@ namespace djv
                 return out;
             }
 
+            void Info::_getStatFileNames(SequenceStat sequenceStat, std::vector<std::string>& out) const
+            {
+                if (Type::Sequence == _type)
+                {
+                    switch (sequenceStat)
+                    {
+                    case SequenceStat::All:
+                        for (const auto i : Math::Frame::toFrames(_sequence))
+                        {
+                            out.push_back(getFileName(i));
+                        }
+                        break;
+                    case SequenceStat::FirstLast:
+                    {
+                        const auto& ranges = _sequence.getRanges();
+                        if (ranges.size())
+                        {
+                            const Math::Frame::Number first = ranges.front().getMin();
+                            const Math::Frame::Number last = ranges.back().getMax();
+                            out.push_back(getFileName(first));
+                            if (last != first)
+                            {
+                                out.push_back(getFileName(last));
+                            }
+                        }
+                        break;
+                    }
+                    default: break;
+                    }
+                }
+                else
+                {
+                    out.push_back(_path.get());
+                }
+            }
+
+            bool Info::_setStat(const StatInfo* statInfo, size_t count, SequenceStat sequenceStat)
+            {
+                _exists      = false;
+                _size        = 0;
+                _user        = 0;
+                _permissions = 0;
+                _time        = 0;
+                for (size_t i = 0; i < count; ++i)
+                {
+                    if (!statInfo[i].exists)
+                    {
+                        return false;
+                    }
+                }
+                if (Type::Sequence == _type)
+                {
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        _exists       = true;
+                        _size        += statInfo[i].size;
+                        _permissions |= statInfo[i].permissions;
+                        _time         = std::max(_time, statInfo[i].time);
+                    }
+                    if (count)
+                    {
+                        _user = statInfo[0].user;
+                    }
+                    const size_t frameCount = _sequence.getFrameCount();
+                    if (SequenceStat::FirstLast == sequenceStat && count > 0 && frameCount > count)
+                    {
+                        // Estimate the size from the frames that were stat'ed.
+                        _size = _size / count * frameCount;
+                    }
+                }
+                else if (count)
+                {
+                    _exists      = true;
+                    if (statInfo[0].directory)
+                    {
+                        _type    = Type::Directory;
+                    }
+                    _size        = statInfo[0].size;
+                    _user        = statInfo[0].user;
+                    _permissions = statInfo[0].permissions;
+                    _time        = statInfo[0].time;
+                }
+                return true;
+            }
+
+            namespace
+            {
+                //! The number of threads is larger than the number of cores
+                //! since the time is spent waiting on the file system.
+                //! \todo Should this be configurable?
+                const size_t statThreadCount = 16;
+
+                //! \todo Should this be configurable?
+                const size_t statThreadFileCount = 16;
+
+            } // namespace
+
+            void statFiles(const std::vector<std::string>& fileNames, std::vector<StatInfo>& out)
+            {
+                out.resize(fileNames.size());
+                const size_t threadCount = std::min(statThreadCount, fileNames.size() / statThreadFileCount);
+                parallelFor(
+                    fileNames.size(),
+                    1,
+                    threadCount,
+                    [&fileNames, &out](size_t, size_t begin, size_t end)
+                    {
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            statFile(fileNames[i], out[i]);
+                        }
+                    });
+            }
+
+            void stat(std::vector<Info>& value, SequenceStat sequenceStat)
+            {
+                // Stat the files of all of the items in a single batch.
+                std::vector<std::string> fileNames;
+                std::vector<size_t> offsets;
+                offsets.reserve(value.size() + 1);
+                for (const auto& i : value)
+                {
+                    offsets.push_back(fileNames.size());
+                    i._getStatFileNames(sequenceStat, fileNames);
+                }
+                offsets.push_back(fileNames.size());
+                std::vector<StatInfo> statInfo;
+                statFiles(fileNames, statInfo);
+                for (size_t i = 0; i < value.size(); ++i)
+                {
+                    value[i]._setStat(statInfo.data() + offsets[i], offsets[i + 1] - offsets[i], sequenceStat);
+                }
+            }
+
             bool isSequenceWildcard(const std::string& value) noexcept
             {
                 auto i = value.begin();
@@ -210,63 +377,457 @@ namespace djv
                 return data[in];
             }
 
-            void sequence(Info& info, const DirectoryListOptions& options, std::vector<Info>& out)
+            bool isFiltered(
+                const std::string&          fileName,
+                bool                        isDirectory,
+                bool                        isHidden,
+                const DirectoryListOptions& options)
             {
-                std::string extension = info.getPath().getExtension();
-                std::transform(extension.begin(), extension.end(), extension.begin(), tolower);
-                const auto i = std::find(
-                    options.sequenceExtensions.begin(),
-                    options.sequenceExtensions.end(),
-                    extension);
-                if (options.sequences && i != options.sequenceExtensions.end())
-                {
-                    const size_t size = out.size();
-                    size_t j = 0;
-                    for (; j < size; ++j)
-                    {
-                        if (out[j].addToSequence(info))
+                bool out = false;
+
+                // Filter hidden items.
+                if (isHidden)
+                {
+                    out = !options.showHidden;
+                }
+
+                // Filter "." and ".." items.
+                if (!out &&
+                    fileName.size() == 1 &&
+                    '.' == fileName[0])
+                {
+                    out = true;
+                }
+                if (!out &&
+                    fileName.size() == 2 &&
+                    '.' == fileName[0] &&
+                    '.' == fileName[1])
+                {
+                    out = true;
+                }
+
+                // Filter string matches.
+                if (!out &&
+                    options.filter.size() &&
+                    !String::match(fileName, options.filter))
+                {
+                    out = true;
+                }
+
+                // Filter file extensions.
+                if (!out &&
+                    !isDirectory &&
+                    options.extensions.size())
+                {
+                    // The extensions are compared case insensitively.
+                    std::string fileNameLower = fileName;
+                    std::transform(fileNameLower.begin(), fileNameLower.end(), fileNameLower.begin(), tolower);
+                    bool match = false;
+                    for (const auto& i : options.extensions)
+                    {
+                        std::string extension = i;
+                        std::transform(extension.begin(), extension.end(), extension.begin(), tolower);
+                        if (fileNameLower.size() >= extension.size() &&
+                            0 == fileNameLower.compare(fileNameLower.size() - extension.size(), extension.size(), extension))
                         {
+                            match = true;
                             break;
                         }
                     }
-                    if (size == j)
+                    out = !match;
+                }
+
+                return out;
+            }
+
+            namespace
+            {
+                //! Frame numbers that are part of a sequence.
+                struct SequenceGroup
+                {
+                    Path                             path;
+                    size_t                           pad = 0;
+                    std::vector<Math::Frame::Number> frames;
+                };
+
+                //! Unpadded frame numbers that may be part of a padded sequence
+                //! (for example "render.1000.exr" with "render.0999.exr").
+                struct UnpaddedFrame
+                {
+                    Path                path;
+                    size_t              width = 0;
+                    Math::Frame::Number frame = 0;
+                };
+
+                //! The sequences that share a base name and extension.
+                struct SequenceGroups
+                {
+                    std::map<size_t, SequenceGroup> padded;
+                    std::vector<UnpaddedFrame>       unpadded;
+                };
+
+                //! Parse a frame number. Negative frame numbers are not
+                //! supported, since a leading '-' is more likely a separator
+                //! (for example "render-1.exr"), and those files are listed
+                //! individually.
+                bool parseFrame(const std::string& number, Math::Frame::Number& out)
+                {
+                    bool valid = !number.empty() && number.size() < 19;
+                    for (auto i = number.begin(); valid && i != number.end(); ++i)
                     {
-                        out.push_back(info);
+                        valid = *i >= '0' && *i <= '9';
+                    }
+                    if (valid)
+                    {
+                        out = std::stoll(number);
                     }
+                    return valid;
                 }
-                else
+
+                //! Get whether a file is part of a sequence, and its frame number.
+                bool getSequenceFrame(const Path& path, const DirectoryListOptions& options, Math::Frame::Number& frame)
+                {
+                    bool out = false;
+                    if (options.sequences && parseFrame(path.getNumber(), frame))
+                    {
+                        std::string extension = path.getExtension();
+                        std::transform(extension.begin(), extension.end(), extension.begin(), tolower);
+                        out = options.sequenceExtensions.find(extension) != options.sequenceExtensions.end();
+                    }
+                    return out;
+                }
+
+                std::string getSequenceKey(const Path& path)
+                {
+                    return path.getBaseName() + '/' + path.getExtension();
+                }
+
+                Info getSequenceInfo(SequenceGroup& group)
+                {
+                    Info out;
+                    std::sort(group.frames.begin(), group.frames.end());
+                    group.frames.erase(std::unique(group.frames.begin(), group.frames.end()), group.frames.end());
+                    if (1 == group.frames.size())
+                    {
+                        out = Info(group.path, Type::File, Math::Frame::Sequence(), false);
+                    }
+                    else
+                    {
+                        std::vector<Math::Frame::Range> ranges;
+                        Math::Frame::Number min = group.frames[0];
+                        Math::Frame::Number max = min;
+                        for (size_t i = 1; i < group.frames.size(); ++i)
+                        {
+                            const Math::Frame::Number frame = group.frames[i];
+                            if (frame != max + 1)
+                            {
+                                ranges.push_back(Math::Frame::Range(min, max));
+                                min = frame;
+                            }
+                            max = frame;
+                        }
+                        ranges.push_back(Math::Frame::Range(min, max));
+                        const Math::Frame::Sequence sequence(ranges, group.pad);
+                        std::stringstream ss;
+                        ss << sequence;
+                        Path path = group.path;
+                        path.setNumber(ss.str());
+                        out = Info(path, Type::Sequence, sequence, false);
+                    }
+                    return out;
+                }
+
+            } // namespace
+
+            void sequence(
+                const Path&                     directory,
+                const std::vector<std::string>& fileNames,
+                const DirectoryListOptions&     options,
+                std::vector<Info>&              out)
+            {
+                // Group the files with a hash table keyed by the base name and
+                // extension, and then by the padding.
+                std::unordered_map<std::string, SequenceGroups> groups;
+                std::vector<std::string> keys;
+                for (const auto& fileName : fileNames)
+                {
+                    const Path path(directory, fileName);
+                    Math::Frame::Number frame = 0;
+                    if (getSequenceFrame(path, options, frame))
+                    {
+                        const std::string key = getSequenceKey(path);
+                        auto i = groups.find(key);
+                        if (i == groups.end())
+                        {
+                            i = groups.insert(std::make_pair(key, SequenceGroups())).first;
+                            keys.push_back(key);
+                        }
+                        const std::string& number = path.getNumber();
+                        if (number.size() > 1 && '0' == number[0])
+                        {
+                            auto& group = i->second.padded[number.size()];
+                            if (group.frames.empty())
+                            {
+                                group.path = path;
+                                group.pad = number.size();
+                            }
+                            group.frames.push_back(frame);
+                        }
+                        else
+                        {
+                            UnpaddedFrame unpadded;
+                            unpadded.path = path;
+                            unpadded.width = number.size();
+                            unpadded.frame = frame;
+                            i->second.unpadded.push_back(unpadded);
+                        }
+                    }
+                    else
+                    {
+                        out.push_back(Info(path, Type::File, Math::Frame::Sequence(), false));
+                    }
+                }
+
+                // Add the unpadded frames to the padded sequence with the
+                // largest padding that fits, and then create the sequences.
+                for (const auto& key : keys)
                 {
-                    out.push_back(info);
+                    auto& i = groups[key];
+                    SequenceGroup unpadded;
+                    for (const auto& j : i.unpadded)
+                    {
+                        SequenceGroup* group = &unpadded;
+                        for (auto k = i.padded.rbegin(); k != i.padded.rend(); ++k)
+                        {
+                            if (k->first <= j.width)
+                            {
+                                group = &k->second;
+                                break;
+                            }
+                        }
+                        if (group->frames.empty())
+                        {
+                            group->path = j.path;
+                        }
+                        group->frames.push_back(j.frame);
+                    }
+                    for (auto& j : i.padded)
+                    {
+                        out.push_back(getSequenceInfo(j.second));
+                    }
+                    if (unpadded.frames.size())
+                    {
+                        out.push_back(getSequenceInfo(unpadded));
+                    }
                 }
             }
 
-            void sort(const DirectoryListOptions& options, std::vector<Info>& out)
+            void update(
+                const Path&                     directory,
+                const std::set<std::string>&    fileNames,
+                const DirectoryListOptions&     options,
+                std::vector<Info>&              out)
             {
+                // Get the current state of the changed files, and find the
+                // sequences they belong to.
+                std::vector<Info> changed;
+                changed.reserve(fileNames.size());
+                std::unordered_map<std::string, std::vector<std::string> > sequenceChanges;
+                for (const auto& fileName : fileNames)
+                {
+                    const Path path(directory, fileName);
+                    changed.push_back(Info(path, false));
+                    Math::Frame::Number frame = 0;
+                    if (getSequenceFrame(path, options, frame))
+                    {
+                        sequenceChanges[getSequenceKey(path)].push_back(fileName);
+                    }
+                }
+                stat(changed);
+                std::map<std::string, Info> current;
+                auto changedIt = changed.begin();
+                for (const auto& fileName : fileNames)
+                {
+                    if (changedIt->doesExist())
+                    {
+                        current[fileName] = std::move(*changedIt);
+                    }
+                    ++changedIt;
+                }
+
+                // Remove the changed items and the items of the changed
+                // sequences.
+                std::unordered_map<std::string, std::vector<Info> > sequenceItems;
+                std::vector<Info> items;
+                items.reserve(out.size());
                 for (auto& i : out)
                 {
-                    if (Type::Sequence == i.getType())
+                    const Path& path = i.getPath();
+                    Math::Frame::Number frame = 0;
+                    if (Type::Sequence == i.getType() ||
+                        (Type::File == i.getType() && getSequenceFrame(path, options, frame)))
+                    {
+                        const auto j = sequenceChanges.find(getSequenceKey(path));
+                        if (j != sequenceChanges.end())
+                        {
+                            sequenceItems[j->first].push_back(std::move(i));
+                            continue;
+                        }
+                    }
+                    if (fileNames.find(i.getFileName(Math::Frame::invalid, false)) == fileNames.end())
+                    {
+                        items.push_back(std::move(i));
+                    }
+                }
+                out = std::move(items);
+
+                // Add the changed items that are not part of a sequence.
+                for (const auto& i : current)
+                {
+                    const bool isDirectory = Type::Directory == i.second.getType();
+                    Math::Frame::Number frame = 0;
+                    if ((isDirectory || !getSequenceFrame(i.second.getPath(), options, frame)) &&
+                        !isFiltered(i.first, isDirectory, '.' == i.first[0], options))
                     {
-                        const auto sequence = i.getSequence();
-                        std::stringstream s;
-                        s << sequence;
-                        Path path = i.getPath();
-                        path.setNumber(s.str());
-                        i.setPath(path, Type::Sequence, sequence, false);
+                        out.push_back(i.second);
                     }
                 }
 
+                // Update the sequences.
+                const auto isSequenceFile = [&current, &options](const std::string& fileName)
+                {
+                    const auto i = current.find(fileName);
+                    return i != current.end() &&
+                        i->second.getType() != Type::Directory &&
+                        !isFiltered(fileName, false, '.' == fileName[0], options);
+                };
+                for (const auto& i : sequenceChanges)
+                {
+                    auto& items = sequenceItems[i.first];
+
+                    // Frames that are added to the end of a single sequence
+                    // (for example while it is being rendered) are added
+                    // without re-creating the sequence.
+                    bool append = 1 == items.size() && Type::Sequence == items[0].getType();
+                    bool stat = false;
+                    for (auto j = i.second.begin(); append && j != i.second.end(); ++j)
+                    {
+                        append = isSequenceFile(*j);
+                        if (append)
+                        {
+                            const auto& sequence = items[0].getSequence();
+                            const std::string& number = current[*j].getPath().getNumber();
+                            Math::Frame::Number frame = 0;
+                            parseFrame(number, frame);
+                            if (sequence.contains(frame))
+                            {
+                                append = *j == items[0].getFileName(frame, false);
+                                stat = true;
+                            }
+                            else if (number.size() > 1 && '0' == number[0])
+                            {
+                                append = number.size() == sequence.getPad();
+                            }
+                            else
+                            {
+                                append = number.size() >= sequence.getPad();
+                            }
+                        }
+                    }
+                    if (append)
+                    {
+                        auto& info = items[0];
+                        for (const auto& j : i.second)
+                        {
+                            const auto& fileInfo = current[j];
+                            Math::Frame::Number frame = 0;
+                            parseFrame(fileInfo.getPath().getNumber(), frame);
+                            if (!info.getSequence().contains(frame))
+                            {
+                                info.addToSequence(fileInfo);
+                            }
+                        }
+                        if (stat)
+                        {
+                            info.stat(options.sequenceStat);
+                        }
+                        out.push_back(info);
+                    }
+                    else
+                    {
+                        // Get the files of the existing items, apply the
+                        // changes, and group them again.
+                        std::set<std::string> sequenceFileNames;
+                        for (const auto& j : items)
+                        {
+                            if (Type::Sequence == j.getType())
+                            {
+                                for (const auto k : Math::Frame::toFrames(j.getSequence()))
+                                {
+                                    sequenceFileNames.insert(j.getFileName(k, false));
+                                }
+                            }
+                            else
+                            {
+                                sequenceFileNames.insert(j.getFileName(Math::Frame::invalid, false));
+                            }
+                        }
+                        for (const auto& j : i.second)
+                        {
+                            if (isSequenceFile(j))
+                            {
+                                sequenceFileNames.insert(j);
+                            }
+                            else
+                            {
+                                sequenceFileNames.erase(j);
+                            }
+                        }
+                        std::vector<Info> sequences;
+                        sequence(
+                            directory,
+                            std::vector<std::string>(sequenceFileNames.begin(), sequenceFileNames.end()),
+                            options,
+                            sequences);
+                        File::stat(sequences, options.sequenceStat);
+                        for (auto& j : sequences)
+                        {
+                            out.push_back(std::move(j));
+                        }
+                    }
+                }
+
+                sort(options, out);
+            }
+
+            void sort(const DirectoryListOptions& options, std::vector<Info>& out)
+            {
                 switch (options.sort)
                 {
                 case DirectoryListSort::Name:
+                {
+                    // Get the file names once instead of for every comparison.
+                    std::vector<std::pair<std::string, size_t> > names;
+                    names.reserve(out.size());
+                    for (size_t i = 0; i < out.size(); ++i)
+                    {
+                        names.push_back(std::make_pair(out[i].getFileName(Math::Frame::invalid, false), i));
+                    }
                     std::sort(
-                        out.begin(), out.end(),
-                        [&options](const Info& a, const Info& b)
+                        names.begin(), names.end(),
+                        [&options](const std::pair<std::string, size_t>& a, const std::pair<std::string, size_t>& b)
                         {
-                            return options.reverseSort ?
-                                (a.getFileName(Math::Frame::invalid, false) > b.getFileName(Math::Frame::invalid, false)) :
-                                (a.getFileName(Math::Frame::invalid, false) < b.getFileName(Math::Frame::invalid, false));
+                            return options.reverseSort ? (a.first > b.first) : (a.first < b.first);
                         });
+                    std::vector<Info> tmp;
+                    tmp.reserve(out.size());
+                    for (const auto& i : names)
+                    {
+                        tmp.push_back(std::move(out[i.second]));
+                    }
+                    out = std::move(tmp);
                     break;
+                }
                 case DirectoryListSort::Size:
                     std::sort(
                         out.begin(), out.end(),
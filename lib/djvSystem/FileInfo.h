@@ -46,6 +46,13 @@ namespace djv
                 Exec  = 4, //!< Executable
             };
 
+            //! File sequence stat modes.
+            enum class SequenceStat
+            {
+                All,        //!< Stat all of the frames
+                FirstLast   //!< Stat the first and last frames and estimate the size
+            };
+
             //! Directory listing sort options.
             enum class DirectoryListSort
             {
@@ -64,6 +71,7 @@ namespace djv
                 std::set<std::string>       extensions;
                 bool                        sequences               = false;
                 std::set<std::string>       sequenceExtensions;
+                SequenceStat                sequenceStat            = SequenceStat::All;
                 bool                        showHidden              = false;
                 DirectoryListSort           sort                    = DirectoryListSort::Name;
                 bool                        reverseSort             = false;
@@ -73,6 +81,8 @@ namespace djv
                 bool operator == (const DirectoryListOptions&) const;
             };
 
+            struct StatInfo;
+
             //! File and file sequence information.
             //!
             //! A file sequence is a list of file names that share a common name and
@@ -125,8 +135,10 @@ namespace djv
                 int getPermissions() const noexcept;
                 time_t getTime() const noexcept;
 
-                //! Get information from the file system.
+                //! Get information from the file system. The frames of a file
+                //! sequence are stat'ed in parallel.
                 bool stat(std::string* error = nullptr);
+                bool stat(SequenceStat, std::string* error = nullptr);
 
                 ///@}
 
@@ -149,6 +161,11 @@ namespace djv
 
             private:
                 static Math::Frame::Sequence _parseSequence(const std::string&);
+
+                void _getStatFileNames(SequenceStat, std::vector<std::string>&) const;
+                bool _setStat(const StatInfo*, size_t count, SequenceStat);
+
+                friend void stat(std::vector<Info>&, SequenceStat);
                 
                 Path                  _path;
                 bool                  _exists      = false;
@@ -166,6 +183,11 @@ namespace djv
             //! Get the contents of the given directory.
             std::vector<Info> directoryList(const Path& path, const DirectoryListOptions& options = DirectoryListOptions());
 
+            //! Get information from the file system for multiple items. The
+            //! files are stat'ed in parallel to hide the latency of network
+            //! file systems.
+            void stat(std::vector<Info>&, SequenceStat = SequenceStat::All);
+
             ///@}
 
             //! \name Sequences
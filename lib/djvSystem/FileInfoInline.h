@@ -14,6 +14,7 @@ namespace djv
                     extensions == other.extensions &&
                     sequences == other.sequences &&
                     sequenceExtensions == other.sequenceExtensions &&
+                    sequenceStat == other.sequenceStat &&
                     showHidden == other.showHidden &&
                     sort == other.sort &&
                     reverseSort == other.reverseSort &&
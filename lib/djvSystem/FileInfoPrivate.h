@@ -12,7 +12,53 @@ namespace djv
     {
         namespace File
         {
-            void sequence(Info&, const DirectoryListOptions&, std::vector<Info>&);
+            //! Information from the file system for a single file.
+            struct StatInfo
+            {
+                bool        exists      = false;
+                bool        directory   = false;
+                uint64_t    size        = 0;
+                uid_t       user        = 0;
+                int         permissions = 0;
+                time_t      time        = 0;
+                std::string error;
+            };
+
+            //! Get information from the file system for a single file. This
+            //! function is platform specific.
+            void statFile(const std::string& fileName, StatInfo&);
+
+            //! Get information from the file system for multiple files in
+            //! parallel.
+            void statFiles(const std::vector<std::string>& fileNames, std::vector<StatInfo>&);
+
+            //! Get whether a directory item is removed by the options.
+            bool isFiltered(
+                const std::string&          fileName,
+                bool                        isDirectory,
+                bool                        isHidden,
+                const DirectoryListOptions& options);
+
+            //! Group the files in a directory into sequences. The files are
+            //! grouped with a hash table and each sequence is created with a
+            //! single sort of the frame numbers. The information is not
+            //! stat'ed.
+            void sequence(
+                const Path&                     directory,
+                const std::vector<std::string>& fileNames,
+                const DirectoryListOptions&,
+                std::vector<Info>&);
+
+            //! Update a directory listing with the files that have been added,
+            //! removed, or modified. The files are stat'ed to get their current
+            //! state, so the order of the changes does not matter. Only the
+            //! sequences that contain the files are grouped again.
+            void update(
+                const Path&                  directory,
+                const std::set<std::string>& fileNames,
+                const DirectoryListOptions&,
+                std::vector<Info>&);
+
             void sort(const DirectoryListOptions&, std::vector<Info>&);
 
         } // namespace File
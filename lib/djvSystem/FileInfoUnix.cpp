@@ -6,8 +6,6 @@
 
 #include <djvMath/FrameNumber.h>
 
-#include <djvCore/String.h>
-
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <dirent.h>
@@ -32,139 +30,74 @@ namespace djv
     {
         namespace File
         {
-            bool Info::stat(std::string*)
+            void statFile(const std::string& fileName, StatInfo& out)
             {
-                _exists      = false;
-                _size        = 0;
-                _user        = 0;
-                _permissions = 0;
-                _time        = 0;
-                if (Type::Sequence == _type)
-                {
-                    bool     exists      = false;
-                    uint64_t size        = 0;
-                    uid_t    user        = 0;
-                    int      permissions = 0;
-                    time_t   time        = 0;
-                    for (auto i : Math::Frame::toFrames(_sequence))
-                    {
-                        _STAT info;
-                        memset(&info, 0, sizeof(_STAT));
-                        const std::string fileName = getFileName(i);
-                        if (_STAT_FNC(fileName.c_str(), &info) != 0)
-                        {
-                            return false;
-                        }
-                        exists       = true;
-                        size        += info.st_size;
-                        user         = std::min(_user, static_cast<uid_t>(info.st_uid));
-                        permissions |= (info.st_mode & S_IRUSR) ? static_cast<int>(Permissions::Read)  : 0;
-                        permissions |= (info.st_mode & S_IWUSR) ? static_cast<int>(Permissions::Write) : 0;
-                        permissions |= (info.st_mode & S_IXUSR) ? static_cast<int>(Permissions::Exec)  : 0;
-                        time         = std::max(_time, info.st_mtime);
-                    }
-                    _exists      = exists;
-                    _size        = size;
-                    _user        = user;
-                    _permissions = permissions;
-                    _time        = time;
-                }
-                else
+                out = StatInfo();
+                _STAT info;
+                memset(&info, 0, sizeof(_STAT));
+                if (0 == _STAT_FNC(fileName.c_str(), &info))
                 {
-                    _STAT info;
-                    memset(&info, 0, sizeof(_STAT));
-                    if (_STAT_FNC(_path.get().c_str(), &info) != 0)
-                    {
-                        return false;
-                    }
-                    _exists		  = true;
-                    if (S_ISDIR(info.st_mode))
-                    {
-                        _type     = Type::Directory;
-                    }
-                    _size         = info.st_size;
-                    _user         = info.st_uid;
-                    _permissions |= (info.st_mode & S_IRUSR) ? static_cast<int>(Permissions::Read)  : 0;
-                    _permissions |= (info.st_mode & S_IWUSR) ? static_cast<int>(Permissions::Write) : 0;
-                    _permissions |= (info.st_mode & S_IXUSR) ? static_cast<int>(Permissions::Exec)  : 0;
-                    _time         = info.st_mtime;
+                    out.exists       = true;
+                    out.directory    = S_ISDIR(info.st_mode);
+                    out.size         = info.st_size;
+                    out.user         = info.st_uid;
+                    out.permissions |= (info.st_mode & S_IRUSR) ? static_cast<int>(Permissions::Read)  : 0;
+                    out.permissions |= (info.st_mode & S_IWUSR) ? static_cast<int>(Permissions::Write) : 0;
+                    out.permissions |= (info.st_mode & S_IXUSR) ? static_cast<int>(Permissions::Exec)  : 0;
+                    out.time         = info.st_mtime;
                 }
-                return true;
             }
 
             std::vector<Info> directoryList(const Path& value, const DirectoryListOptions& options)
             {
                 std::vector<Info> out;
                 
-                // List the directory contents.
+                // List the directory contents. The directory entry type is
+                // used so the items do not need to be stat'ed until after they
+                // have been filtered and grouped into sequences.
+                std::vector<std::string> fileNames;
                 if (auto dir = opendir(value.get().c_str()))
                 {
                     dirent* de = nullptr;
                     while ((de = readdir(dir)))
                     {
-                        Info info(Path(value, de->d_name));
-                        
-                        const std::string fileName = info.getFileName(-1, false);
-                        
-                        bool filter = false;
-                        
-                        // Filter hidden items.
-                        if (!filter && fileName.size() > 0 &&
-                            '.' == fileName[0])
+                        const std::string fileName(de->d_name);
+                        bool isDirectory = false;
+                        switch (de->d_type)
                         {
-                            filter = !options.showHidden;
-                        }
-                        
-                        // Filter "." and ".." items.
-                        if (!filter &&
-                            fileName.size() == 1 &&
-                            '.' == fileName[0])
+                        case DT_DIR:
+                            isDirectory = true;
+                            break;
+                        case DT_LNK:
+                        case DT_UNKNOWN:
                         {
-                            filter = true;
-                        }
-                        if (!filter &&
-                            fileName.size() == 2 &&
-                            '.' == fileName[0] &&
-                            '.' == fileName[1])
-                        {
-                            filter = true;
+                            _STAT info;
+                            memset(&info, 0, sizeof(_STAT));
+                            if (0 == _STAT_FNC(Path(value, fileName).get().c_str(), &info))
+                            {
+                                isDirectory = S_ISDIR(info.st_mode);
+                            }
+                            break;
                         }
-                        
-                        // Filter string matches.
-                        if (!filter &&
-                            options.filter.size() &&
-                            !String::match(fileName, options.filter))
-                        {
-                            filter = true;
+                        default: break;
                         }
-                        
-                        // Filter file extensions.
-                        if (!filter &&
-                            info.getType() != System::File::Type::Directory &&
-                            options.extensions.size())
+                        const bool isHidden = fileName.size() > 0 && '.' == fileName[0];
+                        if (!isFiltered(fileName, isDirectory, isHidden, options))
                         {
-                            bool match = false;
-                            for (const auto& i : options.extensions)
+                            if (isDirectory)
                             {
-                                if (String::match(fileName, '\\' + i + '$'))
-                                {
-                                    match = true;
-                                    break;
-                                }
+                                out.push_back(Info(Path(value, fileName), Type::Directory, Math::Frame::Sequence(), false));
                             }
-                            if (!match)
+                            else
                             {
-                                filter = true;
+                                fileNames.push_back(fileName);
                             }
                         }
-
-                        if (!filter)
-                        {
-                            sequence(info, options, out);
-                        }
                     }
                     closedir(dir);
                 }
+                sequence(value, fileNames, options, out);
+                stat(out, options.sequenceStat);
                     
                 // Sort the items.
                 sort(options, out);
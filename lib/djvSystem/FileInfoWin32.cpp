@@ -34,81 +34,32 @@ namespace djv
     {
         namespace File
         {
-            bool Info::stat(std::string* error)
+            void statFile(const std::string& fileName, StatInfo& out)
             {
-                _exists      = false;
-                _size        = 0;
-                _user        = 0;
-                _permissions = 0;
-                _time        = 0;
-                _permissions = 0;
-                if (Type::Sequence == _type)
-                {
-                    bool     exists      = false;
-                    uint64_t size        = 0;
-                    uid_t    user        = 0;
-                    int      permissions = 0;
-                    time_t   time        = 0;
-                    for (auto i : Math::Frame::toFrames(_sequence))
-                    {
-                        _STAT info;
-                        memset(&info, 0, sizeof(_STAT));
-                        if (_STAT_FNC(String::toWide(getFileName(i)).c_str(), &info) != 0)
-                        {
-                            if (error)
-                            {
-                                char tmp[String::cStringLength] = "";
-                                strerror_s(tmp, String::cStringLength, errno);
-                                *error = tmp;
-                            }
-                            return false;
-                        }
-                        exists       = true;
-                        size        += info.st_size;
-                        user         = std::min(_user, static_cast<uid_t>(info.st_uid));
-                        permissions |= (info.st_mode & _S_IREAD)  ? static_cast<int>(Permissions::Read)  : 0;
-                        permissions |= (info.st_mode & _S_IWRITE) ? static_cast<int>(Permissions::Write) : 0;
-                        permissions |= (info.st_mode & _S_IEXEC)  ? static_cast<int>(Permissions::Exec)  : 0;
-                        time         = std::max(_time, info.st_mtime);
-                    }
-                    _exists      = exists;
-                    _size        = size;
-                    _user        = user;
-                    _permissions = permissions;
-                    _time        = time;
-                }
-                else if (_path.isServer())
+                out = StatInfo();
+                if (fileName.size() > 2 && '\\' == fileName[0] && '\\' == fileName[1] && Path(fileName).isServer())
                 {
                     //! \todo What about servers?
-                    _exists = true;
+                    out.exists = true;
+                    return;
                 }
-                else
+                _STAT info;
+                memset(&info, 0, sizeof(_STAT));
+                if (_STAT_FNC(String::toWide(fileName).c_str(), &info) != 0)
                 {
-                    _STAT info;
-                    memset(&info, 0, sizeof(_STAT));
-                    if (_STAT_FNC(String::toWide(_path.get()).c_str(), &info) != 0)
-                    {
-                        if (error)
-                        {
-                            char tmp[String::cStringLength] = "";
-                            strerror_s(tmp, String::cStringLength, errno);
-                            *error = tmp;
-                        }
-                        return false;
-                    }
-                    _exists       = true;
-                    if (info.st_mode & _S_IFDIR)
-                    {
-                        _type     = Type::Directory;
-                    }
-                    _size         = info.st_size;
-                    _user         = info.st_uid;
-                    _permissions |= (info.st_mode & _S_IREAD)  ? static_cast<int>(Permissions::Read)  : 0;
-                    _permissions |= (info.st_mode & _S_IWRITE) ? static_cast<int>(Permissions::Write) : 0;
-                    _permissions |= (info.st_mode & _S_IEXEC)  ? static_cast<int>(Permissions::Exec)  : 0;
-                    _time         = info.st_mtime;
+                    char tmp[String::cStringLength] = "";
+                    strerror_s(tmp, String::cStringLength, errno);
+                    out.error = tmp;
+                    return;
                 }
-                return true;
+                out.exists       = true;
+                out.directory    = (info.st_mode & _S_IFDIR) != 0;
+                out.size         = info.st_size;
+                out.user         = info.st_uid;
+                out.permissions |= (info.st_mode & _S_IREAD)  ? static_cast<int>(Permissions::Read)  : 0;
+                out.permissions |= (info.st_mode & _S_IWRITE) ? static_cast<int>(Permissions::Write) : 0;
+                out.permissions |= (info.st_mode & _S_IEXEC)  ? static_cast<int>(Permissions::Exec)  : 0;
+                out.time         = info.st_mtime;
             }
 
             namespace
@@ -212,57 +163,33 @@ namespace djv
                     memcpy(pathBuf, path.c_str(), size * sizeof(WCHAR));
                     pathBuf[size++] = 0;
 
-                    // List the directory contents.
+                    // List the directory contents. The items are not stat'ed
+                    // until after they have been filtered and grouped into
+                    // sequences.
                     std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>, wchar_t> utf16;
                     WIN32_FIND_DATAW ffd;
                     HANDLE hFind = FindFirstFileW(pathBuf, &ffd);
                     if (hFind != INVALID_HANDLE_VALUE)
                     {
+                        std::vector<std::string> fileNames;
                         try
                         {
                             do
                             {
                                 const std::string fileName = utf16.to_bytes(ffd.cFileName);
-
-                                bool filter = false;
-                                if (ffd.dwFileAttributes & FILE_ATTRIBUTE_HIDDEN)
-                                {
-                                    filter = !options.showHidden;
-                                }
-                                if (fileName.size() == 1 && '.' == fileName[0])
+                                const bool isDirectory = (ffd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+                                const bool isHidden = (ffd.dwFileAttributes & FILE_ATTRIBUTE_HIDDEN) != 0;
+                                if (!isFiltered(fileName, isDirectory, isHidden, options))
                                 {
-                                    filter = true;
-                                }
-                                if (fileName.size() == 2 && '.' == fileName[0] && '.' == fileName[1])
-                                {
-                                    filter = true;
-                                }
-                                if (options.filter.size() && !String::match(fileName, options.filter))
-                                {
-                                    filter = true;
-                                }
-                                if (!filter && !(ffd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) && options.extensions.size())
-                                {
-                                    bool match = false;
-                                    for (const auto& i : options.extensions)
+                                    if (isDirectory)
                                     {
-                                        if (String::match(fileName, '\\' + i + '$'))
-                                        {
-                                            match = true;
-                                            break;
-                                        }
+                                        out.push_back(Info(Path(value, fileName), Type::Directory, Math::Frame::Sequence(), false));
                                     }
-                                    if (!match)
+                                    else
                                     {
-                                        filter = true;
+                                        fileNames.push_back(fileName);
                                     }
                                 }
-
-                                if (!filter)
-                                {
-                                    Info info(Path(value, fileName));
-                                    sequence(info, options, out);
-                                }
                             } while (FindNextFileW(hFind, &ffd) != 0);
                         }
                         catch (const std::exception&)
@@ -270,6 +197,8 @@ namespace djv
                             //! \bug How should we handle this error?
                         }
                         FindClose(hFind);
+                        sequence(value, fileNames, options, out);
+                        stat(out, options.sequenceStat);
                     }
                     else if (value.isServer())
                     {
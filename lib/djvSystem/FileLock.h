@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvCore/Core.h>
+
+#include <memory>
+#include <string>
+
+namespace djv
+{
+    namespace System
+    {
+        namespace File
+        {
+            //! Advisory file lock.
+            //!
+            //! The lock is only respected by other processes that also use
+            //! it, the locked file can still be opened and modified. The lock
+            //! is released when the object is destroyed.
+            class Lock
+            {
+                DJV_NON_COPYABLE(Lock);
+
+            protected:
+                void _init(const std::string& fileName);
+                Lock();
+
+            public:
+                ~Lock();
+
+                //! Create a new file lock. The lock file is created if it does
+                //! not exist.
+                //! Throws:
+                //! - Error
+                static std::shared_ptr<Lock> create(const std::string& fileName);
+
+                const std::string& getFileName() const;
+
+                //! Get whether the lock is held.
+                bool isLocked() const;
+
+                //! Try to take an exclusive lock without waiting. Returns false
+                //! if another process holds the lock.
+                bool tryLock();
+
+                void unlock();
+
+            private:
+                DJV_PRIVATE();
+            };
+
+        } // namespace File
+    } // namespace System
+} // namespace djv
@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvSystem/FileLock.h>
+
+#include <djvSystem/File.h>
+
+#include <djvCore/StringFormat.h>
+
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace System
+    {
+        namespace File
+        {
+            struct Lock::Private
+            {
+                std::string fileName;
+                int f = -1;
+                bool locked = false;
+            };
+
+            void Lock::_init(const std::string& fileName)
+            {
+                DJV_PRIVATE_PTR();
+                p.fileName = fileName;
+                p.f = ::open(fileName.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+                if (-1 == p.f)
+                {
+                    //! \todo How can we translate this?
+                    throw Error(String::Format("{0}: Cannot open file.").arg(fileName));
+                }
+            }
+
+            Lock::Lock() :
+                _p(new Private)
+            {}
+
+            Lock::~Lock()
+            {
+                DJV_PRIVATE_PTR();
+                if (p.f != -1)
+                {
+                    unlock();
+                    ::close(p.f);
+                }
+            }
+
+            std::shared_ptr<Lock> Lock::create(const std::string& fileName)
+            {
+                auto out = std::shared_ptr<Lock>(new Lock);
+                out->_init(fileName);
+                return out;
+            }
+
+            const std::string& Lock::getFileName() const
+            {
+                return _p->fileName;
+            }
+
+            bool Lock::isLocked() const
+            {
+                return _p->locked;
+            }
+
+            bool Lock::tryLock()
+            {
+                DJV_PRIVATE_PTR();
+                if (!p.locked)
+                {
+                    p.locked = 0 == ::flock(p.f, LOCK_EX | LOCK_NB);
+                }
+                return p.locked;
+            }
+
+            void Lock::unlock()
+            {
+                DJV_PRIVATE_PTR();
+                if (p.locked)
+                {
+                    ::flock(p.f, LOCK_UN);
+                    p.locked = false;
+                }
+            }
+
+        } // namespace File
+    } // namespace System
+} // namespace djv
@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvSystem/FileLock.h>
+
+#include <djvSystem/File.h>
+
+#include <djvCore/StringFormat.h>
+
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif // WIN32_LEAN_AND_MEAN
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif // NOMINMAX
+#include <windows.h>
+
+#include <codecvt>
+#include <locale>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace System
+    {
+        namespace File
+        {
+            struct Lock::Private
+            {
+                std::string fileName;
+                HANDLE f = INVALID_HANDLE_VALUE;
+                bool locked = false;
+            };
+
+            void Lock::_init(const std::string& fileName)
+            {
+                DJV_PRIVATE_PTR();
+                p.fileName = fileName;
+                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>, wchar_t> utf16;
+                p.f = CreateFileW(
+                    utf16.from_bytes(fileName).c_str(),
+                    GENERIC_READ | GENERIC_WRITE,
+                    FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                    NULL,
+                    OPEN_ALWAYS,
+                    FILE_ATTRIBUTE_NORMAL,
+                    NULL);
+                if (INVALID_HANDLE_VALUE == p.f)
+                {
+                    //! \todo How can we translate this?
+                    throw Error(String::Format("{0}: Cannot open file.").arg(fileName));
+                }
+            }
+
+            Lock::Lock() :
+                _p(new Private)
+            {}
+
+            Lock::~Lock()
+            {
+                DJV_PRIVATE_PTR();
+                if (p.f != INVALID_HANDLE_VALUE)
+                {
+                    unlock();
+                    CloseHandle(p.f);
+                }
+            }
+
+            std::shared_ptr<Lock> Lock::create(const std::string& fileName)
+            {
+                auto out = std::shared_ptr<Lock>(new Lock);
+                out->_init(fileName);
+                return out;
+            }
+
+            const std::string& Lock::getFileName() const
+            {
+                return _p->fileName;
+            }
+
+            bool Lock::isLocked() const
+            {
+                return _p->locked;
+            }
+
+            bool Lock::tryLock()
+            {
+                DJV_PRIVATE_PTR();
+                if (!p.locked)
+                {
+                    OVERLAPPED overlapped = {};
+                    p.locked = LockFileEx(
+                        p.f,
+                        LOCKFILE_EXCLUSIVE_LOCK | LOCKFILE_FAIL_IMMEDIATELY,
+                        0,
+                        1,
+                        0,
+                        &overlapped) != 0;
+                }
+                return p.locked;
+            }
+
+            void Lock::unlock()
+            {
+                DJV_PRIVATE_PTR();
+                if (p.locked)
+                {
+                    OVERLAPPED overlapped = {};
+                    UnlockFileEx(p.f, 0, 1, 0, &overlapped);
+                    p.locked = false;
+                }
+            }
+
+        } // namespace File
+    } // namespace System
+} // namespace djv
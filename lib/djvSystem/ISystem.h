@@ -66,6 +66,13 @@ namespace djv
             //! Override this function to do work each frame.
             virtual void tick();
 
+            //! Get the time when the system next needs to be ticked. This is
+            //! used by the application event loop to sleep while there is no
+            //! work to do. The default implementation returns the maximum
+            //! time point, meaning the system only needs to be ticked when
+            //! the application is woken up.
+            virtual Core::Time::TimePoint getNextTick() const;
+
             ///@}
 
         private:
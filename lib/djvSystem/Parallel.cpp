@@ -0,0 +1,195 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvSystem/Parallel.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace djv
+{
+    namespace System
+    {
+        namespace
+        {
+            //! The state of one call to parallelFor().
+            struct Task
+            {
+                const std::function<void(size_t, size_t, size_t)>* function = nullptr;
+                size_t count = 0;
+                size_t blockSize = 1;
+                std::atomic<size_t> next;
+                std::atomic<size_t> thread;
+
+                std::mutex mutex;
+                std::condition_variable cv;
+                size_t finished = 0;
+                std::exception_ptr exception;
+
+                void run(size_t threadIndex)
+                {
+                    // The function is only used for the blocks that are
+                    // claimed, so a worker that starts after the caller has
+                    // returned does nothing.
+                    size_t begin = 0;
+                    while ((begin = next.fetch_add(blockSize)) < count)
+                    {
+                        const size_t end = std::min(begin + blockSize, count);
+                        std::exception_ptr e;
+                        try
+                        {
+                            (*function)(threadIndex, begin, end);
+                        }
+                        catch (...)
+                        {
+                            e = std::current_exception();
+                        }
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (e && !exception)
+                        {
+                            exception = e;
+                        }
+                        finished += end - begin;
+                        if (finished == count)
+                        {
+                            cv.notify_all();
+                        }
+                    }
+                }
+            };
+
+            //! Worker threads that are started when they are first needed
+            //! and kept until the process exits.
+            class Pool
+            {
+            public:
+                ~Pool()
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        _running = false;
+                    }
+                    _cv.notify_all();
+                    for (auto& i : _threads)
+                    {
+                        i.join();
+                    }
+                }
+
+                void add(const std::shared_ptr<Task>& task, size_t jobCount)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        while (_threads.size() < jobCount)
+                        {
+                            _threads.push_back(std::thread(
+                                [this]
+                                {
+                                    _run();
+                                }));
+                        }
+                        for (size_t i = 0; i < jobCount; ++i)
+                        {
+                            _tasks.push_back(task);
+                        }
+                    }
+                    _cv.notify_all();
+                }
+
+            private:
+                void _run()
+                {
+                    while (true)
+                    {
+                        std::shared_ptr<Task> task;
+                        {
+                            std::unique_lock<std::mutex> lock(_mutex);
+                            _cv.wait(
+                                lock,
+                                [this]
+                                {
+                                    return !_tasks.empty() || !_running;
+                                });
+                            if (!_running)
+                            {
+                                break;
+                            }
+                            task = _tasks.front();
+                            _tasks.pop_front();
+                        }
+                        task->run(task->thread++);
+                    }
+                }
+
+                std::mutex _mutex;
+                std::condition_variable _cv;
+                std::list<std::shared_ptr<Task> > _tasks;
+                std::vector<std::thread> _threads;
+                bool _running = true;
+            };
+
+            Pool& getPool()
+            {
+                static Pool pool;
+                return pool;
+            }
+
+        } // namespace
+
+        size_t getHardwareThreadCount()
+        {
+            return std::max(std::thread::hardware_concurrency(), 1U);
+        }
+
+        void parallelFor(
+            size_t count,
+            size_t blockSize,
+            size_t threadCount,
+            const std::function<void(size_t thread, size_t begin, size_t end)>& function)
+        {
+            if (0 == count)
+            {
+                return;
+            }
+            blockSize = std::max(blockSize, static_cast<size_t>(1));
+            threadCount = std::min(std::max(threadCount, static_cast<size_t>(1)), (count + blockSize - 1) / blockSize);
+            if (1 == threadCount)
+            {
+                for (size_t begin = 0; begin < count; begin += blockSize)
+                {
+                    function(0, begin, std::min(begin + blockSize, count));
+                }
+                return;
+            }
+
+            auto task = std::make_shared<Task>();
+            task->function = &function;
+            task->count = count;
+            task->blockSize = blockSize;
+            task->next = 0;
+            task->thread = 1;
+            getPool().add(task, threadCount - 1);
+            task->run(0);
+            std::unique_lock<std::mutex> lock(task->mutex);
+            task->cv.wait(
+                lock,
+                [task]
+                {
+                    return task->finished == task->count;
+                });
+            if (task->exception)
+            {
+                std::rethrow_exception(task->exception);
+            }
+        }
+
+    } // namespace System
+} // namespace djv
@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <functional>
+
+#include <cstddef>
+
+namespace djv
+{
+    namespace System
+    {
+        //! \name Parallel Loops
+        ///@{
+
+        //! Get the number of hardware threads, or one if it is not known.
+        size_t getHardwareThreadCount();
+
+        //! Run a function for the given number of items in parallel. The
+        //! items are divided into blocks of the given size, and the function
+        //! is given the index of the thread (less than the thread count) and
+        //! the range of items [begin, end).
+        //!
+        //! The blocks are run by the calling thread and by a pool of worker
+        //! threads that is shared by the process, so new threads are not
+        //! started for each call. Since the calling thread also runs blocks
+        //! this may be called from other worker threads. If the function
+        //! throws an exception it is re-thrown once all of the blocks have
+        //! finished.
+        void parallelFor(
+            size_t count,
+            size_t blockSize,
+            size_t threadCount,
+            const std::function<void(size_t thread, size_t begin, size_t end)>&);
+
+        ///@}
+
+    } // namespace System
+} // namespace djv
@@ -263,6 +263,7 @@ namespace djv
         DJV_TEXT("resource_path_documents"),
         DJV_TEXT("resource_path_log_file"),
         DJV_TEXT("resource_path_settings_file"),
+        DJV_TEXT("resource_path_thumbnail_cache_file"),
         DJV_TEXT("resource_path_audio"),
         DJV_TEXT("resource_path_fonts"),
         DJV_TEXT("resource_path_icons"),
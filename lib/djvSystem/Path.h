@@ -33,6 +33,7 @@ namespace djv
                 Documents,
                 LogFile,
                 SettingsFile,
+                ThumbnailCacheFile,
                 Audio,
                 Fonts,
                 Icons,
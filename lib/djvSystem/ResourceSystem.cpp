@@ -153,6 +153,9 @@ namespace djv
             File::Path settingsFile(documents, applicationName + ".json");
             p.paths[File::ResourcePath::SettingsFile] = settingsFile;
 
+            File::Path thumbnailCacheFile(documents, applicationName + ".thumbnails");
+            p.paths[File::ResourcePath::ThumbnailCacheFile] = thumbnailCacheFile;
+
             File::Path testPath = p.paths[File::ResourcePath::Application];
             testPath.append("djvSystem.en.text");
             if (File::Info(testPath).doesExist())
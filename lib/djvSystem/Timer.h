@@ -95,6 +95,7 @@ namespace djv
             static std::shared_ptr<TimerSystem> create(const std::shared_ptr<Context>&);
 
             void tick() override;
+            Core::Time::TimePoint getNextTick() const override;
 
         private:
             void _addTimer(const std::weak_ptr<Timer>&);
@@ -45,8 +45,18 @@ namespace djv
                 bool wordWrap = true;
 
                 typedef std::pair<Render2D::Font::FontInfo, float> TextCacheKey;
+                struct TextCacheKeyHash
+                {
+                    std::size_t operator() (const TextCacheKey& value) const noexcept
+                    {
+                        std::size_t out = 0;
+                        Memory::hashCombine(out, value.first);
+                        Memory::hashCombine(out, value.second);
+                        return out;
+                    }
+                };
                 typedef std::pair<std::vector<Render2D::Font::TextLine>, glm::vec2> TextCacheValue;
-                Memory::Cache<TextCacheKey, TextCacheValue> textCache;
+                Memory::Cache<TextCacheKey, TextCacheValue, TextCacheKeyHash> textCache;
 
                 Math::BBox2f clipRect;
 
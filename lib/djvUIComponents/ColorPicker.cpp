@@ -127,7 +127,8 @@ namespace djv
         {
             DJV_PRIVATE_PTR();
             std::vector<std::string> items;
-            for (size_t i = static_cast<size_t>(Image::Type::L_U8); i < static_cast<size_t>(Image::Type::Count); ++i)
+            // Colors cannot use the planar YUV types.
+            for (size_t i = static_cast<size_t>(Image::Type::L_U8); i <= static_cast<size_t>(Image::Type::RGBA_F32); ++i)
             {
                 std::stringstream ss;
                 ss << static_cast<Image::Type>(i);
@@ -4,6 +4,8 @@
 
 #include <djvUIComponents/FFmpegSettingsWidget.h>
 
+#include <djvUI/CheckBox.h>
+#include <djvUI/ComboBox.h>
 #include <djvUI/FormLayout.h>
 #include <djvUI/GroupBox.h>
 #include <djvUI/IntSlider.h>
@@ -24,6 +26,9 @@ namespace djv
             struct FFmpegWidget::Private
             {
                 std::shared_ptr<UI::Numeric::IntSlider> threadCountSlider;
+                std::shared_ptr<UI::ComboBox> threadTypeComboBox;
+                std::shared_ptr<UI::CheckBox> saveKeyframeIndexCheckBox;
+                std::shared_ptr<UI::ComboBox> codecComboBox;
                 std::shared_ptr<UI::FormLayout> layout;
             };
 
@@ -37,8 +42,17 @@ namespace djv
                 p.threadCountSlider = UI::Numeric::IntSlider::create(context);
                 p.threadCountSlider->setRange(Math::IntRange(1, 16));
 
+                p.threadTypeComboBox = UI::ComboBox::create(context);
+
+                p.saveKeyframeIndexCheckBox = UI::CheckBox::create(context);
+
+                p.codecComboBox = UI::ComboBox::create(context);
+
                 p.layout = UI::FormLayout::create(context);
                 p.layout->addChild(p.threadCountSlider);
+                p.layout->addChild(p.threadTypeComboBox);
+                p.layout->addChild(p.saveKeyframeIndexCheckBox);
+                p.layout->addChild(p.codecComboBox);
                 addChild(p.layout);
 
                 _widgetUpdate();
@@ -62,6 +76,60 @@ namespace djv
                             }
                         }
                     });
+
+                p.threadTypeComboBox->setCallback(
+                    [weak, contextWeak](int value)
+                    {
+                        if (auto context = contextWeak.lock())
+                        {
+                            if (auto widget = weak.lock())
+                            {
+                                auto io = context->getSystemT<AV::IO::IOSystem>();
+                                AV::FFmpeg::Options options;
+                                rapidjson::Document document;
+                                auto& allocator = document.GetAllocator();
+                                fromJSON(io->getOptions(AV::FFmpeg::pluginName, allocator), options);
+                                options.threadType = static_cast<AV::FFmpeg::ThreadType>(value);
+                                io->setOptions(AV::FFmpeg::pluginName, toJSON(options, allocator));
+                            }
+                        }
+                    });
+
+                p.saveKeyframeIndexCheckBox->setCheckedCallback(
+                    [weak, contextWeak](bool value)
+                    {
+                        if (auto context = contextWeak.lock())
+                        {
+                            if (auto widget = weak.lock())
+                            {
+                                auto io = context->getSystemT<AV::IO::IOSystem>();
+                                AV::FFmpeg::Options options;
+                                rapidjson::Document document;
+                                auto& allocator = document.GetAllocator();
+                                fromJSON(io->getOptions(AV::FFmpeg::pluginName, allocator), options);
+                                options.saveKeyframeIndex = value;
+                                io->setOptions(AV::FFmpeg::pluginName, toJSON(options, allocator));
+                            }
+                        }
+                    });
+
+                p.codecComboBox->setCallback(
+                    [weak, contextWeak](int value)
+                    {
+                        if (auto context = contextWeak.lock())
+                        {
+                            if (auto widget = weak.lock())
+                            {
+                                auto io = context->getSystemT<AV::IO::IOSystem>();
+                                AV::FFmpeg::Options options;
+                                rapidjson::Document document;
+                                auto& allocator = document.GetAllocator();
+                                fromJSON(io->getOptions(AV::FFmpeg::pluginName, allocator), options);
+                                options.codec = static_cast<AV::FFmpeg::Codec>(value);
+                                io->setOptions(AV::FFmpeg::pluginName, toJSON(options, allocator));
+                            }
+                        }
+                    });
             }
 
             FFmpegWidget::FFmpegWidget() :
@@ -97,6 +165,10 @@ namespace djv
                 if (event.getData().text)
                 {
                     p.layout->setText(p.threadCountSlider, _getText(DJV_TEXT("settings_io_ffmpeg_thread_count")) + ":");
+                    p.layout->setText(p.threadTypeComboBox, _getText(DJV_TEXT("settings_io_ffmpeg_thread_type")) + ":");
+                    p.layout->setText(p.saveKeyframeIndexCheckBox, _getText(DJV_TEXT("settings_io_ffmpeg_save_keyframe_index")) + ":");
+                    p.layout->setText(p.codecComboBox, _getText(DJV_TEXT("settings_io_ffmpeg_codec")) + ":");
+                    _widgetUpdate();
                 }
             }
 
@@ -110,7 +182,30 @@ namespace djv
                     rapidjson::Document document;
                     auto& allocator = document.GetAllocator();
                     fromJSON(io->getOptions(AV::FFmpeg::pluginName, allocator), options);
+
                     p.threadCountSlider->setValue(options.threadCount);
+
+                    std::vector<std::string> items;
+                    for (auto i : AV::FFmpeg::getThreadTypeEnums())
+                    {
+                        std::stringstream ss;
+                        ss << i;
+                        items.push_back(_getText(ss.str()));
+                    }
+                    p.threadTypeComboBox->setItems(items);
+                    p.threadTypeComboBox->setCurrentItem(static_cast<int>(options.threadType));
+
+                    p.saveKeyframeIndexCheckBox->setChecked(options.saveKeyframeIndex);
+
+                    items.clear();
+                    for (auto i : AV::FFmpeg::getCodecEnums())
+                    {
+                        std::stringstream ss;
+                        ss << i;
+                        items.push_back(_getText(ss.str()));
+                    }
+                    p.codecComboBox->setItems(items);
+                    p.codecComboBox->setCurrentItem(static_cast<int>(options.codec));
                 }
             }
 
@@ -116,6 +116,9 @@ namespace djv
 
                 auto io = context->getSystemT<AV::IO::IOSystem>();
                 p.options.sequenceExtensions = io->getSequenceExtensions();
+                // Only stat the first and last frames of sequences so that
+                // large directories are listed quickly.
+                p.options.sequenceStat = System::File::SequenceStat::FirstLast;
                 p.directoryModel = System::File::DirectoryModel::create(context);
                 p.shortcutsModel = ShortcutsModel::create(context);
                 p.recentPathsModel = System::File::RecentFilesModel::create();
@@ -517,8 +517,8 @@ namespace djv
                             const auto t = std::chrono::duration_cast<std::chrono::milliseconds>(ut - j->second);
                             opacity = std::min(t.count() / static_cast<float>(thumbnailFadeTime), 1.F);
                         }
-                        const uint16_t w = item.thumbnail->getWidth();
-                        const uint16_t h = item.thumbnail->getHeight();
+                        const uint32_t w = item.thumbnail->getWidth();
+                        const uint32_t h = item.thumbnail->getHeight();
                         glm::vec2 pos(0.F, 0.F);
                         switch (p.viewType)
                         {
@@ -557,8 +557,8 @@ namespace djv
                         const auto j = p.icons.find(item.info.getType());
                         if (j != p.icons.end())
                         {
-                            const uint16_t w = j->second->getWidth();
-                            const uint16_t h = j->second->getHeight();
+                            const uint32_t w = j->second->getWidth();
+                            const uint32_t h = j->second->getHeight();
                             glm::vec2 pos(0.F, 0.F);
                             switch (p.viewType)
                             {
@@ -72,6 +72,7 @@ namespace djv
         {
             Image::Color color = Image::Color(0.F, 0.F, 0.F);
             std::shared_ptr<Image::Data> image;
+            glm::vec2 imageScale = glm::vec2(1.F, 1.F);
             glm::vec2 imagePos = glm::vec2(0.F, 0.F);
             float imageZoom = 1.F;
             glm::vec2 pickerPos = glm::vec2(0.F, 0.F);
@@ -354,13 +355,18 @@ namespace djv
                         {
                             if (value)
                             {
+                                auto mediaWeak = std::weak_ptr<Media>(value->getMedia());
                                 widget->_p->imageObserver = Observer::Value<std::shared_ptr<Image::Data> >::create(
                                     value->getViewWidget()->observeImage(),
-                                    [weak](const std::shared_ptr<Image::Data>& value)
+                                    [weak, mediaWeak](const std::shared_ptr<Image::Data>& value)
                                     {
                                         if (auto widget = weak.lock())
                                         {
                                             widget->_p->image = value;
+                                            if (auto media = mediaWeak.lock())
+                                            {
+                                                widget->_p->imageScale = media->getImageScale(value);
+                                            }
                                             widget->_sampleUpdate();
                                             widget->_widgetUpdate();
                                         }
@@ -491,7 +497,7 @@ namespace djv
                     m *= UI::ImageWidget::getXForm(
                         p.image,
                         p.imageData.rotate,
-                        glm::vec2(1.F, 1.F),
+                        p.imageScale,
                         p.imageData.aspectRatio);
                     pixelPos = glm::inverse(glm::translate(m, glm::vec2(-.5F, -.5F))) * pixelPos;
 
@@ -599,8 +605,8 @@ namespace djv
                 break;
             }*/
             default:
-                p.pixelPos.x = pixelPos.x;
-                p.pixelPos.y = pixelPos.y;
+                p.pixelPos.x = pixelPos.x * p.imageScale.x;
+                p.pixelPos.y = pixelPos.y * p.imageScale.y;
                 break;
             }
         }
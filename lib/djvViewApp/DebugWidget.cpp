@@ -20,11 +20,16 @@
 #include <djvRender2D/Render.h>
 
 #include <djvAV/IO.h>
+#include <djvAV/IOSystem.h>
 #include <djvAV/ThumbnailSystem.h>
 
+#include <djvImage/DataPool.h>
+
 #include <djvSystem/Context.h>
 #include <djvSystem/Timer.h>
 
+#include <djvCore/Memory.h>
+
 using namespace djv::Core;
 
 namespace djv
@@ -139,6 +144,9 @@ namespace djv
                 _textBlocks["IconCache"] = UI::Text::Block::create(context);
                 _thermometerWidgets["IconCache"] = UIComponents::ThermometerWidget::create(context);
 
+                _textBlocks["ImageDataPool"] = UI::Text::Block::create(context);
+                _thermometerWidgets["ImageDataPool"] = UIComponents::ThermometerWidget::create(context);
+
                 for (auto& i : _textBlocks)
                 {
                     i.second->setFontFamily(Render2D::Font::familyMono);
@@ -168,6 +176,8 @@ namespace djv
                 _layout->addChild(_thermometerWidgets["ThumbnailImageCache"]);
                 _layout->addChild(_textBlocks["IconCache"]);
                 _layout->addChild(_thermometerWidgets["IconCache"]);
+                _layout->addChild(_textBlocks["ImageDataPool"]);
+                _layout->addChild(_thermometerWidgets["ImageDataPool"]);
                 addChild(_layout);
 
                 _timer = System::Timer::create(context);
@@ -223,6 +233,8 @@ namespace djv
                     const float thumbnailImageCachePercentage = thumbnailSystem->getImageCachePercentage();
                     auto iconSystem = context->getSystemT<UI::IconSystem>();
                     const float iconCachePercentage = iconSystem->getCachePercentage();
+                    auto dataPool = context->getSystemT<AV::IO::IOSystem>()->getDataPool();
+                    const float dataPoolFreePercentage = dataPool->getFreePercentage();
 
                     _lineGraphs["FPS"]->addSample(fps);
                     _lineGraphs["TotalSystemTime"]->addSample(totalSystemTime.count());
@@ -233,6 +245,7 @@ namespace djv
                     _thermometerWidgets["ThumbnailImageCache"]->setPercentage(thumbnailImageCachePercentage);
                     _thermometerWidgets["IconCache"]->setPercentage(iconCachePercentage);
                     _thermometerWidgets["GlyphCache"]->setPercentage(glyphCachePercentage);
+                    _thermometerWidgets["ImageDataPool"]->setPercentage(dataPoolFreePercentage);
 
                     {
                         std::stringstream ss;
@@ -325,6 +338,18 @@ namespace djv
                         ss << std::fixed << iconCachePercentage << "%";
                         _textBlocks["IconCache"]->setText(ss.str());
                     }
+                    {
+                        std::stringstream ss;
+                        ss << _getText(DJV_TEXT("debug_general_image_data_pool")) << ": ";
+                        ss.precision(2);
+                        ss << std::fixed << dataPoolFreePercentage << "% ";
+                        ss << _getText(DJV_TEXT("debug_general_image_data_pool_free")) << ", ";
+                        ss << dataPool->getUsedByteCount() / Memory::megabyte << "MB ";
+                        ss << _getText(DJV_TEXT("debug_general_image_data_pool_used")) << ", ";
+                        ss << dataPool->getReuseCount() << "/" << dataPool->getAllocationCount() << " ";
+                        ss << _getText(DJV_TEXT("debug_general_image_data_pool_reused"));
+                        _textBlocks["ImageDataPool"]->setText(ss.str());
+                    }
                 }
             }
 
@@ -44,6 +44,14 @@ namespace djv
 {
     namespace ViewApp
     {
+        namespace
+        {
+            //! \todo Should these be configurable?
+            const float cachePriorityCurrent = 1.F;
+            const float cachePriorityDefault = .1F;
+
+        } // namespace
+
         struct FileSystem::Private
         {
             Private(FileSystem& p) :
@@ -332,8 +340,12 @@ namespace djv
             auto ioSettings = settingsSystem->getSettingsT<UIComponents::Settings::IO>();
             p.threadCountObserver = Observer::Value<size_t>::create(
                 ioSettings->observeThreadCount(),
-                [weak](size_t value)
+                [weak, contextWeak](size_t value)
                 {
+                    if (auto context = contextWeak.lock())
+                    {
+                        context->getSystemT<AV::IO::IOSystem>()->setThreadCount(value);
+                    }
                     if (auto system = weak.lock())
                     {
                         system->_p->threadCount = value;
@@ -349,24 +361,15 @@ namespace djv
             p.cacheTimer->setRepeating(true);
             p.cacheTimer->start(
                 System::getTimerDuration(System::TimerValue::Medium),
-                [weak](const std::chrono::steady_clock::time_point&, const Time::Duration&)
+                [weak, contextWeak](const std::chrono::steady_clock::time_point&, const Time::Duration&)
                 {
-                    if (auto system = weak.lock())
+                    if (auto context = contextWeak.lock())
                     {
-                        size_t cacheMaxByteCount  = 0;
-                        size_t cacheByteCount = 0;
-                        for (const auto& i : system->_p->media->get())
+                        if (auto system = weak.lock())
                         {
-                            if (i->hasCache())
-                            {
-                                cacheMaxByteCount  += i->getCacheMaxByteCount();
-                                cacheByteCount += i->getCacheByteCount();
-                            }
+                            auto io = context->getSystemT<AV::IO::IOSystem>();
+                            system->_p->cachePercentage->setIfChanged(io->getFrameCache()->getPercentageUsed());
                         }
-                        const float percentage = cacheMaxByteCount ?
-                            (cacheByteCount / static_cast<float>(cacheMaxByteCount) * 100.F) :
-                            0.F;
-                        system->_p->cachePercentage->setIfChanged(percentage);
                     }
                 });
 
@@ -576,6 +579,7 @@ namespace djv
             if (p.currentMedia->setIfChanged(media))
             {
                 _actionsUpdate();
+                _cacheUpdate();
             }
         }
 
@@ -664,22 +668,24 @@ namespace djv
         void FileSystem::_cacheUpdate()
         {
             DJV_PRIVATE_PTR();
-            size_t cacheCount = 0;
-            const auto& media = p.media->get();
-            for (const auto& i : media)
-            {
-                if (i->hasCache())
-                {
-                    ++cacheCount;
-                }
-            }
             const bool cacheEnabled = p.settings->observeCacheEnabled()->get();
             const size_t cacheMaxByteCount = p.settings->observeCacheSize()->get() * Memory::gigabyte;
-            const size_t mediaCacheSizeByteCount = cacheCount > 0 ? (cacheMaxByteCount / cacheCount) : 0;
-            for (const auto& i : media)
+            if (auto context = getContext().lock())
+            {
+                auto io = context->getSystemT<AV::IO::IOSystem>();
+                io->getFrameCache()->setMaxByteCount(cacheMaxByteCount);
+            }
+
+            // The current media reads ahead into the whole cache, the other
+            // media keep the frames they have already read until the memory
+            // is needed.
+            const auto currentMedia = p.currentMedia->get();
+            for (const auto& i : p.media->get())
             {
+                const bool current = i == currentMedia;
                 i->setCacheEnabled(cacheEnabled);
-                i->setCacheMaxByteCount(mediaCacheSizeByteCount);
+                i->setCacheMaxByteCount(current ? cacheMaxByteCount : 0);
+                i->setCachePriority(current ? cachePriorityCurrent : cachePriorityDefault);
             }
         }
 
@@ -4,21 +4,341 @@
 
 #include <djvViewApp/HistogramWidget.h>
 
+#include <djvViewApp/Media.h>
+#include <djvViewApp/MediaWidget.h>
+#include <djvViewApp/WindowSystem.h>
+
+#include <djvUI/Action.h>
+#include <djvUI/ComboBox.h>
+#include <djvUI/GridLayout.h>
+#include <djvUI/Label.h>
+#include <djvUI/Menu.h>
+#include <djvUI/PopupMenu.h>
+#include <djvUI/RowLayout.h>
+
+#include <djvRender2D/Render.h>
+
+#include <djvImage/Data.h>
+#include <djvImage/Stats.h>
+
+#include <djvSystem/Context.h>
+
+#include <djvCore/Cache.h>
+
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <iomanip>
+#include <sstream>
+
 using namespace djv::Core;
 
 namespace djv
 {
     namespace ViewApp
     {
+        namespace
+        {
+            //! \todo Should this be configurable?
+            const size_t statsCacheMax = 100;
+
+            const std::vector<size_t> binCounts = { 64, 128, 256, 512, 1024 };
+
+            const size_t binCountDefault = 256;
+
+            const size_t channelCountMax = 4;
+
+            class HistogramGraph : public UI::Widget
+            {
+                DJV_NON_COPYABLE(HistogramGraph);
+
+            protected:
+                void _init(const std::shared_ptr<System::Context>&);
+                HistogramGraph();
+
+            public:
+                ~HistogramGraph() override;
+
+                static std::shared_ptr<HistogramGraph> create(const std::shared_ptr<System::Context>&);
+
+                void setStats(const Image::Stats&);
+                void setLogScale(bool);
+
+            protected:
+                void _preLayoutEvent(System::Event::PreLayout&) override;
+                void _paintEvent(System::Event::Paint&) override;
+
+            private:
+                Image::Stats _stats;
+                bool _logScale = false;
+            };
+
+            void HistogramGraph::_init(const std::shared_ptr<System::Context>& context)
+            {
+                Widget::_init(context);
+                setClassName("djv::ViewApp::HistogramGraph");
+                setBackgroundColorRole(UI::ColorRole::Trough);
+            }
+
+            HistogramGraph::HistogramGraph()
+            {}
+
+            HistogramGraph::~HistogramGraph()
+            {}
+
+            std::shared_ptr<HistogramGraph> HistogramGraph::create(const std::shared_ptr<System::Context>& context)
+            {
+                auto out = std::shared_ptr<HistogramGraph>(new HistogramGraph);
+                out->_init(context);
+                return out;
+            }
+
+            void HistogramGraph::setStats(const Image::Stats& value)
+            {
+                if (value == _stats)
+                    return;
+                _stats = value;
+                _redraw();
+            }
+
+            void HistogramGraph::setLogScale(bool value)
+            {
+                if (value == _logScale)
+                    return;
+                _logScale = value;
+                _redraw();
+            }
+
+            void HistogramGraph::_preLayoutEvent(System::Event::PreLayout&)
+            {
+                const auto& style = _getStyle();
+                const float sw = style->getMetric(UI::MetricsRole::Swatch);
+                _setMinimumSize(glm::vec2(sw * 2.F, sw));
+            }
+
+            void HistogramGraph::_paintEvent(System::Event::Paint& event)
+            {
+                Widget::_paintEvent(event);
+                if (!_stats.isValid())
+                    return;
+
+                const auto& style = _getStyle();
+                const Math::BBox2f& g = getMargin().bbox(getGeometry(), style);
+                const size_t histogramMax = _stats.getHistogramMax();
+                if (0 == histogramMax)
+                    return;
+                const float scale = _logScale ?
+                    1.F / std::log1p(static_cast<float>(histogramMax)) :
+                    1.F / static_cast<float>(histogramMax);
+                const float binWidth = g.w() / static_cast<float>(_stats.binCount);
+
+                // Draw the color channels red, green, and blue, luminance
+                // channels with the foreground color, and alpha channels
+                // dimmed.
+                const auto& render = _getRender();
+                const bool alpha = 2 == _stats.channelCount || 4 == _stats.channelCount;
+                for (uint8_t c = 0; c < _stats.channelCount; ++c)
+                {
+                    Image::Color color;
+                    if (alpha && _stats.channelCount - 1 == c)
+                    {
+                        color = style->getColor(UI::ColorRole::ForegroundDim);
+                    }
+                    else if (_stats.channelCount < 3)
+                    {
+                        color = style->getColor(UI::ColorRole::Foreground);
+                    }
+                    else
+                    {
+                        color = Image::Color(0 == c ? 1.F : 0.F, 1 == c ? 1.F : 0.F, 2 == c ? 1.F : 0.F);
+                    }
+                    color = color.convert(Image::Type::RGBA_F32);
+                    render->setFillColor(Image::Color(
+                        color.getF32(0),
+                        color.getF32(1),
+                        color.getF32(2),
+                        .5F));
+
+                    std::vector<Math::BBox2f> rects;
+                    rects.reserve(_stats.binCount);
+                    const auto& histogram = _stats.histogram[c];
+                    for (size_t i = 0; i < _stats.binCount; ++i)
+                    {
+                        if (histogram[i])
+                        {
+                            const float v = _logScale ?
+                                std::log1p(static_cast<float>(histogram[i])) * scale :
+                                histogram[i] * scale;
+                            const float h = std::ceil(v * g.h());
+                            rects.push_back(Math::BBox2f(
+                                g.min.x + floorf(i * binWidth),
+                                g.max.y - h,
+                                std::max(ceilf(binWidth), 1.F),
+                                h));
+                        }
+                    }
+                    render->drawRects(rects);
+                }
+            }
+
+        } // namespace
+
         struct HistogramWidget::Private
         {
+            std::shared_ptr<Image::Data> image;
+            Image::Stats stats;
+            size_t binCount = binCountDefault;
+            bool logScale = false;
+            Memory::Cache<UID, Image::Stats> statsCache;
+            std::future<Image::Stats> statsFuture;
+            UID statsUID = 0;
+
+            std::map<std::string, std::shared_ptr<UI::Action> > actions;
+            std::shared_ptr<HistogramGraph> graph;
+            std::vector<std::shared_ptr<UI::Text::Label> > headerLabels;
+            std::vector<std::shared_ptr<UI::Text::Label> > channelLabels;
+            std::vector<std::vector<std::shared_ptr<UI::Text::Label> > > valueLabels;
+            std::shared_ptr<UI::ComboBox> binCountComboBox;
+            std::shared_ptr<UI::Menu> settingsMenu;
+            std::shared_ptr<UI::PopupMenu> settingsPopupMenu;
+            std::shared_ptr<UI::VerticalLayout> layout;
 
+            std::map<std::string, std::shared_ptr<Observer::Value<bool> > > actionObservers;
+            std::shared_ptr<Observer::Value<std::shared_ptr<MediaWidget> > > activeWidgetObserver;
+            std::shared_ptr<Observer::Value<std::shared_ptr<Image::Data> > > imageObserver;
         };
 
         void HistogramWidget::_init(const std::shared_ptr<System::Context>& context)
         {
             Widget::_init(context);
+
+            DJV_PRIVATE_PTR();
             setClassName("djv::ViewApp::HistogramWidget");
+
+            p.statsCache.setMax(statsCacheMax);
+
+            p.actions["LogScale"] = UI::Action::create();
+            p.actions["LogScale"]->setButtonType(UI::ButtonType::Toggle);
+
+            p.graph = HistogramGraph::create(context);
+
+            auto gridLayout = UI::GridLayout::create(context);
+            gridLayout->setSpacing(UI::MetricsRole::SpacingSmall);
+            gridLayout->setMargin(UI::MetricsRole::MarginSmall);
+            for (size_t i = 0; i < 4; ++i)
+            {
+                auto label = UI::Text::Label::create(context);
+                label->setTextHAlign(UI::TextHAlign::Right);
+                p.headerLabels.push_back(label);
+                gridLayout->addChild(label);
+                gridLayout->setGridPos(label, static_cast<int>(i) + 1, 0);
+            }
+            p.valueLabels.resize(channelCountMax);
+            for (size_t c = 0; c < channelCountMax; ++c)
+            {
+                auto label = UI::Text::Label::create(context);
+                label->setTextHAlign(UI::TextHAlign::Left);
+                p.channelLabels.push_back(label);
+                gridLayout->addChild(label);
+                gridLayout->setGridPos(label, 0, static_cast<int>(c) + 1);
+                for (size_t i = 0; i < 4; ++i)
+                {
+                    auto valueLabel = UI::Text::Label::create(context);
+                    valueLabel->setFontFamily(Render2D::Font::familyMono);
+                    valueLabel->setTextHAlign(UI::TextHAlign::Right);
+                    p.valueLabels[c].push_back(valueLabel);
+                    gridLayout->addChild(valueLabel);
+                    gridLayout->setGridPos(valueLabel, static_cast<int>(i) + 1, static_cast<int>(c) + 1, UI::GridStretch::Horizontal);
+                }
+            }
+
+            p.binCountComboBox = UI::ComboBox::create(context);
+            std::vector<std::string> items;
+            for (const auto i : binCounts)
+            {
+                items.push_back(std::to_string(i));
+            }
+            p.binCountComboBox->setItems(items);
+
+            p.settingsMenu = UI::Menu::create(context);
+            p.settingsMenu->setIcon("djvIconSettings");
+            p.settingsMenu->setMinimumSizeRole(UI::MetricsRole::None);
+            p.settingsMenu->addAction(p.actions["LogScale"]);
+            p.settingsPopupMenu = UI::PopupMenu::create(context);
+            p.settingsPopupMenu->setMenu(p.settingsMenu);
+
+            p.layout = UI::VerticalLayout::create(context);
+            p.layout->setSpacing(UI::MetricsRole::None);
+            p.layout->setBackgroundColorRole(UI::ColorRole::Background);
+            p.layout->addChild(p.graph);
+            p.layout->setStretch(p.graph);
+            p.layout->addChild(gridLayout);
+            auto hLayout = UI::HorizontalLayout::create(context);
+            hLayout->setSpacing(UI::MetricsRole::None);
+            hLayout->addChild(p.binCountComboBox);
+            hLayout->addExpander();
+            hLayout->addChild(p.settingsPopupMenu);
+            p.layout->addChild(hLayout);
+            addChild(p.layout);
+
+            _widgetUpdate();
+
+            auto weak = std::weak_ptr<HistogramWidget>(std::dynamic_pointer_cast<HistogramWidget>(shared_from_this()));
+            p.binCountComboBox->setCallback(
+                [weak](int value)
+                {
+                    if (auto widget = weak.lock())
+                    {
+                        if (value >= 0 && value < static_cast<int>(binCounts.size()))
+                        {
+                            widget->_p->binCount = binCounts[value];
+                            widget->_p->statsCache.clear();
+                            widget->_statsUpdate();
+                        }
+                    }
+                });
+
+            p.actionObservers["LogScale"] = Observer::Value<bool>::create(
+                p.actions["LogScale"]->observeChecked(),
+                [weak](bool value)
+                {
+                    if (auto widget = weak.lock())
+                    {
+                        widget->_p->logScale = value;
+                        widget->_widgetUpdate();
+                    }
+                });
+
+            if (auto windowSystem = context->getSystemT<WindowSystem>())
+            {
+                p.activeWidgetObserver = Observer::Value<std::shared_ptr<MediaWidget> >::create(
+                    windowSystem->observeActiveWidget(),
+                    [weak](const std::shared_ptr<MediaWidget>& value)
+                    {
+                        if (auto widget = weak.lock())
+                        {
+                            if (value)
+                            {
+                                widget->_p->imageObserver = Observer::Value<std::shared_ptr<Image::Data> >::create(
+                                    value->getMedia()->observeCurrentImage(),
+                                    [weak](const std::shared_ptr<Image::Data>& value)
+                                    {
+                                        if (auto widget = weak.lock())
+                                        {
+                                            widget->_p->image = value;
+                                            widget->_statsUpdate();
+                                        }
+                                    });
+                            }
+                            else
+                            {
+                                widget->_p->image.reset();
+                                widget->_p->imageObserver.reset();
+                                widget->_statsUpdate();
+                            }
+                        }
+                    });
+            }
         }
 
         HistogramWidget::HistogramWidget() :
@@ -26,7 +346,13 @@ namespace djv
         {}
 
         HistogramWidget::~HistogramWidget()
-        {}
+        {
+            DJV_PRIVATE_PTR();
+            if (p.statsFuture.valid())
+            {
+                p.statsFuture.wait();
+            }
+        }
 
         std::shared_ptr<HistogramWidget> HistogramWidget::create(const std::shared_ptr<System::Context>& context)
         {
@@ -35,14 +361,136 @@ namespace djv
             return out;
         }
 
+        void HistogramWidget::_preLayoutEvent(System::Event::PreLayout&)
+        {
+            _setMinimumSize(_p->layout->getMinimumSize());
+        }
+
+        void HistogramWidget::_layoutEvent(System::Event::Layout&)
+        {
+            _p->layout->setGeometry(getGeometry());
+        }
+
         void HistogramWidget::_initEvent(System::Event::Init & event)
         {
             Widget::_initEvent(event);
+            DJV_PRIVATE_PTR();
             if (event.getData().text)
             {
+                p.actions["LogScale"]->setText(_getText(DJV_TEXT("widget_histogram_log_scale")));
+                p.actions["LogScale"]->setTooltip(_getText(DJV_TEXT("widget_histogram_log_scale_tooltip")));
+
+                p.headerLabels[0]->setText(_getText(DJV_TEXT("widget_histogram_min")));
+                p.headerLabels[1]->setText(_getText(DJV_TEXT("widget_histogram_max")));
+                p.headerLabels[2]->setText(_getText(DJV_TEXT("widget_histogram_mean")));
+                p.headerLabels[3]->setText(_getText(DJV_TEXT("widget_histogram_std_dev")));
+
+                p.binCountComboBox->setTooltip(_getText(DJV_TEXT("widget_histogram_bins_tooltip")));
+                p.settingsPopupMenu->setTooltip(_getText(DJV_TEXT("widget_histogram_settings_tooltip")));
+            }
+        }
+
+        void HistogramWidget::_updateEvent(System::Event::Update&)
+        {
+            DJV_PRIVATE_PTR();
+            if (p.statsFuture.valid() &&
+                p.statsFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+            {
+                try
+                {
+                    const auto stats = p.statsFuture.get();
+                    if (stats.binCount == p.binCount)
+                    {
+                        p.statsCache.add(p.statsUID, stats);
+                    }
+                }
+                catch (const std::exception& e)
+                {
+                    _log(e.what(), System::LogLevel::Error);
+                }
+                p.statsUID = 0;
+
+                // Start on the latest image if it changed in the meantime.
+                _statsUpdate();
+            }
+        }
+
+        void HistogramWidget::_statsUpdate()
+        {
+            DJV_PRIVATE_PTR();
+            if (p.image && p.image->isValid())
+            {
+                const UID uid = p.image->getUID();
+                Image::Stats stats;
+                if (p.statsCache.get(uid, stats))
+                {
+                    p.stats = stats;
+                    _widgetUpdate();
+                }
+                else if (!p.statsFuture.valid())
+                {
+                    // Only one image is processed at a time so that the
+                    // statistics never fall behind playback.
+                    p.statsUID = uid;
+                    const auto image = p.image;
+                    const size_t binCount = p.binCount;
+                    p.statsFuture = std::async(
+                        std::launch::async,
+                        [image, binCount]
+                        {
+                            return Image::getStats(*image, binCount);
+                        });
+                }
+            }
+            else
+            {
+                p.stats = Image::Stats();
+                _widgetUpdate();
+            }
+        }
+
+        void HistogramWidget::_widgetUpdate()
+        {
+            DJV_PRIVATE_PTR();
+
+            p.actions["LogScale"]->setChecked(p.logScale);
+
+            const auto i = std::find(binCounts.begin(), binCounts.end(), p.binCount);
+            p.binCountComboBox->setCurrentItem(i != binCounts.end() ? static_cast<int>(i - binCounts.begin()) : -1);
+
+            p.graph->setStats(p.stats);
+            p.graph->setLogScale(p.logScale);
+
+            std::vector<std::string> channelNames;
+            switch (p.stats.channelCount)
+            {
+            case 1: channelNames = { "L" }; break;
+            case 2: channelNames = { "L", "A" }; break;
+            case 3: channelNames = { "R", "G", "B" }; break;
+            case 4: channelNames = { "R", "G", "B", "A" }; break;
+            default: break;
+            }
+            for (size_t c = 0; c < channelCountMax; ++c)
+            {
+                const bool visible = c < p.stats.channelCount;
+                p.channelLabels[c]->setVisible(visible);
+                for (const auto& j : p.valueLabels[c])
+                {
+                    j->setVisible(visible);
+                }
+                if (visible)
+                {
+                    p.channelLabels[c]->setText(channelNames[c]);
+                    const float values[] = { p.stats.min[c], p.stats.max[c], p.stats.mean[c], p.stats.stdDev[c] };
+                    for (size_t j = 0; j < 4; ++j)
+                    {
+                        std::stringstream ss;
+                        ss << std::fixed << std::setprecision(4) << values[j];
+                        p.valueLabels[c][j]->setText(ss.str());
+                    }
+                }
             }
         }
 
     } // namespace ViewApp
 } // namespace djv
-
@@ -11,6 +11,11 @@ namespace djv
     namespace ViewApp
     {
         //! Histogram widget.
+        //!
+        //! The statistics are computed in the background for the current
+        //! image of the active media, and cached by the image UID. Images
+        //! that arrive while the statistics are being computed are skipped
+        //! except for the latest one, so playback is never blocked.
         class HistogramWidget : public UI::Widget
         {
             DJV_NON_COPYABLE(HistogramWidget);
@@ -25,9 +30,16 @@ namespace djv
             static std::shared_ptr<HistogramWidget> create(const std::shared_ptr<System::Context>&);
 
         protected:
+            void _preLayoutEvent(System::Event::PreLayout&) override;
+            void _layoutEvent(System::Event::Layout&) override;
+
             void _initEvent(System::Event::Init &) override;
+            void _updateEvent(System::Event::Update&) override;
 
         private:
+            void _statsUpdate();
+            void _widgetUpdate();
+
             DJV_PRIVATE();
         };
 
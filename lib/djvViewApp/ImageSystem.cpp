@@ -6,6 +6,7 @@
 
 #include <djvViewApp/ColorSpaceWidget.h>
 #include <djvViewApp/FileSystem.h>
+#include <djvViewApp/HistogramWidget.h>
 #include <djvViewApp/ImageControlsWidget.h>
 #include <djvViewApp/ImageData.h>
 #include <djvViewApp/ImageSettings.h>
@@ -55,6 +56,7 @@ namespace djv
             std::shared_ptr<UI::Menu> menu;
             std::shared_ptr<ImageControlsWidget> imageControlsWidget;
             std::shared_ptr<ColorSpaceWidget> colorSpaceWidget;
+            std::shared_ptr<HistogramWidget> histogramWidget;
 
             std::shared_ptr<Observer::Value<std::shared_ptr<Media> > > currentMediaObserver;
             std::shared_ptr<Observer::Value<std::shared_ptr<Image::Data> > > currentImageObserver;
@@ -80,6 +82,7 @@ namespace djv
             p.actions["ColorSpace"] = UI::Action::create();
             p.actions["ColorSpace"]->setButtonType(UI::ButtonType::Toggle);
             p.actions["ColorSpace"]->setIcon("djvIconColor");
+            p.actions["Histogram"] = UI::Action::create();
             p.actions["RedChannel"] = UI::Action::create();
             p.actions["GreenChannel"] = UI::Action::create();
             p.actions["BlueChannel"] = UI::Action::create();
@@ -119,6 +122,7 @@ namespace djv
 
             _addShortcut(DJV_TEXT("shortcut_image_controls"), GLFW_KEY_B, UI::getSystemModifier());
             _addShortcut(DJV_TEXT("shortcut_image_color_space"), GLFW_KEY_P, UI::getSystemModifier());
+            _addShortcut(DJV_TEXT("shortcut_image_histogram"), 0);
             _addShortcut(DJV_TEXT("shortcut_image_red_channel"), GLFW_KEY_R);
             _addShortcut(DJV_TEXT("shortcut_image_green_channel"), GLFW_KEY_G);
             _addShortcut(DJV_TEXT("shortcut_image_blue_channel"), GLFW_KEY_B);
@@ -376,7 +380,8 @@ namespace djv
             return
             {
                 p.actions["ImageControls"],
-                p.actions["ColorSpace"]
+                p.actions["ColorSpace"],
+                p.actions["Histogram"]
             };
         }
 
@@ -415,6 +420,16 @@ namespace djv
                     widget->setBellowsState(p.colorSpaceBellowsState);
                     p.colorSpaceWidget = widget;
 
+                    out.titleBar = titleBar;
+                    out.widget = widget;
+                }
+                else if (value == p.actions["Histogram"])
+                {
+                    auto titleBar = ToolTitleBar::create(DJV_TEXT("widget_histogram_title"), context);
+
+                    auto widget = HistogramWidget::create(context);
+                    p.histogramWidget = widget;
+
                     out.titleBar = titleBar;
                     out.widget = widget;
                 }
@@ -441,6 +456,10 @@ namespace djv
                     p.colorSpaceWidget.reset();
                 }
             }
+            else if (value == p.actions["Histogram"])
+            {
+                p.histogramWidget.reset();
+            }
         }
 
         void ImageSystem::_textUpdate()
@@ -452,6 +471,8 @@ namespace djv
                 p.actions["ImageControls"]->setTooltip(_getText(DJV_TEXT("menu_image_controls_widget_tooltip")));
                 p.actions["ColorSpace"]->setText(_getText(DJV_TEXT("menu_image_color_space")));
                 p.actions["ColorSpace"]->setTooltip(_getText(DJV_TEXT("menu_image_color_space_widget_tooltip")));
+                p.actions["Histogram"]->setText(_getText(DJV_TEXT("menu_image_histogram")));
+                p.actions["Histogram"]->setTooltip(_getText(DJV_TEXT("menu_image_histogram_tooltip")));
                 p.actions["RedChannel"]->setText(_getText(DJV_TEXT("menu_image_red_channel")));
                 p.actions["RedChannel"]->setTextBrief(_getText(DJV_TEXT("button_image_red_channel")));
                 p.actions["RedChannel"]->setTooltip(_getText(DJV_TEXT("menu_image_red_channel_tooltip")));
@@ -494,6 +515,7 @@ namespace djv
             {
                 p.actions["ImageControls"]->setShortcuts(_getShortcuts("shortcut_image_controls"));
                 p.actions["ColorSpace"]->setShortcuts(_getShortcuts("shortcut_image_color_space"));
+                p.actions["Histogram"]->setShortcuts(_getShortcuts("shortcut_image_histogram"));
                 p.actions["RedChannel"]->setShortcuts(_getShortcuts("shortcut_image_red_channel"));
                 p.actions["GreenChannel"]->setShortcuts(_getShortcuts("shortcut_image_green_channel"));
                 p.actions["BlueChannel"]->setShortcuts(_getShortcuts("shortcut_image_blue_channel"));
@@ -63,6 +63,7 @@ namespace djv
 
             private:
                 std::shared_ptr<Image::Data> _image;
+                glm::vec2 _imageScale = glm::vec2(1.F, 1.F);
                 glm::vec2 _imagePos = glm::vec2(0.F, 0.F);
                 float _imageZoom = 0.F;
                 ImageData _imageData;
@@ -98,13 +99,18 @@ namespace djv
                             {
                                 if (value)
                                 {
+                                    auto mediaWeak = std::weak_ptr<Media>(value->getMedia());
                                     widget->_imageObserver = Observer::Value<std::shared_ptr<Image::Data> >::create(
                                         value->getMedia()->observeCurrentImage(),
-                                        [weak](const std::shared_ptr<Image::Data>& value)
+                                        [weak, mediaWeak](const std::shared_ptr<Image::Data>& value)
                                         {
                                             if (auto widget = weak.lock())
                                             {
                                                 widget->_image = value;
+                                                if (auto media = mediaWeak.lock())
+                                                {
+                                                    widget->_imageScale = media->getImageScale(value);
+                                                }
                                                 widget->_redraw();
                                             }
                                         });
@@ -272,7 +278,7 @@ namespace djv
                     glm::mat3x3 m(1.F);
                     m = glm::translate(m, glm::vec2(g.w() / 2.F, g.h() / 2.F) - glm::vec2(_magnifyPos.x * magnify, _magnifyPos.y * magnify));
                     m = glm::translate(m, g.min + glm::vec2(_imagePos.x * magnify, _imagePos.y * magnify));
-                    m *= UI::ImageWidget::getXForm(_image, _imageData.rotate, glm::vec2(_imageZoom * magnify, _imageZoom * magnify), _imageData.aspectRatio);
+                    m *= UI::ImageWidget::getXForm(_image, _imageData.rotate, _imageScale * _imageZoom * magnify, _imageData.aspectRatio);
                     render->pushTransform(m);
                     Render2D::ImageOptions options;
                     options.channelsDisplay = _imageData.channelsDisplay;
@@ -37,6 +37,9 @@ namespace djv
             const size_t audioBufferFrameCount = 256;
             const size_t videoQueueSize        = 10;
             const size_t realSpeedFrameCount   = 30;
+
+            //! \todo Should this be configurable?
+            const uint32_t tileImageSize = 8192;
             
         } // namespace
 
@@ -60,6 +63,7 @@ namespace djv
             std::shared_ptr<Observer::ValueSubject<Math::Frame::Sequence> > sequence;
             std::shared_ptr<Observer::ValueSubject<Math::Frame::Index> > currentFrame;
             std::shared_ptr<Observer::ValueSubject<std::shared_ptr<Image::Data> > > currentImage;
+            std::shared_ptr<Observer::ValueSubject<bool> > tiles;
             std::shared_ptr<Observer::ValueSubject<Playback> > playback;
             std::shared_ptr<Observer::ValueSubject<PlaybackMode> > playbackMode;
             std::shared_ptr<Observer::ValueSubject<AV::IO::InOutPoints> > inOutPoints;
@@ -71,6 +75,7 @@ namespace djv
             std::shared_ptr<Observer::ValueSubject<Math::Frame::Sequence> > cachedFrames;
             bool cacheEnabled = false;
             size_t cacheMaxByteCount = 0;
+            float cachePriority = 1.F;
             std::shared_ptr<Observer::ListSubject<std::shared_ptr<AnnotatePrimitive> > > annotations;
             std::shared_ptr<Command::UndoStack> undoStack;
 
@@ -119,6 +124,7 @@ namespace djv
             p.sequence = Observer::ValueSubject<Math::Frame::Sequence>::create();
             p.currentFrame = Observer::ValueSubject<Math::Frame::Index>::create(Math::Frame::invalid);
             p.currentImage = Observer::ValueSubject<std::shared_ptr<Image::Data> >::create();
+            p.tiles = Observer::ValueSubject<bool>::create(false);
             p.playback = Observer::ValueSubject<Playback>::create(Playback::First);
             p.playbackMode = Observer::ValueSubject<PlaybackMode>::create(PlaybackMode::First);
             p.inOutPoints = Observer::ValueSubject<AV::IO::InOutPoints>::create();
@@ -238,9 +244,28 @@ namespace djv
         void Media::setLayer(int value)
         {
             DJV_PRIVATE_PTR();
+            const int prevLayer = p.layers->get().second;
             if (p.layers->setIfChanged(std::make_pair(p.info->get().video, value)))
             {
-                _open();
+                if (p.read && p.read->canChangeLayer())
+                {
+                    // Change the layer without opening the file again, and
+                    // keep the previous layer in the cache so that switching
+                    // back is fast. Only the previous layer is kept since
+                    // every cached layer is read for each frame and shares
+                    // the cache memory.
+                    p.read->setLayer(value);
+                    p.read->setCacheLayers({ static_cast<size_t>(prevLayer), static_cast<size_t>(value) });
+                    _tilesUpdate();
+                    if (Playback::Stop == p.playback->get())
+                    {
+                        _seek(p.currentFrame->get());
+                    }
+                }
+                else
+                {
+                    _open();
+                }
             }
         }
 
@@ -279,6 +304,50 @@ namespace djv
             return _p->currentImage;
         }
 
+        bool Media::canReadTiles() const
+        {
+            DJV_PRIVATE_PTR();
+            return p.read ? p.read->canReadTiles() : false;
+        }
+
+        std::future<std::shared_ptr<Image::Data> > Media::readTile(const AV::IO::Tile& tile)
+        {
+            DJV_PRIVATE_PTR();
+            if (p.read)
+            {
+                return p.read->readTile(tile);
+            }
+            std::promise<std::shared_ptr<Image::Data> > promise;
+            promise.set_value(nullptr);
+            return promise.get_future();
+        }
+
+        std::shared_ptr<Observer::IValueSubject<bool> > Media::observeTiles() const
+        {
+            return _p->tiles;
+        }
+
+        glm::vec2 Media::getImageScale(const std::shared_ptr<Image::Data>& image) const
+        {
+            DJV_PRIVATE_PTR();
+            glm::vec2 out(1.F, 1.F);
+            const auto& layers = p.layers->get();
+            if (image &&
+                image->isValid() &&
+                canReadTiles() &&
+                layers.second >= 0 &&
+                layers.second < static_cast<int>(layers.first.size()))
+            {
+                const Image::Size& size = layers.first[layers.second].size;
+                if (size.isValid())
+                {
+                    out.x = size.w / static_cast<float>(image->getWidth());
+                    out.y = size.h / static_cast<float>(image->getHeight());
+                }
+            }
+            return out;
+        }
+
         std::shared_ptr<Observer::IValueSubject<Math::IntRational> > Media::observeSpeed() const
         {
             return _p->speed;
@@ -676,6 +745,16 @@ namespace djv
                 p.read->setCacheMaxByteCount(p.cacheMaxByteCount);
             }
         }
+
+        void Media::setCachePriority(float value)
+        {
+            DJV_PRIVATE_PTR();
+            p.cachePriority = value;
+            if (p.read)
+            {
+                p.read->setCachePriority(p.cachePriority);
+            }
+        }
             
         std::shared_ptr<Core::Observer::IListSubject<std::shared_ptr<AnnotatePrimitive> > > Media::observeAnnotations() const
         {
@@ -785,11 +864,13 @@ namespace djv
                     p.read->setLoop(true);
                     p.read->setCacheEnabled(p.cacheEnabled);
                     p.read->setCacheMaxByteCount(p.cacheMaxByteCount);
+                    p.read->setCachePriority(p.cachePriority);
 
                     const auto info = p.read->getInfo().get();
                     p.info->setIfChanged(info);
                     const int currentLayer = Math::clamp(p.layers->get().second, 0, static_cast<int>(info.video.size()) - 1);
                     p.layers->setIfChanged(std::make_pair(info.video, currentLayer));
+                    _tilesUpdate();
                     Math::IntRational speed = info.videoSpeed;
                     Math::Frame::Sequence sequence = info.videoSequence;
                     p.audioInfo = info.audio;
@@ -1035,6 +1116,7 @@ namespace djv
                     {
                         p.read->setPlayback(false);
                     }
+                    _tilesUpdate();
                     _stopAudioStream();
                     p.playbackTimer->stop();
                     _seek(p.currentFrame->get());
@@ -1047,6 +1129,7 @@ namespace djv
                     {
                         p.read->setPlayback(true);
                     }
+                    _tilesUpdate();
                     p.ioDirection = forward ? AV::IO::Direction::Forward : AV::IO::Direction::Reverse;
                     _seek(p.currentFrame->get());
                     p.audioData.reset();
@@ -1177,6 +1260,29 @@ namespace djv
             }
         }
 
+        void Media::_tilesUpdate()
+        {
+            DJV_PRIVATE_PTR();
+            // Large images are read as tiles when playback is stopped, so
+            // that only the visible parts of them are read.
+            bool tiles = false;
+            const auto& layers = p.layers->get();
+            if (p.read &&
+                p.read->canReadTiles() &&
+                Playback::Stop == p.playback->get() &&
+                layers.second >= 0 &&
+                layers.second < static_cast<int>(layers.first.size()))
+            {
+                const Image::Size& size = layers.first[layers.second].size;
+                tiles = size.w > tileImageSize || size.h > tileImageSize;
+            }
+            if (p.read)
+            {
+                p.read->setTilesEnabled(tiles);
+            }
+            p.tiles->setIfChanged(tiles);
+        }
+
         void Media::_queueUpdate()
         {
             DJV_PRIVATE_PTR();
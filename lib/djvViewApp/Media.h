@@ -7,6 +7,7 @@
 #include <djvViewApp/Enum.h>
 
 #include <djvAV/IO.h>
+#include <djvAV/TileCache.h>
 
 #include <djvCore/ListObserver.h>
 #include <djvCore/ValueObserver.h>
@@ -96,6 +97,27 @@ namespace djv
 
             ///@}
 
+            //! \name Tiles
+            ///@{
+
+            //! Get whether regions of the images can be read as tiles.
+            bool canReadTiles() const;
+
+            //! Read a tile of the current layer in the background.
+            std::future<std::shared_ptr<Image::Data> > readTile(const AV::IO::Tile&);
+
+            //! Observe whether the images are read as tiles. When enabled the
+            //! current image is the last mip level of the image, which is
+            //! drawn as a placeholder until the tiles are read.
+            std::shared_ptr<Core::Observer::IValueSubject<bool> > observeTiles() const;
+
+            //! Get the scale from an image to the full resolution image of
+            //! the current layer. The scale is not one when the image is a
+            //! placeholder.
+            glm::vec2 getImageScale(const std::shared_ptr<Image::Data>&) const;
+
+            ///@}
+
             //! \name Playback
             ///@{
 
@@ -164,6 +186,7 @@ namespace djv
 
             void setCacheEnabled(bool);
             void setCacheMaxByteCount(size_t);
+            void setCachePriority(float);
 
             ///@}
 
@@ -210,6 +233,7 @@ namespace djv
             void _seek(Math::Frame::Index);
             void _playbackUpdate();
             void _playbackTick();
+            void _tilesUpdate();
             void _startAudioStream();
             void _stopAudioStream();
             void _queueUpdate();
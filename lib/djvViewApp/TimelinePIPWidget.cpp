@@ -198,6 +198,8 @@ namespace djv
                         AV::IO::ReadOptions options;
                         options.videoQueueSize = 1;
                         options.audioQueueSize = 0;
+                        const uint16_t size = static_cast<uint16_t>(_getStyle()->getMetric(UI::MetricsRole::TextColumn));
+                        options.preferredSize = Image::Size(size, size);
                         p.read = io->read(value, options);
                         const auto info = p.read->getInfo().get();
                         p.speed = info.videoSpeed;
@@ -43,6 +43,35 @@ namespace djv
         {
             //! \todo Should this be configurable?
             const size_t zoomAnimation = 200;
+
+            //! Get the rectangle of a tile in the coordinates of the full
+            //! resolution image.
+            Math::BBox2f getTileRect(
+                const AV::IO::Tile& tile,
+                const Image::Size& size,
+                const Image::Size& levelSize,
+                const Image::Mirror& mirror)
+            {
+                const Math::BBox2i window = AV::IO::getTileWindow(tile, levelSize);
+                const float sx = size.w / static_cast<float>(levelSize.w);
+                const float sy = size.h / static_cast<float>(levelSize.h);
+                Math::BBox2f out(
+                    glm::vec2(window.min.x * sx, window.min.y * sy),
+                    glm::vec2((window.max.x + 1) * sx, (window.max.y + 1) * sy));
+                if (mirror.x)
+                {
+                    out = Math::BBox2f(
+                        glm::vec2(size.w - out.max.x, out.min.y),
+                        glm::vec2(size.w - out.min.x, out.max.y));
+                }
+                if (mirror.y)
+                {
+                    out = Math::BBox2f(
+                        glm::vec2(out.min.x, size.h - out.max.y),
+                        glm::vec2(out.max.x, size.h - out.min.y));
+                }
+                return out;
+            }
             
         } // namespace
 
@@ -65,6 +94,11 @@ namespace djv
             Math::Frame::Sequence sequence;
             Math::Frame::Index currentFrame = Math::Frame::invalidIndex;
             std::vector<std::shared_ptr<AnnotatePrimitive> > annotations;
+            bool tilesEnabled = false;
+            uint8_t tileLevel = 0;
+            std::vector<AV::IO::Tile> visibleTiles;
+            std::map<AV::IO::Tile, std::future<std::shared_ptr<Image::Data> > > tileFutures;
+            std::map<AV::IO::Tile, std::shared_ptr<Image::Data> > tiles;
             glm::vec2 pressedImagePos = glm::vec2(0.F, 0.F);
             bool viewInit = true;
 
@@ -84,6 +118,7 @@ namespace djv
             std::shared_ptr<Observer::Value<float> > realSpeedObserver;
             std::shared_ptr<Observer::Value<Math::Frame::Sequence> > sequenceObserver;
             std::shared_ptr<Observer::Value<Math::Frame::Index> > currentFrameObserver;
+            std::shared_ptr<Observer::Value<bool> > tilesObserver;
             std::shared_ptr<Observer::List<std::shared_ptr<AnnotatePrimitive> > > annotationsObserver;
 
             std::shared_ptr<System::Animation::Animation> zoomAnimation;
@@ -211,7 +246,10 @@ namespace djv
                 {
                     if (auto widget = weak.lock())
                     {
+                        widget->_p->tileFutures.clear();
+                        widget->_p->tiles.clear();
                         widget->_hudUpdate();
+                        widget->_resize();
                     }
                 });
             p.speedObserver = Observer::Value<Math::IntRational>::create(
@@ -254,6 +292,16 @@ namespace djv
                         widget->_hudUpdate();
                     }
                 });
+            p.tilesObserver = Observer::Value<bool>::create(
+                p.media->observeTiles(),
+                [weak](bool value)
+                {
+                    if (auto widget = weak.lock())
+                    {
+                        widget->_p->tilesEnabled = value;
+                        widget->_resize();
+                    }
+                });
             p.annotationsObserver = Observer::List<std::shared_ptr<AnnotatePrimitive> >::create(
                 p.media->observeAnnotations(),
                 [weak](const std::vector<std::shared_ptr<AnnotatePrimitive> >& value)
@@ -424,6 +472,7 @@ namespace djv
             const Math::BBox2f& g = getGeometry();
             p.layout->setGeometry(g);
             p.gridOverlay->setImageBBox(getImageBBox());
+            _tilesUpdate();
         }
 
         void ViewWidget::_paintEvent(System::Event::Paint &)
@@ -470,8 +519,7 @@ namespace djv
             {
                 glm::mat3x3 m(1.F);
                 m = glm::translate(m, g.min + p.imagePos->get());
-                m *= UI::ImageWidget::getXForm(image, p.imageData.rotate, glm::vec2(zoom, zoom), p.imageData.aspectRatio);
-                render->pushTransform(m);
+                m *= _getImageXForm(glm::vec2(zoom, zoom));
                 render->setFillColor(Image::Color(1.F, 1.F, 1.F));
                 Render2D::ImageOptions options;
                 options.channelsDisplay = p.imageData.channelsDisplay;
@@ -500,8 +548,39 @@ namespace djv
                 options.softClipEnabled = p.imageData.softClipEnabled;
                 options.softClip = p.imageData.softClip;
                 options.cache = Render2D::ImageCache::Dynamic;
-                render->drawImage(image, glm::vec2(0.F, 0.F), options);
-                render->popTransform();
+
+                // The image is only drawn when some of the visible tiles are
+                // not available yet. When tiles are enabled the image is a
+                // lower mip level that is scaled to the full resolution.
+                std::vector<std::pair<Math::BBox2f, std::shared_ptr<Image::Data> > > tiles;
+                const Image::Size size = _getImageSize();
+                const Image::Size levelSize = AV::IO::getLevelSize(size, p.tileLevel);
+                for (const auto& tile : p.visibleTiles)
+                {
+                    const auto j = p.tiles.find(tile);
+                    if (j != p.tiles.end() && j->second)
+                    {
+                        tiles.push_back(std::make_pair(getTileRect(tile, size, levelSize, p.imageData.mirror), j->second));
+                    }
+                }
+                if (tiles.size() < p.visibleTiles.size() || p.visibleTiles.empty())
+                {
+                    render->pushTransform(glm::scale(m, p.media->getImageScale(image)));
+                    render->drawImage(image, glm::vec2(0.F, 0.F), options);
+                    render->popTransform();
+                }
+                options.cache = Render2D::ImageCache::Tile;
+                for (const auto& tile : tiles)
+                {
+                    const Image::Size& tileSize = tile.second->getSize();
+                    glm::mat3x3 tileM = glm::translate(m, tile.first.min);
+                    tileM = glm::scale(tileM, glm::vec2(
+                        tile.first.w() / static_cast<float>(tileSize.w),
+                        tile.first.h() / static_cast<float>(tileSize.h)));
+                    render->pushTransform(tileM);
+                    render->drawImage(tile.second, glm::vec2(0.F, 0.F), options);
+                    render->popTransform();
+                }
             }
 
             // Draw the annotations.
@@ -520,13 +599,48 @@ namespace djv
             }
         }
 
+        void ViewWidget::_updateEvent(System::Event::Update&)
+        {
+            DJV_PRIVATE_PTR();
+            bool redraw = false;
+            auto i = p.tileFutures.begin();
+            while (i != p.tileFutures.end())
+            {
+                if (i->second.valid() &&
+                    i->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+                {
+                    // Null tiles are kept so that they are not requested
+                    // again, the full image is drawn instead.
+                    try
+                    {
+                        p.tiles[i->first] = i->second.get();
+                        redraw = true;
+                    }
+                    catch (const std::exception& e)
+                    {
+                        p.tiles[i->first] = nullptr;
+                        _log(e.what(), System::LogLevel::Error);
+                    }
+                    i = p.tileFutures.erase(i);
+                }
+                else
+                {
+                    ++i;
+                }
+            }
+            if (redraw)
+            {
+                _redraw();
+            }
+        }
+
         std::vector<glm::vec3> ViewWidget::_getImagePoints(bool posAndZoom) const
         {
             DJV_PRIVATE_PTR();
             std::vector<glm::vec3> out;
-            if (auto image = p.image->get())
+            if (p.image->get())
             {
-                const Image::Size& size = image->getSize();
+                const Image::Size size = _getImageSize();
                 out.resize(4);
                 out[0].x = 0.F;
                 out[0].y = 0.F;
@@ -548,11 +662,7 @@ namespace djv
                     m = glm::translate(m, g.min + p.imagePos->get());
                 }
                 const float zoom = p.imageZoom->get();
-                m *= UI::ImageWidget::getXForm(
-                    image,
-                    p.imageData.rotate,
-                    posAndZoom ? glm::vec2(zoom, zoom) : glm::vec2(1.F, 1.F),
-                    p.imageData.aspectRatio);
+                m *= _getImageXForm(posAndZoom ? glm::vec2(zoom, zoom) : glm::vec2(1.F, 1.F));
                 for (auto& i : out)
                 {
                     i = m * i;
@@ -561,6 +671,32 @@ namespace djv
             return out;
         }
 
+        Image::Size ViewWidget::_getImageSize() const
+        {
+            DJV_PRIVATE_PTR();
+            Image::Size out;
+            if (auto image = p.image->get())
+            {
+                const glm::vec2 scale = p.media->getImageScale(image);
+                out.w = static_cast<uint32_t>(roundf(image->getWidth() * scale.x));
+                out.h = static_cast<uint32_t>(roundf(image->getHeight() * scale.y));
+            }
+            return out;
+        }
+
+        glm::mat3x3 ViewWidget::_getImageXForm(const glm::vec2& zoom) const
+        {
+            DJV_PRIVATE_PTR();
+            auto image = p.image->get();
+            const glm::vec2 scale = p.media->getImageScale(image);
+            const glm::mat3x3 m = UI::ImageWidget::getXForm(
+                image,
+                p.imageData.rotate,
+                zoom * scale,
+                p.imageData.aspectRatio);
+            return glm::scale(m, glm::vec2(1.F / scale.x, 1.F / scale.y));
+        }
+
         glm::vec2 ViewWidget::_getCenter(const std::vector<glm::vec3>& value)
         {
             glm::vec2 out(0.F, 0.F);
@@ -654,6 +790,71 @@ namespace djv
             _resize();
         }
 
+        void ViewWidget::_tilesUpdate()
+        {
+            DJV_PRIVATE_PTR();
+            p.visibleTiles.clear();
+            if (p.image->get() && p.tilesEnabled)
+            {
+                // Find the mip level closest to the zoom.
+                const Image::Size size = _getImageSize();
+                const float zoom = p.imageZoom->get();
+                const uint8_t levelCount = AV::IO::getLevelCount(size);
+                p.tileLevel = 0;
+                while (p.tileLevel + 1 < levelCount && zoom * static_cast<float>(1 << (p.tileLevel + 1)) <= 1.F)
+                {
+                    ++p.tileLevel;
+                }
+
+                // Find the visible tiles.
+                const auto& style = _getStyle();
+                const Math::BBox2f& g = getMargin().bbox(getGeometry(), style);
+                glm::mat3x3 m(1.F);
+                m = glm::translate(m, g.min + p.imagePos->get());
+                m *= _getImageXForm(glm::vec2(zoom, zoom));
+                const Image::Size levelSize = AV::IO::getLevelSize(size, p.tileLevel);
+                uint32_t tileCountX = 0;
+                uint32_t tileCountY = 0;
+                AV::IO::getTileCount(levelSize, tileCountX, tileCountY);
+                for (uint32_t y = 0; y < tileCountY; ++y)
+                {
+                    for (uint32_t x = 0; x < tileCountX; ++x)
+                    {
+                        const AV::IO::Tile tile(p.currentFrame, p.tileLevel, x, y);
+                        const Math::BBox2f rect = getTileRect(tile, size, levelSize, p.imageData.mirror);
+                        const std::vector<glm::vec3> points =
+                        {
+                            m * glm::vec3(rect.min.x, rect.min.y, 1.F),
+                            m * glm::vec3(rect.max.x, rect.min.y, 1.F),
+                            m * glm::vec3(rect.max.x, rect.max.y, 1.F),
+                            m * glm::vec3(rect.min.x, rect.max.y, 1.F)
+                        };
+                        if (_getBBox(points).intersects(g))
+                        {
+                            p.visibleTiles.push_back(tile);
+                        }
+                    }
+                }
+            }
+
+            // Request the visible tiles and remove the others.
+            std::map<AV::IO::Tile, std::future<std::shared_ptr<Image::Data> > > tileFutures;
+            std::map<AV::IO::Tile, std::shared_ptr<Image::Data> > tiles;
+            for (const auto& tile : p.visibleTiles)
+            {
+                const auto i = p.tiles.find(tile);
+                if (i != p.tiles.end())
+                {
+                    tiles[tile] = i->second;
+                    continue;
+                }
+                const auto j = p.tileFutures.find(tile);
+                tileFutures[tile] = j != p.tileFutures.end() ? std::move(j->second) : p.media->readTile(tile);
+            }
+            p.tileFutures = std::move(tileFutures);
+            p.tiles = std::move(tiles);
+        }
+
         void ViewWidget::_hudUpdate()
         {
             DJV_PRIVATE_PTR();
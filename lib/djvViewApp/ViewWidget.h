@@ -21,6 +21,10 @@ namespace djv
         class Media;
 
         //! Image view widget.
+        //!
+        //! Large images are drawn with tiles when the media supports it.
+        //! Only the tiles that are visible are requested, from the mip
+        //! level that is closest to the current zoom.
         class ViewWidget : public UI::Widget
         {
             DJV_NON_COPYABLE(ViewWidget);
@@ -71,8 +75,12 @@ namespace djv
             void _layoutEvent(System::Event::Layout&) override;
             void _paintEvent(System::Event::Paint &) override;
 
+            void _updateEvent(System::Event::Update&) override;
+
         private:
             std::vector<glm::vec3> _getImagePoints(bool posAndZoom = false) const;
+            Image::Size _getImageSize() const;
+            glm::mat3x3 _getImageXForm(const glm::vec2& zoom) const;
             static glm::vec2 _getCenter(const std::vector<glm::vec3>&);
             static Math::BBox2f _getBBox(const std::vector<glm::vec3>&);
 
@@ -81,6 +89,7 @@ namespace djv
 
             void _gridUpdate();
             void _hudUpdate();
+            void _tilesUpdate();
 
             DJV_PRIVATE();
         };
@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvCore/Cache.h>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+using namespace djv;
+
+// Measure the time per add() and get() as the cache grows, to show that
+// they stay flat regardless of the number of entries.
+
+const size_t cacheMax = 1000000;
+const size_t opCount = 100000;
+
+int main()
+{
+    Core::Memory::Cache<size_t, size_t> cache;
+    std::mt19937 rng;
+
+    std::cout << std::setw(12) << "entries" <<
+        std::setw(16) << "add (ns/op)" <<
+        std::setw(16) << "get (ns/op)" << std::endl;
+    size_t key = 0;
+    for (size_t size = 1000; size <= cacheMax; size *= 10)
+    {
+        // Fill the cache to the given size.
+        cache.setMax(size);
+        while (cache.getSize() < size)
+        {
+            cache.add(key, key);
+            ++key;
+        }
+
+        // Add new entries, each one evicting the least recently used entry.
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < opCount; ++i)
+        {
+            cache.add(key, key);
+            ++key;
+        }
+        auto end = std::chrono::steady_clock::now();
+        const double addTime = std::chrono::duration<double, std::nano>(end - start).count() / opCount;
+
+        // Look up random entries.
+        std::uniform_int_distribution<size_t> dist(key - size, key - 1);
+        size_t value = 0;
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < opCount; ++i)
+        {
+            cache.get(dist(rng), value);
+        }
+        end = std::chrono::steady_clock::now();
+        const double getTime = std::chrono::duration<double, std::nano>(end - start).count() / opCount;
+
+        std::cout << std::setw(12) << size <<
+            std::setw(16) << std::fixed << std::setprecision(1) << addTime <<
+            std::setw(16) << getTime << std::endl;
+    }
+    std::cout << "Hits: " << cache.getHitCount() << std::endl;
+    std::cout << "Misses: " << cache.getMissCount() << std::endl;
+    std::cout << "Evictions: " << cache.getEvictionCount() << std::endl;
+    return 0;
+}
@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvImage/Convert.h>
+#include <djvImage/Data.h>
+
+#include <djvCore/Error.h>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+using namespace djv;
+
+// Convert an image between every pair of image types and print the
+// throughput in megapixels per second. Planar YUV types are only used as the
+// input.
+//
+// Usage: ConvertBenchmark [-size (width) (height)] [-threads (value)]
+
+namespace
+{
+    //! \todo Should this be configurable?
+    const size_t repeatCount = 5;
+
+    std::string getLabel(Image::Type value)
+    {
+        std::stringstream ss;
+        ss << value;
+        std::string out = ss.str();
+        const std::string prefix = "image_type_";
+        if (0 == out.find(prefix))
+        {
+            out = out.substr(prefix.size());
+        }
+        return out;
+    }
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    int r = 1;
+    try
+    {
+        Image::Size size(1920, 1080);
+        size_t threadCount = 0;
+        for (int i = 1; i < argc; ++i)
+        {
+            if (std::string("-size") == argv[i] && i < argc - 2)
+            {
+                size.w = std::stoi(argv[++i]);
+                size.h = std::stoi(argv[++i]);
+            }
+            else if (std::string("-threads") == argv[i] && i < argc - 1)
+            {
+                threadCount = std::stoi(argv[++i]);
+            }
+            else
+            {
+                throw std::runtime_error("Usage: ConvertBenchmark [-size (width) (height)] [-threads (value)]");
+            }
+        }
+
+        auto convert = Image::Convert::create(threadCount);
+        std::cout << "Size: " << size << std::endl;
+        std::cout << "Threads: " << convert->getThreadCount() << std::endl;
+        std::cout << std::setw(16) << "input" <<
+            std::setw(16) << "output" <<
+            std::setw(16) << "time (ms)" <<
+            std::setw(16) << "MPixels/s" << std::endl;
+        for (auto inType : Image::getTypeEnums())
+        {
+            if (Image::Type::None == inType)
+            {
+                continue;
+            }
+            const Image::Info inInfo(size, inType);
+            auto in = Image::Data::create(inInfo);
+            uint8_t* p = in->getData();
+            for (size_t i = 0; i < inInfo.getDataByteCount(); ++i)
+            {
+                p[i] = static_cast<uint8_t>(i);
+            }
+            if (Image::isFloatType(inType))
+            {
+                // Use valid floating point values.
+                const Image::Info info(size, Image::Type::RGBA_U8);
+                auto tmp = Image::Data::create(info);
+                memcpy(tmp->getData(), p, std::min(info.getDataByteCount(), inInfo.getDataByteCount()));
+                convert->process(*tmp, inInfo, *in);
+            }
+            for (auto outType : Image::getTypeEnums())
+            {
+                if (Image::Type::None == outType || Image::isYUVType(outType))
+                {
+                    continue;
+                }
+                const Image::Info outInfo(size, outType);
+                auto out = Image::Data::create(outInfo);
+                convert->process(*in, outInfo, *out);
+                const auto start = std::chrono::steady_clock::now();
+                for (size_t i = 0; i < repeatCount; ++i)
+                {
+                    convert->process(*in, outInfo, *out);
+                }
+                const std::chrono::duration<double> delta = std::chrono::steady_clock::now() - start;
+                const double seconds = delta.count() / repeatCount;
+                std::cout << std::setw(16) << getLabel(inType) <<
+                    std::setw(16) << getLabel(outType) << std::fixed << std::setprecision(3) <<
+                    std::setw(16) << seconds * 1000.0 << std::setprecision(1) <<
+                    std::setw(16) << size.w * size.h / seconds / 1000000.0 << std::endl;
+            }
+        }
+        r = 0;
+    }
+    catch (const std::exception& e)
+    {
+        std::cout << Core::Error::format(e) << std::endl;
+    }
+    return r;
+}
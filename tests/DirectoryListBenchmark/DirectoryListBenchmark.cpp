@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvSystem/FileIO.h>
+#include <djvSystem/FileInfo.h>
+
+#include <djvCore/Error.h>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+using namespace djv;
+
+// Generate a directory of empty files split into a few image sequences and
+// some other files, then list it with and without sequence grouping and print
+// the time and the number of items. The files are only generated the first
+// time, so remove the directory after changing the number of files.
+//
+// Usage: DirectoryListBenchmark (directory) [-files (value)]
+
+namespace
+{
+    //! \todo Should this be configurable?
+    const size_t sequenceCount = 5;
+    const size_t repeatCount = 3;
+
+    void generate(const System::File::Path& path, size_t fileCount)
+    {
+        System::File::mkdir(path);
+        auto io = System::File::IO::create();
+        for (size_t i = 0; i < fileCount; ++i)
+        {
+            // Every hundredth file is not part of a sequence.
+            std::stringstream ss;
+            if (i % 100 != 0)
+            {
+                ss << "render" << (i * sequenceCount / fileCount) << "." <<
+                    std::setfill('0') << std::setw(7) << (i - i / 100) << ".exr";
+            }
+            else
+            {
+                ss << "file" << i << ".txt";
+            }
+            io->open(System::File::Path(path, ss.str()).get(), System::File::Mode::Write);
+        }
+        io->close();
+    }
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    int r = 1;
+    try
+    {
+        std::string directory;
+        size_t fileCount = 500000;
+        for (int i = 1; i < argc; ++i)
+        {
+            if (std::string("-files") == argv[i] && i < argc - 1)
+            {
+                fileCount = std::stoi(argv[++i]);
+            }
+            else
+            {
+                directory = argv[i];
+            }
+        }
+        if (directory.empty())
+        {
+            throw std::runtime_error("Usage: DirectoryListBenchmark (directory) [-files (value)]");
+        }
+
+        const System::File::Path path(directory, "DirectoryListBenchmark");
+        if (!System::File::Info(path).doesExist())
+        {
+            std::cout << "Generating " << fileCount << " files..." << std::endl;
+            generate(path, fileCount);
+        }
+
+        std::cout << std::setw(12) << "sequences" <<
+            std::setw(16) << "items" <<
+            std::setw(16) << "time (s)" <<
+            std::setw(16) << "time (us/file)" << std::endl;
+        for (const bool sequences : { false, true })
+        {
+            System::File::DirectoryListOptions options;
+            options.sequences = sequences;
+            options.sequenceExtensions.insert(".exr");
+            size_t items = 0;
+            double seconds = 0.0;
+            for (size_t i = 0; i < repeatCount; ++i)
+            {
+                const auto start = std::chrono::steady_clock::now();
+                items = System::File::directoryList(path, options).size();
+                const std::chrono::duration<double> delta = std::chrono::steady_clock::now() - start;
+                seconds += delta.count();
+            }
+            seconds /= repeatCount;
+            std::cout << std::setw(12) << (sequences ? "on" : "off") <<
+                std::setw(16) << items << std::fixed << std::setprecision(3) <<
+                std::setw(16) << seconds <<
+                std::setw(16) << seconds / fileCount * 1000000.0 << std::endl;
+        }
+        r = 0;
+    }
+    catch (const std::exception& e)
+    {
+        std::cout << Core::Error::format(e) << std::endl;
+    }
+    return r;
+}
@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvCmdLineApp/Application.h>
+
+#include <djvAV/FFmpeg.h>
+#include <djvAV/IOSystem.h>
+
+#include <djvSystem/FileInfo.h>
+
+#include <djvCore/Error.h>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+using namespace djv;
+
+// Decode a movie as fast as possible with each of the FFmpeg thread types,
+// and print the number of frames decoded per second.
+//
+// Usage: FFmpegBenchmark (input) [-threads (value)]
+
+class Application : public CmdLine::Application
+{
+    DJV_NON_COPYABLE(Application);
+
+protected:
+    void _init(std::list<std::string>&);
+
+    Application();
+
+public:
+    static std::shared_ptr<Application> create(std::list<std::string>&);
+
+    void run() override;
+
+private:
+    std::string _input;
+    size_t _threadCount = 0;
+};
+
+void Application::_init(std::list<std::string>& args)
+{
+    CmdLine::Application::_init(args);
+
+    _threadCount = std::thread::hardware_concurrency();
+    auto i = args.begin();
+    while (i != args.end())
+    {
+        if ("-threads" == *i)
+        {
+            i = args.erase(i);
+            if (i != args.end())
+            {
+                _threadCount = std::stoi(*i);
+                i = args.erase(i);
+            }
+        }
+        else
+        {
+            ++i;
+        }
+    }
+    if (args.size() != 1)
+    {
+        throw std::runtime_error("Usage: FFmpegBenchmark (input) [-threads (value)]");
+    }
+    _input = args.front();
+    _threadCount = std::max(_threadCount, static_cast<size_t>(1));
+}
+
+Application::Application()
+{}
+
+std::shared_ptr<Application> Application::create(std::list<std::string>& args)
+{
+    auto out = std::shared_ptr<Application>(new Application);
+    out->_init(args);
+    return out;
+}
+
+void Application::run()
+{
+    auto io = getSystemT<AV::IO::IOSystem>();
+    std::cout << "Input: " << _input << std::endl;
+    std::cout << "Threads: " << _threadCount << std::endl;
+    std::cout << std::setw(20) << "thread type" <<
+        std::setw(12) << "frames" <<
+        std::setw(12) << "seconds" <<
+        std::setw(12) << "fps" << std::endl;
+    for (auto threadType : AV::FFmpeg::getThreadTypeEnums())
+    {
+        AV::FFmpeg::Options options;
+        options.threadCount = _threadCount;
+        options.threadType = threadType;
+        {
+            rapidjson::Document document;
+            io->setOptions(AV::FFmpeg::pluginName, toJSON(options, document.GetAllocator()));
+        }
+
+        AV::IO::ReadOptions readOptions;
+        readOptions.videoQueueSize = _threadCount * 2;
+        auto read = io->read(System::File::Info(_input), readOptions);
+        read->getInfo().get();
+
+        // Pull the frames from the reader until it reaches the end of the
+        // file. The audio frames are discarded.
+        size_t frameCount = 0;
+        const auto start = std::chrono::steady_clock::now();
+        while (true)
+        {
+            bool finished = false;
+            {
+                std::lock_guard<std::mutex> lock(read->getMutex());
+                auto& videoQueue = read->getVideoQueue();
+                while (!videoQueue.isEmpty())
+                {
+                    if (videoQueue.popFrame().data)
+                    {
+                        ++frameCount;
+                    }
+                }
+                read->getAudioQueue().clearFrames();
+                finished = videoQueue.isFinished();
+            }
+            if (finished)
+            {
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        const std::chrono::duration<double> delta = std::chrono::steady_clock::now() - start;
+        const double seconds = delta.count();
+
+        std::stringstream ss;
+        ss << threadType;
+        std::cout << std::setw(20) << ss.str() <<
+            std::setw(12) << frameCount <<
+            std::setw(12) << std::fixed << std::setprecision(2) << seconds <<
+            std::setw(12) << (seconds > 0.0 ? frameCount / seconds : 0.0) << std::endl;
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    int r = 1;
+    try
+    {
+        auto args = Application::args(argc, argv);
+        auto app = Application::create(args);
+        app->run();
+        r = app->getExitCode();
+    }
+    catch (const std::exception & e)
+    {
+        std::cout << Core::Error::format(e) << std::endl;
+    }
+    return r;
+}
@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVTest/HeadlessTest.h>
+
+#include <djvAV/AVSystem.h>
+
+#include <djvSystem/Context.h>
+#include <djvSystem/FileInfo.h>
+
+#include <djvCore/Error.h>
+#include <djvCore/OS.h>
+
+#include <iostream>
+
+using namespace djv;
+using namespace djv::Core;
+
+int main(int argc, char ** argv)
+{
+    int r = 0;
+    try
+    {
+        // Disable OpenGL before any of the systems are created.
+        OS::setEnv("DJV_GL_DISABLE", "1");
+        auto context = System::Context::create(argv[0]);
+        auto avSystem = AV::AVSystem::create(context);
+
+        const System::File::Path tempPath(System::File::getTemp(), "djvHeadlessTest");
+        std::cout << "Temp path: " << tempPath.get() << std::endl;
+
+        AVTest::HeadlessTest(tempPath, context).run();
+    }
+    catch (const std::exception & error)
+    {
+        std::cout << Error::format(error) << std::endl;
+        DJV_ASSERT(false);
+    }
+    return r;
+}
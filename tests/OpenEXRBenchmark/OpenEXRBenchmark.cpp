@@ -0,0 +1,257 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvCmdLineApp/Application.h>
+
+#include <djvAV/IOSystem.h>
+#include <djvAV/OpenEXR.h>
+
+#include <djvSystem/FileInfo.h>
+
+#include <djvCore/Error.h>
+
+#include <ImfChannelList.h>
+#include <ImfFrameBuffer.h>
+#include <ImfHeader.h>
+#include <ImfOutputFile.h>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+using namespace djv;
+
+// Write full frame, cropped, and overscan OpenEXR sequences, then read them
+// with each OpenEXR thread count and print the number of frames read per
+// second. The cropped sequence has a data window inside of the display
+// window, and the overscan sequence has a data window larger than the
+// display window.
+//
+// Usage: OpenEXRBenchmark (directory) [-threads (value)] [-frames (value)]
+
+class Application : public CmdLine::Application
+{
+    DJV_NON_COPYABLE(Application);
+
+protected:
+    void _init(std::list<std::string>&);
+
+    Application();
+
+public:
+    static std::shared_ptr<Application> create(std::list<std::string>&);
+
+    void run() override;
+
+private:
+    void _write(const System::File::Info&, const Imath::Box2i& dataWindow);
+    double _read(const System::File::Info&);
+
+    std::string _directory;
+    size_t _threadCount = 0;
+    size_t _frameCount = 24;
+};
+
+void Application::_init(std::list<std::string>& args)
+{
+    CmdLine::Application::_init(args);
+
+    _threadCount = std::thread::hardware_concurrency();
+    auto i = args.begin();
+    while (i != args.end())
+    {
+        if ("-threads" == *i)
+        {
+            i = args.erase(i);
+            if (i != args.end())
+            {
+                _threadCount = std::stoi(*i);
+                i = args.erase(i);
+            }
+        }
+        else if ("-frames" == *i)
+        {
+            i = args.erase(i);
+            if (i != args.end())
+            {
+                _frameCount = std::stoi(*i);
+                i = args.erase(i);
+            }
+        }
+        else
+        {
+            ++i;
+        }
+    }
+    if (args.size() != 1)
+    {
+        throw std::runtime_error("Usage: OpenEXRBenchmark (directory) [-threads (value)] [-frames (value)]");
+    }
+    _directory = args.front();
+    _threadCount = std::max(_threadCount, static_cast<size_t>(1));
+    _frameCount = std::max(_frameCount, static_cast<size_t>(1));
+}
+
+Application::Application()
+{}
+
+std::shared_ptr<Application> Application::create(std::list<std::string>& args)
+{
+    auto out = std::shared_ptr<Application>(new Application);
+    out->_init(args);
+    return out;
+}
+
+namespace
+{
+    const int width  = 1920;
+    const int height = 1080;
+
+} // namespace
+
+void Application::run()
+{
+    struct Test
+    {
+        std::string name;
+        Imath::Box2i dataWindow;
+    };
+    const std::vector<Test> tests =
+    {
+        { "full", Imath::Box2i(Imath::V2i(0, 0), Imath::V2i(width - 1, height - 1)) },
+        { "cropped", Imath::Box2i(Imath::V2i(width / 4, height / 4), Imath::V2i(width * 3 / 4 - 1, height * 3 / 4 - 1)) },
+        { "overscan", Imath::Box2i(Imath::V2i(-width / 20, -height / 20), Imath::V2i(width * 21 / 20 - 1, height * 21 / 20 - 1)) }
+    };
+    std::vector<System::File::Info> fileInfos;
+    for (const auto& test : tests)
+    {
+        const System::File::Info fileInfo(
+            System::File::Path(_directory, "OpenEXRBenchmark_" + test.name + ".1.exr"),
+            System::File::Type::Sequence,
+            Math::Frame::Sequence(1, _frameCount),
+            false);
+        std::cout << "Writing: " << fileInfo << std::endl;
+        _write(fileInfo, test.dataWindow);
+        fileInfos.push_back(fileInfo);
+    }
+
+    std::cout << std::setw(12) << "threads";
+    for (const auto& test : tests)
+    {
+        std::cout << std::setw(12) << test.name;
+    }
+    std::cout << std::endl;
+    for (size_t threadCount = 1; threadCount <= _threadCount; threadCount *= 2)
+    {
+        std::cout << std::setw(12) << threadCount;
+        for (const auto& fileInfo : fileInfos)
+        {
+            AV::OpenEXR::Options options;
+            options.threadCount = threadCount;
+            {
+                rapidjson::Document document;
+                auto io = getSystemT<AV::IO::IOSystem>();
+                io->setOptions(AV::OpenEXR::pluginName, toJSON(options, document.GetAllocator()));
+            }
+            const double seconds = _read(fileInfo);
+            std::cout << std::setw(12) << std::fixed << std::setprecision(2) <<
+                (seconds > 0.0 ? _frameCount / seconds : 0.0);
+        }
+        std::cout << std::endl;
+    }
+}
+
+void Application::_write(const System::File::Info& fileInfo, const Imath::Box2i& dataWindow)
+{
+    Imf::Header header(
+        Imath::Box2i(Imath::V2i(0, 0), Imath::V2i(width - 1, height - 1)),
+        dataWindow);
+    const char* channels[] = { "R", "G", "B", "A" };
+    for (const auto& i : channels)
+    {
+        header.channels().insert(i, Imf::Channel(Imf::HALF));
+    }
+    const int w = dataWindow.max.x - dataWindow.min.x + 1;
+    const int h = dataWindow.max.y - dataWindow.min.y + 1;
+    std::vector<float> data(w * h * 4);
+    for (int y = 0; y < h; ++y)
+    {
+        for (int x = 0; x < w; ++x)
+        {
+            float* p = data.data() + (y * w + x) * 4;
+            p[0] = x / static_cast<float>(w);
+            p[1] = y / static_cast<float>(h);
+            p[2] = 0.F;
+            p[3] = 1.F;
+        }
+    }
+    Imf::FrameBuffer frameBuffer;
+    for (size_t c = 0; c < 4; ++c)
+    {
+        frameBuffer.insert(
+            channels[c],
+            Imf::Slice(
+                Imf::FLOAT,
+                reinterpret_cast<char*>(data.data() - (dataWindow.min.x + dataWindow.min.y * w) * 4 + c),
+                sizeof(float) * 4,
+                sizeof(float) * 4 * w));
+    }
+    const auto& sequence = fileInfo.getSequence();
+    for (size_t i = 0; i < sequence.getFrameCount(); ++i)
+    {
+        const Math::Frame::Number frame = sequence.getFrame(i);
+        Imf::OutputFile f(fileInfo.getFileName(frame).c_str(), header);
+        f.setFrameBuffer(frameBuffer);
+        f.writePixels(h);
+    }
+}
+
+double Application::_read(const System::File::Info& fileInfo)
+{
+    auto io = getSystemT<AV::IO::IOSystem>();
+    auto read = io->read(fileInfo);
+    read->getInfo().get();
+
+    // Pull the frames from the reader until it reaches the end of the
+    // sequence.
+    const auto start = std::chrono::steady_clock::now();
+    while (true)
+    {
+        bool finished = false;
+        {
+            std::lock_guard<std::mutex> lock(read->getMutex());
+            auto& videoQueue = read->getVideoQueue();
+            while (!videoQueue.isEmpty())
+            {
+                videoQueue.popFrame();
+            }
+            finished = videoQueue.isFinished();
+        }
+        if (finished)
+        {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    const std::chrono::duration<double> delta = std::chrono::steady_clock::now() - start;
+    return delta.count();
+}
+
+int main(int argc, char ** argv)
+{
+    int r = 1;
+    try
+    {
+        auto args = Application::args(argc, argv);
+        auto app = Application::create(args);
+        app->run();
+        r = app->getExitCode();
+    }
+    catch (const std::exception & e)
+    {
+        std::cout << Core::Error::format(e) << std::endl;
+    }
+    return r;
+}
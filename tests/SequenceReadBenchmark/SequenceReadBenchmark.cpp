@@ -0,0 +1,258 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvCmdLineApp/Application.h>
+
+#include <djvAV/IOSystem.h>
+
+#include <djvSystem/FileInfo.h>
+#include <djvSystem/Timer.h>
+
+#include <djvCore/Error.h>
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+using namespace djv;
+
+// Write small DPX, Cineon, and JPEG sequences, then read them with and
+// without the sequence header template and print the time and the number of
+// read system calls per frame. Small images are used so that the cost of
+// opening the files and parsing the headers is not hidden by the pixel data.
+//
+// The system calls are only counted on Linux.
+//
+// Usage: SequenceReadBenchmark (directory) [-frames (value)] [-size (value)]
+
+class Application : public CmdLine::Application
+{
+    DJV_NON_COPYABLE(Application);
+
+protected:
+    void _init(std::list<std::string>&);
+
+    Application();
+
+public:
+    static std::shared_ptr<Application> create(std::list<std::string>&);
+
+    void run() override;
+
+private:
+    bool _write(const System::File::Info&, const Image::Info&);
+    void _read(const System::File::Info&, bool headerTemplate, double& seconds, size_t& syscalls);
+
+    std::string _directory;
+    size_t _frameCount = 100;
+    uint16_t _size = 64;
+};
+
+void Application::_init(std::list<std::string>& args)
+{
+    CmdLine::Application::_init(args);
+
+    auto i = args.begin();
+    while (i != args.end())
+    {
+        if ("-frames" == *i)
+        {
+            i = args.erase(i);
+            if (i != args.end())
+            {
+                _frameCount = std::stoi(*i);
+                i = args.erase(i);
+            }
+        }
+        else if ("-size" == *i)
+        {
+            i = args.erase(i);
+            if (i != args.end())
+            {
+                _size = std::stoi(*i);
+                i = args.erase(i);
+            }
+        }
+        else
+        {
+            ++i;
+        }
+    }
+    if (args.size() != 1)
+    {
+        throw std::runtime_error("Usage: SequenceReadBenchmark (directory) [-frames (value)] [-size (value)]");
+    }
+    _directory = args.front();
+    _frameCount = std::max(_frameCount, static_cast<size_t>(1));
+    _size = std::max(_size, static_cast<uint16_t>(1));
+}
+
+Application::Application()
+{}
+
+std::shared_ptr<Application> Application::create(std::list<std::string>& args)
+{
+    auto out = std::shared_ptr<Application>(new Application);
+    out->_init(args);
+    return out;
+}
+
+namespace
+{
+    size_t getReadSyscalls()
+    {
+        size_t out = 0;
+#if defined(DJV_PLATFORM_LINUX)
+        std::ifstream f("/proc/self/io");
+        std::string key;
+        size_t value = 0;
+        while (f >> key >> value)
+        {
+            if ("syscr:" == key)
+            {
+                out = value;
+                break;
+            }
+        }
+#endif // DJV_PLATFORM_LINUX
+        return out;
+    }
+
+} // namespace
+
+void Application::run()
+{
+    struct Test
+    {
+        std::string extension;
+        Image::Type type;
+    };
+    const std::vector<Test> tests =
+    {
+        { ".dpx", Image::Type::RGB_U10 },
+        { ".cin", Image::Type::RGB_U10 },
+        { ".jpg", Image::Type::RGB_U8 }
+    };
+
+    std::cout << std::setw(12) << "format" <<
+        std::setw(16) << "full (us)" <<
+        std::setw(16) << "template (us)" <<
+        std::setw(16) << "full (calls)" <<
+        std::setw(16) << "template (calls)" << std::endl;
+    for (const auto& test : tests)
+    {
+        const System::File::Info fileInfo(
+            System::File::Path(_directory, "SequenceReadBenchmark.1" + test.extension),
+            System::File::Type::Sequence,
+            Math::Frame::Sequence(1, _frameCount),
+            false);
+        if (!_write(fileInfo, Image::Info(_size, _size, test.type)))
+        {
+            std::cout << std::setw(12) << test.extension << "  not available" << std::endl;
+            continue;
+        }
+
+        double seconds[2] = { 0.0, 0.0 };
+        size_t syscalls[2] = { 0, 0 };
+        for (size_t i = 0; i < 2; ++i)
+        {
+            _read(fileInfo, 1 == i, seconds[i], syscalls[i]);
+        }
+        std::cout << std::setw(12) << test.extension << std::fixed << std::setprecision(1);
+        for (size_t i = 0; i < 2; ++i)
+        {
+            std::cout << std::setw(16) << seconds[i] / _frameCount * 1000000.0;
+        }
+        for (size_t i = 0; i < 2; ++i)
+        {
+            std::cout << std::setw(16) << syscalls[i] / static_cast<double>(_frameCount);
+        }
+        std::cout << std::endl;
+    }
+}
+
+bool Application::_write(const System::File::Info& fileInfo, const Image::Info& imageInfo)
+{
+    auto io = getSystemT<AV::IO::IOSystem>();
+    AV::IO::Info info;
+    info.video.push_back(imageInfo);
+    info.videoSequence = fileInfo.getSequence();
+    if (!io->canWrite(fileInfo, info))
+    {
+        return false;
+    }
+    auto write = io->write(fileInfo, info);
+    {
+        std::lock_guard<std::mutex> lock(write->getMutex());
+        auto& writeQueue = write->getVideoQueue();
+        writeQueue.setMax(_frameCount);
+        for (size_t i = 0; i < _frameCount; ++i)
+        {
+            auto image = Image::Data::create(imageInfo);
+            image->zero();
+            writeQueue.addFrame(AV::IO::VideoFrame(i, image));
+        }
+        writeQueue.setFinished(true);
+    }
+    while (write->isRunning())
+    {
+        std::this_thread::sleep_for(System::getTimerDuration(System::TimerValue::Fast));
+    }
+    return true;
+}
+
+void Application::_read(const System::File::Info& fileInfo, bool headerTemplate, double& seconds, size_t& syscalls)
+{
+    auto io = getSystemT<AV::IO::IOSystem>();
+    AV::IO::ReadOptions options;
+    options.headerTemplate = headerTemplate;
+    auto read = io->read(fileInfo, options);
+    read->getInfo().get();
+
+    // Pull the frames from the reader until it reaches the end of the
+    // sequence.
+    const size_t syscallsStart = getReadSyscalls();
+    const auto start = std::chrono::steady_clock::now();
+    while (true)
+    {
+        bool finished = false;
+        {
+            std::lock_guard<std::mutex> lock(read->getMutex());
+            auto& videoQueue = read->getVideoQueue();
+            while (!videoQueue.isEmpty())
+            {
+                videoQueue.popFrame();
+            }
+            finished = videoQueue.isFinished();
+        }
+        if (finished)
+        {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    const std::chrono::duration<double> delta = std::chrono::steady_clock::now() - start;
+    seconds = delta.count();
+    syscalls = getReadSyscalls() - syscallsStart;
+}
+
+int main(int argc, char ** argv)
+{
+    int r = 1;
+    try
+    {
+        auto args = Application::args(argc, argv);
+        auto app = Application::create(args);
+        app->run();
+        r = app->getExitCode();
+    }
+    catch (const std::exception & e)
+    {
+        std::cout << Core::Error::format(e) << std::endl;
+    }
+    return r;
+}
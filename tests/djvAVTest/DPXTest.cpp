@@ -4,9 +4,12 @@
 
 #include <djvAVTest/DPXTest.h>
 
+#include <djvAVTest/TileTestUtil.h>
+
 #include <djvAV/DPX.h>
 
 #include <djvSystem/Context.h>
+#include <djvSystem/FileInfo.h>
 #include <djvSystem/FileIO.h>
 #include <djvSystem/TextSystem.h>
 
@@ -35,6 +38,7 @@ namespace djv
             _enum();
             _header();
             _serialize();
+            _tile();
         }
         
         void DPXTest::_enum()
@@ -337,8 +341,20 @@ namespace djv
                     Info info2;
                     info2.video.push_back(Image::Info());
                     DPX::Transfer transfer = DPX::Transfer::First;
-                    DPX::read(io, info2, transfer, textSystem);
+                    const DPX::Header header = DPX::read(io, info2, transfer, textSystem);
                     DJV_ASSERT(info.tags == info2.tags);
+
+                    io->open(System::File::Path(getTempPath(), "test.dpx").get(), System::File::Mode::Read);
+                    Info info3;
+                    DJV_ASSERT(DPX::read(io, info3, header, info2));
+                    DJV_ASSERT(info2.video == info3.video);
+                    DJV_ASSERT(info.tags == info3.tags);
+
+                    io->open(System::File::Path(getTempPath(), "test2.dpx").get(), System::File::Mode::Write);
+                    info.video[0] = Image::Info(2, 2, Image::Type::RGB_U10);
+                    DPX::write(io, info, DPX::Version::_2_0, DPX::Endian::Auto, DPX::Transfer::First);
+                    io->open(System::File::Path(getTempPath(), "test2.dpx").get(), System::File::Mode::Read);
+                    DJV_ASSERT(!DPX::read(io, info3, header, info2));
                 }
 
                 for (const auto& i : Image::getTypeEnums())
@@ -425,6 +441,14 @@ namespace djv
             }
         }
 
+        void DPXTest::_tile()
+        {
+            if (auto context = getContext().lock())
+            {
+                tileTest(System::File::Info(System::File::Path(getTempPath(), "tile.dpx")), context);
+            }
+        }
+
     } // namespace AVTest
 } // namespace djv
 
@@ -29,6 +29,7 @@ namespace djv
                 AV::DPX::Endian = AV::DPX::Endian::Auto,
                 AV::DPX::Transfer = AV::DPX::Transfer::First);
             void _serialize();
+            void _tile();
         };
         
     } // namespace AVTest
@@ -6,6 +6,14 @@
 
 #include <djvAV/FFmpeg.h>
 
+#include <djvSystem/Context.h>
+#include <djvSystem/FileInfo.h>
+#include <djvSystem/FileIO.h>
+#include <djvSystem/LogSystem.h>
+#include <djvSystem/ResourceSystem.h>
+#include <djvSystem/TextSystem.h>
+#include <djvSystem/Timer.h>
+
 #include <djvCore/Error.h>
 
 #include <libavutil/error.h>
@@ -27,6 +35,8 @@ namespace djv
         void FFmpegTest::run()
         {
             _convert();
+            _keyframeIndex();
+            _write();
             _serialize();
         }
         
@@ -90,6 +100,23 @@ namespace djv
                 FFmpeg::extractAudio(p, i, 4, out);
             }
             
+            DJV_ASSERT(FF_THREAD_SLICE == FFmpeg::toFFmpeg(FFmpeg::ThreadType::Slice));
+            DJV_ASSERT(FF_THREAD_FRAME == FFmpeg::toFFmpeg(FFmpeg::ThreadType::Frame));
+            DJV_ASSERT((FF_THREAD_FRAME | FF_THREAD_SLICE) == FFmpeg::toFFmpeg(FFmpeg::ThreadType::FrameSlice));
+
+            for (const auto i : {
+                Image::Type::L_U8,
+                Image::Type::RGB_U8,
+                Image::Type::RGBA_U8,
+                Image::Type::RGBA_U16,
+                Image::Type::YUV_420P_U8,
+                Image::Type::YUV_422P_U10,
+                Image::Type::YUV_444P_U16 })
+            {
+                DJV_ASSERT(i == FFmpeg::toImageType(FFmpeg::toFFmpeg(i, Memory::Endian::LSB)));
+            }
+            DJV_ASSERT(AV_PIX_FMT_NONE == FFmpeg::toFFmpeg(Image::Type::RGBA_F32, Memory::Endian::LSB));
+
             for (const auto i : {
                 AVERROR_EOF,
                 AVERROR_EXIT,
@@ -99,10 +126,147 @@ namespace djv
             }
         }
         
+        void FFmpegTest::_keyframeIndex()
+        {
+            {
+                const FFmpeg::KeyframeIndex index;
+                DJV_ASSERT(!index.isValid());
+                DJV_ASSERT(!index.getKeyframe(0).isValid());
+            }
+
+            {
+                const FFmpeg::KeyframeIndex index(
+                    {
+                        FFmpeg::Keyframe(10, 1000),
+                        FFmpeg::Keyframe(20, 2000),
+                        FFmpeg::Keyframe(35, 3500)
+                    },
+                    49);
+                DJV_ASSERT(index.isValid());
+                DJV_ASSERT(49 == index.getLastFrame());
+                DJV_ASSERT(!index.getKeyframe(9).isValid());
+                DJV_ASSERT(FFmpeg::Keyframe(10, 1000) == index.getKeyframe(10));
+                DJV_ASSERT(FFmpeg::Keyframe(10, 1000) == index.getKeyframe(19));
+                DJV_ASSERT(FFmpeg::Keyframe(20, 2000) == index.getKeyframe(20));
+                DJV_ASSERT(FFmpeg::Keyframe(20, 2000) == index.getKeyframe(34));
+                DJV_ASSERT(FFmpeg::Keyframe(35, 3500) == index.getKeyframe(49));
+                DJV_ASSERT(FFmpeg::Keyframe(35, 3500) == index.getKeyframe(100));
+
+                const System::File::Path path(getTempPath(), "FFmpegTest.txt");
+                System::File::writeLines(path.get(), { "" });
+                const System::File::Info fileInfo(path);
+                const std::string fileName = FFmpeg::getKeyframeIndexFileName(getTempPath(), fileInfo);
+                FFmpeg::saveKeyframeIndex(fileName, fileInfo, index);
+                DJV_ASSERT(index == FFmpeg::loadKeyframeIndex(fileName, fileInfo));
+
+                System::File::writeLines(path.get(), { "Changed" });
+                DJV_ASSERT(!FFmpeg::loadKeyframeIndex(fileName, System::File::Info(path)).isValid());
+            }
+        }
+
+        void FFmpegTest::_write()
+        {
+            if (auto context = getContext().lock())
+            {
+                for (auto codec : FFmpeg::getCodecEnums())
+                {
+                    if (!FFmpeg::findEncoder(codec))
+                    {
+                        std::stringstream ss;
+                        ss << "Encoder not available: " << codec;
+                        _print(ss.str());
+                        continue;
+                    }
+                    try
+                    {
+                        std::stringstream ss;
+                        ss << "FFmpegTest_" << codec << ".mov";
+                        _print(ss.str());
+                        const System::File::Info fileInfo(System::File::Path(getTempPath(), ss.str()));
+
+                        // Encode synthetic frames.
+                        const Image::Info imageInfo(64, 32, Image::Type::RGB_U8);
+                        const size_t frameCount = 30;
+                        {
+                            IO::Info info;
+                            info.videoSpeed = Math::IntRational(24, 1);
+                            info.video.push_back(imageInfo);
+                            FFmpeg::Options options;
+                            options.codec = codec;
+                            auto write = FFmpeg::Write::create(
+                                fileInfo,
+                                info,
+                                WriteOptions(),
+                                options,
+                                context->getSystemT<System::TextSystem>(),
+                                context->getSystemT<System::ResourceSystem>(),
+                                context->getSystemT<System::LogSystem>());
+                            {
+                                std::lock_guard<std::mutex> lock(write->getMutex());
+                                auto& writeQueue = write->getVideoQueue();
+                                writeQueue.setMax(frameCount);
+                                for (size_t i = 0; i < frameCount; ++i)
+                                {
+                                    auto image = Image::Data::create(imageInfo);
+                                    uint8_t* p = image->getData();
+                                    for (uint32_t y = 0; y < imageInfo.size.h; ++y)
+                                    {
+                                        for (uint32_t x = 0; x < imageInfo.size.w; ++x, p += 3)
+                                        {
+                                            p[0] = static_cast<uint8_t>(x * 4 + i);
+                                            p[1] = static_cast<uint8_t>(y * 8);
+                                            p[2] = static_cast<uint8_t>(i * 8);
+                                        }
+                                    }
+                                    writeQueue.addFrame(VideoFrame(i, image));
+                                }
+                                writeQueue.setFinished(true);
+                            }
+                            while (write->isRunning())
+                            {
+                                std::this_thread::sleep_for(System::getTimerDuration(System::TimerValue::Fast));
+                            }
+                        }
+
+                        // Read the frames back.
+                        auto read = FFmpeg::Read::create(
+                            fileInfo,
+                            ReadOptions(),
+                            FFmpeg::Options(),
+                            context->getSystemT<System::TextSystem>(),
+                            context->getSystemT<System::ResourceSystem>(),
+                            context->getSystemT<System::LogSystem>());
+                        const auto info = read->getInfo().get();
+                        DJV_ASSERT(1 == info.video.size());
+                        DJV_ASSERT(imageInfo.size == info.video[0].size);
+                        DJV_ASSERT(frameCount == info.videoSequence.getFrameCount());
+                    }
+                    catch (const std::exception& e)
+                    {
+                        _print(Error::format(e));
+                    }
+                }
+            }
+        }
+
         void FFmpegTest::_serialize()
         {
+            for (auto i : FFmpeg::getThreadTypeEnums())
+            {
+                FFmpeg::Options options;
+                options.threadType = i;
+                options.saveKeyframeIndex = false;
+                rapidjson::Document document;
+                auto& allocator = document.GetAllocator();
+                auto json = toJSON(options, allocator);
+                FFmpeg::Options options2;
+                fromJSON(json, options2);
+                DJV_ASSERT(options == options2);
+            }
+            for (auto i : FFmpeg::getCodecEnums())
             {
                 FFmpeg::Options options;
+                options.codec = i;
                 rapidjson::Document document;
                 auto& allocator = document.GetAllocator();
                 auto json = toJSON(options, allocator);
@@ -19,6 +19,8 @@ namespace djv
         
         private:
             void _convert();
+            void _keyframeIndex();
+            void _write();
             void _serialize();
         };
         
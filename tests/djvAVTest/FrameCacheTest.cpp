@@ -0,0 +1,216 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVTest/FrameCacheTest.h>
+
+#include <djvAV/FrameCache.h>
+#include <djvAV/IO.h>
+
+#include <djvCore/UID.h>
+
+using namespace djv::Core;
+using namespace djv::AV;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        FrameCacheTest::FrameCacheTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::AVTest::FrameCacheTest", tempPath, context)
+        {}
+
+        void FrameCacheTest::run()
+        {
+            _frames();
+            _budget();
+            _priority();
+            _cache();
+        }
+
+        namespace
+        {
+            std::shared_ptr<Image::Data> createImage()
+            {
+                return Image::Data::create(Image::Info(16, 16, Image::Type::RGBA_U8));
+            }
+
+        } // namespace
+
+        void FrameCacheTest::_frames()
+        {
+            {
+                auto frameCache = IO::FrameCache::create();
+                DJV_ASSERT(0 == frameCache->getMaxByteCount());
+                DJV_ASSERT(0 == frameCache->getByteCount());
+                DJV_ASSERT(0 == frameCache->getCount());
+                DJV_ASSERT(0.F == frameCache->getPercentageUsed());
+            }
+
+            {
+                auto frameCache = IO::FrameCache::create();
+                const UID uid = createUID();
+                auto image = createImage();
+                const size_t byteCount = image->getDataByteCount();
+                for (Math::Frame::Index i = 0; i < 3; ++i)
+                {
+                    frameCache->add(uid, i, image);
+                }
+                frameCache->add(uid, 10, image);
+                frameCache->add(uid, 10, image);
+                DJV_ASSERT(4 == frameCache->getCount());
+                DJV_ASSERT(4 == frameCache->getCount(uid));
+                DJV_ASSERT(byteCount * 4 == frameCache->getByteCount());
+                DJV_ASSERT(byteCount * 4 == frameCache->getByteCount(uid));
+                Math::Frame::Sequence frames;
+                frames.add(Math::Frame::Range(0, 2));
+                frames.add(Math::Frame::Range(10));
+                DJV_ASSERT(frames == frameCache->getFrames(uid));
+                DJV_ASSERT(frameCache->contains(uid, 1));
+                DJV_ASSERT(!frameCache->contains(uid, 3));
+                DJV_ASSERT(!frameCache->contains(createUID(), 1));
+                std::shared_ptr<Image::Data> out;
+                DJV_ASSERT(frameCache->get(uid, 1, out));
+                DJV_ASSERT(image == out);
+
+                frameCache->remove(uid, Math::Frame::Range(2, 10));
+                DJV_ASSERT(2 == frameCache->getCount(uid));
+                DJV_ASSERT(Math::Frame::Sequence(0, 1) == frameCache->getFrames(uid));
+
+                // Frames that failed to read are cached as null images.
+                frameCache->add(uid, -100, nullptr);
+                DJV_ASSERT(frameCache->contains(uid, -100));
+                DJV_ASSERT(frameCache->get(uid, -100, out));
+                DJV_ASSERT(!out);
+                DJV_ASSERT(byteCount * 2 == frameCache->getByteCount(uid));
+                frameCache->add(uid, 1000, image);
+                DJV_ASSERT(4 == frameCache->getCount(uid));
+                frameCache->remove(uid, Math::Frame::Range(-100));
+                frameCache->remove(uid, Math::Frame::Range(1000));
+                DJV_ASSERT(Math::Frame::Sequence(0, 1) == frameCache->getFrames(uid));
+                frameCache->clear(uid);
+                DJV_ASSERT(0 == frameCache->getCount());
+                DJV_ASSERT(0 == frameCache->getByteCount());
+
+                frameCache->add(uid, 0, image);
+                frameCache->remove(uid);
+                DJV_ASSERT(0 == frameCache->getCount());
+                DJV_ASSERT(!frameCache->contains(uid, 0));
+            }
+        }
+
+        void FrameCacheTest::_budget()
+        {
+            auto frameCache = IO::FrameCache::create();
+            auto image = createImage();
+            const size_t byteCount = image->getDataByteCount();
+            frameCache->setMaxByteCount(byteCount * 4);
+            DJV_ASSERT(byteCount * 4 == frameCache->getMaxByteCount());
+
+            const UID a = createUID();
+            frameCache->setWindow(a, 0, Math::Frame::Sequence(0, 9));
+            for (Math::Frame::Index i = 0; i < 4; ++i)
+            {
+                frameCache->add(a, i, image);
+            }
+            DJV_ASSERT(100.F == frameCache->getPercentageUsed());
+
+            // Frames outside of the window are removed first, even when
+            // they are closer to the current frame.
+            frameCache->setWindow(a, 0, Math::Frame::Sequence(2, 3));
+            const UID b = createUID();
+            frameCache->setWindow(b, 100, Math::Frame::Sequence(100, 101));
+            frameCache->add(b, 100, image);
+            DJV_ASSERT(byteCount * 4 == frameCache->getByteCount());
+            DJV_ASSERT(!frameCache->contains(a, 1));
+            DJV_ASSERT(frameCache->contains(a, 0));
+            DJV_ASSERT(frameCache->contains(b, 100));
+
+            // Then the frames furthest from the current frame.
+            frameCache->setWindow(a, 0, Math::Frame::Sequence(0, 9));
+            frameCache->add(b, 101, image);
+            DJV_ASSERT(!frameCache->contains(a, 3));
+            DJV_ASSERT(frameCache->contains(b, 101));
+            DJV_ASSERT(2 == frameCache->getEvictionCount(a));
+            DJV_ASSERT(0 == frameCache->getEvictionCount(b));
+
+            // The frames inside the window of the media being added to are
+            // not removed to make room for it.
+            frameCache->remove(a);
+            for (Math::Frame::Index i = 102; i < 106; ++i)
+            {
+                frameCache->setWindow(b, 100, Math::Frame::Sequence(100, i));
+                frameCache->add(b, i, image);
+            }
+            DJV_ASSERT(6 == frameCache->getCount(b));
+
+            frameCache->setMaxByteCount(byteCount * 2);
+            DJV_ASSERT(2 == frameCache->getCount());
+            DJV_ASSERT(frameCache->contains(b, 100));
+            DJV_ASSERT(frameCache->contains(b, 101));
+        }
+
+        void FrameCacheTest::_priority()
+        {
+            auto frameCache = IO::FrameCache::create();
+            auto image = createImage();
+            const size_t byteCount = image->getDataByteCount();
+            frameCache->setMaxByteCount(byteCount * 4);
+            const UID a = createUID();
+            const UID b = createUID();
+            frameCache->setPriority(a, .1F);
+            for (const auto uid : { a, b })
+            {
+                frameCache->setWindow(uid, 0, Math::Frame::Sequence(0, 9));
+                frameCache->add(uid, 0, image);
+                frameCache->add(uid, 1, image);
+            }
+            const UID c = createUID();
+            frameCache->setWindow(c, 0, Math::Frame::Sequence(0, 9));
+            frameCache->add(c, 0, image);
+            frameCache->add(c, 1, image);
+            DJV_ASSERT(0 == frameCache->getCount(a));
+            DJV_ASSERT(2 == frameCache->getCount(b));
+            DJV_ASSERT(2 == frameCache->getCount(c));
+        }
+
+        void FrameCacheTest::_cache()
+        {
+            {
+                IO::Cache cache;
+                DJV_ASSERT(cache.getFrameCache());
+                cache.setSequenceSize(100);
+                cache.setMax(10);
+                cache.setCurrentFrame(20);
+                auto image = createImage();
+                cache.add(20, image);
+                cache.add(50, image);
+                DJV_ASSERT(cache.contains(20));
+                DJV_ASSERT(!cache.contains(50));
+            }
+
+            {
+                auto frameCache = IO::FrameCache::create();
+                {
+                    IO::Cache cache;
+                    cache.setFrameCache(frameCache);
+                    DJV_ASSERT(frameCache == cache.getFrameCache());
+                    cache.setSequenceSize(100);
+                    cache.setMax(10);
+                    cache.setCurrentFrame(20);
+                    auto image = createImage();
+                    cache.add(20, image);
+                    cache.add(50, image);
+                    DJV_ASSERT(cache.contains(20));
+                    DJV_ASSERT(cache.contains(50));
+                    DJV_ASSERT(2 == frameCache->getCount());
+                    DJV_ASSERT(image->getDataByteCount() * 2 == cache.getTotalByteCount());
+                }
+                DJV_ASSERT(0 == frameCache->getCount());
+            }
+        }
+
+    } // namespace AVTest
+} // namespace djv
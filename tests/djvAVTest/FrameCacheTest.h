@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvTestLib/Test.h>
+
+namespace djv
+{
+    namespace AVTest
+    {
+        class FrameCacheTest : public Test::ITest
+        {
+        public:
+            FrameCacheTest(
+                const System::File::Path& tempPath,
+                const std::shared_ptr<System::Context>&);
+            
+            void run() override;
+            
+        private:
+            void _frames();
+            void _budget();
+            void _priority();
+            void _cache();
+        };
+        
+    } // namespace AVTest
+} // namespace djv
+
@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVTest/HeadlessTest.h>
+
+#include <djvAV/IOSystem.h>
+#include <djvAV/ThumbnailSystem.h>
+
+#include <djvGL/GLFWSystem.h>
+
+#include <djvImage/Data.h>
+
+#include <djvSystem/Context.h>
+#include <djvSystem/Timer.h>
+
+#include <djvCore/Error.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+using namespace djv::Core;
+using namespace djv::AV;
+using namespace djv::AV::IO;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        namespace
+        {
+            const Image::Size size(16, 8);
+            const uint8_t color[] = { 10, 20, 30, 255 };
+
+        } // namespace
+
+        HeadlessTest::HeadlessTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITickTest(
+                "djv::AVTest::HeadlessTest",
+                System::File::Path(tempPath, "HeadlessTest"),
+                context)
+        {}
+        
+        void HeadlessTest::run()
+        {
+            if (auto context = getContext().lock())
+            {
+                auto glfwSystem = context->getSystemT<GL::GLFW::GLFWSystem>();
+                DJV_ASSERT(glfwSystem);
+                DJV_ASSERT(!glfwSystem->getWindow());
+            }
+            _write();
+            _thumbnail();
+        }
+
+        void HeadlessTest::_write()
+        {
+            if (auto context = getContext().lock())
+            {
+                auto io = context->getSystemT<IOSystem>();
+                const System::File::Info fileInfo(System::File::Path(getTempPath(), "headless.ppm"));
+
+                // The PPM writer does not support alpha, so the image is
+                // converted to RGB with the CPU.
+                const Image::Info imageInfo(size, Image::Type::RGBA_U8);
+                auto image = Image::Data::create(imageInfo);
+                for (uint32_t y = 0; y < size.h; ++y)
+                {
+                    uint8_t* p = image->getData(y);
+                    for (uint32_t x = 0; x < size.w; ++x, p += 4)
+                    {
+                        memcpy(p, color, 4);
+                    }
+                }
+                {
+                    Info info;
+                    info.video.push_back(imageInfo);
+                    auto write = io->write(fileInfo, info);
+                    {
+                        std::lock_guard<std::mutex> lock(write->getMutex());
+                        auto& writeQueue = write->getVideoQueue();
+                        writeQueue.addFrame(VideoFrame(0, image));
+                        writeQueue.setFinished(true);
+                    }
+                    while (write->isRunning())
+                    {
+                        std::this_thread::sleep_for(System::getTimerDuration(System::TimerValue::Fast));
+                    }
+                }
+
+                auto read = io->read(fileInfo);
+                std::shared_ptr<Image::Data> readImage;
+                bool running = true;
+                while (running)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(read->getMutex());
+                        auto& readQueue = read->getVideoQueue();
+                        if (!readQueue.isEmpty())
+                        {
+                            readImage = readQueue.popFrame().data;
+                        }
+                        running = !readQueue.isFinished() || !readQueue.isEmpty();
+                    }
+                    if (running)
+                    {
+                        std::this_thread::sleep_for(System::getTimerDuration(System::TimerValue::Fast));
+                    }
+                }
+                DJV_ASSERT(readImage);
+                DJV_ASSERT(size == readImage->getSize());
+                DJV_ASSERT(Image::Type::RGB_U8 == readImage->getType());
+                for (uint32_t y = 0; y < size.h; ++y)
+                {
+                    const uint8_t* p = readImage->getData(y);
+                    for (uint32_t x = 0; x < size.w; ++x, p += 3)
+                    {
+                        DJV_ASSERT(0 == memcmp(p, color, 3));
+                    }
+                }
+            }
+        }
+
+        void HeadlessTest::_thumbnail()
+        {
+            if (auto context = getContext().lock())
+            {
+                auto system = context->getSystemT<ThumbnailSystem>();
+                const System::File::Info fileInfo(System::File::Path(getTempPath(), "headless.ppm"));
+                auto future = system->getImage(fileInfo, Image::Size(8, 4), Image::Type::RGBA_U8);
+                while (future.future.valid() &&
+                    future.future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+                {
+                    _tickFor(System::getTimerDuration(System::TimerValue::Fast));
+                }
+                const auto image = future.future.get();
+                DJV_ASSERT(image);
+                DJV_ASSERT(Image::Size(8, 4) == image->getSize());
+                DJV_ASSERT(Image::Type::RGBA_U8 == image->getType());
+                const uint8_t* p = image->getData(0, 0);
+                for (size_t c = 0; c < 4; ++c)
+                {
+                    DJV_ASSERT(std::abs(static_cast<int>(p[c]) - static_cast<int>(color[c])) <= 1);
+                }
+            }
+        }
+        
+    } // namespace AVTest
+} // namespace djv
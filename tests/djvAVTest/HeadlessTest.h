@@ -0,0 +1,28 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvTestLib/TickTest.h>
+
+namespace djv
+{
+    namespace AVTest
+    {
+        //! This test is run in a separate process (HeadlessTest) with OpenGL
+        //! disabled.
+        class HeadlessTest : public Test::ITickTest
+        {
+        public:
+            HeadlessTest(
+                const System::File::Path& tempPath,
+                const std::shared_ptr<System::Context>&);
+            
+            void run() override;
+
+        private:
+            void _write();
+            void _thumbnail();
+        };
+        
+    } // namespace AVTest
+} // namespace djv
@@ -45,6 +45,7 @@ namespace djv
             _audioQueue();
             _inOutPoints();
             _cache();
+            _reduction();
             _plugin();
             _io();
             _system();
@@ -237,8 +238,86 @@ namespace djv
                     _print(ss.str());
                 }
             }
+
+            {
+                Cache cache;
+                cache.setSequenceSize(100);
+                cache.setMax(20);
+                cache.setCurrentFrame(50);
+                DJV_ASSERT(Math::Frame::Sequence(40, 60) == cache.getSequence());
+                cache.setCurrentFrame(5);
+                Math::Frame::Sequence sequence;
+                sequence.add(Math::Frame::Range(0, 15));
+                sequence.add(Math::Frame::Range(95, 99));
+                DJV_ASSERT(sequence == cache.getSequence());
+                cache.setDirection(Direction::Reverse);
+                DJV_ASSERT(sequence == cache.getSequence());
+                cache.setCurrentFrame(50);
+                DJV_ASSERT(Math::Frame::Sequence(40, 60) == cache.getSequence());
+                cache.setInOutPoints(InOutPoints(true, 45, 54));
+                DJV_ASSERT(Math::Frame::Sequence(45, 54) == cache.getSequence());
+            }
+
+            {
+                Cache cache;
+                cache.setSequenceSize(100);
+                cache.setMax(20);
+                cache.setCurrentFrame(50);
+                auto image = Image::Data::create(Image::Info(1, 2, Image::Type::RGB_U8));
+                DJV_ASSERT(std::vector<Math::Frame::Index>({ 40, 41, 42 }) == cache.getUncachedFrames(3, {}));
+                cache.add(40, image);
+                cache.add(42, image);
+                DJV_ASSERT(std::vector<Math::Frame::Index>({ 43, 44 }) == cache.getUncachedFrames(2, { 41 }));
+                cache.add(41, image);
+                DJV_ASSERT(std::vector<Math::Frame::Index>({ 43 }) == cache.getUncachedFrames(1, {}));
+                cache.setCurrentFrame(51);
+                DJV_ASSERT(!cache.contains(40));
+                DJV_ASSERT(cache.contains(41));
+                DJV_ASSERT(std::vector<Math::Frame::Index>({ 43 }) == cache.getUncachedFrames(1, {}));
+                cache.setCurrentFrame(50);
+                DJV_ASSERT(std::vector<Math::Frame::Index>({ 40, 43 }) == cache.getUncachedFrames(2, {}));
+                cache.add(70, image);
+                DJV_ASSERT(!cache.contains(70));
+            }
+
+            {
+                Cache cache;
+                cache.setSequenceSize(100);
+                cache.setMax(20);
+                cache.setCurrentFrame(50);
+                DJV_ASSERT(0 == cache.getLayer());
+                auto image = Image::Data::create(Image::Info(1, 2, Image::Type::RGB_U8));
+                cache.add(40, image);
+                const size_t byteCount = cache.getTotalByteCount();
+                cache.add(40, image, 1);
+                cache.add(41, image, 1);
+                DJV_ASSERT(cache.contains(40));
+                DJV_ASSERT(!cache.contains(41));
+                DJV_ASSERT(cache.getTotalByteCount() > byteCount);
+                cache.setLayer(1);
+                DJV_ASSERT(1 == cache.getLayer());
+                DJV_ASSERT(cache.contains(40));
+                DJV_ASSERT(cache.contains(41));
+                cache.setCurrentFrame(51);
+                DJV_ASSERT(!cache.contains(40));
+                cache.setLayer(0);
+                DJV_ASSERT(!cache.contains(40));
+                cache.clear();
+                DJV_ASSERT(0 == cache.getTotalByteCount());
+            }
         }
         
+        void IOTest::_reduction()
+        {
+            DJV_ASSERT(0 == getReduction(Image::Size(1920, 1080), Image::Size(), 3));
+            DJV_ASSERT(0 == getReduction(Image::Size(1920, 1080), Image::Size(1920, 1080), 3));
+            DJV_ASSERT(1 == getReduction(Image::Size(1920, 1080), Image::Size(960, 540), 3));
+            DJV_ASSERT(2 == getReduction(Image::Size(1920, 1080), Image::Size(400, 200), 3));
+            DJV_ASSERT(3 == getReduction(Image::Size(1920, 1080), Image::Size(128, 128), 3));
+            DJV_ASSERT(4 == getReduction(Image::Size(1920, 1080), Image::Size(64, 64), 4));
+            DJV_ASSERT(1 == getReduction(Image::Size(5, 5), Image::Size(3, 3), 3));
+        }
+
         void IOTest::_plugin()
         {
             if (auto context = getContext().lock())
@@ -27,6 +27,7 @@ namespace djv
             void _audioQueue();
             void _inOutPoints();
             void _cache();
+            void _reduction();
             void _plugin();
             void _io();
             void _io(
@@ -4,12 +4,28 @@
 
 #include <djvAVTest/OpenEXRTest.h>
 
+#include <djvAVTest/TileTestUtil.h>
+
+#include <djvAV/IOSystem.h>
 #include <djvAV/OpenEXR.h>
 
+#include <djvImage/Convert.h>
+#include <djvImage/Data.h>
+
+#include <djvSystem/Context.h>
+#include <djvSystem/FileInfo.h>
+#include <djvSystem/Timer.h>
+
 #include <djvCore/Error.h>
 
+#include <ImfChannelList.h>
+#include <ImfFrameBuffer.h>
+#include <ImfOutputFile.h>
 #include <ImfStandardAttributes.h>
 
+#include <cmath>
+#include <thread>
+
 using namespace djv::Core;
 using namespace djv::AV;
 using namespace djv::AV::IO;
@@ -18,6 +34,95 @@ namespace djv
 {
     namespace AVTest
     {
+        namespace
+        {
+            //! The display window is taller than the 256 scanline chunks used
+            //! by the reader so that more than one chunk is read.
+            const Image::Size size(40, 600);
+
+            float getValue(int x, int y, size_t c)
+            {
+                return ((x + 1000) * 7 + (y + 1000) * 13 + c * 50) % 256 / 255.F;
+            }
+
+            void writeImage(
+                const std::string& fileName,
+                const Math::BBox2i& dataWindow)
+            {
+                const Imath::Box2i displayWindowImf(
+                    Imath::V2i(0, 0),
+                    Imath::V2i(size.w - 1, size.h - 1));
+                const Imath::Box2i dataWindowImf(
+                    Imath::V2i(dataWindow.min.x, dataWindow.min.y),
+                    Imath::V2i(dataWindow.max.x, dataWindow.max.y));
+                Imf::Header header(displayWindowImf, dataWindowImf);
+                const char* channels[] = { "r", "g", "b" };
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    header.channels().insert(channels[c], Imf::Channel(Imf::FLOAT));
+                }
+
+                const size_t cb = 3 * sizeof(float);
+                const size_t scb = dataWindow.w() * cb;
+                std::vector<float> buf(dataWindow.w() * dataWindow.h() * 3);
+                for (int y = 0; y < dataWindow.h(); ++y)
+                {
+                    float* p = buf.data() + y * dataWindow.w() * 3;
+                    for (int x = 0; x < dataWindow.w(); ++x, p += 3)
+                    {
+                        for (size_t c = 0; c < 3; ++c)
+                        {
+                            p[c] = getValue(dataWindow.min.x + x, dataWindow.min.y + y, c);
+                        }
+                    }
+                }
+                const ptrdiff_t offset =
+                    static_cast<ptrdiff_t>(dataWindow.min.x) * static_cast<ptrdiff_t>(cb) +
+                    static_cast<ptrdiff_t>(dataWindow.min.y) * static_cast<ptrdiff_t>(scb);
+                Imf::FrameBuffer frameBuffer;
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    frameBuffer.insert(
+                        channels[c],
+                        Imf::Slice(
+                            Imf::FLOAT,
+                            reinterpret_cast<char*>(buf.data()) - offset + c * sizeof(float),
+                            cb,
+                            scb));
+                }
+                Imf::OutputFile file(fileName.c_str(), header);
+                file.setFrameBuffer(frameBuffer);
+                file.writePixels(dataWindow.h());
+            }
+
+            std::shared_ptr<Image::Data> readImage(
+                const System::File::Info& fileInfo,
+                const std::shared_ptr<IOSystem>& io)
+            {
+                std::shared_ptr<Image::Data> out;
+                auto read = io->read(fileInfo);
+                bool running = true;
+                while (running)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(read->getMutex());
+                        auto& readQueue = read->getVideoQueue();
+                        if (!readQueue.isEmpty())
+                        {
+                            out = readQueue.popFrame().data;
+                        }
+                        running = !readQueue.isFinished() || !readQueue.isEmpty();
+                    }
+                    if (running)
+                    {
+                        std::this_thread::sleep_for(System::getTimerDuration(System::TimerValue::Fast));
+                    }
+                }
+                return out;
+            }
+
+        } // namespace
+
         OpenEXRTest::OpenEXRTest(
             const System::File::Path& tempPath,
             const std::shared_ptr<System::Context>& context) :
@@ -29,6 +134,8 @@ namespace djv
             _enum();
             _data();
             _serialize();
+            _tile();
+            _dataWindow();
         }
 
         void OpenEXRTest::_enum()
@@ -304,6 +411,66 @@ namespace djv
             }
         }
         
+
+        void OpenEXRTest::_tile()
+        {
+            if (auto context = getContext().lock())
+            {
+                tileTest(System::File::Info(System::File::Path(getTempPath(), "tile.exr")), context);
+            }
+        }
+
+
+        void OpenEXRTest::_dataWindow()
+        {
+            if (auto context = getContext().lock())
+            {
+                auto io = context->getSystemT<IOSystem>();
+                const std::vector<std::pair<std::string, Math::BBox2i> > dataWindows =
+                {
+                    // Data windows that fit horizontally inside the display
+                    // window are read with a single call.
+                    { "cropped", Math::BBox2i(5, 10, 25, 500) },
+                    { "croppedEdge", Math::BBox2i(0, 300, 40, 200) },
+
+                    // Data windows that extend horizontally outside of the
+                    // display window are read in scanline chunks.
+                    { "overscan", Math::BBox2i(-8, -8, 56, 616) },
+                    { "overscanCropped", Math::BBox2i(-4, 30, 30, 520) },
+                    { "overscanRight", Math::BBox2i(20, -3, 30, 300) }
+                };
+                for (const auto& i : dataWindows)
+                {
+                    _print("Data window: " + i.first);
+                    const Math::BBox2i& dataWindow = i.second;
+                    const System::File::Info fileInfo(System::File::Path(getTempPath(), i.first + ".exr"));
+                    writeImage(fileInfo.getFileName(), dataWindow);
+
+                    const auto image = readImage(fileInfo, io);
+                    DJV_ASSERT(image);
+                    DJV_ASSERT(size == image->getSize());
+                    auto imageF32 = Image::Data::create(Image::Info(size, Image::Type::RGB_F32));
+                    Image::Convert::create(1)->process(*image, imageF32->getInfo(), *imageF32);
+                    for (uint32_t y = 0; y < size.h; ++y)
+                    {
+                        for (uint32_t x = 0; x < size.w; ++x)
+                        {
+                            const bool inside =
+                                static_cast<int>(x) >= dataWindow.min.x &&
+                                static_cast<int>(x) <= dataWindow.max.x &&
+                                static_cast<int>(y) >= dataWindow.min.y &&
+                                static_cast<int>(y) <= dataWindow.max.y;
+                            const float* p = reinterpret_cast<const float*>(imageF32->getData(x, y));
+                            for (size_t c = 0; c < 3; ++c)
+                            {
+                                const float value = inside ? getValue(x, y, c) : 0.F;
+                                DJV_ASSERT(fabsf(p[c] - value) < .001F);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
     } // namespace AVTest
 } // namespace djv
-
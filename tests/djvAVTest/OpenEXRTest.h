@@ -21,6 +21,8 @@ namespace djv
             void _enum();
             void _data();
             void _serialize();
+            void _tile();
+            void _dataWindow();
         };
         
     } // namespace AVTest
@@ -4,8 +4,13 @@
 
 #include <djvAVTest/TIFFTest.h>
 
+#include <djvAVTest/TileTestUtil.h>
+
 #include <djvAV/TIFF.h>
 
+#include <djvSystem/Context.h>
+#include <djvSystem/FileInfo.h>
+
 #include <djvCore/Error.h>
 
 using namespace djv::Core;
@@ -25,6 +30,7 @@ namespace djv
         void TIFFTest::run()
         {
             _serialize();
+            _tile();
         }
 
         void TIFFTest::_serialize()
@@ -52,6 +58,14 @@ namespace djv
             }
         }
 
+        void TIFFTest::_tile()
+        {
+            if (auto context = getContext().lock())
+            {
+                tileTest(System::File::Info(System::File::Path(getTempPath(), "tile.tif")), context);
+            }
+        }
+
     } // namespace AVTest
 } // namespace djv
 
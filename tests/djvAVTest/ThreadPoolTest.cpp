@@ -0,0 +1,211 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVTest/ThreadPoolTest.h>
+
+#include <djvAV/ThreadPool.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <vector>
+
+using namespace djv::Core;
+using namespace djv::AV;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        ThreadPoolTest::ThreadPoolTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::AVTest::ThreadPoolTest", tempPath, context)
+        {}
+        
+        void ThreadPoolTest::run()
+        {
+            _threads();
+            _jobs();
+            _priority();
+            _cancel();
+        }
+        
+        void ThreadPoolTest::_threads()
+        {
+            auto threadPool = IO::ThreadPool::create(4);
+            DJV_ASSERT(4 == threadPool->getThreadCount());
+            threadPool->setThreadCount(2);
+            DJV_ASSERT(2 == threadPool->getThreadCount());
+            threadPool->setThreadCount(8);
+            DJV_ASSERT(8 == threadPool->getThreadCount());
+            threadPool->setThreadCount(0);
+            DJV_ASSERT(1 == threadPool->getThreadCount());
+        }
+        
+        void ThreadPoolTest::_jobs()
+        {
+            auto threadPool = IO::ThreadPool::create(4);
+            const UID uid = createUID();
+            std::atomic<size_t> count(0);
+            std::mutex mutex;
+            std::condition_variable cv;
+            const size_t jobCount = 100;
+            for (size_t i = 0; i < jobCount; ++i)
+            {
+                threadPool->addJob(
+                    uid,
+                    IO::JobPriority::Low,
+                    [&count, &mutex, &cv]
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        ++count;
+                        cv.notify_one();
+                    });
+            }
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(
+                lock,
+                [&count, jobCount]
+                {
+                    return jobCount == count;
+                });
+            DJV_ASSERT(jobCount == count);
+        }
+        
+        void ThreadPoolTest::_priority()
+        {
+            auto threadPool = IO::ThreadPool::create(1);
+            const UID uid = createUID();
+
+            // Block the worker thread so that the queue fills up.
+            std::mutex mutex;
+            std::condition_variable cv;
+            bool blocked = true;
+            threadPool->addJob(
+                uid,
+                IO::JobPriority::High,
+                [&mutex, &cv, &blocked]
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    cv.wait(
+                        lock,
+                        [&blocked]
+                        {
+                            return !blocked;
+                        });
+                });
+
+            std::vector<IO::JobPriority> order;
+            for (auto priority : { IO::JobPriority::Low, IO::JobPriority::High, IO::JobPriority::Low, IO::JobPriority::High })
+            {
+                threadPool->addJob(
+                    uid,
+                    priority,
+                    [&mutex, &cv, &order, priority]
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        order.push_back(priority);
+                        cv.notify_all();
+                    });
+            }
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                blocked = false;
+            }
+            cv.notify_all();
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(
+                    lock,
+                    [&order]
+                    {
+                        return 4 == order.size();
+                    });
+            }
+            DJV_ASSERT(IO::JobPriority::High == order[0]);
+            DJV_ASSERT(IO::JobPriority::High == order[1]);
+            DJV_ASSERT(IO::JobPriority::Low == order[2]);
+            DJV_ASSERT(IO::JobPriority::Low == order[3]);
+        }
+        
+        void ThreadPoolTest::_cancel()
+        {
+            auto threadPool = IO::ThreadPool::create(1);
+            const UID uid = createUID();
+            const UID uid2 = createUID();
+
+            std::mutex mutex;
+            std::condition_variable cv;
+            bool started = false;
+            bool blocked = true;
+            threadPool->addJob(
+                uid,
+                IO::JobPriority::High,
+                [&mutex, &cv, &started, &blocked]
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    started = true;
+                    cv.notify_all();
+                    cv.wait(
+                        lock,
+                        [&blocked]
+                        {
+                            return !blocked;
+                        });
+                });
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(
+                    lock,
+                    [&started]
+                    {
+                        return started;
+                    });
+            }
+
+            std::atomic<size_t> count(0);
+            std::atomic<size_t> count2(0);
+            std::vector<std::future<void> > futures2;
+            for (size_t i = 0; i < 10; ++i)
+            {
+                threadPool->addJob(
+                    uid,
+                    IO::JobPriority::Low,
+                    [&count]
+                    {
+                        ++count;
+                    });
+                auto promise = std::make_shared<std::promise<void> >();
+                futures2.push_back(promise->get_future());
+                threadPool->addJob(
+                    uid2,
+                    IO::JobPriority::Low,
+                    [&count2, promise]
+                    {
+                        ++count2;
+                        promise->set_value();
+                    });
+            }
+            DJV_ASSERT(20 == threadPool->getJobCount());
+            threadPool->cancelJobs(uid);
+            DJV_ASSERT(10 == threadPool->getJobCount());
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                blocked = false;
+            }
+            cv.notify_all();
+            for (auto& future : futures2)
+            {
+                DJV_ASSERT(future.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+            }
+            threadPool.reset();
+            DJV_ASSERT(0 == count);
+            DJV_ASSERT(10 == count2);
+        }
+        
+    } // namespace AVTest
+} // namespace djv
+
@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvTestLib/Test.h>
+
+namespace djv
+{
+    namespace AVTest
+    {
+        class ThreadPoolTest : public Test::ITest
+        {
+        public:
+            ThreadPoolTest(
+                const System::File::Path& tempPath,
+                const std::shared_ptr<System::Context>&);
+            
+            void run() override;
+            
+        private:
+            void _threads();
+            void _jobs();
+            void _priority();
+            void _cancel();
+        };
+        
+    } // namespace AVTest
+} // namespace djv
+
@@ -0,0 +1,316 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVTest/ThumbnailCacheTest.h>
+
+#include <djvAV/IO.h>
+#include <djvAV/ThumbnailCache.h>
+
+#include <djvImage/Data.h>
+
+#include <djvSystem/Context.h>
+#include <djvSystem/FileIO.h>
+#include <djvSystem/FileInfo.h>
+#include <djvSystem/TextSystem.h>
+
+#include <djvCore/Memory.h>
+
+#include <cstdio>
+
+using namespace djv::Core;
+using namespace djv::AV;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        ThumbnailCacheTest::ThumbnailCacheTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest(
+                "djv::AVTest::ThumbnailCacheTest",
+                System::File::Path(tempPath, "ThumbnailCacheTest"),
+                context)
+        {}
+
+        void ThumbnailCacheTest::run()
+        {
+            if (auto context = getContext().lock())
+            {
+                _textSystem = context->getSystemT<System::TextSystem>();
+                _entries();
+                _persistent();
+                _readOnly();
+                _validate();
+                _trim();
+                _recover();
+                _textSystem.reset();
+            }
+        }
+
+        namespace
+        {
+            System::File::Info writeFile(const System::File::Path& path, size_t size)
+            {
+                auto io = System::File::IO::create();
+                io->open(path.get(), System::File::Mode::Write);
+                std::vector<uint8_t> data(size, 0);
+                io->write(data.data(), data.size());
+                io->close();
+                return System::File::Info(path);
+            }
+
+            IO::Info getInfo(const std::string& fileName)
+            {
+                IO::Info out;
+                out.fileName = fileName;
+                out.videoSpeed = Math::IntRational(24, 1);
+                out.videoSequence = Math::Frame::Sequence(1, 10);
+                out.video.push_back(Image::Info(64, 32, Image::Type::RGBA_U8));
+                out.audio = Audio::Info(2, Audio::Type::S16, 48000);
+                out.audioSampleCount = 1000;
+                out.tags.set("Key", "Value");
+                return out;
+            }
+
+            std::shared_ptr<Image::Data> getImage()
+            {
+                auto out = Image::Data::create(Image::Info(16, 8, Image::Type::RGB_U8));
+                for (size_t i = 0; i < out->getDataByteCount(); ++i)
+                {
+                    out->getData()[i] = static_cast<uint8_t>(i);
+                }
+                out->setPluginName("Test");
+                Image::Tags tags;
+                tags.set("Key", "Value");
+                out->setTags(tags);
+                return out;
+            }
+
+        } // namespace
+
+        void ThumbnailCacheTest::_entries()
+        {
+            const System::File::Path path(getTempPath(), "entries.thumbnails");
+            const auto fileInfo = writeFile(System::File::Path(getTempPath(), "entries.ppm"), 100);
+            auto cache = ThumbnailCache::create(_textSystem, path.get(), Memory::megabyte, false);
+            DJV_ASSERT(path.get() == cache->getFileName());
+            DJV_ASSERT(0 == cache->getEntryCount());
+            DJV_ASSERT(0 == cache->getByteCount());
+            DJV_ASSERT(Memory::megabyte == cache->getMaxByteCount());
+
+            IO::Info info;
+            DJV_ASSERT(!cache->getInfo(fileInfo, 0, info));
+            DJV_ASSERT(!cache->getImage(fileInfo, 0));
+
+            const auto info2 = getInfo(fileInfo.getFileName());
+            cache->addInfo(fileInfo, 0, info2);
+            DJV_ASSERT(cache->getInfo(fileInfo, 0, info));
+            DJV_ASSERT(info2 == info);
+            DJV_ASSERT(!cache->getInfo(fileInfo, 1, info));
+
+            const auto image = getImage();
+            cache->addImage(fileInfo, 0, image);
+            auto image2 = cache->getImage(fileInfo, 0);
+            DJV_ASSERT(image2);
+            DJV_ASSERT(*image == *image2);
+            DJV_ASSERT(image->getPluginName() == image2->getPluginName());
+            DJV_ASSERT(image->getTags() == image2->getTags());
+            DJV_ASSERT(!cache->getImage(fileInfo, 1));
+            DJV_ASSERT(2 == cache->getEntryCount());
+            DJV_ASSERT(cache->getByteCount() > 0);
+            DJV_ASSERT(cache->getPercentageUsed() > 0.F);
+
+            // Replacing an entry should not change the number of entries.
+            cache->addImage(fileInfo, 0, image);
+            DJV_ASSERT(2 == cache->getEntryCount());
+            DJV_ASSERT(cache->getPackByteCount() > cache->getByteCount());
+
+            cache->clear();
+            DJV_ASSERT(0 == cache->getEntryCount());
+            DJV_ASSERT(0 == cache->getByteCount());
+            DJV_ASSERT(!cache->getInfo(fileInfo, 0, info));
+        }
+
+        void ThumbnailCacheTest::_persistent()
+        {
+            const System::File::Path path(getTempPath(), "persistent.thumbnails");
+            const auto fileInfo = writeFile(System::File::Path(getTempPath(), "persistent.ppm"), 100);
+            const auto info = getInfo(fileInfo.getFileName());
+            const auto image = getImage();
+            {
+                auto cache = ThumbnailCache::create(_textSystem, path.get(), Memory::megabyte, false);
+                cache->addInfo(fileInfo, 0, info);
+                cache->addImage(fileInfo, 0, image);
+            }
+            DJV_ASSERT(System::File::Info(path.get() + ".index").doesExist());
+            {
+                // Open the cache with the index.
+                auto cache = ThumbnailCache::create(_textSystem, path.get(), Memory::megabyte, false);
+                DJV_ASSERT(2 == cache->getEntryCount());
+                IO::Info info2;
+                DJV_ASSERT(cache->getInfo(fileInfo, 0, info2));
+                DJV_ASSERT(info == info2);
+                auto image2 = cache->getImage(fileInfo, 0);
+                DJV_ASSERT(image2);
+                DJV_ASSERT(*image == *image2);
+            }
+            {
+                // Open the cache without the index.
+                std::remove((path.get() + ".index").c_str());
+                auto cache = ThumbnailCache::create(_textSystem, path.get(), Memory::megabyte, false);
+                DJV_ASSERT(2 == cache->getEntryCount());
+                IO::Info info2;
+                DJV_ASSERT(cache->getInfo(fileInfo, 0, info2));
+                DJV_ASSERT(info == info2);
+            }
+        }
+
+        void ThumbnailCacheTest::_readOnly()
+        {
+            const System::File::Path path(getTempPath(), "readOnly.thumbnails");
+            const auto fileInfo = writeFile(System::File::Path(getTempPath(), "readOnly.ppm"), 100);
+            const auto info = getInfo(fileInfo.getFileName());
+            {
+                auto cache = ThumbnailCache::create(_textSystem, path.get(), Memory::megabyte, false);
+                DJV_ASSERT(!cache->isReadOnly());
+                cache->addInfo(fileInfo, 0, info);
+                {
+                    // The lock is held by the first cache so the second cache
+                    // is read-only.
+                    auto cache2 = ThumbnailCache::create(_textSystem, path.get(), Memory::megabyte, false);
+                    DJV_ASSERT(cache2->isReadOnly());
+                    DJV_ASSERT(1 == cache2->getEntryCount());
+                    IO::Info info2;
+                    DJV_ASSERT(cache2->getInfo(fileInfo, 0, info2));
+                    DJV_ASSERT(info == info2);
+                    const size_t packByteCount = cache2->getPackByteCount();
+                    cache2->addInfo(fileInfo, 1, info);
+                    DJV_ASSERT(!cache2->getInfo(fileInfo, 1, info2));
+                    DJV_ASSERT(packByteCount == cache2->getPackByteCount());
+                    cache2->clear();
+                    DJV_ASSERT(0 == cache2->getEntryCount());
+                }
+                DJV_ASSERT(!System::File::Info(path.get() + ".index").doesExist());
+                cache->addInfo(fileInfo, 1, info);
+                DJV_ASSERT(2 == cache->getEntryCount());
+            }
+            {
+                // The lock is released when the cache is destroyed.
+                auto cache = ThumbnailCache::create(_textSystem, path.get(), Memory::megabyte, false);
+                DJV_ASSERT(!cache->isReadOnly());
+                DJV_ASSERT(2 == cache->getEntryCount());
+            }
+        }
+
+        void ThumbnailCacheTest::_validate()
+        {
+            const System::File::Path path(getTempPath(), "validate.thumbnails");
+            const System::File::Path filePath(getTempPath(), "validate.ppm");
+            const System::File::Path filePath2(getTempPath(), "validate2.ppm");
+            auto fileInfo = writeFile(filePath, 100);
+            auto fileInfo2 = writeFile(filePath2, 100);
+            auto cache = ThumbnailCache::create(_textSystem, path.get(), Memory::megabyte, false);
+            cache->addInfo(fileInfo, 0, getInfo(fileInfo.getFileName()));
+            cache->addImage(fileInfo, 0, getImage());
+            cache->addInfo(fileInfo2, 0, getInfo(fileInfo2.getFileName()));
+            cache->validate();
+            DJV_ASSERT(3 == cache->getEntryCount());
+
+            // Entries for changed files are not used, and they are removed by
+            // the validation.
+            fileInfo = writeFile(filePath, 200);
+            IO::Info info;
+            DJV_ASSERT(!cache->getInfo(fileInfo, 0, info));
+            std::remove(filePath2.get().c_str());
+            cache->validate();
+            DJV_ASSERT(0 == cache->getEntryCount());
+        }
+
+        void ThumbnailCacheTest::_trim()
+        {
+            const System::File::Path path(getTempPath(), "trim.thumbnails");
+            const auto fileInfo = writeFile(System::File::Path(getTempPath(), "trim.ppm"), 100);
+            const size_t maxByteCount = 16 * Memory::kilobyte;
+            auto cache = ThumbnailCache::create(_textSystem, path.get(), maxByteCount, false);
+            const auto image = getImage();
+            for (size_t i = 0; i < 1000; ++i)
+            {
+                cache->addImage(fileInfo, i, image);
+
+                // Keep the first entry in use so it is not removed.
+                DJV_ASSERT(cache->getImage(fileInfo, 0));
+                DJV_ASSERT(cache->getPackByteCount() <= maxByteCount);
+            }
+            DJV_ASSERT(cache->getEntryCount() < 1000);
+            DJV_ASSERT(!cache->getImage(fileInfo, 1));
+            DJV_ASSERT(cache->getImage(fileInfo, 999));
+
+            cache->setMaxByteCount(maxByteCount / 2);
+            DJV_ASSERT(cache->getPackByteCount() <= maxByteCount / 2);
+            DJV_ASSERT(cache->getImage(fileInfo, 0));
+        }
+
+        void ThumbnailCacheTest::_recover()
+        {
+            const System::File::Path path(getTempPath(), "recover.thumbnails");
+            const auto fileInfo = writeFile(System::File::Path(getTempPath(), "recover.ppm"), 100);
+            const auto info = getInfo(fileInfo.getFileName());
+            {
+                auto cache = ThumbnailCache::create(_textSystem, path.get(), Memory::megabyte, false);
+                cache->addInfo(fileInfo, 0, info);
+            }
+            std::remove((path.get() + ".index").c_str());
+            {
+                // Simulate an incomplete entry at the end of the file.
+                auto io = System::File::IO::create();
+                io->open(path.get(), System::File::Mode::Append);
+                io->write("DJVR");
+            }
+            {
+                auto cache = ThumbnailCache::create(_textSystem, path.get(), Memory::megabyte, false);
+                DJV_ASSERT(1 == cache->getEntryCount());
+                IO::Info info2;
+                DJV_ASSERT(cache->getInfo(fileInfo, 0, info2));
+                DJV_ASSERT(info == info2);
+                cache->addInfo(fileInfo, 1, info);
+                DJV_ASSERT(cache->getInfo(fileInfo, 1, info2));
+            }
+            {
+                auto cache = ThumbnailCache::create(_textSystem, path.get(), Memory::megabyte, false);
+                cache->addInfo(fileInfo, 2, info);
+            }
+            std::remove((path.get() + ".index").c_str());
+            {
+                // Simulate a corrupt entry at the start of the file, the
+                // following entries should still be found.
+                auto io = System::File::IO::create();
+                io->open(path.get(), System::File::Mode::ReadWrite);
+                io->setPos(12);
+                io->writeU8(0xff);
+            }
+            {
+                auto cache = ThumbnailCache::create(_textSystem, path.get(), Memory::megabyte, false);
+                DJV_ASSERT(2 == cache->getEntryCount());
+                IO::Info info2;
+                DJV_ASSERT(!cache->getInfo(fileInfo, 0, info2));
+                DJV_ASSERT(cache->getInfo(fileInfo, 1, info2));
+                DJV_ASSERT(cache->getInfo(fileInfo, 2, info2));
+                DJV_ASSERT(info == info2);
+            }
+            {
+                // Not a pack file.
+                auto io = System::File::IO::create();
+                io->open(path.get(), System::File::Mode::Write);
+                io->write("Hello world!");
+            }
+            std::remove((path.get() + ".index").c_str());
+            {
+                auto cache = ThumbnailCache::create(_textSystem, path.get(), Memory::megabyte, false);
+                DJV_ASSERT(0 == cache->getEntryCount());
+            }
+        }
+
+    } // namespace AVTest
+} // namespace djv
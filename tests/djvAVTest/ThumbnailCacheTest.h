@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvTestLib/Test.h>
+
+namespace djv
+{
+    namespace System
+    {
+        class TextSystem;
+
+    } // namespace System
+
+    namespace AVTest
+    {
+        class ThumbnailCacheTest : public Test::ITest
+        {
+        public:
+            ThumbnailCacheTest(
+                const System::File::Path& tempPath,
+                const std::shared_ptr<System::Context>&);
+            
+            void run() override;
+            
+        private:
+            void _entries();
+            void _persistent();
+            void _readOnly();
+            void _validate();
+            void _trim();
+            void _recover();
+
+            std::shared_ptr<System::TextSystem> _textSystem;
+        };
+        
+    } // namespace AVTest
+} // namespace djv
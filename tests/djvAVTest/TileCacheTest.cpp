@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVTest/TileCacheTest.h>
+
+#include <djvAV/TileCache.h>
+
+using namespace djv::Core;
+using namespace djv::AV;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        TileCacheTest::TileCacheTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::AVTest::TileCacheTest", tempPath, context)
+        {}
+
+        void TileCacheTest::run()
+        {
+            _tile();
+            _util();
+            _cache();
+        }
+
+        void TileCacheTest::_tile()
+        {
+            {
+                const IO::Tile tile;
+                DJV_ASSERT(Math::Frame::invalidIndex == tile.frame);
+                DJV_ASSERT(0 == tile.level);
+                DJV_ASSERT(0 == tile.x);
+                DJV_ASSERT(0 == tile.y);
+            }
+
+            {
+                const IO::Tile tile(1, 2, 3, 4);
+                DJV_ASSERT(1 == tile.frame);
+                DJV_ASSERT(2 == tile.level);
+                DJV_ASSERT(3 == tile.x);
+                DJV_ASSERT(4 == tile.y);
+                DJV_ASSERT(tile == IO::Tile(1, 2, 3, 4));
+                DJV_ASSERT(tile != IO::Tile(1, 2, 3, 5));
+                DJV_ASSERT(tile < IO::Tile(2, 0, 0, 0));
+                DJV_ASSERT(IO::Tile(1, 2, 3, 3) < tile);
+                DJV_ASSERT(std::hash<IO::Tile>()(tile) == std::hash<IO::Tile>()(IO::Tile(1, 2, 3, 4)));
+            }
+        }
+
+        void TileCacheTest::_util()
+        {
+            {
+                DJV_ASSERT(Image::Size(1001, 3) == IO::getLevelSize(Image::Size(1001, 3), 0));
+                DJV_ASSERT(Image::Size(501, 2) == IO::getLevelSize(Image::Size(1001, 3), 1));
+                DJV_ASSERT(Image::Size(251, 1) == IO::getLevelSize(Image::Size(1001, 3), 2));
+            }
+
+            {
+                DJV_ASSERT(1 == IO::getLevelCount(Image::Size(512, 512), 512));
+                DJV_ASSERT(2 == IO::getLevelCount(Image::Size(513, 100), 512));
+                DJV_ASSERT(7 == IO::getLevelCount(Image::Size(32768, 16384), 512));
+            }
+
+            {
+                uint32_t x = 0;
+                uint32_t y = 0;
+                IO::getTileCount(Image::Size(1025, 512), x, y, 512);
+                DJV_ASSERT(3 == x);
+                DJV_ASSERT(1 == y);
+            }
+
+            {
+                const auto window = IO::getTileWindow(IO::Tile(0, 0, 2, 0), Image::Size(1025, 512), 512);
+                DJV_ASSERT(1024 == window.min.x);
+                DJV_ASSERT(0 == window.min.y);
+                DJV_ASSERT(1 == window.w());
+                DJV_ASSERT(512 == window.h());
+            }
+        }
+
+        void TileCacheTest::_cache()
+        {
+            auto tileCache = IO::TileCache::create();
+            DJV_ASSERT(0 == tileCache->getByteCount());
+            DJV_ASSERT(0 == tileCache->getCount());
+
+            const Image::Info info(16, 16, Image::Type::RGBA_U8);
+            const size_t byteCount = info.getDataByteCount();
+            tileCache->setMaxByteCount(byteCount * 3);
+            DJV_ASSERT(byteCount * 3 == tileCache->getMaxByteCount());
+            for (uint32_t i = 0; i < 4; ++i)
+            {
+                tileCache->add(IO::Tile(0, 0, i, 0), Image::Data::create(info));
+            }
+            DJV_ASSERT(3 == tileCache->getCount());
+            DJV_ASSERT(byteCount * 3 == tileCache->getByteCount());
+            DJV_ASSERT(!tileCache->contains(IO::Tile(0, 0, 0, 0)));
+            DJV_ASSERT(tileCache->contains(IO::Tile(0, 0, 3, 0)));
+
+            std::shared_ptr<Image::Data> image;
+            DJV_ASSERT(tileCache->get(IO::Tile(0, 0, 1, 0), image));
+            DJV_ASSERT(image);
+            tileCache->add(IO::Tile(1, 0, 0, 0), Image::Data::create(info));
+            DJV_ASSERT(tileCache->contains(IO::Tile(0, 0, 1, 0)));
+            DJV_ASSERT(!tileCache->contains(IO::Tile(0, 0, 2, 0)));
+
+            tileCache->clear();
+            DJV_ASSERT(0 == tileCache->getCount());
+            DJV_ASSERT(0 == tileCache->getByteCount());
+        }
+        
+    } // namespace AVTest
+} // namespace djv
+
@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVTest/TileTestUtil.h>
+
+#include <djvAV/IOSystem.h>
+#include <djvAV/TileCache.h>
+
+#include <djvImage/Convert.h>
+#include <djvImage/Data.h>
+
+#include <djvSystem/Context.h>
+#include <djvSystem/FileInfo.h>
+#include <djvSystem/Timer.h>
+
+#include <cmath>
+#include <thread>
+
+using namespace djv::Core;
+using namespace djv::AV;
+using namespace djv::AV::IO;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        namespace
+        {
+            //! The size is not a multiple of the tile size so that the tiles
+            //! on the right and bottom edges are partial.
+            const Image::Size size(1100, 700);
+
+            std::shared_ptr<Image::Data> convertF32(const std::shared_ptr<Image::Data>& image)
+            {
+                auto out = Image::Data::create(Image::Info(image->getSize(), Image::Type::RGBA_F32));
+                Image::Convert::create(1)->process(*image, out->getInfo(), *out);
+                return out;
+            }
+
+            void compare(
+                const std::shared_ptr<Image::Data>& tile,
+                const std::shared_ptr<Image::Data>& image,
+                const Math::BBox2i& window)
+            {
+                DJV_ASSERT(tile);
+                DJV_ASSERT(Image::Size(window.w(), window.h()) == tile->getSize());
+                const auto tileF32 = convertF32(tile);
+                for (int y = 0; y < window.h(); ++y)
+                {
+                    for (int x = 0; x < window.w(); ++x)
+                    {
+                        const float* a = reinterpret_cast<const float*>(tileF32->getData(x, y));
+                        const float* b = reinterpret_cast<const float*>(image->getData(window.min.x + x, window.min.y + y));
+                        for (size_t c = 0; c < 4; ++c)
+                        {
+                            DJV_ASSERT(fabsf(a[c] - b[c]) < .01F);
+                        }
+                    }
+                }
+            }
+
+        } // namespace
+
+        void tileTest(const System::File::Info& fileInfo, const std::shared_ptr<System::Context>& context)
+        {
+            auto io = context->getSystemT<IOSystem>();
+
+            // Write the image. Neighboring pixels are different so that
+            // misplaced tiles are detected.
+            const Image::Info imageInfo(size, Image::Type::RGB_U8);
+            auto image = Image::Data::create(imageInfo);
+            for (uint32_t y = 0; y < size.h; ++y)
+            {
+                uint8_t* p = image->getData(y);
+                for (uint32_t x = 0; x < size.w; ++x, p += 3)
+                {
+                    for (uint32_t c = 0; c < 3; ++c)
+                    {
+                        p[c] = static_cast<uint8_t>((x * 7 + y * 13 + c * 50) % 256);
+                    }
+                }
+            }
+            {
+                Info info;
+                info.video.push_back(imageInfo);
+                auto write = io->write(fileInfo, info);
+                {
+                    std::lock_guard<std::mutex> lock(write->getMutex());
+                    auto& writeQueue = write->getVideoQueue();
+                    writeQueue.addFrame(VideoFrame(0, image));
+                    writeQueue.setFinished(true);
+                }
+                while (write->isRunning())
+                {
+                    std::this_thread::sleep_for(System::getTimerDuration(System::TimerValue::Fast));
+                }
+            }
+
+            // Read the full resolution image.
+            auto read = io->read(fileInfo);
+            read->getInfo().get();
+            DJV_ASSERT(read->canReadTiles());
+            std::shared_ptr<Image::Data> readImage;
+            bool running = true;
+            while (running)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(read->getMutex());
+                    auto& readQueue = read->getVideoQueue();
+                    if (!readQueue.isEmpty())
+                    {
+                        readImage = readQueue.popFrame().data;
+                    }
+                    running = !readQueue.isFinished() || !readQueue.isEmpty();
+                }
+                if (running)
+                {
+                    std::this_thread::sleep_for(System::getTimerDuration(System::TimerValue::Fast));
+                }
+            }
+            DJV_ASSERT(readImage);
+            DJV_ASSERT(size == readImage->getSize());
+
+            // Compare the level zero tiles with crops of the image.
+            const auto level0 = convertF32(readImage);
+            for (const auto& tile : { Tile(0, 0, 0, 0), Tile(0, 0, 2, 1) })
+            {
+                compare(read->readTile(tile).get(), level0, getTileWindow(tile, size));
+            }
+
+            // Compare the level one tiles with crops of the reduced image.
+            const Image::Size levelSize = getLevelSize(size, 1);
+            auto reducedInfo = readImage->getInfo();
+            reducedInfo.size = levelSize;
+            reducedInfo.layout = Image::Layout();
+            auto reduced = Image::Data::create(reducedInfo);
+            Image::Convert::create(1)->process(*readImage, reducedInfo, *reduced);
+            const auto level1 = convertF32(reduced);
+            for (const auto& tile : { Tile(0, 1, 0, 0), Tile(0, 1, 1, 0) })
+            {
+                compare(read->readTile(tile).get(), level1, getTileWindow(tile, levelSize));
+            }
+        }
+
+    } // namespace AVTest
+} // namespace djv
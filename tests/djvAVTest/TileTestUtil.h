@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <memory>
+
+namespace djv
+{
+    namespace System
+    {
+        class Context;
+
+        namespace File
+        {
+            class Info;
+
+        } // namespace File
+    } // namespace System
+
+    namespace AVTest
+    {
+        //! Write an image and compare the tiles read with
+        //! AV::IO::IRead::readTile() against the full resolution image. Level
+        //! zero tiles are compared with crops of the image, and level one
+        //! tiles with crops of the reduced image.
+        void tileTest(const System::File::Info&, const std::shared_ptr<System::Context>&);
+
+    } // namespace AVTest
+} // namespace djv
@@ -25,8 +25,11 @@ namespace djv
                 cache.add(1, "a");
                 cache.add(2, "b");
                 cache.add(3, "c");
-                DJV_ASSERT(cache.getKeys() == std::vector<int>({ 1, 2, 3 }));
-                DJV_ASSERT(cache.getValues() == std::vector<std::string>({ "a", "b", "c" }));
+                DJV_ASSERT(cache.getKeys() == std::vector<int>({ 3, 2, 1 }));
+                DJV_ASSERT(cache.getValues() == std::vector<std::string>({ "c", "b", "a" }));
+                std::string value;
+                DJV_ASSERT(cache.get(1, value));
+                DJV_ASSERT(cache.getKeys() == std::vector<int>({ 1, 3, 2 }));
                 std::string key;
                 DJV_ASSERT(!cache.get(0, key));
             }
@@ -43,6 +46,72 @@ namespace djv
                 DJV_ASSERT(cache.getKeys() == std::vector<int>({ 2, 3 }));
                 DJV_ASSERT(cache.getValues() == std::vector<std::string>({ "b", "c" }));
             }
+
+            {
+                Memory::Cache<int, std::string> cache;
+                cache.setMax(2);
+                cache.add(1, "a");
+                cache.add(2, "b");
+                std::string value;
+                DJV_ASSERT(cache.get(1, value));
+                cache.add(3, "c");
+                DJV_ASSERT(cache.contains(1));
+                DJV_ASSERT(!cache.contains(2));
+                DJV_ASSERT(cache.contains(3));
+                cache.add(1, "d");
+                DJV_ASSERT(2 == cache.getSize());
+                DJV_ASSERT(cache.get(1, value));
+                DJV_ASSERT("d" == value);
+                cache.remove(1);
+                DJV_ASSERT(!cache.contains(1));
+                DJV_ASSERT(1 == cache.getSize());
+                cache.clear();
+                DJV_ASSERT(0 == cache.getSize());
+            }
+
+            {
+                Memory::Cache<int, std::string> cache;
+                cache.setCostFunction(
+                    [](const std::string& value)
+                    {
+                        return value.size();
+                    });
+                cache.setMaxCost(6);
+                DJV_ASSERT(6 == cache.getMaxCost());
+                cache.add(1, "aa");
+                cache.add(2, "bb");
+                cache.add(3, "cc");
+                DJV_ASSERT(6 == cache.getCost());
+                DJV_ASSERT(100.F == cache.getPercentageUsed());
+                cache.add(4, "dddd");
+                DJV_ASSERT(cache.getKeys() == std::vector<int>({ 4, 3 }));
+                DJV_ASSERT(6 == cache.getCost());
+                cache.remove(3);
+                DJV_ASSERT(4 == cache.getCost());
+                cache.setMaxCost(0);
+                cache.add(5, "eeeeeeee");
+                DJV_ASSERT(12 == cache.getCost());
+                cache.clear();
+                DJV_ASSERT(0 == cache.getCost());
+            }
+
+            {
+                Memory::Cache<int, std::string> cache;
+                cache.setMax(1);
+                cache.add(1, "a");
+                cache.add(2, "b");
+                std::string value;
+                cache.get(1, value);
+                cache.get(2, value);
+                cache.get(2, value);
+                DJV_ASSERT(2 == cache.getHitCount());
+                DJV_ASSERT(1 == cache.getMissCount());
+                DJV_ASSERT(1 == cache.getEvictionCount());
+                cache.resetStatistics();
+                DJV_ASSERT(0 == cache.getHitCount());
+                DJV_ASSERT(0 == cache.getMissCount());
+                DJV_ASSERT(0 == cache.getEvictionCount());
+            }
         }
         
     } // namespace CoreTest
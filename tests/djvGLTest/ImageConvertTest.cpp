@@ -54,7 +54,13 @@ namespace djv
                     Image::Type::RGBA_U16,
                     Image::Type::RGBA_U32,
                     Image::Type::RGBA_F16,
-                    Image::Type::RGBA_F32
+                    Image::Type::RGBA_F32,
+                    Image::Type::YUV_420P_U10,
+                    Image::Type::YUV_422P_U10,
+                    Image::Type::YUV_444P_U10,
+                    Image::Type::YUV_420P_U16,
+                    Image::Type::YUV_422P_U16,
+                    Image::Type::YUV_444P_U16
 #else // DJV_GL_ES2
                     Image::Type::L_U32,
                     Image::Type::LA_U32,
@@ -72,9 +78,18 @@ namespace djv
                 }
                 const auto& textSystem = context->getSystemT<System::TextSystem>();
                 const auto& resourceSystem = context->getSystemT<System::ResourceSystem>();
+                // Planar YUV images can only be converted from.
+                std::vector<Image::Type> outputTypes;
                 for (const auto& i : types)
                 {
-                    for (const auto& j : types)
+                    if (!Image::isYUVType(i))
+                    {
+                        outputTypes.push_back(i);
+                    }
+                }
+                for (const auto& i : types)
+                {
+                    for (const auto& j : outputTypes)
                     {
                         for (const auto& k : {
                             Image::Layout(Image::Mirror(false, false)),
@@ -0,0 +1,206 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvImageTest/ConvertTest.h>
+
+#include <djvImage/Convert.h>
+#include <djvImage/Data.h>
+
+#include <djvCore/Memory.h>
+
+#include <cmath>
+
+using namespace djv::Core;
+using namespace djv::Image;
+
+namespace djv
+{
+    namespace ImageTest
+    {
+        ConvertTest::ConvertTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::ImageTest::ConvertTest", tempPath, context)
+        {}
+        
+        void ConvertTest::run()
+        {
+            _types();
+            _layout();
+            _yuv();
+            _resize();
+            _threads();
+        }
+
+        void ConvertTest::_types()
+        {
+            // Convert black and white pixels through every pair of types.
+            auto convert = Image::Convert::create();
+            auto data = Image::Data::create(Image::Info(2, 1, Image::Type::RGBA_F32));
+            float* p = reinterpret_cast<float*>(data->getData());
+            for (size_t i = 0; i < 4; ++i)
+            {
+                p[i] = 3 == i ? 1.F : 0.F;
+                p[4 + i] = 1.F;
+            }
+            for (auto i : Image::getTypeEnums())
+            {
+                if (Image::Type::None == i || Image::isYUVType(i))
+                {
+                    continue;
+                }
+                const Image::Info info(2, 1, i);
+                auto data2 = Image::Data::create(info);
+                convert->process(*data, info, *data2);
+                for (auto j : Image::getTypeEnums())
+                {
+                    if (Image::Type::None == j || Image::isYUVType(j))
+                    {
+                        continue;
+                    }
+                    const Image::Info info2(2, 1, j);
+                    auto data3 = Image::Data::create(info2);
+                    convert->process(*data2, info2, *data3);
+                    auto data4 = Image::Data::create(data->getInfo());
+                    convert->process(*data3, data->getInfo(), *data4);
+                    const float* p2 = reinterpret_cast<const float*>(data4->getData());
+                    for (size_t k = 0; k < 8; ++k)
+                    {
+                        DJV_ASSERT(std::abs(p[k] - p2[k]) < .001F);
+                    }
+                }
+            }
+        }
+
+        void ConvertTest::_layout()
+        {
+            auto convert = Image::Convert::create();
+            {
+                auto data = Image::Data::create(Image::Info(3, 2, Image::Type::L_U16));
+                uint16_t* p = reinterpret_cast<uint16_t*>(data->getData());
+                for (uint16_t i = 0; i < 6; ++i)
+                {
+                    p[i] = i;
+                }
+                const Image::Info info(3, 2, Image::Type::L_U16, Image::Layout(Image::Mirror(true, true)));
+                auto data2 = Image::Data::create(info);
+                convert->process(*data, info, *data2);
+                const uint16_t* p2 = reinterpret_cast<const uint16_t*>(data2->getData());
+                for (uint16_t i = 0; i < 6; ++i)
+                {
+                    DJV_ASSERT(5 - i == p2[i]);
+                }
+            }
+
+            {
+                auto data = Image::Data::create(Image::Info(3, 1, Image::Type::L_U16));
+                uint16_t* p = reinterpret_cast<uint16_t*>(data->getData());
+                for (uint16_t i = 0; i < 3; ++i)
+                {
+                    p[i] = 0x0102 * (i + 1);
+                }
+                const Image::Info info(
+                    3, 1, Image::Type::L_U16,
+                    Image::Layout(Image::Mirror(), 4, Memory::opposite(Memory::getEndian())));
+                auto data2 = Image::Data::create(info);
+                convert->process(*data, info, *data2);
+                DJV_ASSERT(8 == data2->getScanlineByteCount());
+                const uint16_t* p2 = reinterpret_cast<const uint16_t*>(data2->getData());
+                for (uint16_t i = 0; i < 3; ++i)
+                {
+                    DJV_ASSERT(0x0201 * (i + 1) == p2[i]);
+                }
+            }
+
+            {
+                auto data = Image::Data::create(Image::Info(1, 1, Image::Type::RGB_U16));
+                uint16_t* p = reinterpret_cast<uint16_t*>(data->getData());
+                p[0] = 65535;
+                p[1] = 32768;
+                p[2] = 0;
+                const Image::Info info(1, 1, Image::Type::RGB_U10);
+                auto data2 = Image::Data::create(info);
+                convert->process(*data, info, *data2);
+                const auto& u10 = *reinterpret_cast<const Image::U10_S*>(data2->getData());
+                DJV_ASSERT(1023 == u10.r);
+                DJV_ASSERT(512 == u10.g);
+                DJV_ASSERT(0 == u10.b);
+            }
+
+            {
+                auto data = Image::Data::create(Image::Info(1, 1, Image::Type::RGBA_U8));
+                uint8_t* p = data->getData();
+                p[0] = 30;
+                p[1] = 60;
+                p[2] = 90;
+                p[3] = 128;
+                const Image::Info info(1, 1, Image::Type::LA_U8);
+                auto data2 = Image::Data::create(info);
+                convert->process(*data, info, *data2);
+                DJV_ASSERT(60 == data2->getData()[0]);
+                DJV_ASSERT(128 == data2->getData()[1]);
+            }
+        }
+
+        void ConvertTest::_yuv()
+        {
+            auto convert = Image::Convert::create();
+            for (auto range : Image::getYUVRangeEnums())
+            {
+                Image::Info info(4, 4, Image::Type::YUV_420P_U8);
+                info.yuvRange = range;
+                auto data = Image::Data::create(info);
+                const uint8_t white = Image::YUVRange::Video == range ? 235 : 255;
+                memset(data->getPlaneData(0), white, info.getPlaneByteCount(0));
+                memset(data->getPlaneData(1), 128, info.getPlaneByteCount(1));
+                memset(data->getPlaneData(2), 128, info.getPlaneByteCount(2));
+                const Image::Info info2(4, 4, Image::Type::RGB_U8);
+                auto data2 = Image::Data::create(info2);
+                convert->process(*data, info2, *data2);
+                for (size_t i = 0; i < info2.getDataByteCount(); ++i)
+                {
+                    DJV_ASSERT(255 == data2->getData()[i]);
+                }
+            }
+        }
+
+        void ConvertTest::_resize()
+        {
+            auto convert = Image::Convert::create();
+            auto data = Image::Data::create(Image::Info(16, 8, Image::Type::RGB_U8));
+            for (size_t i = 0; i < data->getDataByteCount(); ++i)
+            {
+                data->getData()[i] = i % 3 * 100;
+            }
+            for (const auto& size : { Image::Size(5, 3), Image::Size(32, 17) })
+            {
+                const Image::Info info(size, Image::Type::RGBA_U8);
+                auto data2 = Image::Data::create(info);
+                convert->process(*data, info, *data2);
+                for (size_t i = 0; i < info.getDataByteCount(); ++i)
+                {
+                    DJV_ASSERT((3 == i % 4 ? 255 : i % 4 * 100) == data2->getData()[i]);
+                }
+            }
+        }
+
+        void ConvertTest::_threads()
+        {
+            auto data = Image::Data::create(Image::Info(512, 512, Image::Type::RGBA_U8));
+            for (size_t i = 0; i < data->getDataByteCount(); ++i)
+            {
+                data->getData()[i] = static_cast<uint8_t>(i * 7);
+            }
+            const Image::Info info(512, 512, Image::Type::RGB_F16, Image::Layout(Image::Mirror(true, false)));
+            auto data2 = Image::Data::create(info);
+            Image::Convert::create(1)->process(*data, info, *data2);
+            auto data3 = Image::Data::create(info);
+            auto convert = Image::Convert::create(4);
+            DJV_ASSERT(4 == convert->getThreadCount());
+            convert->process(*data, info, *data3);
+            DJV_ASSERT(*data2 == *data3);
+        }
+        
+    } // namespace ImageTest
+} // namespace djv
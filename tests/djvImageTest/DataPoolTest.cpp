@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvImageTest/DataPoolTest.h>
+
+#include <djvImage/Data.h>
+#include <djvImage/DataPool.h>
+
+#include <cstring>
+
+using namespace djv::Core;
+using namespace djv::Image;
+
+namespace djv
+{
+    namespace ImageTest
+    {
+        DataPoolTest::DataPoolTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::ImageTest::DataPoolTest", tempPath, context)
+        {}
+        
+        void DataPoolTest::run()
+        {
+            _sizeClass();
+            _pool();
+            _data();
+        }
+                
+        void DataPoolTest::_sizeClass()
+        {
+            DJV_ASSERT(256 == DataPool::getSizeClass(0));
+            DJV_ASSERT(256 == DataPool::getSizeClass(1));
+            DJV_ASSERT(256 == DataPool::getSizeClass(256));
+            for (size_t i = 1; i < 100000; i += 997)
+            {
+                const size_t sizeClass = DataPool::getSizeClass(i);
+                DJV_ASSERT(sizeClass >= i);
+                DJV_ASSERT(sizeClass == DataPool::getSizeClass(sizeClass));
+            }
+        }
+
+        void DataPoolTest::_pool()
+        {
+            {
+                auto pool = DataPool::create();
+                DJV_ASSERT(pool->getMaxByteCount() > 0);
+                DJV_ASSERT(!pool->hasHugePages());
+                DJV_ASSERT(0 == pool->getUsedByteCount());
+                DJV_ASSERT(0 == pool->getFreeByteCount());
+                DJV_ASSERT(0.F == pool->getFreePercentage());
+            }
+
+            {
+                auto pool = DataPool::create();
+                const size_t byteCount = 1000;
+                const size_t sizeClass = DataPool::getSizeClass(byteCount);
+                uint8_t* a = pool->allocate(byteCount);
+                DJV_ASSERT(a);
+                DJV_ASSERT(0 == reinterpret_cast<uintptr_t>(a) % 64);
+                DJV_ASSERT(sizeClass == pool->getUsedByteCount());
+                pool->release(a, byteCount);
+                DJV_ASSERT(0 == pool->getUsedByteCount());
+                DJV_ASSERT(sizeClass == pool->getFreeByteCount());
+
+                // Allocations of the same size class re-use the memory.
+                uint8_t* b = pool->allocate(sizeClass - 1);
+                DJV_ASSERT(a == b);
+                DJV_ASSERT(2 == pool->getAllocationCount());
+                DJV_ASSERT(1 == pool->getReuseCount());
+                DJV_ASSERT(0 == pool->getFreeByteCount());
+                pool->release(b, sizeClass - 1);
+
+                pool->clear();
+                DJV_ASSERT(0 == pool->getFreeByteCount());
+            }
+
+            {
+                auto pool = DataPool::create();
+                pool->setHugePages(true);
+                DJV_ASSERT(pool->hasHugePages());
+                const size_t byteCount = 4 * 1024 * 1024;
+                uint8_t* a = pool->allocate(byteCount);
+                DJV_ASSERT(a);
+                DJV_ASSERT(0 == reinterpret_cast<uintptr_t>(a) % (2 * 1024 * 1024));
+                memset(a, 1, byteCount);
+                pool->release(a, byteCount);
+
+                // Huge page allocations are re-used like the others.
+                uint8_t* b = pool->allocate(byteCount);
+                DJV_ASSERT(a == b);
+                DJV_ASSERT(1 == pool->getReuseCount());
+                pool->release(b, byteCount);
+
+                // Small allocations do not use huge pages.
+                uint8_t* c = pool->allocate(1000);
+                DJV_ASSERT(c);
+                DJV_ASSERT(0 == reinterpret_cast<uintptr_t>(c) % 64);
+                pool->release(c, 1000);
+
+                pool->setHugePages(false);
+                DJV_ASSERT(!pool->hasHugePages());
+            }
+
+            {
+                auto pool = DataPool::create();
+                pool->setMaxByteCount(1024);
+                DJV_ASSERT(1024 == pool->getMaxByteCount());
+                uint8_t* a = pool->allocate(512);
+                uint8_t* b = pool->allocate(512);
+                uint8_t* c = pool->allocate(512);
+                uint8_t* d = pool->allocate(4096);
+                pool->release(a, 512);
+                pool->release(b, 512);
+                pool->release(c, 512);
+                pool->release(d, 4096);
+                DJV_ASSERT(1024 == pool->getFreeByteCount());
+                DJV_ASSERT(100.F == pool->getFreePercentage());
+
+                // Releasing a different size class frees the other memory.
+                uint8_t* e = pool->allocate(768);
+                pool->release(e, 768);
+                DJV_ASSERT(pool->getFreeByteCount() <= 1024);
+                uint8_t* f = pool->allocate(768);
+                DJV_ASSERT(e == f);
+                pool->release(f, 768);
+
+                pool->setMaxByteCount(0);
+                DJV_ASSERT(0 == pool->getFreeByteCount());
+            }
+        }
+
+        void DataPoolTest::_data()
+        {
+            auto pool = DataPool::create();
+            const Image::Info info(16, 16, Image::Type::RGBA_U8);
+            const uint8_t* p = nullptr;
+            {
+                auto data = Image::Data::create(info, pool);
+                DJV_ASSERT(data->isValid());
+                DJV_ASSERT(info == data->getInfo());
+                p = data->getData();
+                DJV_ASSERT(pool->getUsedByteCount() >= data->getDataByteCount());
+            }
+            DJV_ASSERT(0 == pool->getUsedByteCount());
+            {
+                auto data = Image::Data::create(info, pool);
+                DJV_ASSERT(p == data->getData());
+                DJV_ASSERT(1 == pool->getReuseCount());
+            }
+            {
+                auto data = Image::Data::create(info, std::shared_ptr<DataPool>());
+                DJV_ASSERT(data->isValid());
+            }
+        }
+
+    } // namespace ImageTest
+} // namespace djv
+
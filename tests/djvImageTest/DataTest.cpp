@@ -7,8 +7,16 @@
 #include <djvImage/Color.h>
 #include <djvImage/Data.h>
 
+#if defined(DJV_MMAP)
+#include <djvSystem/File.h>
+#include <djvSystem/FileIO.h>
+#include <djvSystem/Path.h>
+#endif // DJV_MMAP
+
 #include <djvCore/Memory.h>
 
+#include <cstring>
+
 using namespace djv::Core;
 using namespace djv::Image;
 
@@ -26,6 +34,9 @@ namespace djv
         {
             _data();
             _operators();
+#if defined(DJV_MMAP)
+            _memoryMap();
+#endif // DJV_MMAP
         }
                 
         void DataTest::_data()
@@ -128,6 +139,64 @@ namespace djv
             }
         }
         
+#if defined(DJV_MMAP)
+        void DataTest::_memoryMap()
+        {
+            const Image::Info info(2, 2, Image::Type::L_U8);
+            const std::string fileName = System::File::Path(getTempPath(), "DataTest.raw").get();
+            {
+                auto io = System::File::IO::create();
+                io->open(fileName, System::File::Mode::Write);
+                const uint8_t header[] = { 9, 9 };
+                io->write(header, 2);
+                const uint8_t data[] = { 1, 2, 3, 4 };
+                io->write(data, 4);
+            }
+
+            {
+                auto io = System::File::IO::create();
+                io->open(fileName, System::File::Mode::Read);
+                io->seek(2);
+                auto data = Image::Data::create(info, io);
+                DJV_ASSERT(data->isMemoryMapped());
+                DJV_ASSERT(6 == io->getPos());
+                const auto constData = std::const_pointer_cast<const Image::Data>(data);
+                DJV_ASSERT(1 == constData->getData()[0]);
+                DJV_ASSERT(4 == constData->getData(1, 1)[0]);
+
+                data->detach();
+                DJV_ASSERT(!data->isMemoryMapped());
+                DJV_ASSERT(4 == data->getData(1, 1)[0]);
+                data->detach();
+            }
+
+            {
+                // The data must be detached before it is written.
+                auto io = System::File::IO::create();
+                io->open(fileName, System::File::Mode::Read);
+                io->seek(2);
+                auto data = Image::Data::create(info, io);
+                DJV_ASSERT(1 == data->getData()[0]);
+                DJV_ASSERT(data->isMemoryMapped());
+                data->detach();
+                data->getData()[0] = 5;
+                DJV_ASSERT(!data->isMemoryMapped());
+                DJV_ASSERT(5 == data->getData()[0]);
+            }
+
+            try
+            {
+                auto io = System::File::IO::create();
+                io->open(fileName, System::File::Mode::Read);
+                io->seek(4);
+                Image::Data::create(info, io);
+                DJV_ASSERT(false);
+            }
+            catch (const std::exception&)
+            {}
+        }
+#endif // DJV_MMAP
+
         void DataTest::_util()
         {
             {
@@ -223,6 +292,27 @@ namespace djv
                     _print("Average: " + ss.str());
                 }
             }
+
+            {
+                Image::Info info(4, 2, Image::Type::YUV_420P_U8);
+                info.yuvRange = Image::YUVRange::Full;
+                auto data = Image::Data::create(info);
+                memset(data->getPlaneData(0), 0, info.getPlaneScanlineByteCount(0));
+                memset(data->getPlaneData(0) + info.getPlaneScanlineByteCount(0), 255, info.getPlaneScanlineByteCount(0));
+                memset(data->getPlaneData(1), 128, info.getPlaneByteCount(1));
+                memset(data->getPlaneData(2), 128, info.getPlaneByteCount(2));
+                const auto average = Image::getAverageColor(data);
+                {
+                    std::stringstream ss;
+                    ss << average;
+                    _print("Average: " + ss.str());
+                }
+                DJV_ASSERT(Image::Type::RGB_U8 == average.getType());
+                const uint8_t* p = average.getData();
+                DJV_ASSERT(p[0] >= 127 && p[0] <= 128);
+                DJV_ASSERT(p[0] == p[1]);
+                DJV_ASSERT(p[0] == p[2]);
+            }
         }
 
     } // namespace ImageTest
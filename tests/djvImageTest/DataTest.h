@@ -20,6 +20,9 @@ namespace djv
         private:
             void _data();
             void _operators();
+#if defined(DJV_MMAP)
+            void _memoryMap();
+#endif // DJV_MMAP
             void _util();
         };
         
@@ -28,6 +28,7 @@ namespace djv
             _layout();
             _size();
             _info();
+            _planes();
             _serialize();
         }
         
@@ -85,6 +86,13 @@ namespace djv
                 const Image::Size size(1, 2);
                 DJV_ASSERT(.5F == size.getAspectRatio());
             }
+
+            {
+                const Image::Size size(131072, 65536);
+                DJV_ASSERT(131072 == size.w);
+                DJV_ASSERT(65536 == size.h);
+                DJV_ASSERT(2.F == size.getAspectRatio());
+            }
         }
         
         void InfoTest::_info()
@@ -187,6 +195,57 @@ namespace djv
             }
         }
 
+        void InfoTest::_planes()
+        {
+            {
+                const Image::Info info(5, 3, Image::Type::RGB_U8);
+                DJV_ASSERT(1 == info.getPlaneCount());
+                DJV_ASSERT(info.size == info.getPlaneSize(0));
+                DJV_ASSERT(0 == info.getPlaneOffset(0));
+                DJV_ASSERT(info.getDataByteCount() == info.getPlaneByteCount(0));
+            }
+
+            {
+                const Image::Info info(32768, 16384, Image::Type::RGBA_F32);
+                DJV_ASSERT(32768 * 16 == info.getScanlineByteCount());
+                DJV_ASSERT(static_cast<size_t>(32768) * 16384 * 16 == info.getDataByteCount());
+            }
+
+            {
+                const Image::Info info(5, 3, Image::Type::YUV_420P_U8);
+                DJV_ASSERT(3 == info.getPlaneCount());
+                DJV_ASSERT(1 == info.getPixelByteCount());
+                DJV_ASSERT(Image::Size(5, 3) == info.getPlaneSize(0));
+                DJV_ASSERT(Image::Size(3, 2) == info.getPlaneSize(1));
+                DJV_ASSERT(Image::Size(3, 2) == info.getPlaneSize(2));
+                DJV_ASSERT(5 == info.getScanlineByteCount());
+                DJV_ASSERT(15 == info.getPlaneOffset(1));
+                DJV_ASSERT(21 == info.getPlaneOffset(2));
+                DJV_ASSERT(27 == info.getDataByteCount());
+            }
+
+            {
+                const Image::Info info(5, 3, Image::Type::YUV_422P_U10);
+                DJV_ASSERT(2 == info.getPixelByteCount());
+                DJV_ASSERT(Image::Size(3, 3) == info.getPlaneSize(1));
+                DJV_ASSERT(6 == info.getPlaneScanlineByteCount(1));
+                DJV_ASSERT(30 + 18 + 18 == info.getDataByteCount());
+            }
+
+            {
+                const Image::Info info(5, 3, Image::Type::YUV_444P_U16);
+                DJV_ASSERT(info.size == info.getPlaneSize(2));
+                DJV_ASSERT(30 * 3 == info.getDataByteCount());
+            }
+
+            {
+                Image::Info info(5, 3, Image::Type::YUV_420P_U8);
+                Image::Info info2 = info;
+                info2.yuvRange = Image::YUVRange::Full;
+                DJV_ASSERT(info != info2);
+            }
+        }
+
         void InfoTest::_serialize()
         {
             {
@@ -0,0 +1,204 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvImageTest/StatsTest.h>
+
+#include <djvImage/Convert.h>
+#include <djvImage/Data.h>
+#include <djvImage/Stats.h>
+
+#include <djvCore/Memory.h>
+
+#include <cmath>
+#include <limits>
+
+using namespace djv::Core;
+using namespace djv::Image;
+
+namespace djv
+{
+    namespace ImageTest
+    {
+        StatsTest::StatsTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::ImageTest::StatsTest", tempPath, context)
+        {}
+
+        void StatsTest::run()
+        {
+            _types();
+            _float();
+            _layout();
+            _threads();
+        }
+
+        void StatsTest::_types()
+        {
+            {
+                const Image::Stats stats;
+                DJV_ASSERT(!stats.isValid());
+                DJV_ASSERT(0 == stats.getHistogramMax());
+                DJV_ASSERT(!Image::getStats(*Image::Data::create(Image::Info())).isValid());
+            }
+
+            // Compute the statistics of a black and a white pixel for every type.
+            auto convert = Image::Convert::create();
+            auto data = Image::Data::create(Image::Info(2, 1, Image::Type::RGBA_F32));
+            float* p = reinterpret_cast<float*>(data->getData());
+            for (size_t i = 0; i < 4; ++i)
+            {
+                p[i] = 3 == i ? 1.F : 0.F;
+                p[4 + i] = 1.F;
+            }
+            for (auto i : Image::getTypeEnums())
+            {
+                if (Image::Type::None == i || Image::isYUVType(i))
+                {
+                    continue;
+                }
+                const Image::Info info(2, 1, i);
+                auto data2 = Image::Data::create(info);
+                convert->process(*data, info, *data2);
+                const auto stats = Image::getStats(*data2, 16);
+                DJV_ASSERT(stats.isValid());
+                const uint8_t channelCount = Image::getChannelCount(i);
+                DJV_ASSERT(channelCount == stats.channelCount);
+                DJV_ASSERT(16 == stats.binCount);
+                for (uint8_t c = 0; c < channelCount; ++c)
+                {
+                    if ((2 == channelCount || 4 == channelCount) && channelCount - 1 == c)
+                    {
+                        DJV_ASSERT(2 == stats.histogram[c][15]);
+                        DJV_ASSERT(std::abs(stats.min[c] - 1.F) < .001F);
+                        DJV_ASSERT(std::abs(stats.mean[c] - 1.F) < .001F);
+                        DJV_ASSERT(std::abs(stats.stdDev[c]) < .001F);
+                    }
+                    else
+                    {
+                        DJV_ASSERT(1 == stats.histogram[c][0]);
+                        DJV_ASSERT(1 == stats.histogram[c][15]);
+                        DJV_ASSERT(std::abs(stats.min[c]) < .001F);
+                        DJV_ASSERT(std::abs(stats.mean[c] - .5F) < .001F);
+                        DJV_ASSERT(std::abs(stats.stdDev[c] - .5F) < .001F);
+                    }
+                    DJV_ASSERT(std::abs(stats.max[c] - 1.F) < .001F);
+                }
+                DJV_ASSERT(2 == stats.getHistogramMax() || 1 == stats.getHistogramMax());
+            }
+        }
+
+        void StatsTest::_float()
+        {
+            // Values outside of the range 0.0 - 1.0 are counted in the first
+            // and last bins, and values that are not finite are only counted
+            // in the histogram.
+            for (auto type : { Image::Type::L_F32, Image::Type::L_F16 })
+            {
+                const std::vector<float> values =
+                {
+                    -.5F,
+                    .25F,
+                    2.F,
+                    std::numeric_limits<float>::infinity(),
+                    std::numeric_limits<float>::quiet_NaN()
+                };
+                auto data = Image::Data::create(Image::Info(values.size(), 1, Image::Type::L_F32));
+                memcpy(data->getData(), values.data(), values.size() * sizeof(float));
+                const Image::Info info(values.size(), 1, type);
+                auto data2 = Image::Data::create(info);
+                if (Image::Type::L_F32 == type)
+                {
+                    data2 = data;
+                }
+                else
+                {
+                    F16_T* p = reinterpret_cast<F16_T*>(data2->getData());
+                    for (size_t i = 0; i < values.size(); ++i)
+                    {
+                        p[i] = values[i];
+                    }
+                }
+                const auto stats = Image::getStats(*data2, 4);
+                DJV_ASSERT(2 == stats.histogram[0][0]);
+                DJV_ASSERT(1 == stats.histogram[0][1]);
+                DJV_ASSERT(0 == stats.histogram[0][2]);
+                DJV_ASSERT(2 == stats.histogram[0][3]);
+                DJV_ASSERT(-.5F == stats.min[0]);
+                DJV_ASSERT(2.F == stats.max[0]);
+                DJV_ASSERT(std::abs(stats.mean[0] - .5833F) < .001F);
+            }
+        }
+
+        void StatsTest::_layout()
+        {
+            {
+                auto data = Image::Data::create(Image::Info(3, 1, Image::Type::L_U16));
+                uint16_t* p = reinterpret_cast<uint16_t*>(data->getData());
+                p[0] = 0;
+                p[1] = 65535;
+                p[2] = 65535;
+                const Image::Info info(
+                    3, 1, Image::Type::L_U16,
+                    Image::Layout(Image::Mirror(true, false), 4, Memory::opposite(Memory::getEndian())));
+                auto data2 = Image::Data::create(info);
+                Image::Convert::create()->process(*data, info, *data2);
+                DJV_ASSERT(Image::getStats(*data) == Image::getStats(*data2));
+            }
+
+            {
+                auto data = Image::Data::create(Image::Info(1, 1, Image::Type::RGB_U10));
+                auto& u10 = *reinterpret_cast<Image::U10_S*>(data->getData());
+                u10.r = 1023;
+                u10.g = 512;
+                u10.b = 0;
+                const auto stats = Image::getStats(*data, 2);
+                DJV_ASSERT(1 == stats.histogram[0][1]);
+                DJV_ASSERT(1 == stats.histogram[1][1]);
+                DJV_ASSERT(1 == stats.histogram[2][0]);
+            }
+
+            {
+                Image::Info info(4, 4, Image::Type::YUV_420P_U8);
+                info.yuvRange = Image::YUVRange::Full;
+                auto data = Image::Data::create(info);
+                memset(data->getPlaneData(0), 255, info.getPlaneByteCount(0));
+                memset(data->getPlaneData(1), 128, info.getPlaneByteCount(1));
+                memset(data->getPlaneData(2), 128, info.getPlaneByteCount(2));
+                const auto stats = Image::getStats(*data);
+                DJV_ASSERT(3 == stats.channelCount);
+                for (uint8_t c = 0; c < 3; ++c)
+                {
+                    DJV_ASSERT(16 == stats.histogram[c][255]);
+                }
+            }
+        }
+
+        void StatsTest::_threads()
+        {
+            for (auto type : { Image::Type::RGBA_U8, Image::Type::RGB_U16, Image::Type::RGBA_F32 })
+            {
+                auto data = Image::Data::create(Image::Info(512, 512, Image::Type::RGBA_U8));
+                for (size_t i = 0; i < data->getDataByteCount(); ++i)
+                {
+                    data->getData()[i] = static_cast<uint8_t>(i * 7);
+                }
+                const Image::Info info(512, 512, type);
+                auto data2 = Image::Data::create(info);
+                Image::Convert::create()->process(*data, info, *data2);
+                const auto stats = Image::getStats(*data2, 256, 1);
+                const auto stats2 = Image::getStats(*data2, 256, 4);
+                DJV_ASSERT(stats.histogram == stats2.histogram);
+                DJV_ASSERT(stats.min == stats2.min);
+                DJV_ASSERT(stats.max == stats2.max);
+                for (uint8_t c = 0; c < stats.channelCount; ++c)
+                {
+                    DJV_ASSERT(std::abs(stats.mean[c] - stats2.mean[c]) < .0001F);
+                    DJV_ASSERT(std::abs(stats.stdDev[c] - stats2.stdDev[c]) < .0001F);
+                }
+            }
+        }
+
+    } // namespace ImageTest
+} // namespace djv
@@ -188,6 +188,17 @@ namespace djv
                     }
                 }
             }
+
+            {
+                DJV_ASSERT(!Image::isYUVType(Image::Type::RGB_U8));
+                DJV_ASSERT(Image::isYUVType(Image::Type::YUV_420P_U8));
+                DJV_ASSERT(Image::Type::RGB_U8 == Image::getRGBType(Image::Type::RGB_U8));
+                DJV_ASSERT(Image::Type::RGB_U8 == Image::getRGBType(Image::Type::YUV_422P_U8));
+                DJV_ASSERT(Image::Type::RGB_U10 == Image::getRGBType(Image::Type::YUV_420P_U10));
+                DJV_ASSERT(Image::Type::RGB_U16 == Image::getRGBType(Image::Type::YUV_444P_U16));
+                DJV_ASSERT(Image::DataType::U10 == Image::getDataType(Image::Type::YUV_422P_U10));
+                DJV_ASSERT(Image::Channels::RGB == Image::getChannels(Image::Type::YUV_444P_U8));
+            }
         }
 
 #define CONVERT(A, RANGE, B) \
@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvOCIOTest/ImageConvertTest.h>
+
+#include <djvOCIO/ImageConvert.h>
+#include <djvOCIO/OCIO.h>
+#include <djvOCIO/OCIOSystem.h>
+
+#include <djvImage/Data.h>
+
+#include <djvSystem/Context.h>
+#include <djvSystem/ResourceSystem.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+using namespace djv::Core;
+using namespace djv::OCIO;
+
+namespace _OCIO = OCIO_NAMESPACE;
+
+namespace djv
+{
+    namespace OCIOTest
+    {
+        ImageConvertTest::ImageConvertTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::OCIOTest::ImageConvertTest", tempPath, context)
+        {}
+        
+        void ImageConvertTest::run()
+        {
+            if (auto context = getContext().lock())
+            {
+                auto resourceSystem = context->getSystemT<System::ResourceSystem>();
+                OCIO::Config config;
+                config.fileName = System::File::Path(
+                    resourceSystem->getPath(System::File::ResourcePath::Color),
+                    "nuke-default/config.ocio").get();
+                auto system = context->getSystemT<OCIO::OCIOSystem>();
+                system->setConfigMode(OCIO::ConfigMode::CmdLine);
+                system->setCmdLineConfig(config);
+            }
+
+            _types();
+            _convert();
+            _threads();
+        }
+
+        void ImageConvertTest::_types()
+        {
+            {
+                auto convert = OCIO::ImageConvert::create(2);
+                DJV_ASSERT(2 == convert->getThreadCount());
+            }
+
+            {
+                DJV_ASSERT(Image::Type::RGB_U8 == OCIO::ImageConvert::getProcessType(Image::Type::RGB_U8));
+                DJV_ASSERT(Image::Type::RGBA_F16 == OCIO::ImageConvert::getProcessType(Image::Type::RGBA_F16));
+                DJV_ASSERT(Image::Type::RGB_F32 == OCIO::ImageConvert::getProcessType(Image::Type::L_U8));
+                DJV_ASSERT(Image::Type::RGBA_F32 == OCIO::ImageConvert::getProcessType(Image::Type::LA_F16));
+                DJV_ASSERT(Image::Type::RGB_F32 == OCIO::ImageConvert::getProcessType(Image::Type::RGB_U10));
+                DJV_ASSERT(Image::Type::RGB_U8 == OCIO::ImageConvert::getProcessType(Image::Type::YUV_420P_U8));
+            }
+        }
+
+        void ImageConvertTest::_convert()
+        {
+            // Compare the LUT with the OpenColorIO processor.
+            const OCIO::Convert colorSpace("linear", "sRGB");
+            const std::vector<float> values = { 0.F, .001F, .018F, .18F, .5F, .75F, 1.F };
+            auto data = Image::Data::create(Image::Info(values.size(), 1, Image::Type::RGB_F32));
+            float* p = reinterpret_cast<float*>(data->getData());
+            for (size_t i = 0; i < values.size(); ++i)
+            {
+                p[i * 3 + 0] = values[i];
+                p[i * 3 + 1] = values[values.size() - 1 - i];
+                p[i * 3 + 2] = values[i] * .5F;
+            }
+            std::vector<float> expected(p, p + values.size() * 3);
+            auto processor = _OCIO::GetCurrentConfig()->getProcessor(colorSpace.input.c_str(), colorSpace.output.c_str());
+            _OCIO::PackedImageDesc imageDesc(expected.data(), static_cast<long>(values.size()), 1, 3);
+            processor->apply(imageDesc);
+
+            auto convert = OCIO::ImageConvert::create();
+            convert->process(*data, colorSpace);
+            for (size_t i = 0; i < expected.size(); ++i)
+            {
+                DJV_ASSERT(std::abs(p[i] - expected[i]) < .01F);
+            }
+
+            // Check the other data types and that the alpha channel is not
+            // modified.
+            for (auto type : { Image::Type::RGBA_U8, Image::Type::RGBA_U16, Image::Type::RGBA_F16 })
+            {
+                auto data2 = Image::Data::create(Image::Info(2, 1, type));
+                switch (type)
+                {
+                case Image::Type::RGBA_U8:
+                {
+                    uint8_t* p2 = data2->getData();
+                    const uint8_t v[] = { 0, 0, 0, 64, 255, 255, 255, 128 };
+                    memcpy(p2, v, sizeof(v));
+                    convert->process(*data2, colorSpace);
+                    DJV_ASSERT(std::abs(p2[0] / 255.F - expected[0]) < .01F);
+                    DJV_ASSERT(std::abs(p2[4] / 255.F - expected[18]) < .01F);
+                    DJV_ASSERT(64 == p2[3]);
+                    DJV_ASSERT(128 == p2[7]);
+                    break;
+                }
+                case Image::Type::RGBA_U16:
+                {
+                    uint16_t* p2 = reinterpret_cast<uint16_t*>(data2->getData());
+                    const uint16_t v[] = { 0, 0, 0, 64, 65535, 65535, 65535, 128 };
+                    memcpy(p2, v, sizeof(v));
+                    convert->process(*data2, colorSpace);
+                    DJV_ASSERT(std::abs(p2[0] / 65535.F - expected[0]) < .01F);
+                    DJV_ASSERT(std::abs(p2[4] / 65535.F - expected[18]) < .01F);
+                    DJV_ASSERT(64 == p2[3]);
+                    DJV_ASSERT(128 == p2[7]);
+                    break;
+                }
+                case Image::Type::RGBA_F16:
+                {
+                    Image::F16_T* p2 = reinterpret_cast<Image::F16_T*>(data2->getData());
+                    p2[0] = p2[1] = p2[2] = .18F;
+                    p2[3] = .5F;
+                    p2[4] = p2[5] = p2[6] = std::numeric_limits<float>::quiet_NaN();
+                    p2[7] = 1.F;
+                    convert->process(*data2, colorSpace);
+                    DJV_ASSERT(std::abs(p2[0] - expected[3 * 3]) < .01F);
+                    DJV_ASSERT(.5F == p2[3]);
+                    DJV_ASSERT(std::isfinite(static_cast<float>(p2[4])));
+                    DJV_ASSERT(1.F == p2[7]);
+                    break;
+                }
+                default: break;
+                }
+            }
+
+            // Invalid conversions and unsupported types are ignored.
+            {
+                auto data2 = Image::Data::create(Image::Info(1, 1, Image::Type::RGB_F32));
+                float* p2 = reinterpret_cast<float*>(data2->getData());
+                p2[0] = p2[1] = p2[2] = .5F;
+                convert->process(*data2, OCIO::Convert());
+                convert->process(*data2, OCIO::Convert("linear", "linear"));
+                DJV_ASSERT(.5F == p2[0]);
+                auto data3 = Image::Data::create(Image::Info(1, 1, Image::Type::L_F32));
+                *reinterpret_cast<float*>(data3->getData()) = .5F;
+                convert->process(*data3, colorSpace);
+                DJV_ASSERT(.5F == *reinterpret_cast<float*>(data3->getData()));
+            }
+        }
+
+        void ImageConvertTest::_threads()
+        {
+            const OCIO::Convert colorSpace("linear", "sRGB");
+            const Image::Info info(512, 512, Image::Type::RGBA_F32);
+            auto data = Image::Data::create(info);
+            auto data2 = Image::Data::create(info);
+            float* p = reinterpret_cast<float*>(data->getData());
+            for (size_t i = 0; i < 512 * 512 * 4; ++i)
+            {
+                p[i] = (i % 1021) / 512.F;
+            }
+            memcpy(data2->getData(), data->getData(), data->getDataByteCount());
+            OCIO::ImageConvert::create(1)->process(*data, colorSpace);
+            OCIO::ImageConvert::create(4)->process(*data2, colorSpace);
+            DJV_ASSERT(0 == memcmp(data->getData(), data2->getData(), data->getDataByteCount()));
+        }
+
+    } // namespace OCIOTest
+} // namespace djv
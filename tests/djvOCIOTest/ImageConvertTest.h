@@ -0,0 +1,27 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvTestLib/Test.h>
+
+namespace djv
+{
+    namespace OCIOTest
+    {
+        class ImageConvertTest : public Test::ITest
+        {
+        public:
+            ImageConvertTest(
+                const System::File::Path& tempPath,
+                const std::shared_ptr<System::Context>&);
+            
+            void run() override;
+
+        private:
+            void _types();
+            void _convert();
+            void _threads();
+        };
+        
+    } // namespace OCIOTest
+} // namespace djv
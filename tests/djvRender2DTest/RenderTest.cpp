@@ -133,6 +133,15 @@ namespace djv
                 }
                 render->setFillColor(Image::Color(.6F, 1.F, .4F));
                 render->drawFilledImage(image, glm::vec2(400.f, 500.f));
+                const size_t dynamicTextureCount = render->getDynamicTextureCount();
+                imageOptions.cache = ImageCache::Tile;
+                for (size_t i = 0; i < tileTextureCacheMax + 1; ++i)
+                {
+                    image = Image::Data::create(imageInfo);
+                    render->drawImage(image, glm::vec2(200.f, 300.f), imageOptions);
+                }
+                DJV_ASSERT(dynamicTextureCount == render->getDynamicTextureCount());
+                DJV_ASSERT(tileTextureCacheMax == render->getTileTextureCount());
                 
                 Font::FontInfo fontInfo(1, 1, 64, dpiDefault);
                 auto fontSystem = context->getSystemT<Font::FontSystem>();
@@ -168,6 +177,11 @@ namespace djv
                     ss << "Dynamic texture count: " << render->getDynamicTextureCount();
                     _print(ss.str());
                 }
+                {
+                    std::stringstream ss;
+                    ss << "Tile texture count: " << render->getTileTextureCount();
+                    _print(ss.str());
+                }
                 {
                     std::stringstream ss;
                     ss << "VBO size: " << render->getVBOSize();
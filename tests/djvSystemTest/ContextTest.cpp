@@ -10,6 +10,7 @@
 #include <djvCore/String.h>
 
 #include <sstream>
+#include <thread>
 
 using namespace djv::Core;
 using namespace djv::System;
@@ -94,6 +95,20 @@ namespace djv
                     ss << "fps averge: " << context->getFPSAverage();
                     _print(ss.str());
                 }
+
+                // Clear any wake up left from the ticks above.
+                context->wait(std::chrono::steady_clock::now());
+                DJV_ASSERT(!context->wait(std::chrono::steady_clock::now() + std::chrono::milliseconds(10)));
+                context->wake();
+                DJV_ASSERT(context->wait(std::chrono::steady_clock::now() + std::chrono::seconds(10)));
+                std::thread thread(
+                    [context]
+                    {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                        context->wake();
+                    });
+                DJV_ASSERT(context->wait(Time::TimePoint::max()));
+                thread.join();
             }
         }
         
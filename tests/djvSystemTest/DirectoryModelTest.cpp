@@ -7,6 +7,9 @@
 #include <djvSystem/DirectoryModel.h>
 #include <djvSystem/FileIO.h>
 
+#include <algorithm>
+#include <cstdio>
+
 using namespace djv::Core;
 using namespace djv::System;
 
@@ -157,6 +160,32 @@ namespace djv
                 io->close();
 
                 _tickFor(std::chrono::milliseconds(1000));
+
+                // Add files to the directory while it is being watched.
+                File::DirectoryListOptions optionsB;
+                optionsB.sequences = true;
+                optionsB.sequenceExtensions.insert(".exr");
+                model->setOptions(optionsB);
+                _tickFor(std::chrono::milliseconds(1000));
+                for (const auto& i : { "render.0001.exr", "render.0002.exr" })
+                {
+                    io->open(File::Path(path, i).get(), File::Mode::Write);
+                    io->close();
+                }
+                _tickFor(std::chrono::milliseconds(2000));
+                auto j = std::find(fileNames.begin(), fileNames.end(), "render.0001-0002.exr");
+                DJV_ASSERT(j != fileNames.end());
+                const File::Info& sequenceInfo = info[j - fileNames.begin()];
+                DJV_ASSERT(File::Type::Sequence == sequenceInfo.getType());
+
+                io->open(File::Path(path, "render.0003.exr").get(), File::Mode::Write);
+                io->close();
+                _tickFor(std::chrono::milliseconds(2000));
+                DJV_ASSERT(std::find(fileNames.begin(), fileNames.end(), "render.0001-0003.exr") != fileNames.end());
+
+                std::remove(File::Path(path, "render.0002.exr").get().c_str());
+                _tickFor(std::chrono::milliseconds(2000));
+                DJV_ASSERT(std::find(fileNames.begin(), fileNames.end(), "render.0001,0003.exr") != fileNames.end());
             }
         }
         
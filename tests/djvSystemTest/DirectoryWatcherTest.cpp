@@ -41,6 +41,12 @@ namespace djv
                     {
                         changed = true;
                     });
+                std::vector<File::DirectoryWatcherEvent> events;
+                watcher->setEventsCallback(
+                    [&events](const std::vector<File::DirectoryWatcherEvent>& value)
+                    {
+                        events.insert(events.end(), value.begin(), value.end());
+                    });
                 
                 _tickFor(std::chrono::milliseconds(1000));
                 
@@ -56,9 +62,21 @@ namespace djv
                 
                 _tickFor(std::chrono::milliseconds(1000));
                 
-                std::stringstream ss;
-                ss << "changed: " << changed;
-                _print(ss.str());
+                {
+                    std::stringstream ss;
+                    ss << "changed: " << changed;
+                    _print(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << "events: " << events.size();
+                    _print(ss.str());
+                }
+                for (const auto& i : events)
+                {
+                    // The file names are not available on all platforms.
+                    DJV_ASSERT(i.fileName.empty() || 0 == i.fileName.find("file"));
+                }
             }
         }
         
@@ -293,7 +293,97 @@ namespace djv
                 options.extensions.insert(".exr");
                 File::directoryList(File::Path(getTempPath()), options);
             }
-            
+
+            {
+                const File::Path path(getTempPath(), "directoryList");
+                File::mkdir(path);
+                auto io = File::IO::create();
+                for (const auto& i : { "pad.0999.exr", "pad.1000.exr", "pad.1001.exr", "pad.5.exr", "file.exr" })
+                {
+                    io->open(File::Path(path, i).get(), File::Mode::Write);
+                }
+                io->close();
+                File::DirectoryListOptions options;
+                options.sequences = true;
+                options.sequenceExtensions.insert(".exr");
+                const auto list = File::directoryList(path, options);
+                DJV_ASSERT(3 == list.size());
+                DJV_ASSERT("file.exr" == list[0].getFileName(Math::Frame::invalid, false));
+                DJV_ASSERT("pad.0999-1001.exr" == list[1].getFileName(Math::Frame::invalid, false));
+                DJV_ASSERT(File::Type::Sequence == list[1].getType());
+                DJV_ASSERT("pad.5.exr" == list[2].getFileName(Math::Frame::invalid, false));
+                DJV_ASSERT(File::Type::File == list[2].getType());
+                options.sequences = false;
+                DJV_ASSERT(5 == File::directoryList(path, options).size());
+            }
+
+            {
+                // Negative frame numbers are not part of a sequence.
+                const File::Path path(getTempPath(), "directoryListNegative");
+                File::mkdir(path);
+                auto io = File::IO::create();
+                for (const auto& i : { "neg-1.exr", "neg-2.exr", "neg-3.exr" })
+                {
+                    io->open(File::Path(path, i).get(), File::Mode::Write);
+                }
+                io->close();
+                File::DirectoryListOptions options;
+                options.sequences = true;
+                options.sequenceExtensions.insert(".exr");
+                const auto list = File::directoryList(path, options);
+                DJV_ASSERT(3 == list.size());
+                for (const auto& i : list)
+                {
+                    DJV_ASSERT(File::Type::File == i.getType());
+                }
+                DJV_ASSERT("neg-1.exr" == list[0].getFileName(Math::Frame::invalid, false));
+            }
+
+            {
+                const File::Path path(getTempPath(), "directoryListExtensions");
+                File::mkdir(path);
+                auto io = File::IO::create();
+                for (const auto& i : { "SHOT.0001.DPX", "IMG_1234.JPG", "file.jpg", "file.txt" })
+                {
+                    io->open(File::Path(path, i).get(), File::Mode::Write);
+                }
+                io->close();
+                File::DirectoryListOptions options;
+                options.extensions.insert(".dpx");
+                options.extensions.insert(".jpg");
+                const auto list = File::directoryList(path, options);
+                DJV_ASSERT(3 == list.size());
+                for (const auto& i : list)
+                {
+                    DJV_ASSERT(i.getFileName(Math::Frame::invalid, false) != "file.txt");
+                }
+            }
+
+            {
+                File::DirectoryListOptions options;
+                options.sequences = true;
+                options.sequenceExtensions.insert(".exr");
+                const auto list = File::directoryList(File::Path(getTempPath()), options);
+                options.sequenceStat = File::SequenceStat::FirstLast;
+                const auto list2 = File::directoryList(File::Path(getTempPath()), options);
+                DJV_ASSERT(list.size() == list2.size());
+                for (size_t i = 0; i < list.size(); ++i)
+                {
+                    DJV_ASSERT(list[i].getSize() == list2[i].getSize());
+                }
+            }
+
+            {
+                std::vector<File::Info> list;
+                list.push_back(File::Info(File::Path(getTempPath(), _fileName), false));
+                list.push_back(File::Info(File::Path(getTempPath(), _sequenceName), File::Type::Sequence, _sequence, false));
+                list.push_back(File::Info(File::Path(getTempPath(), "missing.txt"), false));
+                File::stat(list);
+                DJV_ASSERT(list[0].doesExist());
+                DJV_ASSERT(list[1].doesExist());
+                DJV_ASSERT(!list[2].doesExist());
+            }
+
             {
                 const File::Info info = File::getSequence(
                     File::Path(getTempPath(), "render.1.exr"),
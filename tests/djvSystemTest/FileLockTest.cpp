@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvSystemTest/FileLockTest.h>
+
+#include <djvSystem/File.h>
+#include <djvSystem/FileInfo.h>
+#include <djvSystem/FileLock.h>
+#include <djvSystem/Path.h>
+
+#include <djvCore/Error.h>
+
+using namespace djv::Core;
+using namespace djv::System;
+
+namespace djv
+{
+    namespace SystemTest
+    {
+        FileLockTest::FileLockTest(
+            const File::Path& tempPath,
+            const std::shared_ptr<Context>& context) :
+            ITest(
+                "djv::SystemTest::FileLockTest",
+                File::Path(tempPath, "FileLockTest"),
+                context)
+        {}
+        
+        void FileLockTest::run()
+        {
+            const std::string fileName = File::Path(getTempPath(), "FileLockTest.lock").get();
+            {
+                auto lock = File::Lock::create(fileName);
+                DJV_ASSERT(fileName == lock->getFileName());
+                DJV_ASSERT(File::Info(fileName).doesExist());
+                DJV_ASSERT(!lock->isLocked());
+                DJV_ASSERT(lock->tryLock());
+                DJV_ASSERT(lock->isLocked());
+                DJV_ASSERT(lock->tryLock());
+
+                // The lock is held so it can't be taken again.
+                auto lock2 = File::Lock::create(fileName);
+                DJV_ASSERT(!lock2->tryLock());
+                DJV_ASSERT(!lock2->isLocked());
+
+                lock->unlock();
+                DJV_ASSERT(!lock->isLocked());
+                DJV_ASSERT(lock2->tryLock());
+                DJV_ASSERT(!lock->tryLock());
+            }
+            {
+                // The lock is released when the object is destroyed.
+                auto lock = File::Lock::create(fileName);
+                {
+                    auto lock2 = File::Lock::create(fileName);
+                    DJV_ASSERT(lock2->tryLock());
+                }
+                DJV_ASSERT(lock->tryLock());
+            }
+            
+            try
+            {
+                File::Lock::create(File::Path(getTempPath(), "FileLockTest/FileLockTest.lock").get());
+                DJV_ASSERT(false);
+            }
+            catch (const std::exception& e)
+            {
+                _print(Error::format(e.what()));
+            }
+        }
+        
+    } // namespace SystemTest
+} // namespace djv
+
@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvSystemTest/ParallelTest.h>
+
+#include <djvSystem/Parallel.h>
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace djv::Core;
+using namespace djv::System;
+
+namespace djv
+{
+    namespace SystemTest
+    {
+        ParallelTest::ParallelTest(
+            const File::Path& tempPath,
+            const std::shared_ptr<Context>& context) :
+            ITest("djv::SystemTest::ParallelTest", tempPath, context)
+        {}
+        
+        void ParallelTest::run()
+        {
+            DJV_ASSERT(getHardwareThreadCount() > 0);
+
+            for (size_t threadCount : { 0, 1, 4, 16 })
+            {
+                std::vector<int> values(1000, 0);
+                std::atomic<bool> threadValid(true);
+                parallelFor(
+                    values.size(),
+                    16,
+                    threadCount,
+                    [&values, &threadValid, threadCount](size_t thread, size_t begin, size_t end)
+                    {
+                        if (thread >= std::max(threadCount, static_cast<size_t>(1)))
+                        {
+                            threadValid = false;
+                        }
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            ++values[i];
+                        }
+                    });
+                DJV_ASSERT(threadValid);
+                for (auto i : values)
+                {
+                    DJV_ASSERT(1 == i);
+                }
+            }
+
+            {
+                // Nested loops are run by the calling threads.
+                std::atomic<size_t> count(0);
+                parallelFor(
+                    16,
+                    1,
+                    4,
+                    [&count](size_t, size_t, size_t)
+                    {
+                        parallelFor(
+                            100,
+                            10,
+                            4,
+                            [&count](size_t, size_t begin, size_t end)
+                            {
+                                count += end - begin;
+                            });
+                    });
+                DJV_ASSERT(1600 == count);
+            }
+
+            {
+                parallelFor(0, 1, 4, [](size_t, size_t, size_t) {});
+            }
+
+            {
+                std::atomic<size_t> count(0);
+                bool error = false;
+                try
+                {
+                    parallelFor(
+                        100,
+                        1,
+                        4,
+                        [&count](size_t, size_t begin, size_t)
+                        {
+                            ++count;
+                            if (50 == begin)
+                            {
+                                throw std::runtime_error("error");
+                            }
+                        });
+                }
+                catch (const std::exception&)
+                {
+                    error = true;
+                }
+                DJV_ASSERT(error);
+                DJV_ASSERT(100 == count);
+            }
+        }
+        
+    } // namespace SystemTest
+} // namespace djv
+
@@ -46,8 +46,12 @@ namespace djv
                         _print(ss.str());
                     });
                 DJV_ASSERT(timer->isActive());
+                const auto nextTick = context->getSystemT<TimerSystem>()->getNextTick();
+                DJV_ASSERT(nextTick <= std::chrono::steady_clock::now() + std::chrono::milliseconds(250));
                 
                 _tickFor(std::chrono::milliseconds(500));
+                DJV_ASSERT(!timer->isActive());
+                DJV_ASSERT(context->getSystemT<TimerSystem>()->getNextTick() > nextTick);
             }
 
             if (auto context = getContext().lock())
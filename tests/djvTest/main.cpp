@@ -36,18 +36,23 @@
 #include <djvSystemTest/FileTest.h>
 #include <djvSystemTest/FileIOTest.h>
 #include <djvSystemTest/FileInfoTest.h>
+#include <djvSystemTest/FileLockTest.h>
 #include <djvSystemTest/IEventSystemTest.h>
 #include <djvSystemTest/ISystemTest.h>
 #include <djvSystemTest/LogSystemTest.h>
 #include <djvSystemTest/ObjectTest.h>
+#include <djvSystemTest/ParallelTest.h>
 #include <djvSystemTest/PathTest.h>
 #include <djvSystemTest/RecentFilesModelTest.h>
 #include <djvSystemTest/TextSystemTest.h>
 #include <djvSystemTest/TimerTest.h>
 
 #include <djvImageTest/ColorTest.h>
+#include <djvImageTest/ConvertTest.h>
+#include <djvImageTest/DataPoolTest.h>
 #include <djvImageTest/DataTest.h>
 #include <djvImageTest/InfoTest.h>
+#include <djvImageTest/StatsTest.h>
 #include <djvImageTest/TagsTest.h>
 #include <djvImageTest/TypeTest.h>
 
@@ -68,6 +73,7 @@
 #include <djvGLTest/TextureTest.h>
 #include <djvGLTest/TextureAtlasTest.h>
 
+#include <djvOCIOTest/ImageConvertTest.h>
 #include <djvOCIOTest/OCIOSystemTest.h>
 #include <djvOCIOTest/OCIOTest.h>
 
@@ -85,10 +91,14 @@
 #include <djvAVTest/AVSystemTest.h>
 #include <djvAVTest/CineonTest.h>
 #include <djvAVTest/DPXTest.h>
+#include <djvAVTest/FrameCacheTest.h>
 #include <djvAVTest/IOTest.h>
 #include <djvAVTest/PPMTest.h>
 #include <djvAVTest/SpeedTest.h>
+#include <djvAVTest/ThreadPoolTest.h>
+#include <djvAVTest/ThumbnailCacheTest.h>
 #include <djvAVTest/ThumbnailSystemTest.h>
+#include <djvAVTest/TileCacheTest.h>
 #include <djvAVTest/TimeTest.h>
 #if defined(FFmpeg_FOUND)
 #include <djvAVTest/FFmpegTest.h>
@@ -180,18 +190,23 @@ int main(int argc, char ** argv)
         tests.emplace_back(new SystemTest::FileTest(tempPath, context));
         tests.emplace_back(new SystemTest::FileIOTest(tempPath, context));
         tests.emplace_back(new SystemTest::FileInfoTest(tempPath, context));
+        tests.emplace_back(new SystemTest::FileLockTest(tempPath, context));
         tests.emplace_back(new SystemTest::IEventSystemTest(tempPath, context));
         tests.emplace_back(new SystemTest::ISystemTest(tempPath, context));
         tests.emplace_back(new SystemTest::LogSystemTest(tempPath, context));
         tests.emplace_back(new SystemTest::ObjectTest(tempPath, context));
+        tests.emplace_back(new SystemTest::ParallelTest(tempPath, context));
         tests.emplace_back(new SystemTest::PathTest(tempPath, context));
         tests.emplace_back(new SystemTest::RecentFilesModelTest(tempPath, context));
         tests.emplace_back(new SystemTest::TextSystemTest(tempPath, context));
         tests.emplace_back(new SystemTest::TimerTest(tempPath, context));
 
         tests.emplace_back(new ImageTest::ColorTest(tempPath, context));
+        tests.emplace_back(new ImageTest::ConvertTest(tempPath, context));
+        tests.emplace_back(new ImageTest::DataPoolTest(tempPath, context));
         tests.emplace_back(new ImageTest::DataTest(tempPath, context));
         tests.emplace_back(new ImageTest::InfoTest(tempPath, context));
+        tests.emplace_back(new ImageTest::StatsTest(tempPath, context));
         tests.emplace_back(new ImageTest::TypeTest(tempPath, context));
         tests.emplace_back(new ImageTest::TagsTest(tempPath, context));
 
@@ -212,6 +227,7 @@ int main(int argc, char ** argv)
         tests.emplace_back(new GLTest::TextureAtlasTest(tempPath, context));
         tests.emplace_back(new GLTest::TextureTest(tempPath, context));
 
+        tests.emplace_back(new OCIOTest::ImageConvertTest(tempPath, context));
         tests.emplace_back(new OCIOTest::OCIOSystemTest(tempPath, context));
         tests.emplace_back(new OCIOTest::OCIOTest(tempPath, context));
 
@@ -229,10 +245,14 @@ int main(int argc, char ** argv)
         tests.emplace_back(new AVTest::AVSystemTest(tempPath, context));
         tests.emplace_back(new AVTest::CineonTest(tempPath, context));
         tests.emplace_back(new AVTest::DPXTest(tempPath, context));
+        tests.emplace_back(new AVTest::FrameCacheTest(tempPath, context));
         tests.emplace_back(new AVTest::IOTest(tempPath, context));
         tests.emplace_back(new AVTest::PPMTest(tempPath, context));
         tests.emplace_back(new AVTest::SpeedTest(tempPath, context));
+        tests.emplace_back(new AVTest::ThreadPoolTest(tempPath, context));
+        tests.emplace_back(new AVTest::ThumbnailCacheTest(tempPath, context));
         tests.emplace_back(new AVTest::ThumbnailSystemTest(tempPath, context));
+        tests.emplace_back(new AVTest::TileCacheTest(tempPath, context));
         tests.emplace_back(new AVTest::TimeTest(tempPath, context));
 #if defined(FFmpeg_FOUND)
         tests.emplace_back(new AVTest::FFmpegTest(tempPath, context));